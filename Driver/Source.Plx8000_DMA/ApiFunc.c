@@ -55,6 +55,8 @@
 #include "PciRegs.h"
 #include "PlxChipFn.h"
 #include "PlxInterrupt.h"
+#include "PlxLatency.h"
+#include "PlxStats.h"
 #include "SuppFunc.h"
 
 
@@ -1159,6 +1161,292 @@ PlxPciPhysicalMemoryUnmap(
 
 
 
+/*******************************************************************************
+ *
+ * Function   :  PlxPciScatterMemoryAllocate
+ *
+ * Description:  Allocate a page-locked buffer from multiple physically contiguous
+ *               chunks & an SGL buffer for the chunk descriptors
+ *
+ * Note       :  If a chunk cannot be allocated, the chunk size is halved for the
+ *               remainder of the buffer rather than reducing the total size.
+ *
+ ******************************************************************************/
+PLX_STATUS
+PlxPciScatterMemoryAllocate(
+    DEVICE_EXTENSION *pdx,
+    PLX_SCATTER_MEM  *pScatterMem,
+    VOID             *pOwner
+    )
+{
+    U32                     ChunkSize;
+    U64                     BytesRemaining;
+    PLX_PHYS_MEM_OBJECT    *pChunk;
+    PLX_SCATTER_MEM_OBJECT *pScatter;
+
+
+    // Buffer is always a whole number of pages
+    BytesRemaining =
+        (pScatterMem->Size + (PAGE_SIZE - 1)) & ~((U64)PAGE_SIZE - 1);
+
+    // Initialize buffer information
+    pScatterMem->UserAddr  = 0;
+    pScatterMem->SglAddr   = 0;
+    pScatterMem->Tag       = 0;
+    pScatterMem->NumChunks = 0;
+
+    if (BytesRemaining == 0)
+    {
+        return PLX_STATUS_INVALID_SIZE;
+    }
+
+    // Limit size, since chunks are pinned kernel memory
+    if (pScatterMem->Size > MAX_SCATTER_BUFFER_SIZE)
+    {
+        DebugPrintf((
+            "ERROR - Scatter buffer size exceeds max (%lldMB)\n",
+            (MAX_SCATTER_BUFFER_SIZE >> 20)
+            ));
+        return PLX_STATUS_INVALID_SIZE;
+    }
+
+    // Determine initial chunk size
+    ChunkSize = pScatterMem->ChunkSize;
+    if (ChunkSize == 0)
+    {
+        ChunkSize = DEFAULT_SCATTER_CHUNK_SIZE;
+    }
+    else if (ChunkSize > MAX_SCATTER_CHUNK_SIZE)
+    {
+        ChunkSize = MAX_SCATTER_CHUNK_SIZE;
+    }
+    ChunkSize = PAGE_ALIGN( ChunkSize );
+
+    // Allocate memory for new list object
+    pScatter =
+        kmalloc(
+            sizeof(PLX_SCATTER_MEM_OBJECT),
+            GFP_KERNEL
+            );
+    if (pScatter == NULL)
+    {
+        DebugPrintf(("ERROR - Memory allocation for list object failed\n"));
+        return PLX_STATUS_INSUFFICIENT_RES;
+    }
+
+    // Clear object
+    RtlZeroMemory( pScatter, sizeof(PLX_SCATTER_MEM_OBJECT) );
+
+    INIT_LIST_HEAD( &(pScatter->List_Chunks) );
+    atomic_set( &(pScatter->RefCount), 1 );
+    pScatter->pOwner     = pOwner;
+    pScatter->Size       = BytesRemaining;
+    pScatter->SglChannel = -1;
+
+    DebugPrintf((
+        "Attempt to allocate scatter buffer (%lldKB) in %dKB chunks\n",
+        (BytesRemaining >> 10), (ChunkSize >> 10)
+        ));
+
+    // Allocate chunks until entire buffer is satisfied
+    while (BytesRemaining != 0)
+    {
+        pChunk =
+            kmalloc(
+                sizeof(PLX_PHYS_MEM_OBJECT),
+                GFP_KERNEL
+                );
+        if (pChunk == NULL)
+        {
+            break;
+        }
+
+        do
+        {
+            RtlZeroMemory( pChunk, sizeof(PLX_PHYS_MEM_OBJECT) );
+
+            // Final chunk may be smaller
+            if (BytesRemaining < ChunkSize)
+            {
+                pChunk->Size = (U32)BytesRemaining;
+            }
+            else
+            {
+                pChunk->Size = ChunkSize;
+            }
+
+            // Attempt to allocate the chunk
+            if (Plx_dma_buffer_alloc( pdx, pChunk ) == NULL)
+            {
+                if (ChunkSize == PAGE_SIZE)
+                {
+                    break;
+                }
+
+                // Memory is likely fragmented, so use smaller chunks
+                ChunkSize = PAGE_ALIGN( ChunkSize >> 1 );
+
+                DebugPrintf((
+                    "Chunk allocation failed, reduce chunk size to %dKB\n",
+                    (ChunkSize >> 10)
+                    ));
+            }
+        }
+        while (pChunk->pKernelVa == NULL);
+
+        if (pChunk->pKernelVa == NULL)
+        {
+            kfree( pChunk );
+            break;
+        }
+
+        pChunk->pOwner = pOwner;
+
+        // Add chunk to buffer
+        list_add_tail(
+            &(pChunk->ListEntry),
+            &(pScatter->List_Chunks)
+            );
+
+        pScatter->NumChunks++;
+
+        if (pChunk->Size > pScatter->ChunkSize)
+        {
+            pScatter->ChunkSize = pChunk->Size;
+        }
+
+        BytesRemaining -= pChunk->Size;
+    }
+
+    // Allocate buffer for one SGL descriptor per chunk
+    if (BytesRemaining == 0)
+    {
+        pScatter->Sgl.Size = pScatter->NumChunks * (4 * sizeof(U32));
+
+        Plx_dma_buffer_alloc(
+            pdx,
+            &(pScatter->Sgl)
+            );
+    }
+
+    if (pScatter->Sgl.pKernelVa == NULL)
+    {
+        ErrorPrintf(("ERROR - Scatter buffer allocation failed\n"));
+        PlxScatterMemoryRelease( pdx, pScatter );
+        return PLX_STATUS_INSUFFICIENT_RES;
+    }
+
+    DebugPrintf((
+        "Allocated scatter buffer (%lldKB) in %d chunks (SGL=%08llx)\n",
+        (pScatter->Size >> 10), pScatter->NumChunks, pScatter->Sgl.BusPhysical
+        ));
+
+    // Return buffer information
+    pScatterMem->Size      = pScatter->Size;
+    pScatterMem->ChunkSize = pScatter->ChunkSize;
+    pScatterMem->NumChunks = pScatter->NumChunks;
+    pScatterMem->SglAddr   = pScatter->Sgl.BusPhysical;
+    pScatterMem->Tag       = pScatter->Sgl.CpuPhysical;
+
+    // Add buffer object to list
+    spin_lock(
+        &(pdx->Lock_PhysicalMemList)
+        );
+
+    list_add_tail(
+        &(pScatter->ListEntry),
+        &(pdx->List_ScatterMem)
+        );
+
+    spin_unlock(
+        &(pdx->Lock_PhysicalMemList)
+        );
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxPciScatterMemoryFree
+ *
+ * Description:  Free a previously allocated scatter buffer
+ *
+ * Note       :  The buffer is not freed while a DMA channel may still be
+ *               walking its SGL, since the device would write freed memory.
+ *
+ ******************************************************************************/
+PLX_STATUS
+PlxPciScatterMemoryFree(
+    DEVICE_EXTENSION *pdx,
+    PLX_SCATTER_MEM  *pScatterMem,
+    VOID             *pOwner
+    )
+{
+    PLX_STATUS              status;
+    PLX_SCATTER_MEM_OBJECT *pScatter;
+
+
+    spin_lock( &(pdx->Lock_PhysicalMemList) );
+
+    pScatter =
+        PlxScatterMemoryFind(
+            pdx,
+            pScatterMem->Tag
+            );
+
+    if (pScatter == NULL)
+    {
+        spin_unlock( &(pdx->Lock_PhysicalMemList) );
+        DebugPrintf(("ERROR - Scatter buffer object not found in list\n"));
+        return PLX_STATUS_INVALID_DATA;
+    }
+
+    // Only the process that allocated the buffer may free it
+    if (pScatter->pOwner != pOwner)
+    {
+        spin_unlock( &(pdx->Lock_PhysicalMemList) );
+        DebugPrintf(("ERROR - Scatter buffer owned by different process\n"));
+        return PLX_STATUS_IN_USE;
+    }
+
+    // Transfers start under the list lock, so SGL channel is current
+    if (pScatter->SglChannel >= 0)
+    {
+        status =
+            PlxDmaChannelIdle(
+                pdx,
+                pScatter->SglChannel,
+                NULL
+                );
+
+        if (status != PLX_STATUS_COMPLETE)
+        {
+            spin_unlock( &(pdx->Lock_PhysicalMemList) );
+            DebugPrintf((
+                "ERROR - Scatter buffer SGL in use by channel %d\n",
+                pScatter->SglChannel
+                ));
+            return PLX_STATUS_IN_PROGRESS;
+        }
+    }
+
+    // Remove the object from the list
+    list_del( &(pScatter->ListEntry) );
+
+    spin_unlock( &(pdx->Lock_PhysicalMemList) );
+
+    // Drop the list reference, buffer released after any map in progress
+    PlxScatterMemoryPut( pdx, pScatter );
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
 /*******************************************************************************
  *
  * Function   :  PlxInterruptEnable
@@ -1511,6 +1799,7 @@ PlxNotificationWait(
             {
                 // Timeout reached
                 DebugPrintf(("Timeout waiting for interrupt\n"));
+                PLX_STAT_INC( pdx, NotifyTimeouts );
                 rc = PLX_STATUS_TIMEOUT;
             }
             else
@@ -1883,6 +2172,9 @@ PlxDmaChannelOpen(
     // No SGL DMA is pending
     pdx->DmaInfo[channel].bSglPending = FALSE;
 
+    // SGL descriptor location is set on first SGL transfer
+    pdx->DmaInfo[channel].bDescrExternal = FALSE;
+
     spin_unlock(
         &(pdx->Lock_Dma[channel])
         );
@@ -2335,48 +2627,21 @@ PlxDmaStatus(
     VOID             *pOwner
     )
 {
-    U16 OffsetDmaBase;
-    U32 RegValue;
+    U32        RegValue;
+    PLX_STATUS status;
 
 
-    // Verify valid DMA channel
-    switch (channel)
-    {
-        case 0:
-        case 1:
-        case 2:
-        case 3:
-            if (channel >= pdx->NumDmaChannels)
-            {
-                DebugPrintf((
-                    "Error - Channel %d exceeds max supported (%d)\n",
-                    channel, (pdx->NumDmaChannels - 1)
-                    ));
-                return PLX_STATUS_INVALID_ACCESS;
-            }
-            break;
-
-        default:
-            DebugPrintf(("ERROR - Invalid DMA channel\n"));
-            return PLX_STATUS_INVALID_ACCESS;
-    }
+    // Verify channel & owner
+    status =
+        PlxDmaChannelVerify(
+            pdx,
+            channel,
+            pOwner
+            );
 
-    // Verify ownership if requested
-    if (pOwner != NULL)
+    if (status != PLX_STATUS_OK)
     {
-        // Verify DMA has been opened
-        if (pdx->DmaInfo[channel].bOpen == FALSE)
-        {
-            DebugPrintf(("ERROR - DMA channel has not been opened\n"));
-            return PLX_STATUS_INVALID_ACCESS;
-        }
-
-        // Verify owner
-        if (pdx->DmaInfo[channel].pOwner != pOwner)
-        {
-            DebugPrintf(("ERROR - DMA owned by different process\n"));
-            return PLX_STATUS_IN_USE;
-        }
+        return status;
     }
 
     // Verify channel is enabled in hardware
@@ -2417,27 +2682,12 @@ PlxDmaStatus(
         }
     }
 
-    // Set the channel's base register offset (200h, 300h, etc)
-    OffsetDmaBase = 0x200 + (channel * 0x100);
-
     // Get DMA status
-    RegValue = PLX_DMA_REG_READ( pdx, OffsetDmaBase + 0x38 );
-
-    // Check if DMA is in progress
-    if (RegValue & (1 << 30))
-    {
-        // Check if DMA is paused
-        if (RegValue & (1 << 0))
-        {
-            DebugPrintf(("DMA is paused\n"));
-            return PLX_STATUS_PAUSED;
-        }
-
-        DebugPrintf(("DMA is in-progress\n"));
-        return PLX_STATUS_IN_PROGRESS;
-    }
-
-    return PLX_STATUS_COMPLETE;
+    return PlxDmaChannelIdle(
+        pdx,
+        channel,
+        NULL
+        );
 }
 
 
@@ -2460,20 +2710,23 @@ PlxDmaTransferBlock(
 {
     U16        OffsetDmaBase;
     U32        RegValue;
+    U32        RegCount;
+    U64        TimeStart;
     PLX_STATUS status;
 
 
-    // Verify DMA channel is available
+    TimeStart = PlxLatencyTimestamp();
+
+    // Verify channel & owner (hardware enable was verified at open)
     status =
-        PlxDmaStatus(
+        PlxDmaChannelVerify(
             pdx,
             channel,
             pOwner
             );
 
-    if (status != PLX_STATUS_COMPLETE)
+    if (status != PLX_STATUS_OK)
     {
-        DebugPrintf(("ERROR - DMA unavailable or in-progress\n"));
         return status;
     }
 
@@ -2491,6 +2744,29 @@ PlxDmaTransferBlock(
         &(pdx->Lock_Dma[channel])
         );
 
+    // Verify an SGL DMA transfer has not claimed the channel
+    if (pdx->DmaInfo[channel].bSglPending)
+    {
+        spin_unlock( &(pdx->Lock_Dma[channel]) );
+        DebugPrintf(("ERROR - An SGL DMA transfer is currently pending\n"));
+        return PLX_STATUS_IN_PROGRESS;
+    }
+
+    // Verify DMA is idle & get control/status for use below
+    status =
+        PlxDmaChannelIdle(
+            pdx,
+            channel,
+            &RegValue
+            );
+
+    if (status != PLX_STATUS_COMPLETE)
+    {
+        spin_unlock( &(pdx->Lock_Dma[channel]) );
+        DebugPrintf(("ERROR - DMA unavailable or in-progress\n"));
+        return status;
+    }
+
     // Write Source Address
     PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x0, PLX_64_LOW_32(pParams->AddrSource) );
     PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x4, PLX_64_HIGH_32(pParams->AddrSource) );
@@ -2500,19 +2776,16 @@ PlxDmaTransferBlock(
     PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0xC, PLX_64_HIGH_32(pParams->AddrDest) );
 
     // Set Transfer Count & address & interrupt options
-    RegValue =
+    RegCount =
         (1                       << 31) |   // Valid bit
         (pParams->bConstAddrSrc  << 29) |   // Keep source address constant
         (pParams->bConstAddrDest << 28) |   // Keep destination address constant
         (pParams->ByteCount      <<  0);    // Byte count
     if (pParams->bIgnoreBlockInt == 0)
     {
-        RegValue |= (1 << 30);
+        RegCount |= (1 << 30);
     }
-    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x10, RegValue );
-
-    // Get DMA control/status
-    RegValue = PLX_DMA_REG_READ( pdx, OffsetDmaBase + 0x38 );
+    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x10, RegCount );
 
     // Set DMA to block mode
     if (pdx->Key.PlxFamily == PLX_FAMILY_SIRIUS)
@@ -2530,15 +2803,20 @@ PlxDmaTransferBlock(
     // Clear any active status bits ([31,12:8])
     RegValue |= ((1 << 31) | (0x1F << 8));
 
-    spin_unlock(
-        &(pdx->Lock_Dma[channel])
-        );
-
     DebugPrintf(("Start DMA transfer...\n"));
 
+    // Note transfer size for statistics once DMA is done
+    PLX_STAT_DMA_START( pdx, channel, pParams->ByteCount );
+
     // Start DMA ([3])
     PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x38, RegValue | (1 << 3) );
 
+    spin_unlock(
+        &(pdx->Lock_Dma[channel])
+        );
+
+    PlxLatencyRecord( pdx, PLX_LAT_OP_DMA_SUBMIT, TimeStart );
+
     return PLX_STATUS_OK;
 }
 
@@ -2560,24 +2838,21 @@ PlxDmaTransferUserBuffer(
     VOID             *pOwner
     )
 {
-    U16        OffsetDmaBase;
-    U32        RegValue;
     U32        NumDescriptors;
     U64        SglPciAddress;
     PLX_STATUS status;
 
 
-    // Verify DMA channel is available
+    // Verify channel & owner (hardware enable was verified at open)
     status =
-        PlxDmaStatus(
+        PlxDmaChannelVerify(
             pdx,
             channel,
             pOwner
             );
 
-    if (status != PLX_STATUS_COMPLETE)
+    if (status != PLX_STATUS_OK)
     {
-        DebugPrintf(("ERROR - DMA unavailable or in-progress\n"));
         return status;
     }
 
@@ -2593,6 +2868,21 @@ PlxDmaTransferUserBuffer(
         return PLX_STATUS_IN_PROGRESS;
     }
 
+    // Verify DMA is idle
+    status =
+        PlxDmaChannelIdle(
+            pdx,
+            channel,
+            NULL
+            );
+
+    if (status != PLX_STATUS_COMPLETE)
+    {
+        spin_unlock( &(pdx->Lock_Dma[channel]) );
+        DebugPrintf(("ERROR - DMA unavailable or in-progress\n"));
+        return status;
+    }
+
     // Set the SGL DMA pending flag
     pdx->DmaInfo[channel].bSglPending = TRUE;
 
@@ -2617,88 +2907,190 @@ PlxDmaTransferUserBuffer(
         return status;
     }
 
-    // Make sure DMA descriptors are set to external ([2] = 0)
-    if (pdx->Key.PlxFamily == PLX_FAMILY_SIRIUS)
-    {
-        RegValue = PLX_DMA_REG_READ( pdx, 0x1FC );
-        PLX_DMA_REG_WRITE( pdx, 0x1FC, RegValue & ~(1 << 2) );
-    }
+    // Note transfer size for statistics once DMA is done
+    PLX_STAT_DMA_START( pdx, channel, pParams->ByteCount );
 
-    // Set the channel's base register offset (200h, 300h, etc)
-    OffsetDmaBase = 0x200 + (channel * 0x100);
+    spin_lock(
+        &(pdx->Lock_Dma[channel])
+        );
 
-    // Verify DMA prefetch doesn't exceed descriptor count & is a multiple of 4
-    if (NumDescriptors < 4)
-    {
-        RegValue = 1;
-    }
-    else if (NumDescriptors >= 256)
-    {
-        RegValue = 0;
-    }
-    else
+    // Start the SGL transfer
+    PlxDmaSglStart(
+        pdx,
+        channel,
+        SglPciAddress,
+        NumDescriptors
+        );
+
+    spin_unlock(
+        &(pdx->Lock_Dma[channel])
+        );
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxDmaTransferScatterMemory
+ *
+ * Description:  Transfers an entire scatter buffer using its pre-built SGL
+ *
+ * Note       :  The SGL descriptors are only rewritten if the transfer
+ *               parameters differ from those the SGL was last built for.
+ *               The channel lock is held from the idle check until the
+ *               transfer is started.  Lock order is channel, then list.
+ *
+ ******************************************************************************/
+PLX_STATUS
+PlxDmaTransferScatterMemory(
+    DEVICE_EXTENSION *pdx,
+    U8                channel,
+    U64               Tag,
+    PLX_DMA_PARAMS   *pParams,
+    VOID             *pOwner
+    )
+{
+    U32                     NumDescriptors;
+    U64                     ByteCount;
+    U64                     SglPciAddress;
+    PLX_STATUS              status;
+    PLX_SCATTER_MEM_OBJECT *pScatter;
+
+
+    // Verify channel & owner (hardware enable was verified at open)
+    status =
+        PlxDmaChannelVerify(
+            pdx,
+            channel,
+            pOwner
+            );
+
+    if (status != PLX_STATUS_OK)
     {
-        RegValue = (NumDescriptors & (U8)~0x3);
+        return status;
     }
-    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x34, RegValue );
 
     spin_lock(
         &(pdx->Lock_Dma[channel])
         );
 
-    // Clear all DMA registers
-    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x00, 0 );
-    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x04, 0 );
-    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x08, 0 );
-    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x0C, 0 );
-    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x10, 0 );
-
-    // Descriptor ring address
-    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x14, PLX_64_LOW_32(SglPciAddress) );
-    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x18, PLX_64_HIGH_32(SglPciAddress) );
+    // Verify an SGL DMA transfer is not pending
+    if (pdx->DmaInfo[channel].bSglPending)
+    {
+        spin_unlock( &(pdx->Lock_Dma[channel]) );
+        DebugPrintf(("ERROR - An SGL DMA transfer is currently pending\n"));
+        return PLX_STATUS_IN_PROGRESS;
+    }
 
-    // Current descriptor address
-    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x1C, PLX_64_LOW_32(SglPciAddress) );
+    // Verify DMA is idle
+    status =
+        PlxDmaChannelIdle(
+            pdx,
+            channel,
+            NULL
+            );
 
-    // Descriptor ring size
-    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x20, NumDescriptors );
+    if (status != PLX_STATUS_COMPLETE)
+    {
+        spin_unlock( &(pdx->Lock_Dma[channel]) );
+        DebugPrintf(("ERROR - DMA unavailable or in-progress\n"));
+        return status;
+    }
 
-    // Current descriptor transfer size
-    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x28, 0 );
+    spin_lock( &(pdx->Lock_PhysicalMemList) );
 
-    // Disable invalid descriptor interrupt (x3C[1])
-    RegValue = PLX_DMA_REG_READ( pdx, OffsetDmaBase + 0x3C );
-    RegValue &= ~(1 << 1);
-    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x3C, RegValue );
+    pScatter =
+        PlxScatterMemoryFind(
+            pdx,
+            Tag
+            );
 
-    // Get DMA control/status
-    RegValue = PLX_DMA_REG_READ( pdx, OffsetDmaBase + 0x38 );
+    if (pScatter == NULL)
+    {
+        spin_unlock( &(pdx->Lock_PhysicalMemList) );
+        spin_unlock( &(pdx->Lock_Dma[channel]) );
+        DebugPrintf(("ERROR - Scatter buffer object not found in list\n"));
+        return PLX_STATUS_INVALID_DATA;
+    }
 
-    // Make sure descriptor write-back ([2]) is disabled
-    RegValue &= ~(1 << 2);
+    // SGL may be rewritten, so only one channel may use it at a time
+    if ((pScatter->SglChannel >= 0) && (pScatter->SglChannel != channel))
+    {
+        status =
+            PlxDmaChannelIdle(
+                pdx,
+                pScatter->SglChannel,
+                NULL
+                );
 
-    // Clear any active status bits ([31,12:8])
-    RegValue |= ((1 << 31) | (0x1F << 8));
+        if (status != PLX_STATUS_COMPLETE)
+        {
+            spin_unlock( &(pdx->Lock_PhysicalMemList) );
+            spin_unlock( &(pdx->Lock_Dma[channel]) );
+            DebugPrintf((
+                "ERROR - Scatter buffer SGL in use by channel %d\n",
+                pScatter->SglChannel
+                ));
+            return PLX_STATUS_IN_PROGRESS;
+        }
+    }
 
-    // Enable SGL off-chip mode & descriptor fetch stops at end
-    if (pdx->Key.PlxFamily == PLX_FAMILY_SIRIUS)
+    // Rebuild SGL only if the device side of the transfer has changed
+    if ((pScatter->bSglBuilt == FALSE) ||
+        (pScatter->SglParams.PciAddr        != pParams->PciAddr) ||
+        (pScatter->SglParams.Direction      != pParams->Direction) ||
+        (pScatter->SglParams.bConstAddrSrc  != pParams->bConstAddrSrc) ||
+        (pScatter->SglParams.bConstAddrDest != pParams->bConstAddrDest))
     {
-        RegValue |= (1 << 5) | (1 << 4);        // SGL mode (4) & descriptor halt mode (5)
+        PlxScatterSglBuild(
+            pdx,
+            pScatter,
+            pParams
+            );
     }
     else
     {
-        RegValue &= ~(3 << 5);
-        RegValue |= (2 << 5) | (1 << 4);        // SGL mode ([6:5]) & descriptor halt mode (4)
+        DebugPrintf(("Re-use previously built scatter buffer SGL\n"));
     }
 
-    spin_unlock(
-        &(pdx->Lock_Dma[channel])
+    SglPciAddress  = pScatter->Sgl.BusPhysical;
+    NumDescriptors = pScatter->NumChunks;
+    ByteCount      = pScatter->Size;
+
+    DebugPrintf((
+        "Ch %d - DMA scatter buffer %s %08X_%08X (%lld bytes)\n",
+        channel,
+        (pParams->Direction == PLX_DMA_USER_TO_PCI) ? "-->" : "<--",
+        PLX_64_HIGH_32(pParams->PciAddr), PLX_64_LOW_32(pParams->PciAddr),
+        ByteCount
+        ));
+
+    // Flag SGL DMA pending, no user pages are locked for scatter buffers
+    pdx->DmaInfo[channel].bSglPending = TRUE;
+    pdx->DmaInfo[channel].NumPages    = 0;
+    pdx->DmaInfo[channel].PageList    = NULL;
+
+    // Note transfer size for statistics once DMA is done
+    PLX_STAT_DMA_START( pdx, channel, ByteCount );
+
+    // Start the SGL transfer before another channel can claim the SGL
+    PlxDmaSglStart(
+        pdx,
+        channel,
+        SglPciAddress,
+        NumDescriptors
         );
 
-    DebugPrintf(("Start DMA transfer...\n"));
+    pScatter->SglChannel = channel;
 
-    // Start DMA (x38[3])
-    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x38, RegValue | (1 << 3) );
+    spin_unlock( &(pdx->Lock_PhysicalMemList) );
+
+    spin_unlock(
+        &(pdx->Lock_Dma[channel])
+        );
 
     return PLX_STATUS_OK;
 }
@@ -232,6 +232,20 @@ PlxPciPhysicalMemoryUnmap(
     VOID             *pOwner
     );
 
+PLX_STATUS
+PlxPciScatterMemoryAllocate(
+    DEVICE_EXTENSION *pdx,
+    PLX_SCATTER_MEM  *pScatterMem,
+    VOID             *pOwner
+    );
+
+PLX_STATUS
+PlxPciScatterMemoryFree(
+    DEVICE_EXTENSION *pdx,
+    PLX_SCATTER_MEM  *pScatterMem,
+    VOID             *pOwner
+    );
+
 PLX_STATUS
 PlxInterruptEnable(
     DEVICE_EXTENSION *pdx,
@@ -326,6 +340,15 @@ PlxDmaTransferUserBuffer(
     VOID             *pOwner
     );
 
+PLX_STATUS
+PlxDmaTransferScatterMemory(
+    DEVICE_EXTENSION *pdx,
+    U8                channel,
+    U64               Tag,
+    PLX_DMA_PARAMS   *pParams,
+    VOID             *pOwner
+    );
+
 PLX_STATUS
 PlxDmaChannelClose(
     DEVICE_EXTENSION *pdx,
@@ -54,6 +54,8 @@
 #include "Driver.h"
 #include "PciFunc.h"
 #include "PlxIoctl.h"
+#include "PlxLatency.h"
+#include "PlxStats.h"
 #include "SuppFunc.h"
 
 
@@ -242,6 +244,19 @@ Dispatch_mmap(
             break;
 
         default:
+            // Check for a scatter buffer, which requires a per-chunk mapping
+            rc =
+                PlxScatterMemoryMap(
+                    pdx,
+                    vma
+                    );
+
+            if (rc != -ENOENT)
+            {
+                DebugPrintf(("...Completed message\n"));
+                return rc;
+            }
+
             // Use provided offset as CPU physical address for mapping
             AddressToMap = (U64)offset << PAGE_SHIFT;
 
@@ -349,6 +364,7 @@ Dispatch_IoControl(
     )
 {
     int               status;
+    U64               TimeStart;
     VOID             *pOwner;
     PLX_PARAMS        IoBuffer;
     PLX_PARAMS       *pIoBuffer;
@@ -357,6 +373,9 @@ Dispatch_IoControl(
 
     DebugPrintf_Cont((" \n"));
 
+    // Note start time for service latency
+    TimeStart = PlxLatencyTimestamp();
+
     // Get the device extension
     if (iminor(filp->f_path.dentry->d_inode) == PLX_MNGMT_INTERFACE)
     {
@@ -855,6 +874,28 @@ Dispatch_IoControl(
                     );
             break;
 
+        case PLX_IOCTL_SCATTER_MEM_ALLOCATE:
+            DebugPrintf_Cont(("PLX_IOCTL_SCATTER_MEM_ALLOCATE\n"));
+
+            pIoBuffer->ReturnCode =
+                PlxPciScatterMemoryAllocate(
+                    pdx,
+                    &(pIoBuffer->u.ScatterMem),
+                    pOwner
+                    );
+            break;
+
+        case PLX_IOCTL_SCATTER_MEM_FREE:
+            DebugPrintf_Cont(("PLX_IOCTL_SCATTER_MEM_FREE\n"));
+
+            pIoBuffer->ReturnCode =
+                PlxPciScatterMemoryFree(
+                    pdx,
+                    &(pIoBuffer->u.ScatterMem),
+                    pOwner
+                    );
+            break;
+
         case PLX_IOCTL_COMMON_BUFFER_PROPERTIES:
             DebugPrintf_Cont(("PLX_IOCTL_COMMON_BUFFER_PROPERTIES\n"));
 
@@ -1023,6 +1064,19 @@ Dispatch_IoControl(
                     );
             break;
 
+        case PLX_IOCTL_DMA_TRANSFER_SCATTER_MEM:
+            DebugPrintf_Cont(("PLX_IOCTL_DMA_TRANSFER_SCATTER_MEM\n"));
+
+            pIoBuffer->ReturnCode =
+                PlxDmaTransferScatterMemory(
+                    pdx,
+                    (U8)pIoBuffer->value[0],
+                    pIoBuffer->value[1],
+                    &(pIoBuffer->u.TxParams),
+                    pOwner
+                    );
+            break;
+
         case PLX_IOCTL_DMA_CHANNEL_CLOSE:
             DebugPrintf_Cont(("PLX_IOCTL_DMA_CHANNEL_CLOSE\n"));
 
@@ -1036,6 +1090,20 @@ Dispatch_IoControl(
             break;
 
 
+        /******************************************
+         * Driver Statistics
+         *****************************************/
+        case PLX_IOCTL_DEVICE_GET_STATS:
+            DebugPrintf_Cont(("PLX_IOCTL_DEVICE_GET_STATS\n"));
+
+            pIoBuffer->ReturnCode =
+                PlxStatsGet(
+                    pdx,
+                    PLX_INT_TO_PTR(pIoBuffer->value[0])
+                    );
+            break;
+
+
         /******************************************
          * Unsupported Messages
          *****************************************/
@@ -1051,6 +1119,12 @@ Dispatch_IoControl(
 
     DebugPrintf(("...Completed message\n"));
 
+    // Record service time for device messages
+    if (pdx != NULL)
+    {
+        PlxLatencyRecord( pdx, PLX_LAT_OP_IOCTL, TimeStart );
+    }
+
     status =
         copy_to_user(
             (PLX_PARAMS*)args,
@@ -73,6 +73,10 @@
 #define PLX_MAX_NAME_LENGTH                 0x20          // Max length of registered device name
 #define DEFAULT_SIZE_COMMON_BUFFER          (64 * 1024)   // Default size of Common Buffer
 #define MAX_DMA_CHANNELS                    4             // Total number of DMA Channels
+#define DEFAULT_SCATTER_CHUNK_SIZE          (4 << 20)     // Default size of scatter buffer chunks
+#define MAX_SCATTER_CHUNK_SIZE              (64 << 20)    // Max chunk size, must fit in SGL descriptor count
+#define MAX_SCATTER_BUFFER_SIZE             ((U64)4 << 30) // Max total size of a scatter buffer
+#define SCATTER_DMA_STOP_WAIT_MS            1000          // Max wait for DMA to stop before scatter buffer release
 #define MIN_WORKING_POWER_STATE	            PowerDeviceD2 // Minimum state required for local register access
 
 
@@ -204,6 +208,23 @@ typedef struct _PLX_PHYS_MEM_OBJECT
 } PLX_PHYS_MEM_OBJECT;
 
 
+// Information about scatter buffers built from multiple contiguous chunks
+typedef struct _PLX_SCATTER_MEM_OBJECT
+{
+    struct list_head     ListEntry;
+    VOID                *pOwner;
+    atomic_t             RefCount;              // References held (device list & maps in progress)
+    struct list_head     List_Chunks;           // Chunks as PLX_PHYS_MEM_OBJECT list
+    U32                  NumChunks;             // Number of chunks & SGL descriptors
+    U32                  ChunkSize;             // Size of the largest chunk
+    U64                  Size;                  // Total buffer size
+    PLX_PHYS_MEM_OBJECT  Sgl;                   // Pre-built SGL descriptors for chunks
+    BOOLEAN              bSglBuilt;             // Flag whether SGL built for a transfer
+    PLX_DMA_PARAMS       SglParams;             // Transfer parameters SGL is built for
+    S8                   SglChannel;            // Channel last started with the SGL (-1 = none)
+} PLX_SCATTER_MEM_OBJECT;
+
+
 // PCI BAR Space information
 typedef struct _PLX_PCI_BAR_INFO
 {
@@ -219,6 +240,7 @@ typedef struct _PLX_DMA_INFO
     VOID                 *pOwner;               // Object that requested to open the channel
     BOOLEAN               bOpen;                // Flag to note if DMA channel is open
     BOOLEAN               bSglPending;          // Flag to note if an SGL DMA is pending
+    BOOLEAN               bDescrExternal;       // Flag to note if SGL descriptors set to external
     U32                   NumPages;             // Number of pages mapped for user buffer
     U32                   InitialOffset;        // Initial offset of user buffer
     U32                   BufferSize;           // Total size of the user buffer
@@ -238,6 +260,55 @@ typedef struct _PLX_REG_DATA
 } PLX_REG_DATA;
 
 
+// Driver operations timed by the latency histograms
+typedef enum _PLX_LAT_OP
+{
+    PLX_LAT_OP_IOCTL,                           // Dispatch_IoControl() service time
+    PLX_LAT_OP_ISR,                             // OnInterrupt() time for device interrupts
+    PLX_LAT_OP_DPC_DELAY,                       // Time from ISR scheduling DPC until it runs
+    PLX_LAT_OP_DPC,                             // DpcForIsr() run time
+    PLX_LAT_OP_SGL_BUILD,                       // PlxLockBufferAndBuildSgl() time
+    PLX_LAT_OP_SGL_COMPLETE,                    // PlxSglDmaTransferComplete() time
+    PLX_LAT_OP_DMA_SUBMIT,                      // DMA block/SGL transfer submission time
+    PLX_LAT_OP_COUNT
+} PLX_LAT_OP;
+
+#define PLX_LAT_NUM_BUCKETS                 24  // Number of log2 histogram buckets
+
+
+// Latency histogram for a driver operation
+typedef struct _PLX_LAT_HIST
+{
+    U64 Count;                                  // Number of operations recorded
+    U64 TotalNs;                                // Sum of all latencies
+    U64 MaxNs;                                  // Largest latency seen
+    U32 Bucket[PLX_LAT_NUM_BUCKETS];            // Counts by log2 latency range
+} PLX_LAT_HIST;
+
+
+// Set of latency histograms kept for each CPU
+typedef struct _PLX_LAT_STATS
+{
+    PLX_LAT_HIST Op[PLX_LAT_OP_COUNT];
+} PLX_LAT_STATS;
+
+
+// Device statistics counters, updated atomically & always enabled
+typedef struct _PLX_STATS_COUNTERS
+{
+    atomic64_t DmaBytes[PLX_STATS_MAX_DMA_CHANNELS];     // Bytes transferred per DMA channel
+    atomic64_t DmaTransfers[PLX_STATS_MAX_DMA_CHANNELS]; // Transfers completed per DMA channel
+    atomic64_t DmaPending[PLX_STATS_MAX_DMA_CHANNELS];   // Bytes of transfer in flight, not reported
+    atomic64_t SglDescriptors;                          // SGL descriptors built
+    atomic64_t PagesPinned;                             // User buffer pages locked
+    atomic64_t Interrupts;                              // Device interrupts handled
+    atomic64_t InterruptsSpurious;                      // ISR calls returning IRQ_NONE
+    atomic64_t DpcCount;                                // DPCs run
+    atomic64_t NotifySignalled;                         // Wait objects signalled
+    atomic64_t NotifyTimeouts;                          // Notification waits timed out
+} PLX_STATS_COUNTERS;
+
+
 // All relevant information about the device
 typedef struct _DEVICE_EXTENSION
 {
@@ -264,6 +335,14 @@ typedef struct _DEVICE_EXTENSION
 
     struct list_head       List_PhysicalMem;              // List of user-allocated physical memory
     spinlock_t             Lock_PhysicalMemList;          // Spinlock for physical memory list
+    struct list_head       List_ScatterMem;               // List of user-allocated scatter buffers (uses physical memory lock)
+
+    PLX_LAT_STATS         *pLatStats;                     // Per-CPU operation latency histograms
+    U64                    DpcQueueTime;                  // Time ISR scheduled the pending DPC
+    struct dentry         *pDebugFsDir;                   // Device debugfs directory
+
+    PLX_STATS_COUNTERS     Stats;                         // Device statistics counters
+    BOOLEAN                bStatsSysfs;                   // Flag whether statistics sysfs entries exist
 
     PLX_DMA_INFO           DmaInfo[MAX_DMA_CHANNELS];     // DMA channel information
     spinlock_t             Lock_Dma[MAX_DMA_CHANNELS];    // Spinlock for DMA channel access
@@ -281,6 +360,7 @@ typedef struct _DRIVER_OBJECT
     U8                      bPciDriverReg;    // Flag whether the driver was registered as PCI
     PLX_PHYS_MEM_OBJECT     CommonBuffer;     // Contiguous memory to be shared by all processes
     struct file_operations  DispatchTable;    // Driver dispatch table
+    struct dentry          *pDebugFsDir;      // Driver debugfs directory
 } DRIVER_OBJECT;
 
 
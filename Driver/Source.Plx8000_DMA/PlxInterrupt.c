@@ -51,6 +51,8 @@
 #include "DrvDefs.h"
 #include "PciFunc.h"
 #include "PlxInterrupt.h"
+#include "PlxLatency.h"
+#include "PlxStats.h"
 #include "SuppFunc.h"
 
 
@@ -77,12 +79,16 @@ OnInterrupt(
     U32               RegStatus;
     U32               IntSource;
     BOOLEAN           bIntActive;
+    U64               TimeStart;
     DEVICE_EXTENSION *pdx;
 
 
     // Get the device extension
     pdx = (DEVICE_EXTENSION *)dev_id;
 
+    // Note start time for ISR latency
+    TimeStart = PlxLatencyTimestamp();
+
     // Disable interrupts and acquire lock 
     spin_lock( &(pdx->Lock_Isr) ); 
 
@@ -154,16 +160,28 @@ OnInterrupt(
 
     // Return if no interrupt active
     if (bIntActive == FALSE)
+    {
+        PLX_STAT_INC( pdx, InterruptsSpurious );
         return IRQ_RETVAL(IRQ_NONE);
+    }
 
     //
     // Schedule deferred procedure (DPC) to complete interrupt processing
     //
 
+    // Count verified device interrupt
+    PLX_STAT_INC( pdx, Interrupts );
+
+    // Record ISR time for device interrupts
+    PlxLatencyRecord( pdx, PLX_LAT_OP_ISR, TimeStart );
+
     // If device is no longer started, do not schedule a DPC
     if (pdx->State != PLX_STATE_STARTED)
         return IRQ_RETVAL(IRQ_HANDLED);
 
+    // Note DPC queue time, coalesced interrupts are measured from the latest
+    pdx->DpcQueueTime = PlxLatencyTimestamp();
+
     // Add task to system work queue
     schedule_work(
         &(pdx->Task_DpcForIsr)
@@ -192,6 +210,7 @@ DpcForIsr(
 {
     U8                  channel;
     U32                 IntStatus;
+    U64                 TimeStart;
     DEVICE_EXTENSION   *pdx;
     PLX_INTERRUPT_DATA  IntData;
 
@@ -212,6 +231,13 @@ DpcForIsr(
         return;
     }
 
+    // Note start time & record delay since ISR queued the DPC
+    TimeStart = PlxLatencyTimestamp();
+    PlxLatencyRecord( pdx, PLX_LAT_OP_DPC_DELAY, pdx->DpcQueueTime );
+
+    // Count DPC run
+    PLX_STAT_INC( pdx, DpcCount );
+
     // Setup for synchonized access to interrupt source
     IntData.pdx = pdx;
 
@@ -226,6 +252,18 @@ DpcForIsr(
         // Get active interrupts for channel
         IntStatus = (IntData.Source_Ints >> (channel * 8)) & 0xFF;
 
+        // Update statistics once transfer has ended
+        if (IntStatus & (INTR_TYPE_DMA_ERROR  | INTR_TYPE_DESCR_INVALID |
+                         INTR_TYPE_ABORT_DONE | INTR_TYPE_IMMED_STOP_DONE))
+        {
+            // Failed or stopped transfers are not counted as moved
+            PlxStatsDmaDone( pdx, channel, FALSE );
+        }
+        else if (IntStatus & INTR_TYPE_DESCR_DMA_DONE)
+        {
+            PlxStatsDmaDone( pdx, channel, TRUE );
+        }
+
         // Check if DMA completed for a driver SGL transfer & cleanup
         if ((IntStatus & INTR_TYPE_DESCR_DMA_DONE) &&
             (pdx->DmaInfo[channel].bSglPending))
@@ -243,6 +281,9 @@ DpcForIsr(
         &IntData
         );
 
+    // Record DPC run time
+    PlxLatencyRecord( pdx, PLX_LAT_OP_DPC, TimeStart );
+
     // Flag a DPC is no longer pending
     pdx->bDpcPending = FALSE;
 }
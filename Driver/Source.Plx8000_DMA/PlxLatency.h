@@ -0,0 +1,101 @@
+#ifndef __PLX_LATENCY_H
+#define __PLX_LATENCY_H
+
+/*******************************************************************************
+ * Copyright 2013-2019 Broadcom Inc
+ * Copyright (c) 2009 to 2012 PLX Technology Inc.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directorY of this source tree, or the
+ * BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * File Name:
+ *
+ *      PlxLatency.h
+ *
+ * Description:
+ *
+ *      Header for driver operation latency histograms
+ *
+ * Revision History:
+ *
+ *      09-01-19 : PCI/PCIe SDK v8.10
+ *
+ ******************************************************************************/
+
+
+#include <linux/ktime.h>
+#include "DrvDefs.h"
+
+
+
+
+/**********************************************
+ *               Definitions
+ *********************************************/
+// Returns current time (ns) used as start of a timed operation
+#define PlxLatencyTimestamp()           ktime_to_ns( ktime_get() )
+
+
+
+
+/**********************************************
+ *               Functions
+ *********************************************/
+VOID
+PlxLatencyRecord(
+    DEVICE_EXTENSION *pdx,
+    PLX_LAT_OP        Op,
+    U64               TimeStart
+    );
+
+VOID
+PlxLatencyDriverInit(
+    DRIVER_OBJECT *pDriverObject
+    );
+
+VOID
+PlxLatencyDriverRelease(
+    DRIVER_OBJECT *pDriverObject
+    );
+
+VOID
+PlxLatencyDeviceInit(
+    DEVICE_EXTENSION *pdx
+    );
+
+VOID
+PlxLatencyDeviceRelease(
+    DEVICE_EXTENSION *pdx
+    );
+
+
+
+#endif
@@ -55,6 +55,8 @@
 #include "PciFunc.h"
 #include "PciRegs.h"
 #include "PlxInterrupt.h"
+#include "PlxLatency.h"
+#include "PlxStats.h"
 #include "SuppFunc.h"
 
 
@@ -235,6 +237,9 @@ PlxSignalNotifications(
             // Save new interrupt sources in case later requested
             pWaitObject->Source_Ints |= SourceInt;
 
+            // Count signalled wait object
+            PLX_STAT_INC( pdx, NotifySignalled );
+
             // Signal wait object
             wake_up_interruptible( &(pWaitObject->WaitQueue) );
         }
@@ -541,9 +546,10 @@ PlxPciPhysicalMemoryFreeAll_ByOwner(
     VOID             *pOwner
     )
 {
-    PLX_PHYSICAL_MEM     PciMem;
-    struct list_head    *pEntry;
-    PLX_PHYS_MEM_OBJECT *pMemObject;
+    PLX_PHYSICAL_MEM        PciMem;
+    struct list_head       *pEntry;
+    PLX_PHYS_MEM_OBJECT    *pMemObject;
+    PLX_SCATTER_MEM_OBJECT *pScatter;
 
 
     spin_lock( &(pdx->Lock_PhysicalMemList) );
@@ -589,7 +595,470 @@ PlxPciPhysicalMemoryFreeAll_ByOwner(
         }
     }
 
+    // Release any scatter buffers owned by the caller
+    pEntry = pdx->List_ScatterMem.next;
+
+    while (pEntry != &(pdx->List_ScatterMem))
+    {
+        pScatter =
+            list_entry(
+                pEntry,
+                PLX_SCATTER_MEM_OBJECT,
+                ListEntry
+                );
+
+        // Jump to next item before object is removed
+        pEntry = pEntry->next;
+
+        if (pScatter->pOwner == pOwner)
+        {
+            list_del( &(pScatter->ListEntry) );
+
+            spin_unlock( &(pdx->Lock_PhysicalMemList) );
+
+            // Buffer can no longer be found, so stop any DMA still using it
+            PlxScatterMemoryDmaStop(
+                pdx,
+                pScatter
+                );
+
+            // Drop the list reference, buffer released after any map in progress
+            PlxScatterMemoryPut(
+                pdx,
+                pScatter
+                );
+
+            spin_lock( &(pdx->Lock_PhysicalMemList) );
+
+            // Restart parsing the list from the beginning
+            pEntry = pdx->List_ScatterMem.next;
+        }
+    }
+
+    spin_unlock( &(pdx->Lock_PhysicalMemList) );
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxScatterMemoryDmaStop
+ *
+ * Description:  Aborts any DMA still walking a scatter buffer's SGL & waits for
+ *               the channel to stop
+ *
+ * Note       :  Used when a process closes without freeing its buffers.  The
+ *               buffer must already be removed from the device list.
+ *
+ ******************************************************************************/
+VOID
+PlxScatterMemoryDmaStop(
+    DEVICE_EXTENSION       *pdx,
+    PLX_SCATTER_MEM_OBJECT *pScatter
+    )
+{
+    U8  channel;
+    U16 LoopCount;
+
+
+    if (pScatter->SglChannel < 0)
+    {
+        return;
+    }
+
+    channel = (U8)pScatter->SglChannel;
+
+    if (PlxDmaChannelIdle( pdx, channel, NULL ) == PLX_STATUS_COMPLETE)
+    {
+        return;
+    }
+
+    DebugPrintf(("Scatter buffer SGL in use by channel %d, aborting...\n", channel));
+
+    // Abort on behalf of the channel's owner
+    PlxDmaControl(
+        pdx,
+        channel,
+        DmaAbort,
+        pdx->DmaInfo[channel].pOwner
+        );
+
+    // Wait for channel to stop walking the SGL
+    LoopCount = SCATTER_DMA_STOP_WAIT_MS;
+
+    while (PlxDmaChannelIdle( pdx, channel, NULL ) != PLX_STATUS_COMPLETE)
+    {
+        if (LoopCount == 0)
+        {
+            ErrorPrintf((
+                "ERROR - DMA channel %d did not stop, scatter buffer may be in use\n",
+                channel
+                ));
+            return;
+        }
+
+        Plx_sleep( 1 );
+        LoopCount--;
+    }
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxScatterMemoryFind
+ *
+ * Description:  Locates a scatter buffer object by its tag
+ *
+ * Note       :  The caller must hold the physical memory list lock
+ *
+ ******************************************************************************/
+PLX_SCATTER_MEM_OBJECT*
+PlxScatterMemoryFind(
+    DEVICE_EXTENSION *pdx,
+    U64               Tag
+    )
+{
+    struct list_head       *pEntry;
+    PLX_SCATTER_MEM_OBJECT *pScatter;
+
+
+    pEntry = pdx->List_ScatterMem.next;
+
+    // Traverse list to find the desired object
+    while (pEntry != &(pdx->List_ScatterMem))
+    {
+        // Get the object
+        pScatter =
+            list_entry(
+                pEntry,
+                PLX_SCATTER_MEM_OBJECT,
+                ListEntry
+                );
+
+        // Tag is the CPU physical address of the buffer's SGL
+        if (pScatter->Sgl.CpuPhysical == Tag)
+        {
+            return pScatter;
+        }
+
+        // Jump to next item in the list
+        pEntry = pEntry->next;
+    }
+
+    return NULL;
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxScatterMemoryRelease
+ *
+ * Description:  Releases all chunks & the SGL of a scatter buffer object
+ *
+ * Note       :  The object must already be removed from the device list
+ *
+ ******************************************************************************/
+VOID
+PlxScatterMemoryRelease(
+    DEVICE_EXTENSION       *pdx,
+    PLX_SCATTER_MEM_OBJECT *pScatter
+    )
+{
+    PLX_PHYS_MEM_OBJECT *pChunk;
+
+
+    // Release each chunk of the buffer
+    while (!list_empty( &(pScatter->List_Chunks) ))
+    {
+        pChunk =
+            list_entry(
+                pScatter->List_Chunks.next,
+                PLX_PHYS_MEM_OBJECT,
+                ListEntry
+                );
+
+        list_del( &(pChunk->ListEntry) );
+
+        Plx_dma_buffer_free(
+            pdx,
+            pChunk
+            );
+
+        kfree( pChunk );
+    }
+
+    // Release the SGL descriptor buffer
+    if (pScatter->Sgl.pKernelVa != NULL)
+    {
+        Plx_dma_buffer_free(
+            pdx,
+            &(pScatter->Sgl)
+            );
+    }
+
+    // Release the list object
+    kfree( pScatter );
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxScatterMemoryPut
+ *
+ * Description:  Drops a reference to a scatter buffer & releases it when the
+ *               last reference is dropped
+ *
+ * Note       :  The object must already be removed from the device list if
+ *               the list reference is dropped
+ *
+ ******************************************************************************/
+VOID
+PlxScatterMemoryPut(
+    DEVICE_EXTENSION       *pdx,
+    PLX_SCATTER_MEM_OBJECT *pScatter
+    )
+{
+    if (atomic_dec_and_test( &(pScatter->RefCount) ))
+    {
+        PlxScatterMemoryRelease(
+            pdx,
+            pScatter
+            );
+    }
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxScatterSglBuild
+ *
+ * Description:  Writes one SGL descriptor per chunk of a scatter buffer
+ *
+ * Note       :  The caller must hold the physical memory list lock
+ *
+ ******************************************************************************/
+VOID
+PlxScatterSglBuild(
+    DEVICE_EXTENSION       *pdx,
+    PLX_SCATTER_MEM_OBJECT *pScatter,
+    PLX_DMA_PARAMS         *pDma
+    )
+{
+    U8                  *VaSgl;
+    U32                  TmpValue;
+    U32                  DescrCount;
+    U64                  PciAddr;
+    U64                  AddrSrc;
+    U64                  AddrDest;
+    struct list_head    *pEntry;
+    PLX_PHYS_MEM_OBJECT *pChunk;
+
+
+    DebugPrintf(("Build SGL for scatter buffer (%d descriptors)\n", pScatter->NumChunks));
+
+    VaSgl      = (U8*)pScatter->Sgl.pKernelVa;
+    PciAddr    = pDma->PciAddr;
+    DescrCount = 0;
+
+    pEntry = pScatter->List_Chunks.next;
+
+    while (pEntry != &(pScatter->List_Chunks))
+    {
+        pChunk =
+            list_entry(
+                pEntry,
+                PLX_PHYS_MEM_OBJECT,
+                ListEntry
+                );
+
+        DescrCount++;
+
+        // Set source destination addresses & increment to next PCI address
+        if (pDma->Direction == PLX_DMA_USER_TO_PCI)
+        {
+            AddrSrc  = pChunk->BusPhysical;
+            AddrDest = PciAddr;
+
+            if (pDma->bConstAddrDest == FALSE)
+            {
+                PciAddr += pChunk->Size;
+            }
+        }
+        else
+        {
+            AddrSrc  = PciAddr;
+            AddrDest = pChunk->BusPhysical;
+
+            if (pDma->bConstAddrSrc == FALSE)
+            {
+                PciAddr += pChunk->Size;
+            }
+        }
+
+        // Descriptor upper bits of addresses ([47:32])
+        TmpValue  = (PLX_64_HIGH_32( AddrSrc ) & 0x0000FFFF) << 16;
+        TmpValue |= (PLX_64_HIGH_32( AddrDest ) & 0x0000FFFF) <<  0;
+
+        *(U32*)(VaSgl + 0x4) = PLX_LE_DATA_32( TmpValue );
+
+        // Descriptor lower bits of destination address ([31:0])
+        TmpValue = PLX_64_LOW_32( AddrDest );
+        *(U32*)(VaSgl + 0x8) = PLX_LE_DATA_32( TmpValue );
+
+        // Descriptor lower bits of source address ([31:0])
+        TmpValue = PLX_64_LOW_32( AddrSrc );
+        *(U32*)(VaSgl + 0xC) = PLX_LE_DATA_32( TmpValue );
+
+        // Descriptor transfer count
+        TmpValue = PLX_LE_U32_BIT( 31 ) |           // Descriptor valid
+                   PLX_LE_DATA_32( pChunk->Size );  // Transfer count
+
+        if (pDma->bConstAddrSrc)
+        {
+            TmpValue |= PLX_LE_U32_BIT( 29 );    // Keep source address constant
+        }
+
+        if (pDma->bConstAddrDest)
+        {
+            TmpValue |= PLX_LE_U32_BIT( 28 );    // Keep destination address constant
+        }
+
+        if (DescrCount == pScatter->NumChunks)
+        {
+            TmpValue |= PLX_LE_U32_BIT( 30 );    // Interrupt when done
+        }
+
+        *(U32*)(VaSgl + 0x0) = TmpValue;
+
+        // Adjust virtual address to next descriptor
+        VaSgl += (4 * sizeof(U32));
+
+        pEntry = pEntry->next;
+    }
+
+    // Make sure descriptors are visible to the device
+    wmb();
+
+    // Update SGL statistics
+    PLX_STAT_ADD( pdx, SglDescriptors, DescrCount );
+
+    // Record parameters the SGL was built for
+    pScatter->SglParams = *pDma;
+    pScatter->bSglBuilt = TRUE;
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxScatterMemoryMap
+ *
+ * Description:  Maps the chunks of a scatter buffer into a contiguous user VA
+ *
+ * Returns    :  -ENOENT if the offset does not refer to a scatter buffer
+ *
+ ******************************************************************************/
+int
+PlxScatterMemoryMap(
+    DEVICE_EXTENSION      *pdx,
+    struct vm_area_struct *vma
+    )
+{
+    int                     rc;
+    unsigned long           VaNext;
+    struct list_head       *pEntry;
+    PLX_PHYS_MEM_OBJECT    *pChunk;
+    PLX_SCATTER_MEM_OBJECT *pScatter;
+
+
+    spin_lock( &(pdx->Lock_PhysicalMemList) );
+
+    pScatter =
+        PlxScatterMemoryFind(
+            pdx,
+            (U64)vma->vm_pgoff << PAGE_SHIFT
+            );
+
+    // Hold a reference so the buffer can't be freed while it is being mapped
+    if (pScatter != NULL)
+    {
+        atomic_inc( &(pScatter->RefCount) );
+    }
+
     spin_unlock( &(pdx->Lock_PhysicalMemList) );
+
+    if (pScatter == NULL)
+    {
+        return -ENOENT;
+    }
+
+    // Verify mapping does not exceed buffer
+    if ((vma->vm_end - vma->vm_start) > pScatter->Size)
+    {
+        ErrorPrintf(("ERROR - Requested map size exceeds scatter buffer size\n"));
+        PlxScatterMemoryPut( pdx, pScatter );
+        return -EINVAL;
+    }
+
+    DebugPrintf(("Map scatter buffer (%d chunks)...\n", pScatter->NumChunks));
+
+    // Set the region as page-locked
+    vma->vm_flags |= VM_RESERVED;
+
+    VaNext = vma->vm_start;
+    pEntry = pScatter->List_Chunks.next;
+
+    // Map each chunk immediately following the previous one
+    while ((pEntry != &(pScatter->List_Chunks)) && (VaNext < vma->vm_end))
+    {
+        pChunk =
+            list_entry(
+                pEntry,
+                PLX_PHYS_MEM_OBJECT,
+                ListEntry
+                );
+
+        rc =
+            remap_pfn_range(
+                vma,
+                VaNext,
+                pChunk->CpuPhysical >> PAGE_SHIFT,
+                min( (unsigned long)pChunk->Size, vma->vm_end - VaNext ),
+                vma->vm_page_prot
+                );
+
+        if (rc != 0)
+        {
+            ErrorPrintf((
+                "ERROR - Unable to map scatter chunk (%08llx) ==> User space\n",
+                pChunk->CpuPhysical
+                ));
+            PlxScatterMemoryPut( pdx, pScatter );
+            return rc;
+        }
+
+        VaNext += pChunk->Size;
+        pEntry  = pEntry->next;
+    }
+
+    DebugPrintf((
+        "Mapped scatter buffer ==> User VA (%08lx)\n",
+        vma->vm_start
+        ));
+
+    PlxScatterMemoryPut( pdx, pScatter );
+
+    return 0;
 }
 
 
@@ -795,6 +1264,106 @@ PlxDmaChannelCleanup(
 
 
 
+/*******************************************************************************
+ *
+ * Function   :  PlxDmaChannelVerify
+ *
+ * Description:  Verifies a DMA channel number &, if requested, its owner
+ *
+ * Note       :  No registers are accessed.  Whether the channel is enabled in
+ *               hardware is verified once when the channel is opened.
+ *
+ ******************************************************************************/
+PLX_STATUS
+PlxDmaChannelVerify(
+    DEVICE_EXTENSION *pdx,
+    U8                channel,
+    VOID             *pOwner
+    )
+{
+    // Verify valid DMA channel
+    if (channel >= pdx->NumDmaChannels)
+    {
+        DebugPrintf((
+            "ERROR - Channel %d exceeds max supported (%d)\n",
+            channel, (pdx->NumDmaChannels - 1)
+            ));
+        return PLX_STATUS_INVALID_ACCESS;
+    }
+
+    // Verify ownership if requested
+    if (pOwner != NULL)
+    {
+        // Verify DMA has been opened
+        if (pdx->DmaInfo[channel].bOpen == FALSE)
+        {
+            DebugPrintf(("ERROR - DMA channel has not been opened\n"));
+            return PLX_STATUS_INVALID_ACCESS;
+        }
+
+        // Verify owner
+        if (pdx->DmaInfo[channel].pOwner != pOwner)
+        {
+            DebugPrintf(("ERROR - DMA owned by different process\n"));
+            return PLX_STATUS_IN_USE;
+        }
+    }
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxDmaChannelIdle
+ *
+ * Description:  Determines whether a DMA channel is idle with a single read
+ *
+ * Note       :  The DMA control/status value is optionally returned so callers
+ *               starting a transfer need not read the register again.  Callers
+ *               starting a transfer must hold the channel's DMA lock.
+ *
+ ******************************************************************************/
+PLX_STATUS
+PlxDmaChannelIdle(
+    DEVICE_EXTENSION *pdx,
+    U8                channel,
+    U32              *pRegCtrl
+    )
+{
+    U32 RegValue;
+
+
+    // Get DMA control/status
+    RegValue = PLX_DMA_REG_READ( pdx, 0x200 + (channel * 0x100) + 0x38 );
+
+    if (pRegCtrl != NULL)
+    {
+        *pRegCtrl = RegValue;
+    }
+
+    // Check if DMA is in progress
+    if (RegValue & (1 << 30))
+    {
+        // Check if DMA is paused
+        if (RegValue & (1 << 0))
+        {
+            DebugPrintf(("DMA is paused\n"));
+            return PLX_STATUS_PAUSED;
+        }
+
+        DebugPrintf(("DMA is in-progress\n"));
+        return PLX_STATUS_IN_PROGRESS;
+    }
+
+    return PLX_STATUS_COMPLETE;
+}
+
+
+
+
 /*******************************************************************************
  *
  * Function   :  PlxSglDmaTransferComplete
@@ -812,6 +1381,7 @@ PlxSglDmaTransferComplete(
     U32          i;
     U32          BusAddr;
     U32          BlockSize;
+    U64          TimeStart;
     PLX_UINT_PTR VaSgl;
 
 
@@ -821,6 +1391,9 @@ PlxSglDmaTransferComplete(
         return;
     }
 
+    // Note start time for cleanup latency
+    TimeStart = PlxLatencyTimestamp();
+
     DebugPrintf(("Unlock user-mode buffer used for SGL DMA transfer...\n"));
 
     // Get pointer to SGL list
@@ -878,6 +1451,113 @@ PlxSglDmaTransferComplete(
 
     // Clear the DMA pending flag
     pdx->DmaInfo[channel].bSglPending = FALSE;
+
+    // Record SGL cleanup time
+    PlxLatencyRecord( pdx, PLX_LAT_OP_SGL_COMPLETE, TimeStart );
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxDmaSglStart
+ *
+ * Description:  Programs a DMA channel with an SGL descriptor ring & starts it
+ *
+ * Note       :  The caller must hold the channel's DMA lock, so the channel
+ *               cannot be claimed between its idle check & the start.
+ *
+ ******************************************************************************/
+VOID
+PlxDmaSglStart(
+    DEVICE_EXTENSION *pdx,
+    U8                channel,
+    U64               SglPciAddress,
+    U32               NumDescriptors
+    )
+{
+    U16 OffsetDmaBase;
+    U32 RegValue;
+
+
+    // Make sure DMA descriptors are set to external ([2] = 0), once per open
+    if ((pdx->Key.PlxFamily == PLX_FAMILY_SIRIUS) &&
+        (pdx->DmaInfo[channel].bDescrExternal == FALSE))
+    {
+        RegValue = PLX_DMA_REG_READ( pdx, 0x1FC );
+        PLX_DMA_REG_WRITE( pdx, 0x1FC, RegValue & ~(1 << 2) );
+
+        pdx->DmaInfo[channel].bDescrExternal = TRUE;
+    }
+
+    // Set the channel's base register offset (200h, 300h, etc)
+    OffsetDmaBase = 0x200 + (channel * 0x100);
+
+    // Verify DMA prefetch doesn't exceed descriptor count & is a multiple of 4
+    if (NumDescriptors < 4)
+    {
+        RegValue = 1;
+    }
+    else if (NumDescriptors >= 256)
+    {
+        RegValue = 0;
+    }
+    else
+    {
+        RegValue = (NumDescriptors & (U8)~0x3);
+    }
+    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x34, RegValue );
+
+    // Clear all DMA registers
+    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x00, 0 );
+    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x04, 0 );
+    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x08, 0 );
+    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x0C, 0 );
+    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x10, 0 );
+
+    // Descriptor ring address
+    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x14, PLX_64_LOW_32(SglPciAddress) );
+    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x18, PLX_64_HIGH_32(SglPciAddress) );
+
+    // Current descriptor address
+    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x1C, PLX_64_LOW_32(SglPciAddress) );
+
+    // Descriptor ring size
+    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x20, NumDescriptors );
+
+    // Current descriptor transfer size
+    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x28, 0 );
+
+    // Disable invalid descriptor interrupt (x3C[1])
+    RegValue = PLX_DMA_REG_READ( pdx, OffsetDmaBase + 0x3C );
+    RegValue &= ~(1 << 1);
+    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x3C, RegValue );
+
+    // Get DMA control/status
+    RegValue = PLX_DMA_REG_READ( pdx, OffsetDmaBase + 0x38 );
+
+    // Make sure descriptor write-back ([2]) is disabled
+    RegValue &= ~(1 << 2);
+
+    // Clear any active status bits ([31,12:8])
+    RegValue |= ((1 << 31) | (0x1F << 8));
+
+    // Enable SGL off-chip mode & descriptor fetch stops at end
+    if (pdx->Key.PlxFamily == PLX_FAMILY_SIRIUS)
+    {
+        RegValue |= (1 << 5) | (1 << 4);        // SGL mode (4) & descriptor halt mode (5)
+    }
+    else
+    {
+        RegValue &= ~(3 << 5);
+        RegValue |= (2 << 5) | (1 << 4);        // SGL mode ([6:5]) & descriptor halt mode (4)
+    }
+
+    DebugPrintf(("Start DMA transfer...\n"));
+
+    // Start DMA (x38[3])
+    PLX_DMA_REG_WRITE( pdx, OffsetDmaBase + 0x38, RegValue | (1 << 3) );
 }
 
 
@@ -909,6 +1589,7 @@ PlxLockBufferAndBuildSgl(
     U32          BytesRemaining;
     U64          BusSgl;
     U64          BusAddr;
+    U64          TimeStart;
     U64          PciAddr;
     U64          AddrSrc;
     U64          AddrDest;
@@ -917,6 +1598,9 @@ PlxLockBufferAndBuildSgl(
     PLX_UINT_PTR VaSgl;
 
 
+    // Note start time for SGL build latency
+    TimeStart = PlxLatencyTimestamp();
+
     DebugPrintf(("Build SGL descriptors for buffer...\n"));
     DebugPrintf(("   User VA : %08lX\n", (PLX_UINT_PTR)pDma->UserVa));
     DebugPrintf(("   PCI Addr: %08lX\n", (PLX_UINT_PTR)pDma->PciAddr));
@@ -1230,6 +1914,13 @@ PlxLockBufferAndBuildSgl(
     // Return number of descriptors created
     *pNumDescr = TotalDescr;
 
+    // Update SGL statistics
+    PLX_STAT_ADD( pdx, SglDescriptors, TotalDescr );
+    PLX_STAT_ADD( pdx, PagesPinned, pdx->DmaInfo[channel].NumPages );
+
+    // Record SGL build time
+    PlxLatencyRecord( pdx, PLX_LAT_OP_SGL_BUILD, TimeStart );
+
     return PLX_STATUS_OK;
 }
 
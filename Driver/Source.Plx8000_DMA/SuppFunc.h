@@ -105,6 +105,43 @@ PlxPciPhysicalMemoryFreeAll_ByOwner(
     VOID             *pOwner
     );
 
+VOID
+PlxScatterMemoryDmaStop(
+    DEVICE_EXTENSION       *pdx,
+    PLX_SCATTER_MEM_OBJECT *pScatter
+    );
+
+PLX_SCATTER_MEM_OBJECT*
+PlxScatterMemoryFind(
+    DEVICE_EXTENSION *pdx,
+    U64               Tag
+    );
+
+VOID
+PlxScatterMemoryRelease(
+    DEVICE_EXTENSION       *pdx,
+    PLX_SCATTER_MEM_OBJECT *pScatter
+    );
+
+VOID
+PlxScatterMemoryPut(
+    DEVICE_EXTENSION       *pdx,
+    PLX_SCATTER_MEM_OBJECT *pScatter
+    );
+
+VOID
+PlxScatterSglBuild(
+    DEVICE_EXTENSION       *pdx,
+    PLX_SCATTER_MEM_OBJECT *pScatter,
+    PLX_DMA_PARAMS         *pDma
+    );
+
+int
+PlxScatterMemoryMap(
+    DEVICE_EXTENSION      *pdx,
+    struct vm_area_struct *vma
+    );
+
 VOID*
 Plx_dma_buffer_alloc(
     DEVICE_EXTENSION    *pdx,
@@ -123,12 +160,34 @@ PlxDmaChannelCleanup(
     VOID             *pOwner
     );
 
+PLX_STATUS
+PlxDmaChannelVerify(
+    DEVICE_EXTENSION *pdx,
+    U8                channel,
+    VOID             *pOwner
+    );
+
+PLX_STATUS
+PlxDmaChannelIdle(
+    DEVICE_EXTENSION *pdx,
+    U8                channel,
+    U32              *pRegCtrl
+    );
+
 VOID
 PlxSglDmaTransferComplete(
     DEVICE_EXTENSION *pdx,
     U8                channel
     );
 
+VOID
+PlxDmaSglStart(
+    DEVICE_EXTENSION *pdx,
+    U8                channel,
+    U64               SglPciAddress,
+    U32               NumDescriptors
+    );
+
 PLX_STATUS
 PlxLockBufferAndBuildSgl(
     DEVICE_EXTENSION *pdx,
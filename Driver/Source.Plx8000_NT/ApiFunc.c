@@ -2251,16 +2251,17 @@ PlxNtReqIdProbe(
     U16              *pReqId
     )
 {
-    U8   i;
-    U16  Offset_CapPcie;
-    U16  Offset_CapAer;
-    U32 *pBarVa;
-    U32  RegValue;
-    U32  RegAerMask;
-    U32  RegPciCommand;
-    U32  RegPcieCapCsr;
-    U32  RegAerSeverity;
-    U32  WriteValue;
+    U8          i;
+    U16         Offset_CapPcie;
+    U16         Offset_CapAer;
+    U32        *pBarVa;
+    U32         RegValue;
+    U32         RegAerMask;
+    U32         RegPciCommand;
+    U32         RegPcieCapCsr;
+    U32         RegAerSeverity;
+    U32         WriteValue;
+    PLX_STATUS  status;
 
 
     /*********************************************************
@@ -2285,11 +2286,35 @@ PlxNtReqIdProbe(
      *   - Issue a dummy memory read or write to a PLX register
      *   - Restore settings
      *   - Capture ReqID from the AER TLP header log
+     *
+     * The ReqID doesn't change while the device is present,
+     * so the first successful result is cached & returned
+     * until invalidated. Config accesses may sleep, so probes
+     * are serialized with a mutex to prevent them corrupting
+     * each other's AER settings. The spinlock only guards the
+     * cached values.
      ********************************************************/
 
     // Default to Req ID of 0
     *pReqId = 0;
 
+    // Return cached ReqID if already probed
+    if (PlxNtReqIdCacheGet( pdx, bReadTlp, pReqId ))
+    {
+        return PLX_STATUS_OK;
+    }
+
+    mutex_lock( &(pdx->Mutex_ReqIdProbe) );
+
+    // Another probe may have completed while waiting
+    if (PlxNtReqIdCacheGet( pdx, bReadTlp, pReqId ))
+    {
+        mutex_unlock( &(pdx->Mutex_ReqIdProbe) );
+        return PLX_STATUS_OK;
+    }
+
+    status = PLX_STATUS_OK;
+
     // For newer PLX chips, use the built-in feature for Read ReqID
     if (bReadTlp &&
         ((pdx->Key.PlxFamily == PLX_FAMILY_DRACO_2) ||
@@ -2331,7 +2356,8 @@ PlxNtReqIdProbe(
     if (pBarVa == NULL)
     {
         DebugPrintf(("ERROR - No valid BAR space available to use (8500 NT-Virtual)\n"));
-        return PLX_STATUS_UNSUPPORTED;
+        status = PLX_STATUS_UNSUPPORTED;
+        goto _Exit_PlxNtReqIdProbe;
     }
 
     // Set default base offsets for PCIe & AER capabilities
@@ -2391,7 +2417,8 @@ PlxNtReqIdProbe(
     if ((RegValue & (1 << 20)) == 0)
     {
         DebugPrintf(("ERROR - ReqID probe failed, unable to capture error TLP\n"));
-        return PLX_STATUS_FAILED;
+        status = PLX_STATUS_FAILED;
+        goto _Exit_PlxNtReqIdProbe;
     }
 
     // Check if AER header is valid from First Error Pointer ([4:0])
@@ -2415,6 +2442,24 @@ PlxNtReqIdProbe(
 
 _Exit_PlxNtReqIdProbe:
 
+    // Cache successful result
+    if (status == PLX_STATUS_OK)
+    {
+        spin_lock( &(pdx->Lock_ReqIdCache) );
+
+        pdx->ReqIdCache[bReadTlp ? 1 : 0]   = *pReqId;
+        pdx->bReqIdCached[bReadTlp ? 1 : 0] = TRUE;
+
+        spin_unlock( &(pdx->Lock_ReqIdCache) );
+    }
+
+    mutex_unlock( &(pdx->Mutex_ReqIdProbe) );
+
+    if (status != PLX_STATUS_OK)
+    {
+        return status;
+    }
+
     DebugPrintf((
         "Probed %s ReqID = %04X [%02x:%02x.%x]\n",
         (bReadTlp) ? "Read" : "Write", *pReqId,
@@ -2427,6 +2472,74 @@ _Exit_PlxNtReqIdProbe:
 
 
 
+/******************************************************************************
+ *
+ * Function   :  PlxNtReqIdCacheGet
+ *
+ * Description:  Returns a previously probed ReqID if one is cached
+ *
+ *****************************************************************************/
+BOOLEAN
+PlxNtReqIdCacheGet(
+    DEVICE_EXTENSION *pdx,
+    BOOLEAN           bReadTlp,
+    U16              *pReqId
+    )
+{
+    BOOLEAN bCached;
+
+
+    spin_lock( &(pdx->Lock_ReqIdCache) );
+
+    bCached = pdx->bReqIdCached[bReadTlp ? 1 : 0];
+    if (bCached)
+    {
+        *pReqId = pdx->ReqIdCache[bReadTlp ? 1 : 0];
+    }
+
+    spin_unlock( &(pdx->Lock_ReqIdCache) );
+
+    if (bCached)
+    {
+        DebugPrintf((
+            "Cached %s ReqID = %04X\n",
+            (bReadTlp) ? "Read" : "Write", *pReqId
+            ));
+    }
+
+    return bCached;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxNtReqIdCacheInvalidate
+ *
+ * Description:  Discards cached ReqIDs so the next request probes again
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxNtReqIdCacheInvalidate(
+    DEVICE_EXTENSION *pdx
+    )
+{
+    spin_lock( &(pdx->Lock_ReqIdCache) );
+
+    pdx->bReqIdCached[0] = FALSE;
+    pdx->bReqIdCached[1] = FALSE;
+
+    spin_unlock( &(pdx->Lock_ReqIdCache) );
+
+    DebugPrintf(("Invalidated cached NT ReqIDs\n"));
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
 /******************************************************************************
  *
  * Function   :  PlxNtLutProperties
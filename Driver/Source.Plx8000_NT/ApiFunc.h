@@ -294,6 +294,18 @@ PlxNtReqIdProbe(
     U16              *pReqId
     );
 
+BOOLEAN
+PlxNtReqIdCacheGet(
+    DEVICE_EXTENSION *pdx,
+    BOOLEAN           bReadTlp,
+    U16              *pReqId
+    );
+
+PLX_STATUS
+PlxNtReqIdCacheInvalidate(
+    DEVICE_EXTENSION *pdx
+    );
+
 PLX_STATUS
 PlxNtLutProperties(
     DEVICE_EXTENSION *pdx,
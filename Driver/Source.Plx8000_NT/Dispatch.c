@@ -981,6 +981,15 @@ Dispatch_IoControl(
                     );
             break;
 
+        case PLX_IOCTL_NT_REQ_ID_CACHE_INVALIDATE:
+            DebugPrintf_Cont(("PLX_IOCTL_NT_REQ_ID_CACHE_INVALIDATE\n"));
+
+            pIoBuffer->ReturnCode =
+                PlxNtReqIdCacheInvalidate(
+                    pdx
+                    );
+            break;
+
         case PLX_IOCTL_NT_LUT_PROPERTIES:
             DebugPrintf_Cont(("PLX_IOCTL_NT_LUT_PROPERTIES\n"));
 
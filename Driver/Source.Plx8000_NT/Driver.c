@@ -552,6 +552,10 @@ AddDevice(
     INIT_LIST_HEAD( &(pdx->List_PhysicalMem) );
     spin_lock_init( &(pdx->Lock_PhysicalMemList) );
 
+    // Initialize NT ReqID cache lock & probe mutex
+    spin_lock_init( &(pdx->Lock_ReqIdCache) );
+    mutex_init( &(pdx->Mutex_ReqIdProbe) );
+
     // Set buffer allocation mask
     if (Plx_dma_set_coherent_mask( pdx, PLX_DMA_BIT_MASK(32) ) != 0)
     {
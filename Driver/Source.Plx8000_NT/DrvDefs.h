@@ -55,6 +55,7 @@
 #include <linux/fs.h>
 #include <linux/list.h>
 #include <linux/mm.h>
+#include <linux/mutex.h>
 #include <linux/version.h>
 #include <linux/workqueue.h>
 #include "Plx.h"
@@ -263,6 +264,11 @@ typedef struct _DEVICE_EXTENSION
     struct list_head       List_PhysicalMem;              // List of user-allocated physical memory
     spinlock_t             Lock_PhysicalMemList;          // Spinlock for physical memory list
 
+    BOOLEAN                bReqIdCached[2];               // Whether write [0] & read [1] ReqIDs are probed
+    U16                    ReqIdCache[2];                 // Probed write [0] & read [1] ReqIDs
+    spinlock_t             Lock_ReqIdCache;               // Spinlock for cached ReqIDs
+    struct mutex           Mutex_ReqIdProbe;              // Serializes ReqID probes (may sleep)
+
 } DEVICE_EXTENSION; 
 
 
@@ -57,6 +57,7 @@
 #include "PlxChipApi.h"
 #include "PlxChipFn.h"
 #include "PlxInterrupt.h"
+#include "PlxStats.h"
 #include "SuppFunc.h"
 
 
@@ -1456,6 +1457,7 @@ PlxNotificationWait(
             {
                 // Timeout reached
                 DebugPrintf(("Timeout waiting for interrupt\n"));
+                PLX_STAT_INC( pdx, NotifyTimeouts );
                 rc = PLX_STATUS_TIMEOUT;
             }
             else
@@ -50,6 +50,8 @@
 
 #include "PlxChipFn.h"
 #include "PlxInterrupt.h"
+#include "PlxLatency.h"
+#include "PlxStats.h"
 #include "SuppFunc.h"
 
 
@@ -73,12 +75,16 @@ OnInterrupt(
 {
     U32               RegPciInt;
     U32               InterruptSource;
+    U64               TimeStart;
     DEVICE_EXTENSION *pdx;
 
 
     // Get the device extension
     pdx = (DEVICE_EXTENSION *)dev_id;
 
+    // Note start time for ISR latency
+    TimeStart = PlxLatencyTimestamp();
+
     // Disable interrupts and acquire lock 
     spin_lock( &(pdx->Lock_Isr) ); 
 
@@ -100,6 +106,7 @@ OnInterrupt(
     if (RegPciInt == 0xFFFFFFFF)
     {
         spin_unlock( &(pdx->Lock_Isr) );
+        PLX_STAT_INC( pdx, InterruptsSpurious );
         return IRQ_RETVAL(IRQ_NONE);
     }
 
@@ -107,6 +114,7 @@ OnInterrupt(
     if ((RegPciInt & (1 << 6)) == 0)
     {
         spin_unlock( &(pdx->Lock_Isr) );
+        PLX_STAT_INC( pdx, InterruptsSpurious );
         return IRQ_RETVAL(IRQ_NONE);
     }
 
@@ -137,6 +145,7 @@ OnInterrupt(
     if (InterruptSource == INTR_TYPE_NONE)
     {
         spin_unlock( &(pdx->Lock_Isr) );
+        PLX_STAT_INC( pdx, InterruptsSpurious );
         return IRQ_RETVAL(IRQ_NONE);
     }
 
@@ -159,10 +168,19 @@ OnInterrupt(
     // Provide interrupt source to DPC
     pdx->Source_Ints = InterruptSource;
 
+    // Count verified device interrupt
+    PLX_STAT_INC( pdx, Interrupts );
+
+    // Record ISR time for device interrupts
+    PlxLatencyRecord( pdx, PLX_LAT_OP_ISR, TimeStart );
+
     // If device is no longer started, do not schedule a DPC
     if (pdx->State != PLX_STATE_STARTED)
         return IRQ_RETVAL(IRQ_HANDLED);
 
+    // Note DPC queue time, coalesced interrupts are measured from the latest
+    pdx->DpcQueueTime = PlxLatencyTimestamp();
+
     // Add task to system work queue
     schedule_work(
         &(pdx->Task_DpcForIsr)
@@ -192,6 +210,7 @@ DpcForIsr(
     U32                 RegValue;
     PLX_REG_DATA        RegData;
     unsigned long       flags;
+    U64                 TimeStart;
     DEVICE_EXTENSION   *pdx;
     PLX_INTERRUPT_DATA  IntData;
 
@@ -215,6 +234,13 @@ DpcForIsr(
         return;
     }
 
+    // Note start time & record delay since ISR queued the DPC
+    TimeStart = PlxLatencyTimestamp();
+    PlxLatencyRecord( pdx, PLX_LAT_OP_DPC_DELAY, pdx->DpcQueueTime );
+
+    // Count DPC run
+    PLX_STAT_INC( pdx, DpcCount );
+
     // Get interrupt source
     IntData.Source_Ints     = pdx->Source_Ints;
     IntData.Source_Doorbell = 0;
@@ -303,6 +329,9 @@ DpcForIsr(
         pdx
         );
 
+    // Record DPC run time
+    PlxLatencyRecord( pdx, PLX_LAT_OP_DPC, TimeStart );
+
     // Flag a DPC is no longer pending
     pdx->bDpcPending = FALSE;
 }
@@ -51,6 +51,8 @@
 #include "PciFunc.h"
 #include "PlxChipFn.h"
 #include "PlxInterrupt.h"
+#include "PlxLatency.h"
+#include "PlxStats.h"
 #include "SuppFunc.h"
 
 
@@ -75,12 +77,16 @@ OnInterrupt(
     U32               RegValue;
     U32               RegPciInt;
     U32               InterruptSource;
+    U64               TimeStart;
     DEVICE_EXTENSION *pdx;
 
 
     // Get the device extension
     pdx = (DEVICE_EXTENSION *)dev_id;
 
+    // Note start time for ISR latency
+    TimeStart = PlxLatencyTimestamp();
+
     // Disable interrupts and acquire lock 
     spin_lock( &(pdx->Lock_Isr) ); 
 
@@ -95,6 +101,7 @@ OnInterrupt(
     if ((RegPciInt & (1 << 8)) == 0)
     {
         spin_unlock( &(pdx->Lock_Isr) );
+        PLX_STAT_INC( pdx, InterruptsSpurious );
         return IRQ_RETVAL(IRQ_NONE);
     }
 
@@ -179,6 +186,7 @@ OnInterrupt(
     if (InterruptSource == INTR_TYPE_NONE)
     {
         spin_unlock( &(pdx->Lock_Isr) );
+        PLX_STAT_INC( pdx, InterruptsSpurious );
         return IRQ_RETVAL(IRQ_NONE);
     }
 
@@ -201,10 +209,19 @@ OnInterrupt(
     // Provide interrupt source to DPC
     pdx->Source_Ints = InterruptSource;
 
+    // Count verified device interrupt
+    PLX_STAT_INC( pdx, Interrupts );
+
+    // Record ISR time for device interrupts
+    PlxLatencyRecord( pdx, PLX_LAT_OP_ISR, TimeStart );
+
     // If device is no longer started, do not schedule a DPC
     if (pdx->State != PLX_STATE_STARTED)
         return IRQ_RETVAL(IRQ_HANDLED);
 
+    // Note DPC queue time, coalesced interrupts are measured from the latest
+    pdx->DpcQueueTime = PlxLatencyTimestamp();
+
     // Add task to system work queue
     schedule_work(
         &(pdx->Task_DpcForIsr)
@@ -233,6 +250,7 @@ DpcForIsr(
 {
     U32                 RegValue;
     unsigned long       flags;
+    U64                 TimeStart;
     DEVICE_EXTENSION   *pdx;
     PLX_INTERRUPT_DATA  IntData;
 
@@ -256,6 +274,13 @@ DpcForIsr(
         return;
     }
 
+    // Note start time & record delay since ISR queued the DPC
+    TimeStart = PlxLatencyTimestamp();
+    PlxLatencyRecord( pdx, PLX_LAT_OP_DPC_DELAY, pdx->DpcQueueTime );
+
+    // Count DPC run
+    PLX_STAT_INC( pdx, DpcCount );
+
     // Get interrupt source
     IntData.Source_Ints     = pdx->Source_Ints;
     IntData.Source_Doorbell = 0;
@@ -326,6 +351,9 @@ DpcForIsr(
     // DMA Channel 0 interrupt
     if (IntData.Source_Ints & INTR_TYPE_DMA_0)
     {
+        // Count completed transfer (aborts are discarded when requested)
+        PlxStatsDmaDone( pdx, 0, TRUE );
+
         // Get DMA Control/Status
         RegValue =
             PLX_9000_REG_READ(
@@ -359,6 +387,9 @@ DpcForIsr(
     // DMA Channel 1 interrupt
     if (IntData.Source_Ints & INTR_TYPE_DMA_1)
     {
+        // Count completed transfer (aborts are discarded when requested)
+        PlxStatsDmaDone( pdx, 1, TRUE );
+
         // Get DMA Control/Status
         RegValue =
             PLX_9000_REG_READ(
@@ -411,6 +442,9 @@ DpcForIsr(
         pdx
         );
 
+    // Record DPC run time
+    PlxLatencyRecord( pdx, PLX_LAT_OP_DPC, TimeStart );
+
     // Flag a DPC is no longer pending
     pdx->bDpcPending = FALSE;
 }
@@ -51,6 +51,8 @@
 #include "Eep_9000.h"
 #include "PciFunc.h"
 #include "PlxChipApi.h"
+#include "PlxLatency.h"
+#include "PlxStats.h"
 #include "SuppFunc.h"
 
 
@@ -1026,6 +1028,9 @@ PlxChip_DmaControl(
             if (RegValue & ((1 << 4) << shift))
                 return PLX_STATUS_COMPLETE;
 
+            // Transfer will not complete, so is not counted as moved
+            PlxStatsDmaDone( pdx, channel, FALSE );
+
             // Abort the transfer (should cause an interrupt)
             PLX_9000_REG_WRITE(
                 pdx,
@@ -1115,10 +1120,13 @@ PlxChip_DmaTransferBlock(
     VOID             *pOwner
     )
 {
-    U8  shift;
+    U8  RegCmdStat;
     U16 OffsetMode;
     U32 RegValue;
+    U64 TimeStart;
+
 
+    TimeStart = PlxLatencyTimestamp();
 
     // Verify DMA channel & setup register offsets
     switch (channel)
@@ -1143,22 +1151,6 @@ PlxChip_DmaTransferBlock(
         return PLX_STATUS_IN_USE;
     }
 
-    // Set shift for status register
-    shift = (channel * 8);
-
-    // Verify that DMA is not in progress
-    RegValue =
-        PLX_9000_REG_READ(
-            pdx,
-            PCI9656_DMA_COMMAND_STAT
-            );
-
-    if ((RegValue & ((1 << 4) << shift)) == 0)
-    {
-        DebugPrintf(("ERROR - DMA channel is currently active\n"));
-        return PLX_STATUS_IN_PROGRESS;
-    }
-
     spin_lock(
         &(pdx->Lock_Dma[channel])
         );
@@ -1171,6 +1163,21 @@ PlxChip_DmaTransferBlock(
         return PLX_STATUS_INVALID_ACCESS;
     }
 
+    // Verify DMA is not in progress & keep channel control/status to start it
+    // (byte access, register is shared with other channel)
+    RegCmdStat =
+        PLX_9000_REG_READ_8(
+            pdx,
+            PCI9656_DMA_COMMAND_STAT + channel
+            );
+
+    if ((RegCmdStat & (1 << 4)) == 0)
+    {
+        DebugPrintf(("ERROR - DMA channel is currently active\n"));
+        spin_unlock( &(pdx->Lock_Dma[channel]) );
+        return PLX_STATUS_IN_PROGRESS;
+    }
+
     // Get DMA mode
     RegValue =
         PLX_9000_REG_READ(
@@ -1236,31 +1243,23 @@ PlxChip_DmaTransferBlock(
         PLX_64_HIGH_32(pParams->PciAddr)
         );
 
-    // Enable DMA channel
-    RegValue =
-        PLX_9000_REG_READ(
-            pdx,
-            PCI9656_DMA_COMMAND_STAT
-            );
+    DebugPrintf(("Starting DMA transfer...\n"));
 
-    PLX_9000_REG_WRITE(
+    // Note transfer size for statistics once DMA is done
+    PLX_STAT_DMA_START( pdx, channel, pParams->ByteCount );
+
+    // Enable & start DMA in one byte write (register shared with other channel)
+    PLX_9000_REG_WRITE_8(
         pdx,
-        PCI9656_DMA_COMMAND_STAT,
-        RegValue | ((1 << 0) << shift)
+        PCI9656_DMA_COMMAND_STAT + channel,
+        (U8)(RegCmdStat | (1 << 0) | (1 << 1))
         );
 
     spin_unlock(
         &(pdx->Lock_Dma[channel])
         );
 
-    DebugPrintf(("Starting DMA transfer...\n"));
-
-    // Start DMA
-    PLX_9000_REG_WRITE(
-        pdx,
-        PCI9656_DMA_COMMAND_STAT,
-        RegValue | (((1 << 0) | (1 << 1)) << shift)
-        );
+    PlxLatencyRecord( pdx, PLX_LAT_OP_DMA_SUBMIT, TimeStart );
 
     return PLX_STATUS_OK;
 }
@@ -1283,7 +1282,7 @@ PlxChip_DmaTransferUserBuffer(
     VOID             *pOwner
     )
 {
-    U8         shift;
+    U8         RegCmdStat;
     U16        OffsetMode;
     U32        RegValue;
     U32        SglPciAddress;
@@ -1314,22 +1313,6 @@ PlxChip_DmaTransferUserBuffer(
         return PLX_STATUS_IN_USE;
     }
 
-    // Set shift for status register
-    shift = (channel * 8);
-
-    // Verify that DMA is not in progress
-    RegValue =
-        PLX_9000_REG_READ(
-            pdx,
-            PCI9656_DMA_COMMAND_STAT
-            );
-
-    if ((RegValue & ((1 << 4) << shift)) == 0)
-    {
-        DebugPrintf(("ERROR - DMA channel is currently active\n"));
-        return PLX_STATUS_IN_PROGRESS;
-    }
-
     spin_lock(
         &(pdx->Lock_Dma[channel])
         );
@@ -1342,6 +1325,21 @@ PlxChip_DmaTransferUserBuffer(
         return PLX_STATUS_INVALID_ACCESS;
     }
 
+    // Verify DMA is not in progress & keep channel control/status to start it
+    // (byte access, register is shared with other channel)
+    RegCmdStat =
+        PLX_9000_REG_READ_8(
+            pdx,
+            PCI9656_DMA_COMMAND_STAT + channel
+            );
+
+    if ((RegCmdStat & (1 << 4)) == 0)
+    {
+        DebugPrintf(("ERROR - DMA channel is currently active\n"));
+        spin_unlock( &(pdx->Lock_Dma[channel]) );
+        return PLX_STATUS_IN_PROGRESS;
+    }
+
     // Verify an SGL DMA transfer is not pending
     if (pdx->DmaInfo[channel].bSglPending)
     {
@@ -1423,32 +1421,22 @@ PlxChip_DmaTransferUserBuffer(
         SglPciAddress | (1 << 0)
         );
 
-    // Enable DMA channel
-    RegValue =
-        PLX_9000_REG_READ(
-            pdx,
-            PCI9656_DMA_COMMAND_STAT
-            );
+    DebugPrintf(("Starting DMA transfer...\n"));
 
-    PLX_9000_REG_WRITE(
+    // Note transfer size for statistics once DMA is done
+    PLX_STAT_DMA_START( pdx, channel, pParams->ByteCount );
+
+    // Enable & start DMA in one byte write (register shared with other channel)
+    PLX_9000_REG_WRITE_8(
         pdx,
-        PCI9656_DMA_COMMAND_STAT,
-        RegValue | ((1 << 0) << shift)
+        PCI9656_DMA_COMMAND_STAT + channel,
+        (U8)(RegCmdStat | (1 << 0) | (1 << 1))
         );
 
     spin_unlock(
         &(pdx->Lock_Dma[channel])
         );
 
-    DebugPrintf(("Starting DMA transfer...\n"));
-
-    // Start DMA
-    PLX_9000_REG_WRITE(
-        pdx,
-        PCI9656_DMA_COMMAND_STAT,
-        RegValue | (((1 << 0) | (1 << 1)) << shift)
-        );
-
     return PLX_STATUS_OK;
 }
 
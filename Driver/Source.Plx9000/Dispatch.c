@@ -55,6 +55,8 @@
 #include "PciFunc.h"
 #include "PlxChipApi.h"
 #include "PlxIoctl.h"
+#include "PlxLatency.h"
+#include "PlxStats.h"
 #include "SuppFunc.h"
 
 
@@ -350,12 +352,16 @@ Dispatch_IoControl(
     )
 {
     int               status;
+    U64               TimeStart;
     VOID             *pOwner;
     PLX_PARAMS        IoBuffer;
     PLX_PARAMS       *pIoBuffer;
     DEVICE_EXTENSION *pdx;
 
 
+    // Note start time for service latency
+    TimeStart = PlxLatencyTimestamp();
+
     // Get the device extension
     if (iminor(filp->f_path.dentry->d_inode) == PLX_MNGMT_INTERFACE)
     {
@@ -1143,6 +1149,20 @@ Dispatch_IoControl(
             break;
 
 
+        /******************************************
+         * Driver Statistics
+         *****************************************/
+        case PLX_IOCTL_DEVICE_GET_STATS:
+            DebugPrintf_Cont(("PLX_IOCTL_DEVICE_GET_STATS\n"));
+
+            pIoBuffer->ReturnCode =
+                PlxStatsGet(
+                    pdx,
+                    PLX_INT_TO_PTR(pIoBuffer->value[0])
+                    );
+            break;
+
+
         /******************************************
          * Unsupported Messages
          *****************************************/
@@ -1159,6 +1179,12 @@ Dispatch_IoControl(
 _Exit_Dispatch_IoControl:
     DebugPrintf(("...Completed message\n"));
 
+    // Record service time for device messages
+    if (pdx != NULL)
+    {
+        PlxLatencyRecord( pdx, PLX_LAT_OP_IOCTL, TimeStart );
+    }
+
     status =
         copy_to_user(
             (PLX_PARAMS*)args,
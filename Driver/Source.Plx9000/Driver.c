@@ -60,6 +60,8 @@
 #include "PciRegs.h"
 #include "PlxChipFn.h"
 #include "PlxInterrupt.h"
+#include "PlxLatency.h"
+#include "PlxStats.h"
 #include "Plx_sysdep.h"
 #include "SuppFunc.h"
 
@@ -225,6 +227,9 @@ Plx_init_module(
         pGbl_DriverObject->MajorID
         ));
 
+    // Create debugfs directory for device latency histograms
+    PlxLatencyDriverInit( pGbl_DriverObject );
+
     // Register the driver
     status = pci_register_driver( &PlxPciDriver );
     if (status != 0)
@@ -311,6 +316,9 @@ Plx_cleanup_module(
         pci_unregister_driver( &PlxPciDriver );
     }
 
+    // Remove debugfs directory
+    PlxLatencyDriverRelease( pGbl_DriverObject );
+
     DebugPrintf((
         "De-register driver (MajorID = %03d)\n",
         pGbl_DriverObject->MajorID
@@ -570,6 +578,12 @@ AddDevice(
         pDriverObject->DeviceCount
         );
 
+    // Setup latency histograms & debugfs entry
+    PlxLatencyDeviceInit( pdx );
+
+    // Setup statistics sysfs entries
+    PlxStatsDeviceInit( pdx );
+
     // Initialize work queue for ISR DPC queueing
     PLX_INIT_WORK(
         &(pdx->Task_DpcForIsr),
@@ -686,6 +700,12 @@ RemoveDevice(
     // Stop device and release its resources
     StopDevice( fdo );
 
+    // Release latency histograms
+    PlxLatencyDeviceRelease( pdx );
+
+    // Remove statistics sysfs entries
+    PlxStatsDeviceRelease( pdx );
+
     DebugPrintf((
         "Remove: %04X %04X [D%x %02X:%02X.%X] (%s)\n",
         pdx->Key.DeviceId, pdx->Key.VendorId, pdx->Key.domain,
@@ -199,6 +199,18 @@
         (value)                                \
         )
 
+// Byte access for registers shared between DMA channels
+#define PLX_9000_REG_READ_8(pdx, offset) \
+    PHYS_MEM_READ_8(                     \
+        (U8*)((pdx)->pRegVa + (offset))  \
+        )
+
+#define PLX_9000_REG_WRITE_8(pdx, offset, value) \
+    PHYS_MEM_WRITE_8(                            \
+        (U8*)((pdx)->pRegVa + (offset)),         \
+        (value)                                  \
+        )
+
 
 
 // PCI Interrupt wait object
@@ -272,6 +284,55 @@ typedef struct _PLX_REG_DATA
 } PLX_REG_DATA;
 
 
+// Driver operations timed by the latency histograms
+typedef enum _PLX_LAT_OP
+{
+    PLX_LAT_OP_IOCTL,                           // Dispatch_IoControl() service time
+    PLX_LAT_OP_ISR,                             // OnInterrupt() time for device interrupts
+    PLX_LAT_OP_DPC_DELAY,                       // Time from ISR scheduling DPC until it runs
+    PLX_LAT_OP_DPC,                             // DpcForIsr() run time
+    PLX_LAT_OP_SGL_BUILD,                       // PlxLockBufferAndBuildSgl() time
+    PLX_LAT_OP_SGL_COMPLETE,                    // PlxSglDmaTransferComplete() time
+    PLX_LAT_OP_DMA_SUBMIT,                      // DMA block transfer submission time
+    PLX_LAT_OP_COUNT
+} PLX_LAT_OP;
+
+#define PLX_LAT_NUM_BUCKETS                 24  // Number of log2 histogram buckets
+
+
+// Latency histogram for a driver operation
+typedef struct _PLX_LAT_HIST
+{
+    U64 Count;                                  // Number of operations recorded
+    U64 TotalNs;                                // Sum of all latencies
+    U64 MaxNs;                                  // Largest latency seen
+    U32 Bucket[PLX_LAT_NUM_BUCKETS];            // Counts by log2 latency range
+} PLX_LAT_HIST;
+
+
+// Set of latency histograms kept for each CPU
+typedef struct _PLX_LAT_STATS
+{
+    PLX_LAT_HIST Op[PLX_LAT_OP_COUNT];
+} PLX_LAT_STATS;
+
+
+// Device statistics counters, updated atomically & always enabled
+typedef struct _PLX_STATS_COUNTERS
+{
+    atomic64_t DmaBytes[PLX_STATS_MAX_DMA_CHANNELS];     // Bytes transferred per DMA channel
+    atomic64_t DmaTransfers[PLX_STATS_MAX_DMA_CHANNELS]; // Transfers completed per DMA channel
+    atomic64_t DmaPending[PLX_STATS_MAX_DMA_CHANNELS];   // Bytes of transfer in flight, not reported
+    atomic64_t SglDescriptors;                          // SGL descriptors built
+    atomic64_t PagesPinned;                             // User buffer pages locked
+    atomic64_t Interrupts;                              // Device interrupts handled
+    atomic64_t InterruptsSpurious;                      // ISR calls returning IRQ_NONE
+    atomic64_t DpcCount;                                // DPCs run
+    atomic64_t NotifySignalled;                         // Wait objects signalled
+    atomic64_t NotifyTimeouts;                          // Notification waits timed out
+} PLX_STATS_COUNTERS;
+
+
 // All relevant information about the device
 typedef struct _DEVICE_EXTENSION
 {
@@ -298,6 +359,13 @@ typedef struct _DEVICE_EXTENSION
     struct list_head       List_PhysicalMem;              // List of user-allocated physical memory
     spinlock_t             Lock_PhysicalMemList;          // Spinlock for physical memory list
 
+    PLX_LAT_STATS         *pLatStats;                     // Per-CPU operation latency histograms
+    U64                    DpcQueueTime;                  // Time ISR scheduled the pending DPC
+    struct dentry         *pDebugFsDir;                   // Device debugfs directory
+
+    PLX_STATS_COUNTERS     Stats;                         // Device statistics counters
+    BOOLEAN                bStatsSysfs;                   // Flag whether statistics sysfs entries exist
+
 #if defined(PLX_DMA_SUPPORT)
     PLX_DMA_INFO           DmaInfo[NUM_DMA_CHANNELS];     // DMA properties and lock
     spinlock_t             Lock_Dma[NUM_DMA_CHANNELS];
@@ -316,6 +384,7 @@ typedef struct _DRIVER_OBJECT
     U8                      bPciDriverReg;    // Flag whether the driver was registered as PCI
     PLX_PHYS_MEM_OBJECT     CommonBuffer;     // Contiguous memory to be shared by all processes
     struct file_operations  DispatchTable;    // Driver dispatch table
+    struct dentry          *pDebugFsDir;      // Driver debugfs directory
 } DRIVER_OBJECT;
 
 
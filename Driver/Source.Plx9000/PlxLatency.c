@@ -0,0 +1,408 @@
+/*******************************************************************************
+ * Copyright 2013-2019 Broadcom Inc
+ * Copyright (c) 2009 to 2012 PLX Technology Inc.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directorY of this source tree, or the
+ * BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * File Name:
+ *
+ *      PlxLatency.c
+ *
+ * Description:
+ *
+ *      Per-CPU latency histograms for driver operations, exposed through
+ *      debugfs as <debugfs>/<driver>/<device>/latency.  Reading the file
+ *      displays the histograms & writing any value to it resets them.
+ *
+ * Revision History:
+ *
+ *      09-01-19 : PCI/PCIe SDK v8.10
+ *
+ ******************************************************************************/
+
+
+#include <linux/debugfs.h>
+#include <linux/math64.h>
+#include <linux/percpu.h>
+#include <linux/seq_file.h>
+#include "PlxLatency.h"
+
+
+
+
+/**********************************************
+ *               Definitions
+ *********************************************/
+// Latency of first bucket (ns) as power of 2
+#define PLX_LAT_BUCKET_SHIFT            7
+
+// Names of timed operations
+static const char *PlxLatencyOpName[PLX_LAT_OP_COUNT] =
+{
+    "ioctl",
+    "isr",
+    "dpc_delay",
+    "dpc",
+    "sgl_build",
+    "sgl_complete",
+    "dma_submit"
+};
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxLatencyRecord
+ *
+ * Description:  Adds the time elapsed since a timestamp to an operation histogram
+ *
+ * Note       :  Only the ISR histogram is updated from interrupt context & all
+ *               others from process context, so disabling preemption is
+ *               sufficient to protect the per-CPU counters.
+ *
+ ******************************************************************************/
+VOID
+PlxLatencyRecord(
+    DEVICE_EXTENSION *pdx,
+    PLX_LAT_OP        Op,
+    U64               TimeStart
+    )
+{
+    U8             bucket;
+    U64            ElapsedNs;
+    PLX_LAT_HIST  *pHist;
+    PLX_LAT_STATS *pStats;
+
+
+    if (pdx->pLatStats == NULL)
+    {
+        return;
+    }
+
+    ElapsedNs = PlxLatencyTimestamp() - TimeStart;
+
+    // Determine log2 bucket
+    bucket = (U8)fls64( ElapsedNs >> PLX_LAT_BUCKET_SHIFT );
+    if (bucket >= PLX_LAT_NUM_BUCKETS)
+    {
+        bucket = PLX_LAT_NUM_BUCKETS - 1;
+    }
+
+    pStats = get_cpu_ptr( pdx->pLatStats );
+
+    pHist = &(pStats->Op[Op]);
+    pHist->Count++;
+    pHist->TotalNs += ElapsedNs;
+    pHist->Bucket[bucket]++;
+    if (ElapsedNs > pHist->MaxNs)
+    {
+        pHist->MaxNs = ElapsedNs;
+    }
+
+    put_cpu_ptr( pdx->pLatStats );
+}
+
+
+
+
+#if defined(CONFIG_DEBUG_FS)
+/*******************************************************************************
+ *
+ * Function   :  PlxLatency_show
+ *
+ * Description:  Displays the latency histograms summed over all CPUs
+ *
+ ******************************************************************************/
+static int
+PlxLatency_show(
+    struct seq_file *m,
+    void            *v
+    )
+{
+    U8                op;
+    U8                bucket;
+    int               cpu;
+    U64               UpperNs;
+    PLX_LAT_HIST      Hist;
+    PLX_LAT_HIST     *pHist;
+    DEVICE_EXTENSION *pdx;
+
+
+    pdx = m->private;
+
+    for (op = 0; op < PLX_LAT_OP_COUNT; op++)
+    {
+        RtlZeroMemory( &Hist, sizeof(PLX_LAT_HIST) );
+
+        // Sum histograms from each CPU
+        for_each_possible_cpu( cpu )
+        {
+            pHist = &(per_cpu_ptr( pdx->pLatStats, cpu )->Op[op]);
+
+            Hist.Count   += pHist->Count;
+            Hist.TotalNs += pHist->TotalNs;
+            if (pHist->MaxNs > Hist.MaxNs)
+            {
+                Hist.MaxNs = pHist->MaxNs;
+            }
+
+            for (bucket = 0; bucket < PLX_LAT_NUM_BUCKETS; bucket++)
+            {
+                Hist.Bucket[bucket] += pHist->Bucket[bucket];
+            }
+        }
+
+        seq_printf(
+            m,
+            "%s: count=%llu avg_ns=%llu max_ns=%llu\n",
+            PlxLatencyOpName[op], Hist.Count,
+            (Hist.Count == 0) ? 0 : div64_u64( Hist.TotalNs, Hist.Count ),
+            Hist.MaxNs
+            );
+
+        // Display non-empty buckets by upper bound
+        for (bucket = 0; bucket < PLX_LAT_NUM_BUCKETS; bucket++)
+        {
+            if (Hist.Bucket[bucket] != 0)
+            {
+                UpperNs = (U64)1 << (bucket + PLX_LAT_BUCKET_SHIFT);
+
+                if (bucket == (PLX_LAT_NUM_BUCKETS - 1))
+                {
+                    seq_printf( m, "    >= %10llu ns : %u\n", UpperNs >> 1, Hist.Bucket[bucket] );
+                }
+                else
+                {
+                    seq_printf( m, "    <  %10llu ns : %u\n", UpperNs, Hist.Bucket[bucket] );
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxLatency_open
+ *
+ * Description:  Opens the debugfs latency file
+ *
+ ******************************************************************************/
+static int
+PlxLatency_open(
+    struct inode *inode,
+    struct file  *filp
+    )
+{
+    return single_open( filp, PlxLatency_show, inode->i_private );
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxLatency_write
+ *
+ * Description:  Resets the latency histograms on any write
+ *
+ ******************************************************************************/
+static ssize_t
+PlxLatency_write(
+    struct file       *filp,
+    const char __user *buf,
+    size_t             count,
+    loff_t            *ppos
+    )
+{
+    int               cpu;
+    DEVICE_EXTENSION *pdx;
+
+
+    pdx = ((struct seq_file*)filp->private_data)->private;
+
+    for_each_possible_cpu( cpu )
+    {
+        RtlZeroMemory(
+            per_cpu_ptr( pdx->pLatStats, cpu ),
+            sizeof(PLX_LAT_STATS)
+            );
+    }
+
+    DebugPrintf(("Reset latency histograms (%s)\n", pdx->LinkName));
+
+    return count;
+}
+
+
+
+
+// Operations for the debugfs latency file
+static const struct file_operations PlxLatency_fops =
+{
+    .owner   = THIS_MODULE,
+    .open    = PlxLatency_open,
+    .read    = seq_read,
+    .write   = PlxLatency_write,
+    .llseek  = seq_lseek,
+    .release = single_release,
+};
+#endif // CONFIG_DEBUG_FS
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxLatencyDriverInit
+ *
+ * Description:  Creates the driver debugfs directory
+ *
+ ******************************************************************************/
+VOID
+PlxLatencyDriverInit(
+    DRIVER_OBJECT *pDriverObject
+    )
+{
+#if defined(CONFIG_DEBUG_FS)
+    pDriverObject->pDebugFsDir = debugfs_create_dir( PLX_DRIVER_NAME, NULL );
+    if (IS_ERR_OR_NULL( pDriverObject->pDebugFsDir ))
+    {
+        DebugPrintf(("WARNING - Unable to create debugfs directory\n"));
+        pDriverObject->pDebugFsDir = NULL;
+    }
+#endif
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxLatencyDriverRelease
+ *
+ * Description:  Removes the driver debugfs directory
+ *
+ ******************************************************************************/
+VOID
+PlxLatencyDriverRelease(
+    DRIVER_OBJECT *pDriverObject
+    )
+{
+#if defined(CONFIG_DEBUG_FS)
+    debugfs_remove_recursive( pDriverObject->pDebugFsDir );
+    pDriverObject->pDebugFsDir = NULL;
+#endif
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxLatencyDeviceInit
+ *
+ * Description:  Allocates the device latency histograms & debugfs entry
+ *
+ ******************************************************************************/
+VOID
+PlxLatencyDeviceInit(
+    DEVICE_EXTENSION *pdx
+    )
+{
+    // Histograms are optional, so failure only disables recording
+    pdx->pLatStats = alloc_percpu( PLX_LAT_STATS );
+    if (pdx->pLatStats == NULL)
+    {
+        ErrorPrintf(("WARNING - Unable to allocate latency histograms\n"));
+        return;
+    }
+
+#if defined(CONFIG_DEBUG_FS)
+    if (pGbl_DriverObject->pDebugFsDir == NULL)
+    {
+        return;
+    }
+
+    pdx->pDebugFsDir =
+        debugfs_create_dir(
+            pdx->LinkName,
+            pGbl_DriverObject->pDebugFsDir
+            );
+
+    if (IS_ERR_OR_NULL( pdx->pDebugFsDir ))
+    {
+        pdx->pDebugFsDir = NULL;
+        return;
+    }
+
+    debugfs_create_file(
+        "latency",
+        S_IRUGO | S_IWUSR,
+        pdx->pDebugFsDir,
+        pdx,
+        &PlxLatency_fops
+        );
+#endif
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxLatencyDeviceRelease
+ *
+ * Description:  Releases the device latency histograms & debugfs entry
+ *
+ ******************************************************************************/
+VOID
+PlxLatencyDeviceRelease(
+    DEVICE_EXTENSION *pdx
+    )
+{
+#if defined(CONFIG_DEBUG_FS)
+    debugfs_remove_recursive( pdx->pDebugFsDir );
+    pdx->pDebugFsDir = NULL;
+#endif
+
+    if (pdx->pLatStats != NULL)
+    {
+        free_percpu( pdx->pLatStats );
+        pdx->pLatStats = NULL;
+    }
+}
@@ -0,0 +1,334 @@
+/*******************************************************************************
+ * Copyright 2013-2019 Broadcom Inc
+ * Copyright (c) 2009 to 2012 PLX Technology Inc.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directorY of this source tree, or the
+ * BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * File Name:
+ *
+ *      PlxStats.c
+ *
+ * Description:
+ *
+ *      Device statistics counters.  Counters are updated atomically & are
+ *      always enabled.  They are exposed to applications through the
+ *      PLX_IOCTL_DEVICE_GET_STATS message & through sysfs as one file per
+ *      counter in /sys/bus/pci/devices/<device>/plx_stats/.
+ *
+ * Revision History:
+ *
+ *      09-01-19 : PCI/PCIe SDK v8.10
+ *
+ ******************************************************************************/
+
+
+#include <linux/device.h>
+#include <linux/pci.h>
+#include <linux/sysfs.h>
+#include <linux/uaccess.h>  // For copy_to_user()
+#include "PlxStats.h"
+
+
+
+
+/**********************************************
+ *               Definitions
+ *********************************************/
+// Declares a sysfs attribute to display a single device counter
+#define PLX_STATS_ATTR(name, ctr)                                       \
+    static ssize_t                                                      \
+    PlxStats_show_##name(                                               \
+        struct device           *dev,                                   \
+        struct device_attribute *attr,                                  \
+        char                    *buf                                    \
+        )                                                               \
+    {                                                                   \
+        DEVICE_EXTENSION *pdx = dev_get_drvdata( dev );                 \
+                                                                        \
+        return sprintf(                                                 \
+            buf, "%llu\n",                                              \
+            (unsigned long long)atomic64_read( &pdx->Stats.ctr )        \
+            );                                                          \
+    }                                                                   \
+    static DEVICE_ATTR( name, S_IRUGO, PlxStats_show_##name, NULL )
+
+// Declares a sysfs attribute to display a per-channel DMA counter
+#define PLX_STATS_ATTR_DMA(name, ctr)                                   \
+    static ssize_t                                                      \
+    PlxStats_show_##name(                                               \
+        struct device           *dev,                                   \
+        struct device_attribute *attr,                                  \
+        char                    *buf                                    \
+        )                                                               \
+    {                                                                   \
+        DEVICE_EXTENSION *pdx = dev_get_drvdata( dev );                 \
+                                                                        \
+        return PlxStats_ShowChannels( pdx, pdx->Stats.ctr, buf );       \
+    }                                                                   \
+    static DEVICE_ATTR( name, S_IRUGO, PlxStats_show_##name, NULL )
+
+
+
+
+/**********************************************
+ *       Private Function Prototypes
+ *********************************************/
+static ssize_t
+PlxStats_ShowChannels(
+    DEVICE_EXTENSION *pdx,
+    atomic64_t       *pCounter,
+    char             *buf
+    );
+
+
+
+
+/**********************************************
+ *           Sysfs Attributes
+ *********************************************/
+PLX_STATS_ATTR_DMA( dma_bytes,         DmaBytes           );
+PLX_STATS_ATTR_DMA( dma_transfers,     DmaTransfers       );
+PLX_STATS_ATTR( sgl_descriptors,       SglDescriptors     );
+PLX_STATS_ATTR( pages_pinned,          PagesPinned        );
+PLX_STATS_ATTR( interrupts,            Interrupts         );
+PLX_STATS_ATTR( interrupts_spurious,   InterruptsSpurious );
+PLX_STATS_ATTR( dpc_count,             DpcCount           );
+PLX_STATS_ATTR( notify_signalled,      NotifySignalled    );
+PLX_STATS_ATTR( notify_timeouts,       NotifyTimeouts     );
+
+static struct attribute *PlxStats_Attrs[] =
+{
+    &dev_attr_dma_bytes.attr,
+    &dev_attr_dma_transfers.attr,
+    &dev_attr_sgl_descriptors.attr,
+    &dev_attr_pages_pinned.attr,
+    &dev_attr_interrupts.attr,
+    &dev_attr_interrupts_spurious.attr,
+    &dev_attr_dpc_count.attr,
+    &dev_attr_notify_signalled.attr,
+    &dev_attr_notify_timeouts.attr,
+    NULL
+};
+
+static const struct attribute_group PlxStats_Group =
+{
+    .name  = "plx_stats",
+    .attrs = PlxStats_Attrs
+};
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxStats_ShowChannels
+ *
+ * Description:  Displays a per-channel DMA counter, one value per channel
+ *
+ ******************************************************************************/
+static ssize_t
+PlxStats_ShowChannels(
+    DEVICE_EXTENSION *pdx,
+    atomic64_t       *pCounter,
+    char             *buf
+    )
+{
+    U8      channel;
+    ssize_t len;
+
+
+    len = 0;
+
+    for (channel = 0; channel < PLX_STATS_NUM_DMA_CHANNELS(pdx); channel++)
+    {
+        len +=
+            sprintf(
+                buf + len,
+                "%s%llu",
+                (channel == 0) ? "" : " ",
+                (unsigned long long)atomic64_read( &pCounter[channel] )
+                );
+    }
+
+    len += sprintf( buf + len, "\n" );
+
+    return len;
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxStatsGet
+ *
+ * Description:  Copies a snapshot of the device counters to a user buffer
+ *
+ ******************************************************************************/
+PLX_STATUS
+PlxStatsGet(
+    DEVICE_EXTENSION *pdx,
+    VOID             *pUserStats
+    )
+{
+    U8               channel;
+    PLX_DEVICE_STATS Stats;
+
+
+    RtlZeroMemory( &Stats, sizeof(PLX_DEVICE_STATS) );
+
+    for (channel = 0; channel < PLX_STATS_MAX_DMA_CHANNELS; channel++)
+    {
+        Stats.DmaBytes[channel]     = atomic64_read( &pdx->Stats.DmaBytes[channel] );
+        Stats.DmaTransfers[channel] = atomic64_read( &pdx->Stats.DmaTransfers[channel] );
+    }
+
+    Stats.SglDescriptors     = atomic64_read( &pdx->Stats.SglDescriptors );
+    Stats.PagesPinned        = atomic64_read( &pdx->Stats.PagesPinned );
+    Stats.Interrupts         = atomic64_read( &pdx->Stats.Interrupts );
+    Stats.InterruptsSpurious = atomic64_read( &pdx->Stats.InterruptsSpurious );
+    Stats.DpcCount           = atomic64_read( &pdx->Stats.DpcCount );
+    Stats.NotifySignalled    = atomic64_read( &pdx->Stats.NotifySignalled );
+    Stats.NotifyTimeouts     = atomic64_read( &pdx->Stats.NotifyTimeouts );
+
+    if (copy_to_user(
+            pUserStats,
+            &Stats,
+            sizeof(PLX_DEVICE_STATS)
+            ) != 0)
+    {
+        return PLX_STATUS_INVALID_ADDR;
+    }
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxStatsDmaDone
+ *
+ * Description:  Counts the transfer in flight on a channel once it has ended
+ *
+ * Note       :  Called from the DMA done interrupt path.  Bytes are only
+ *               counted if the transfer completed without error or abort.
+ *
+ ******************************************************************************/
+VOID
+PlxStatsDmaDone(
+    DEVICE_EXTENSION *pdx,
+    U8                channel,
+    BOOLEAN           bSuccess
+    )
+{
+    S64 ByteCount;
+
+
+    if (channel >= PLX_STATS_MAX_DMA_CHANNELS)
+    {
+        return;
+    }
+
+    // Claim pending transfer so it is only counted once
+    ByteCount = atomic64_xchg( &pdx->Stats.DmaPending[channel], 0 );
+
+    if ((ByteCount == 0) || (bSuccess == FALSE))
+    {
+        return;
+    }
+
+    PLX_STAT_ADD( pdx, DmaBytes[channel], ByteCount );
+    PLX_STAT_INC( pdx, DmaTransfers[channel] );
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxStatsDeviceInit
+ *
+ * Description:  Creates the device statistics sysfs entries
+ *
+ * Note       :  Counters are zeroed along with the device extension
+ *
+ ******************************************************************************/
+VOID
+PlxStatsDeviceInit(
+    DEVICE_EXTENSION *pdx
+    )
+{
+    // Sysfs handlers locate the device extension through the PCI device
+    pci_set_drvdata( pdx->pPciDevice, pdx );
+
+    // Sysfs entries are optional, so failure does not affect counting
+    if (sysfs_create_group(
+            &pdx->pPciDevice->dev.kobj,
+            &PlxStats_Group
+            ) != 0)
+    {
+        ErrorPrintf(("WARNING - Unable to create statistics sysfs entries\n"));
+        return;
+    }
+
+    pdx->bStatsSysfs = TRUE;
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxStatsDeviceRelease
+ *
+ * Description:  Removes the device statistics sysfs entries
+ *
+ ******************************************************************************/
+VOID
+PlxStatsDeviceRelease(
+    DEVICE_EXTENSION *pdx
+    )
+{
+    if (pdx->bStatsSysfs)
+    {
+        sysfs_remove_group(
+            &pdx->pPciDevice->dev.kobj,
+            &PlxStats_Group
+            );
+
+        pdx->bStatsSysfs = FALSE;
+    }
+
+    pci_set_drvdata( pdx->pPciDevice, NULL );
+}
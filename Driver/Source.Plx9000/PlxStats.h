@@ -0,0 +1,107 @@
+#ifndef __PLX_STATS_H
+#define __PLX_STATS_H
+
+/*******************************************************************************
+ * Copyright 2013-2019 Broadcom Inc
+ * Copyright (c) 2009 to 2012 PLX Technology Inc.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directorY of this source tree, or the
+ * BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * File Name:
+ *
+ *      PlxStats.h
+ *
+ * Description:
+ *
+ *      Header for device statistics counters
+ *
+ * Revision History:
+ *
+ *      09-01-19 : PCI/PCIe SDK v8.10
+ *
+ ******************************************************************************/
+
+
+#include "DrvDefs.h"
+
+
+
+
+/**********************************************
+ *               Definitions
+ *********************************************/
+// Update a device statistics counter
+#define PLX_STAT_INC(pdx, ctr)              atomic64_inc( &(pdx)->Stats.ctr )
+#define PLX_STAT_ADD(pdx, ctr, val)         atomic64_add( (val), &(pdx)->Stats.ctr )
+
+// Note size of a DMA transfer just started, counted by PlxStatsDmaDone()
+#define PLX_STAT_DMA_START(pdx, ch, val)    atomic64_set( &(pdx)->Stats.DmaPending[(ch)], (val) )
+
+// Number of DMA channels reported for the device
+#if defined(PLX_DMA_SUPPORT)
+    #define PLX_STATS_NUM_DMA_CHANNELS(pdx) NUM_DMA_CHANNELS
+#else
+    #define PLX_STATS_NUM_DMA_CHANNELS(pdx) 0
+#endif
+
+
+
+
+/**********************************************
+ *               Functions
+ *********************************************/
+PLX_STATUS
+PlxStatsGet(
+    DEVICE_EXTENSION *pdx,
+    VOID             *pUserStats
+    );
+
+VOID
+PlxStatsDmaDone(
+    DEVICE_EXTENSION *pdx,
+    U8                channel,
+    BOOLEAN           bSuccess
+    );
+
+VOID
+PlxStatsDeviceInit(
+    DEVICE_EXTENSION *pdx
+    );
+
+VOID
+PlxStatsDeviceRelease(
+    DEVICE_EXTENSION *pdx
+    );
+
+
+
+#endif
@@ -58,6 +58,8 @@
 #include "PciFunc.h"
 #include "PciRegs.h"
 #include "PlxChipApi.h"
+#include "PlxLatency.h"
+#include "PlxStats.h"
 #include "SuppFunc.h"
 
 
@@ -196,6 +198,9 @@ PlxSignalNotifications(
             pWaitObject->Source_Ints     |= SourceInt;
             pWaitObject->Source_Doorbell |= SourceDB;
 
+            // Count signalled wait object
+            PLX_STAT_INC( pdx, NotifySignalled );
+
             // Signal wait object
             wake_up_interruptible(
                 &(pWaitObject->WaitQueue)
@@ -787,6 +792,7 @@ PlxSglDmaTransferComplete(
     U32          i;
     U32          BusAddr;
     U32          BlockSize;
+    U64          TimeStart;
     PLX_UINT_PTR VaSgl;
 
 
@@ -796,6 +802,9 @@ PlxSglDmaTransferComplete(
         return;
     }
 
+    // Note start time for cleanup latency
+    TimeStart = PlxLatencyTimestamp();
+
     DebugPrintf(("Unlock user-mode buffer used for SGL DMA transfer...\n"));
 
     // Get pointer to SGL list
@@ -843,6 +852,9 @@ PlxSglDmaTransferComplete(
 
     // Clear the DMA pending flag
     pdx->DmaInfo[channel].bSglPending = FALSE;
+
+    // Record SGL cleanup time
+    PlxLatencyRecord( pdx, PLX_LAT_OP_SGL_COMPLETE, TimeStart );
 }
 
 
@@ -876,11 +888,15 @@ PlxLockBufferAndBuildSgl(
     U32          TotalDescr;
     U32          BytesRemaining;
     U64          BusAddr;
+    U64          TimeStart;
     BOOLEAN      bDirLocalToPci;
     PLX_UINT_PTR VaSgl;
     PLX_UINT_PTR UserVa;
 
 
+    // Note start time for SGL build latency
+    TimeStart = PlxLatencyTimestamp();
+
     DebugPrintf(("Build SGL descriptors for buffer...\n"));
     DebugPrintf(("   User VA   : %08lX\n", (PLX_UINT_PTR)pDma->UserVa));
     DebugPrintf(("   Local Addr: %08X\n", pDma->LocalAddr));
@@ -1196,6 +1212,13 @@ PlxLockBufferAndBuildSgl(
     // Return the physical address of the SGL
     *pSglAddress = BusSglOriginal;
 
+    // Update SGL statistics
+    PLX_STAT_ADD( pdx, SglDescriptors, TotalDescr );
+    PLX_STAT_ADD( pdx, PagesPinned, pdx->DmaInfo[channel].NumPages );
+
+    // Record SGL build time
+    PlxLatencyRecord( pdx, PLX_LAT_OP_SGL_BUILD, TimeStart );
+
     return PLX_STATUS_OK;
 }
 
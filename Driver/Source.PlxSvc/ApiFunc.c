@@ -691,6 +691,89 @@ PlxRegisterWrite(
 
 
 
+/*******************************************************************************
+ *
+ * Function   :  PlxRegisterReadBuffer
+ *
+ * Description:  Reads a block of consecutive mapped PLX registers into a user buffer
+ *
+ ******************************************************************************/
+PLX_STATUS
+PlxRegisterReadBuffer(
+    PLX_DEVICE_NODE *pdx,
+    U32              offset,
+    VOID            *pBuffer,
+    U32              ByteCount
+    )
+{
+    U32        idx;
+    U32        BlockSize;
+    U32       *pKernelBuffer;
+    PLX_STATUS status;
+
+
+    // Make sure offset is aligned on 32-bit boundary
+    if (offset & (3 << 0))
+    {
+        return PLX_STATUS_INVALID_OFFSET;
+    }
+
+    // Only whole registers are copied to the user buffer
+    if (ByteCount & (3 << 0))
+    {
+        return PLX_STATUS_INVALID_SIZE;
+    }
+
+    // Allocate a temporary kernel buffer (zeroed so no stale data can leak)
+    pKernelBuffer = kzalloc( PAGE_SIZE, GFP_KERNEL );
+    if (pKernelBuffer == NULL)
+    {
+        return PLX_STATUS_INSUFFICIENT_RES;
+    }
+
+    status = PLX_STATUS_OK;
+
+    // Transfer data in page-sized blocks
+    while ((ByteCount != 0) && (status == PLX_STATUS_OK))
+    {
+        BlockSize = (ByteCount > PAGE_SIZE) ? PAGE_SIZE : ByteCount;
+
+        for (idx = 0; idx < (BlockSize / sizeof(U32)); idx++)
+        {
+            pKernelBuffer[idx] =
+                PlxRegisterRead(
+                    pdx,
+                    offset + (idx * sizeof(U32)),
+                    &status,
+                    FALSE       // Don't adjust offset based on port
+                    );
+            if (status != PLX_STATUS_OK)
+            {
+                break;
+            }
+        }
+
+        if (status == PLX_STATUS_OK)
+        {
+            if (copy_to_user( pBuffer, pKernelBuffer, BlockSize ) != 0)
+            {
+                status = PLX_STATUS_INVALID_ACCESS;
+            }
+        }
+
+        offset    += BlockSize;
+        pBuffer    = (U8*)pBuffer + BlockSize;
+        ByteCount -= BlockSize;
+    }
+
+    kfree( pKernelBuffer );
+
+    return status;
+}
+
+
+
+
 /*******************************************************************************
  *
  * Function   :  PlxPciBarProperties
@@ -1744,6 +1827,178 @@ PlxEepromWriteByOffset_16(
 
 
 
+/*******************************************************************************
+ *
+ * Function   :  PlxEepromReadBuffer
+ *
+ * Description:  Read a block of data from the EEPROM into a user buffer
+ *
+ ******************************************************************************/
+PLX_STATUS
+PlxEepromReadBuffer(
+    PLX_DEVICE_NODE *pdx,
+    U32              offset,
+    VOID            *pBuffer,
+    U32              ByteCount
+    )
+{
+    U32        BlockSize;
+    U32       *pKernelBuffer;
+    PLX_STATUS status;
+
+
+    // Only 32-bit EEPROM controllers support buffer access
+    if (PlxEepromBufferSupported( pdx ) == FALSE)
+    {
+        return PLX_STATUS_UNSUPPORTED;
+    }
+
+    // Allocate a temporary kernel buffer
+    pKernelBuffer = kmalloc( PAGE_SIZE, GFP_KERNEL );
+    if (pKernelBuffer == NULL)
+    {
+        return PLX_STATUS_INSUFFICIENT_RES;
+    }
+
+    status = PLX_STATUS_OK;
+
+    // Transfer data in page-sized blocks
+    while ((ByteCount != 0) && (status == PLX_STATUS_OK))
+    {
+        BlockSize = (ByteCount > PAGE_SIZE) ? PAGE_SIZE : ByteCount;
+
+        status =
+            Plx8000_EepromReadBuffer(
+                pdx,
+                offset,
+                pKernelBuffer,
+                BlockSize
+                );
+
+        if (status == PLX_STATUS_OK)
+        {
+            if (copy_to_user( pBuffer, pKernelBuffer, BlockSize ) != 0)
+            {
+                status = PLX_STATUS_INVALID_ACCESS;
+            }
+        }
+
+        offset    += BlockSize;
+        pBuffer    = (U8*)pBuffer + BlockSize;
+        ByteCount -= BlockSize;
+    }
+
+    kfree( pKernelBuffer );
+
+    return status;
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxEepromWriteBuffer
+ *
+ * Description:  Write a block of data from a user buffer to the EEPROM
+ *
+ ******************************************************************************/
+PLX_STATUS
+PlxEepromWriteBuffer(
+    PLX_DEVICE_NODE *pdx,
+    U32              offset,
+    VOID            *pBuffer,
+    U32              ByteCount,
+    BOOLEAN          bVerify
+    )
+{
+    U32        BlockSize;
+    U32       *pKernelBuffer;
+    PLX_STATUS status;
+
+
+    // Only 32-bit EEPROM controllers support buffer access
+    if (PlxEepromBufferSupported( pdx ) == FALSE)
+    {
+        return PLX_STATUS_UNSUPPORTED;
+    }
+
+    // Allocate a temporary kernel buffer
+    pKernelBuffer = kmalloc( PAGE_SIZE, GFP_KERNEL );
+    if (pKernelBuffer == NULL)
+    {
+        return PLX_STATUS_INSUFFICIENT_RES;
+    }
+
+    status = PLX_STATUS_OK;
+
+    // Transfer data in page-sized blocks
+    while ((ByteCount != 0) && (status == PLX_STATUS_OK))
+    {
+        BlockSize = (ByteCount > PAGE_SIZE) ? PAGE_SIZE : ByteCount;
+
+        if (copy_from_user( pKernelBuffer, pBuffer, BlockSize ) != 0)
+        {
+            status = PLX_STATUS_INVALID_ACCESS;
+            break;
+        }
+
+        status =
+            Plx8000_EepromWriteBuffer(
+                pdx,
+                offset,
+                pKernelBuffer,
+                BlockSize,
+                bVerify
+                );
+
+        offset    += BlockSize;
+        pBuffer    = (U8*)pBuffer + BlockSize;
+        ByteCount -= BlockSize;
+    }
+
+    kfree( pKernelBuffer );
+
+    return status;
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxEepromBufferSupported
+ *
+ * Description:  Determines whether the device supports EEPROM buffer access
+ *
+ ******************************************************************************/
+BOOLEAN
+PlxEepromBufferSupported(
+    PLX_DEVICE_NODE *pdx
+    )
+{
+    switch (pdx->Key.PlxChip & 0xFF00)
+    {
+        case 0x2300:
+        case 0x3300:
+        case 0x8500:
+        case 0x8600:
+        case 0x8700:
+        case 0x9700:
+            return TRUE;
+    }
+
+    if (pdx->Key.PlxChip == 0x8114)
+    {
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+
+
+
 /*******************************************************************************
  *
  * Function   :  PlxPciIoPortTransfer
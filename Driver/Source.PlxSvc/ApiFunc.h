@@ -108,6 +108,14 @@ PlxRegisterWrite(
     BOOLEAN          bAdjustForPort
     );
 
+PLX_STATUS
+PlxRegisterReadBuffer(
+    PLX_DEVICE_NODE *pdx,
+    U32              offset,
+    VOID            *pBuffer,
+    U32              ByteCount
+    );
+
 PLX_STATUS
 PlxPciBarProperties(
     PLX_DEVICE_NODE  *pdx,
@@ -194,6 +202,28 @@ PlxEepromWriteByOffset_16(
     U16              value
     );
 
+PLX_STATUS
+PlxEepromReadBuffer(
+    PLX_DEVICE_NODE *pdx,
+    U32              offset,
+    VOID            *pBuffer,
+    U32              ByteCount
+    );
+
+PLX_STATUS
+PlxEepromWriteBuffer(
+    PLX_DEVICE_NODE *pdx,
+    U32              offset,
+    VOID            *pBuffer,
+    U32              ByteCount,
+    BOOLEAN          bVerify
+    );
+
+BOOLEAN
+PlxEepromBufferSupported(
+    PLX_DEVICE_NODE *pdx
+    );
+
 PLX_STATUS
 PlxPciIoPortTransfer(
     U64              IoPort,
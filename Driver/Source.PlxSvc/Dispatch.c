@@ -54,6 +54,7 @@
 #include "Dispatch.h"
 #include "PciFunc.h"
 #include "PlxIoctl.h"
+#include "SpiFlash.h"
 #include "SuppFunc.h"
 
 
@@ -661,6 +662,18 @@ pIoBuffer->ReturnCode = PLX_STATUS_UNSUPPORTED;
                 ));
             break;
 
+        case PLX_IOCTL_MAPPED_REGISTER_READ_BUFFER:
+            DebugPrintf_Cont(("PLX_IOCTL_MAPPED_REGISTER_READ_BUFFER\n"));
+
+            pIoBuffer->ReturnCode =
+                PlxRegisterReadBuffer(
+                    pdx,
+                    (U32)pIoBuffer->value[0],
+                    PLX_INT_TO_PTR(pIoBuffer->value[2]),
+                    (U32)pIoBuffer->value[1]
+                    );
+            break;
+
 
         /******************************************
          * PCI Mapping Functions
@@ -831,6 +844,59 @@ pIoBuffer->ReturnCode = PLX_STATUS_UNSUPPORTED;
                 ));
             break;
 
+        case PLX_IOCTL_EEPROM_READ_BUFFER:
+            DebugPrintf_Cont(("PLX_IOCTL_EEPROM_READ_BUFFER\n"));
+
+            pIoBuffer->ReturnCode =
+                PlxEepromReadBuffer(
+                    pdx,
+                    (U32)pIoBuffer->value[0],
+                    PLX_INT_TO_PTR(pIoBuffer->value[2]),
+                    (U32)pIoBuffer->value[1]
+                    );
+            break;
+
+        case PLX_IOCTL_EEPROM_WRITE_BUFFER:
+            DebugPrintf_Cont(("PLX_IOCTL_EEPROM_WRITE_BUFFER\n"));
+
+            pIoBuffer->ReturnCode =
+                PlxEepromWriteBuffer(
+                    pdx,
+                    (U32)pIoBuffer->value[0],
+                    PLX_INT_TO_PTR(pIoBuffer->value[2]),
+                    (U32)pIoBuffer->value[1],
+                    (BOOLEAN)pIoBuffer->u.ExData[0]
+                    );
+            break;
+
+
+        /******************************************
+         * SPI Flash Functions
+         *****************************************/
+        case PLX_IOCTL_SPI_FLASH_PAGE_PROGRAM:
+            DebugPrintf_Cont(("PLX_IOCTL_SPI_FLASH_PAGE_PROGRAM\n"));
+
+            pIoBuffer->ReturnCode =
+                Spi_PageProgram(
+                    pdx,
+                    &(pIoBuffer->u.SpiProp),
+                    (U32)pIoBuffer->value[0],
+                    PLX_INT_TO_PTR(pIoBuffer->value[2]),
+                    (U32)pIoBuffer->value[1]
+                    );
+            break;
+
+        case PLX_IOCTL_SPI_FLASH_WAIT_WRITE_DONE:
+            DebugPrintf_Cont(("PLX_IOCTL_SPI_FLASH_WAIT_WRITE_DONE\n"));
+
+            pIoBuffer->ReturnCode =
+                Spi_WaitWriteComplete(
+                    pdx,
+                    &(pIoBuffer->u.SpiProp),
+                    (U32)pIoBuffer->value[0]
+                    );
+            break;
+
 
         /******************************************
          * I/O Port Access Functions
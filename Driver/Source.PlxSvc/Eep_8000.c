@@ -779,6 +779,361 @@ Plx8000_EepromWriteByOffset_16(
 
 
 
+/******************************************************************************
+ *
+ * Function   :  Plx8000_EepromReadBuffer
+ *
+ * Description:  Read a block of 32-bit values from the EEPROM
+ *
+ * Note       :  Reads do not make the EEPROM busy, so the controller idle
+ *               check is only performed once for the entire buffer.
+ *
+ ******************************************************************************/
+PLX_STATUS
+Plx8000_EepromReadBuffer(
+    PLX_DEVICE_NODE *pdx,
+    U32              offset,
+    U32             *pBuffer,
+    U32              ByteCount
+    )
+{
+    U16        OffsetCtrl;
+    U32        i;
+    U32        RegCmd;
+    U32        EepWidth;
+    U32        UpperAddr;
+    PLX_STATUS status;
+
+
+    // Get EEPROM control register offset
+    OffsetCtrl = Plx8000_EepromGetCtrlOffset( pdx );
+
+    // Verify access is supported
+    if (OffsetCtrl == 0x0)
+    {
+        return PLX_STATUS_UNSUPPORTED;
+    }
+
+    // Wait until EEPROM is ready
+    if (Plx8000_EepromWaitIdle( pdx ) == FALSE)
+    {
+        return PLX_STATUS_TIMEOUT;
+    }
+
+    // Get base command & verify range is addressable
+    status =
+        Plx8000_EepromBufferSetup(
+            pdx,
+            offset,
+            ByteCount,
+            &RegCmd,
+            &EepWidth
+            );
+
+    if (status != PLX_STATUS_OK)
+    {
+        return status;
+    }
+
+    // Force upper address byte update on first access
+    UpperAddr = (U32)-1;
+
+    for (i = 0; i < (ByteCount / sizeof(U32)); i++)
+    {
+        // For 3-byte addressing, set upper byte only when it changes
+        if ((EepWidth == 3) && (((offset >> 16) & 0xFF) != UpperAddr))
+        {
+            UpperAddr = (offset >> 16) & 0xFF;
+            Plx8000_EepromSetUpperAddress( pdx, OffsetCtrl, UpperAddr );
+        }
+
+        // Send EEPROM read command
+        if (Plx8000_EepromSendCommand(
+                pdx,
+                RegCmd |
+                ((((offset / sizeof(U32)) >>  0) & 0x1FFF) <<  0) |   // Bits [12:0] of index
+                ((((offset / sizeof(U32)) >> 13) & 1)      << 20) |   // Bit 13 of index
+                (PLX8000_EE_CMD_READ                       << 13)     // EEPROM command
+                ) == FALSE)
+        {
+            return PLX_STATUS_TIMEOUT;
+        }
+
+        // Get EEPROM data (x264h)
+        pBuffer[i] = PLX_8000_REG_READ( pdx, OffsetCtrl + 0x4 );
+
+        offset += sizeof(U32);
+    }
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Plx8000_EepromWriteBuffer
+ *
+ * Description:  Write a block of 32-bit values to the EEPROM & optionally verify
+ *
+ * Note       :  The EEPROM controller only transfers a single 32-bit value per
+ *               write command, so each value still incurs an EEPROM write cycle.
+ *               The controller setup is performed once for the entire buffer.
+ *
+ ******************************************************************************/
+PLX_STATUS
+Plx8000_EepromWriteBuffer(
+    PLX_DEVICE_NODE *pdx,
+    U32              offset,
+    U32             *pBuffer,
+    U32              ByteCount,
+    BOOLEAN          bVerify
+    )
+{
+    U16        OffsetCtrl;
+    U32        i;
+    U32        j;
+    U32        count;
+    U32        RegCmd;
+    U32        EepWidth;
+    U32        UpperAddr;
+    U32        OffsetStart;
+    U32        Verify_Value[PLX8000_EE_VERIFY_COUNT];
+    PLX_STATUS status;
+
+
+    // Get EEPROM control register offset
+    OffsetCtrl = Plx8000_EepromGetCtrlOffset( pdx );
+
+    // Verify access is supported
+    if (OffsetCtrl == 0x0)
+    {
+        return PLX_STATUS_UNSUPPORTED;
+    }
+
+    // Wait until EEPROM is ready
+    if (Plx8000_EepromWaitIdle( pdx ) == FALSE)
+    {
+        return PLX_STATUS_TIMEOUT;
+    }
+
+    // Get base command & verify range is addressable
+    status =
+        Plx8000_EepromBufferSetup(
+            pdx,
+            offset,
+            ByteCount,
+            &RegCmd,
+            &EepWidth
+            );
+
+    if (status != PLX_STATUS_OK)
+    {
+        return status;
+    }
+
+    OffsetStart = offset;
+
+    // Force upper address byte update on first access
+    UpperAddr = (U32)-1;
+
+    for (i = 0; i < (ByteCount / sizeof(U32)); i++)
+    {
+        // Wait for previous write cycle to complete
+        if ((i != 0) && (Plx8000_EepromWaitIdle( pdx ) == FALSE))
+        {
+            return PLX_STATUS_TIMEOUT;
+        }
+
+        // For 3-byte addressing, set upper byte only when it changes
+        if ((EepWidth == 3) && (((offset >> 16) & 0xFF) != UpperAddr))
+        {
+            UpperAddr = (offset >> 16) & 0xFF;
+            Plx8000_EepromSetUpperAddress( pdx, OffsetCtrl, UpperAddr );
+        }
+
+        // Send EEPROM write enable command
+        Plx8000_EepromSendCommand(
+            pdx,
+            RegCmd | (PLX8000_EE_CMD_WRITE_ENABLE << 13)
+            );
+
+        // Prepare EEPROM data (264h)
+        PLX_8000_REG_WRITE( pdx, OffsetCtrl + 0x4, pBuffer[i] );
+
+        // Send EEPROM write command
+        if (Plx8000_EepromSendCommand(
+                pdx,
+                RegCmd |
+                ((((offset / sizeof(U32)) >>  0) & 0x1FFF) <<  0) |   // Bits [12:0] of index
+                ((((offset / sizeof(U32)) >> 13) & 1)      << 20) |   // Bit 13 of index
+                (PLX8000_EE_CMD_WRITE                      << 13)     // EEPROM command
+                ) == FALSE)
+        {
+            return PLX_STATUS_TIMEOUT;
+        }
+
+        offset += sizeof(U32);
+    }
+
+    if (bVerify == FALSE)
+    {
+        return PLX_STATUS_OK;
+    }
+
+    // Read back values in groups & compare
+    for (i = 0; i < (ByteCount / sizeof(U32)); i += count)
+    {
+        count = (ByteCount / sizeof(U32)) - i;
+        if (count > PLX8000_EE_VERIFY_COUNT)
+        {
+            count = PLX8000_EE_VERIFY_COUNT;
+        }
+
+        status =
+            Plx8000_EepromReadBuffer(
+                pdx,
+                OffsetStart + (i * sizeof(U32)),
+                Verify_Value,
+                count * sizeof(U32)
+                );
+
+        if (status != PLX_STATUS_OK)
+        {
+            return status;
+        }
+
+        for (j = 0; j < count; j++)
+        {
+            if (Verify_Value[j] != pBuffer[i + j])
+            {
+                DebugPrintf((
+                    "ERROR - Verify failed at offset %02Xh (wrote %08X, read %08X)\n",
+                    (int)(OffsetStart + ((i + j) * sizeof(U32))),
+                    (int)pBuffer[i + j], (int)Verify_Value[j]
+                    ));
+                return PLX_STATUS_FAILED;
+            }
+        }
+    }
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Plx8000_EepromBufferSetup
+ *
+ * Description:  Returns the base EEPROM command & address width for a buffer
+ *               access & verifies the entire range is addressable
+ *
+ ******************************************************************************/
+PLX_STATUS
+Plx8000_EepromBufferSetup(
+    PLX_DEVICE_NODE *pdx,
+    U32              offset,
+    U32              ByteCount,
+    U32             *pRegCmd,
+    U32             *pEepWidth
+    )
+{
+    U16 OffsetCtrl;
+    U32 EepWidth;
+    U32 RegValue;
+
+
+    // Verify offset & size are 32-bit aligned
+    if (offset & 0x3)
+    {
+        return PLX_STATUS_INVALID_OFFSET;
+    }
+
+    if ((ByteCount == 0) || (ByteCount & 0x3))
+    {
+        return PLX_STATUS_INVALID_SIZE;
+    }
+
+    // Get EEPROM control register offset
+    OffsetCtrl = Plx8000_EepromGetCtrlOffset( pdx );
+
+    // Get EEPROM control register
+    RegValue = PLX_8000_REG_READ( pdx, OffsetCtrl );
+
+    // Some devices don't report byte addressing
+    if ((pdx->Key.PlxChip == 0x8114) ||
+        (pdx->Key.PlxFamily == PLX_FAMILY_VEGA) ||
+        (pdx->Key.PlxFamily == PLX_FAMILY_VEGA_LITE))
+    {
+        EepWidth = 2;
+    }
+    else
+    {
+        // Determine byte addressing ([23:22])
+        EepWidth = (RegValue >> 22) & 0x3;
+        if (EepWidth == 0)
+        {
+           EepWidth = 1;
+        }
+    }
+
+    // Verify entire buffer doesn't exceed byte addressing
+    if (((U64)offset + ByteCount) > ((U64)1 << (EepWidth * 8)))
+    {
+        DebugPrintf((
+            "ERROR - Range %02Xh-%02Xh exceeds %dB addressing\n",
+            (int)offset, (int)(offset + ByteCount - 1), (int)EepWidth
+            ));
+        return PLX_STATUS_INVALID_OFFSET;
+    }
+
+    // Clear command field [15:13]
+    RegValue &= ~(7 << 13);
+
+    // Clear offset field [20,12:0]
+    RegValue &= ~((1 << 20) | (0x1FFF << 0));
+
+    *pRegCmd   = RegValue;
+    *pEepWidth = EepWidth;
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Plx8000_EepromSetUpperAddress
+ *
+ * Description:  Sets the 3rd address byte used for 3-byte addressing
+ *
+ ******************************************************************************/
+VOID
+Plx8000_EepromSetUpperAddress(
+    PLX_DEVICE_NODE *pdx,
+    U16              OffsetCtrl,
+    U32              UpperAddr
+    )
+{
+    U32 RegUpper;
+
+
+    RegUpper = PLX_8000_REG_READ( pdx, OffsetCtrl + 0xC );
+
+    // Set 3rd address byte (26Ch[7:0])
+    RegUpper &= ~(0xFF << 0);
+    RegUpper |= UpperAddr & 0xFF;
+
+    PLX_8000_REG_WRITE( pdx, OffsetCtrl + 0xC, RegUpper );
+}
+
+
+
+
 /******************************************************************************
  *
  * Function   :  Plx8000_EepromWaitIdle
@@ -938,6 +1293,198 @@ Plx8000_EepromSendCommand(
 
 
 
+/**********************************************************
+ * CRC lookup tables for CONST_CRC_XOR_VALUE (MSB first).
+ * Table [k] holds the CRC of byte n followed by k zero bytes
+ * so 4 bytes can be folded into the CRC per iteration.
+ *********************************************************/
+static const U32 Plx8000_CrcTable[4][256] =
+{
+    {
+        0x00000000, 0xDB710641, 0x6D930AC3, 0xB6E20C82, 0xDB261586, 0x005713C7,
+        0xB6B51F45, 0x6DC41904, 0x6D3D2D4D, 0xB64C2B0C, 0x00AE278E, 0xDBDF21CF,
+        0xB61B38CB, 0x6D6A3E8A, 0xDB883208, 0x00F93449, 0xDA7A5A9A, 0x010B5CDB,
+        0xB7E95059, 0x6C985618, 0x015C4F1C, 0xDA2D495D, 0x6CCF45DF, 0xB7BE439E,
+        0xB74777D7, 0x6C367196, 0xDAD47D14, 0x01A57B55, 0x6C616251, 0xB7106410,
+        0x01F26892, 0xDA836ED3, 0x6F85B375, 0xB4F4B534, 0x0216B9B6, 0xD967BFF7,
+        0xB4A3A6F3, 0x6FD2A0B2, 0xD930AC30, 0x0241AA71, 0x02B89E38, 0xD9C99879,
+        0x6F2B94FB, 0xB45A92BA, 0xD99E8BBE, 0x02EF8DFF, 0xB40D817D, 0x6F7C873C,
+        0xB5FFE9EF, 0x6E8EEFAE, 0xD86CE32C, 0x031DE56D, 0x6ED9FC69, 0xB5A8FA28,
+        0x034AF6AA, 0xD83BF0EB, 0xD8C2C4A2, 0x03B3C2E3, 0xB551CE61, 0x6E20C820,
+        0x03E4D124, 0xD895D765, 0x6E77DBE7, 0xB506DDA6, 0xDF0B66EA, 0x047A60AB,
+        0xB2986C29, 0x69E96A68, 0x042D736C, 0xDF5C752D, 0x69BE79AF, 0xB2CF7FEE,
+        0xB2364BA7, 0x69474DE6, 0xDFA54164, 0x04D44725, 0x69105E21, 0xB2615860,
+        0x048354E2, 0xDFF252A3, 0x05713C70, 0xDE003A31, 0x68E236B3, 0xB39330F2,
+        0xDE5729F6, 0x05262FB7, 0xB3C42335, 0x68B52574, 0x684C113D, 0xB33D177C,
+        0x05DF1BFE, 0xDEAE1DBF, 0xB36A04BB, 0x681B02FA, 0xDEF90E78, 0x05880839,
+        0xB08ED59F, 0x6BFFD3DE, 0xDD1DDF5C, 0x066CD91D, 0x6BA8C019, 0xB0D9C658,
+        0x063BCADA, 0xDD4ACC9B, 0xDDB3F8D2, 0x06C2FE93, 0xB020F211, 0x6B51F450,
+        0x0695ED54, 0xDDE4EB15, 0x6B06E797, 0xB077E1D6, 0x6AF48F05, 0xB1858944,
+        0x076785C6, 0xDC168387, 0xB1D29A83, 0x6AA39CC2, 0xDC419040, 0x07309601,
+        0x07C9A248, 0xDCB8A409, 0x6A5AA88B, 0xB12BAECA, 0xDCEFB7CE, 0x079EB18F,
+        0xB17CBD0D, 0x6A0DBB4C, 0x6567CB95, 0xBE16CDD4, 0x08F4C156, 0xD385C717,
+        0xBE41DE13, 0x6530D852, 0xD3D2D4D0, 0x08A3D291, 0x085AE6D8, 0xD32BE099,
+        0x65C9EC1B, 0xBEB8EA5A, 0xD37CF35E, 0x080DF51F, 0xBEEFF99D, 0x659EFFDC,
+        0xBF1D910F, 0x646C974E, 0xD28E9BCC, 0x09FF9D8D, 0x643B8489, 0xBF4A82C8,
+        0x09A88E4A, 0xD2D9880B, 0xD220BC42, 0x0951BA03, 0xBFB3B681, 0x64C2B0C0,
+        0x0906A9C4, 0xD277AF85, 0x6495A307, 0xBFE4A546, 0x0AE278E0, 0xD1937EA1,
+        0x67717223, 0xBC007462, 0xD1C46D66, 0x0AB56B27, 0xBC5767A5, 0x672661E4,
+        0x67DF55AD, 0xBCAE53EC, 0x0A4C5F6E, 0xD13D592F, 0xBCF9402B, 0x6788466A,
+        0xD16A4AE8, 0x0A1B4CA9, 0xD098227A, 0x0BE9243B, 0xBD0B28B9, 0x667A2EF8,
+        0x0BBE37FC, 0xD0CF31BD, 0x662D3D3F, 0xBD5C3B7E, 0xBDA50F37, 0x66D40976,
+        0xD03605F4, 0x0B4703B5, 0x66831AB1, 0xBDF21CF0, 0x0B101072, 0xD0611633,
+        0xBA6CAD7F, 0x611DAB3E, 0xD7FFA7BC, 0x0C8EA1FD, 0x614AB8F9, 0xBA3BBEB8,
+        0x0CD9B23A, 0xD7A8B47B, 0xD7518032, 0x0C208673, 0xBAC28AF1, 0x61B38CB0,
+        0x0C7795B4, 0xD70693F5, 0x61E49F77, 0xBA959936, 0x6016F7E5, 0xBB67F1A4,
+        0x0D85FD26, 0xD6F4FB67, 0xBB30E263, 0x6041E422, 0xD6A3E8A0, 0x0DD2EEE1,
+        0x0D2BDAA8, 0xD65ADCE9, 0x60B8D06B, 0xBBC9D62A, 0xD60DCF2E, 0x0D7CC96F,
+        0xBB9EC5ED, 0x60EFC3AC, 0xD5E91E0A, 0x0E98184B, 0xB87A14C9, 0x630B1288,
+        0x0ECF0B8C, 0xD5BE0DCD, 0x635C014F, 0xB82D070E, 0xB8D43347, 0x63A53506,
+        0xD5473984, 0x0E363FC5, 0x63F226C1, 0xB8832080, 0x0E612C02, 0xD5102A43,
+        0x0F934490, 0xD4E242D1, 0x62004E53, 0xB9714812, 0xD4B55116, 0x0FC45757,
+        0xB9265BD5, 0x62575D94, 0x62AE69DD, 0xB9DF6F9C, 0x0F3D631E, 0xD44C655F,
+        0xB9887C5B, 0x62F97A1A, 0xD41B7698, 0x0F6A70D9
+    },
+    {
+        0x00000000, 0xCACF972A, 0x4EEE2815, 0x8421BF3F, 0x9DDC502A, 0x5713C700,
+        0xD332783F, 0x19FDEF15, 0xE0C9A615, 0x2A06313F, 0xAE278E00, 0x64E8192A,
+        0x7D15F63F, 0xB7DA6115, 0x33FBDE2A, 0xF9344900, 0x1AE24A6B, 0xD02DDD41,
+        0x540C627E, 0x9EC3F554, 0x873E1A41, 0x4DF18D6B, 0xC9D03254, 0x031FA57E,
+        0xFA2BEC7E, 0x30E47B54, 0xB4C5C46B, 0x7E0A5341, 0x67F7BC54, 0xAD382B7E,
+        0x29199441, 0xE3D6036B, 0x35C494D6, 0xFF0B03FC, 0x7B2ABCC3, 0xB1E52BE9,
+        0xA818C4FC, 0x62D753D6, 0xE6F6ECE9, 0x2C397BC3, 0xD50D32C3, 0x1FC2A5E9,
+        0x9BE31AD6, 0x512C8DFC, 0x48D162E9, 0x821EF5C3, 0x063F4AFC, 0xCCF0DDD6,
+        0x2F26DEBD, 0xE5E94997, 0x61C8F6A8, 0xAB076182, 0xB2FA8E97, 0x783519BD,
+        0xFC14A682, 0x36DB31A8, 0xCFEF78A8, 0x0520EF82, 0x810150BD, 0x4BCEC797,
+        0x52332882, 0x98FCBFA8, 0x1CDD0097, 0xD61297BD, 0x6B8929AC, 0xA146BE86,
+        0x256701B9, 0xEFA89693, 0xF6557986, 0x3C9AEEAC, 0xB8BB5193, 0x7274C6B9,
+        0x8B408FB9, 0x418F1893, 0xC5AEA7AC, 0x0F613086, 0x169CDF93, 0xDC5348B9,
+        0x5872F786, 0x92BD60AC, 0x716B63C7, 0xBBA4F4ED, 0x3F854BD2, 0xF54ADCF8,
+        0xECB733ED, 0x2678A4C7, 0xA2591BF8, 0x68968CD2, 0x91A2C5D2, 0x5B6D52F8,
+        0xDF4CEDC7, 0x15837AED, 0x0C7E95F8, 0xC6B102D2, 0x4290BDED, 0x885F2AC7,
+        0x5E4DBD7A, 0x94822A50, 0x10A3956F, 0xDA6C0245, 0xC391ED50, 0x095E7A7A,
+        0x8D7FC545, 0x47B0526F, 0xBE841B6F, 0x744B8C45, 0xF06A337A, 0x3AA5A450,
+        0x23584B45, 0xE997DC6F, 0x6DB66350, 0xA779F47A, 0x44AFF711, 0x8E60603B,
+        0x0A41DF04, 0xC08E482E, 0xD973A73B, 0x13BC3011, 0x979D8F2E, 0x5D521804,
+        0xA4665104, 0x6EA9C62E, 0xEA887911, 0x2047EE3B, 0x39BA012E, 0xF3759604,
+        0x7754293B, 0xBD9BBE11, 0xD7125358, 0x1DDDC472, 0x99FC7B4D, 0x5333EC67,
+        0x4ACE0372, 0x80019458, 0x04202B67, 0xCEEFBC4D, 0x37DBF54D, 0xFD146267,
+        0x7935DD58, 0xB3FA4A72, 0xAA07A567, 0x60C8324D, 0xE4E98D72, 0x2E261A58,
+        0xCDF01933, 0x073F8E19, 0x831E3126, 0x49D1A60C, 0x502C4919, 0x9AE3DE33,
+        0x1EC2610C, 0xD40DF626, 0x2D39BF26, 0xE7F6280C, 0x63D79733, 0xA9180019,
+        0xB0E5EF0C, 0x7A2A7826, 0xFE0BC719, 0x34C45033, 0xE2D6C78E, 0x281950A4,
+        0xAC38EF9B, 0x66F778B1, 0x7F0A97A4, 0xB5C5008E, 0x31E4BFB1, 0xFB2B289B,
+        0x021F619B, 0xC8D0F6B1, 0x4CF1498E, 0x863EDEA4, 0x9FC331B1, 0x550CA69B,
+        0xD12D19A4, 0x1BE28E8E, 0xF8348DE5, 0x32FB1ACF, 0xB6DAA5F0, 0x7C1532DA,
+        0x65E8DDCF, 0xAF274AE5, 0x2B06F5DA, 0xE1C962F0, 0x18FD2BF0, 0xD232BCDA,
+        0x561303E5, 0x9CDC94CF, 0x85217BDA, 0x4FEEECF0, 0xCBCF53CF, 0x0100C4E5,
+        0xBC9B7AF4, 0x7654EDDE, 0xF27552E1, 0x38BAC5CB, 0x21472ADE, 0xEB88BDF4,
+        0x6FA902CB, 0xA56695E1, 0x5C52DCE1, 0x969D4BCB, 0x12BCF4F4, 0xD87363DE,
+        0xC18E8CCB, 0x0B411BE1, 0x8F60A4DE, 0x45AF33F4, 0xA679309F, 0x6CB6A7B5,
+        0xE897188A, 0x22588FA0, 0x3BA560B5, 0xF16AF79F, 0x754B48A0, 0xBF84DF8A,
+        0x46B0968A, 0x8C7F01A0, 0x085EBE9F, 0xC29129B5, 0xDB6CC6A0, 0x11A3518A,
+        0x9582EEB5, 0x5F4D799F, 0x895FEE22, 0x43907908, 0xC7B1C637, 0x0D7E511D,
+        0x1483BE08, 0xDE4C2922, 0x5A6D961D, 0x90A20137, 0x69964837, 0xA359DF1D,
+        0x27786022, 0xEDB7F708, 0xF44A181D, 0x3E858F37, 0xBAA43008, 0x706BA722,
+        0x93BDA449, 0x59723363, 0xDD538C5C, 0x179C1B76, 0x0E61F463, 0xC4AE6349,
+        0x408FDC76, 0x8A404B5C, 0x7374025C, 0xB9BB9576, 0x3D9A2A49, 0xF755BD63,
+        0xEEA85276, 0x2467C55C, 0xA0467A63, 0x6A89ED49
+    },
+    {
+        0x00000000, 0x7555A0F1, 0xEAAB41E2, 0x9FFEE113, 0x0E278585, 0x7B722574,
+        0xE48CC467, 0x91D96496, 0x1C4F0B0A, 0x691AABFB, 0xF6E44AE8, 0x83B1EA19,
+        0x12688E8F, 0x673D2E7E, 0xF8C3CF6D, 0x8D966F9C, 0x389E1614, 0x4DCBB6E5,
+        0xD23557F6, 0xA760F707, 0x36B99391, 0x43EC3360, 0xDC12D273, 0xA9477282,
+        0x24D11D1E, 0x5184BDEF, 0xCE7A5CFC, 0xBB2FFC0D, 0x2AF6989B, 0x5FA3386A,
+        0xC05DD979, 0xB5087988, 0x713C2C28, 0x04698CD9, 0x9B976DCA, 0xEEC2CD3B,
+        0x7F1BA9AD, 0x0A4E095C, 0x95B0E84F, 0xE0E548BE, 0x6D732722, 0x182687D3,
+        0x87D866C0, 0xF28DC631, 0x6354A2A7, 0x16010256, 0x89FFE345, 0xFCAA43B4,
+        0x49A23A3C, 0x3CF79ACD, 0xA3097BDE, 0xD65CDB2F, 0x4785BFB9, 0x32D01F48,
+        0xAD2EFE5B, 0xD87B5EAA, 0x55ED3136, 0x20B891C7, 0xBF4670D4, 0xCA13D025,
+        0x5BCAB4B3, 0x2E9F1442, 0xB161F551, 0xC43455A0, 0xE2785850, 0x972DF8A1,
+        0x08D319B2, 0x7D86B943, 0xEC5FDDD5, 0x990A7D24, 0x06F49C37, 0x73A13CC6,
+        0xFE37535A, 0x8B62F3AB, 0x149C12B8, 0x61C9B249, 0xF010D6DF, 0x8545762E,
+        0x1ABB973D, 0x6FEE37CC, 0xDAE64E44, 0xAFB3EEB5, 0x304D0FA6, 0x4518AF57,
+        0xD4C1CBC1, 0xA1946B30, 0x3E6A8A23, 0x4B3F2AD2, 0xC6A9454E, 0xB3FCE5BF,
+        0x2C0204AC, 0x5957A45D, 0xC88EC0CB, 0xBDDB603A, 0x22258129, 0x577021D8,
+        0x93447478, 0xE611D489, 0x79EF359A, 0x0CBA956B, 0x9D63F1FD, 0xE836510C,
+        0x77C8B01F, 0x029D10EE, 0x8F0B7F72, 0xFA5EDF83, 0x65A03E90, 0x10F59E61,
+        0x812CFAF7, 0xF4795A06, 0x6B87BB15, 0x1ED21BE4, 0xABDA626C, 0xDE8FC29D,
+        0x4171238E, 0x3424837F, 0xA5FDE7E9, 0xD0A84718, 0x4F56A60B, 0x3A0306FA,
+        0xB7956966, 0xC2C0C997, 0x5D3E2884, 0x286B8875, 0xB9B2ECE3, 0xCCE74C12,
+        0x5319AD01, 0x264C0DF0, 0x1F81B6E1, 0x6AD41610, 0xF52AF703, 0x807F57F2,
+        0x11A63364, 0x64F39395, 0xFB0D7286, 0x8E58D277, 0x03CEBDEB, 0x769B1D1A,
+        0xE965FC09, 0x9C305CF8, 0x0DE9386E, 0x78BC989F, 0xE742798C, 0x9217D97D,
+        0x271FA0F5, 0x524A0004, 0xCDB4E117, 0xB8E141E6, 0x29382570, 0x5C6D8581,
+        0xC3936492, 0xB6C6C463, 0x3B50ABFF, 0x4E050B0E, 0xD1FBEA1D, 0xA4AE4AEC,
+        0x35772E7A, 0x40228E8B, 0xDFDC6F98, 0xAA89CF69, 0x6EBD9AC9, 0x1BE83A38,
+        0x8416DB2B, 0xF1437BDA, 0x609A1F4C, 0x15CFBFBD, 0x8A315EAE, 0xFF64FE5F,
+        0x72F291C3, 0x07A73132, 0x9859D021, 0xED0C70D0, 0x7CD51446, 0x0980B4B7,
+        0x967E55A4, 0xE32BF555, 0x56238CDD, 0x23762C2C, 0xBC88CD3F, 0xC9DD6DCE,
+        0x58040958, 0x2D51A9A9, 0xB2AF48BA, 0xC7FAE84B, 0x4A6C87D7, 0x3F392726,
+        0xA0C7C635, 0xD59266C4, 0x444B0252, 0x311EA2A3, 0xAEE043B0, 0xDBB5E341,
+        0xFDF9EEB1, 0x88AC4E40, 0x1752AF53, 0x62070FA2, 0xF3DE6B34, 0x868BCBC5,
+        0x19752AD6, 0x6C208A27, 0xE1B6E5BB, 0x94E3454A, 0x0B1DA459, 0x7E4804A8,
+        0xEF91603E, 0x9AC4C0CF, 0x053A21DC, 0x706F812D, 0xC567F8A5, 0xB0325854,
+        0x2FCCB947, 0x5A9919B6, 0xCB407D20, 0xBE15DDD1, 0x21EB3CC2, 0x54BE9C33,
+        0xD928F3AF, 0xAC7D535E, 0x3383B24D, 0x46D612BC, 0xD70F762A, 0xA25AD6DB,
+        0x3DA437C8, 0x48F19739, 0x8CC5C299, 0xF9906268, 0x666E837B, 0x133B238A,
+        0x82E2471C, 0xF7B7E7ED, 0x684906FE, 0x1D1CA60F, 0x908AC993, 0xE5DF6962,
+        0x7A218871, 0x0F742880, 0x9EAD4C16, 0xEBF8ECE7, 0x74060DF4, 0x0153AD05,
+        0xB45BD48D, 0xC10E747C, 0x5EF0956F, 0x2BA5359E, 0xBA7C5108, 0xCF29F1F9,
+        0x50D710EA, 0x2582B01B, 0xA814DF87, 0xDD417F76, 0x42BF9E65, 0x37EA3E94,
+        0xA6335A02, 0xD366FAF3, 0x4C981BE0, 0x39CDBB11
+    },
+    {
+        0x00000000, 0x3F036DC2, 0x7E06DB84, 0x4105B646, 0xFC0DB708, 0xC30EDACA,
+        0x820B6C8C, 0xBD08014E, 0x236A6851, 0x1C690593, 0x5D6CB3D5, 0x626FDE17,
+        0xDF67DF59, 0xE064B29B, 0xA16104DD, 0x9E62691F, 0x46D4D0A2, 0x79D7BD60,
+        0x38D20B26, 0x07D166E4, 0xBAD967AA, 0x85DA0A68, 0xC4DFBC2E, 0xFBDCD1EC,
+        0x65BEB8F3, 0x5ABDD531, 0x1BB86377, 0x24BB0EB5, 0x99B30FFB, 0xA6B06239,
+        0xE7B5D47F, 0xD8B6B9BD, 0x8DA9A144, 0xB2AACC86, 0xF3AF7AC0, 0xCCAC1702,
+        0x71A4164C, 0x4EA77B8E, 0x0FA2CDC8, 0x30A1A00A, 0xAEC3C915, 0x91C0A4D7,
+        0xD0C51291, 0xEFC67F53, 0x52CE7E1D, 0x6DCD13DF, 0x2CC8A599, 0x13CBC85B,
+        0xCB7D71E6, 0xF47E1C24, 0xB57BAA62, 0x8A78C7A0, 0x3770C6EE, 0x0873AB2C,
+        0x49761D6A, 0x767570A8, 0xE81719B7, 0xD7147475, 0x9611C233, 0xA912AFF1,
+        0x141AAEBF, 0x2B19C37D, 0x6A1C753B, 0x551F18F9, 0xC02244C9, 0xFF21290B,
+        0xBE249F4D, 0x8127F28F, 0x3C2FF3C1, 0x032C9E03, 0x42292845, 0x7D2A4587,
+        0xE3482C98, 0xDC4B415A, 0x9D4EF71C, 0xA24D9ADE, 0x1F459B90, 0x2046F652,
+        0x61434014, 0x5E402DD6, 0x86F6946B, 0xB9F5F9A9, 0xF8F04FEF, 0xC7F3222D,
+        0x7AFB2363, 0x45F84EA1, 0x04FDF8E7, 0x3BFE9525, 0xA59CFC3A, 0x9A9F91F8,
+        0xDB9A27BE, 0xE4994A7C, 0x59914B32, 0x669226F0, 0x279790B6, 0x1894FD74,
+        0x4D8BE58D, 0x7288884F, 0x338D3E09, 0x0C8E53CB, 0xB1865285, 0x8E853F47,
+        0xCF808901, 0xF083E4C3, 0x6EE18DDC, 0x51E2E01E, 0x10E75658, 0x2FE43B9A,
+        0x92EC3AD4, 0xADEF5716, 0xECEAE150, 0xD3E98C92, 0x0B5F352F, 0x345C58ED,
+        0x7559EEAB, 0x4A5A8369, 0xF7528227, 0xC851EFE5, 0x895459A3, 0xB6573461,
+        0x28355D7E, 0x173630BC, 0x563386FA, 0x6930EB38, 0xD438EA76, 0xEB3B87B4,
+        0xAA3E31F2, 0x953D5C30, 0x5B358FD3, 0x6436E211, 0x25335457, 0x1A303995,
+        0xA73838DB, 0x983B5519, 0xD93EE35F, 0xE63D8E9D, 0x785FE782, 0x475C8A40,
+        0x06593C06, 0x395A51C4, 0x8452508A, 0xBB513D48, 0xFA548B0E, 0xC557E6CC,
+        0x1DE15F71, 0x22E232B3, 0x63E784F5, 0x5CE4E937, 0xE1ECE879, 0xDEEF85BB,
+        0x9FEA33FD, 0xA0E95E3F, 0x3E8B3720, 0x01885AE2, 0x408DECA4, 0x7F8E8166,
+        0xC2868028, 0xFD85EDEA, 0xBC805BAC, 0x8383366E, 0xD69C2E97, 0xE99F4355,
+        0xA89AF513, 0x979998D1, 0x2A91999F, 0x1592F45D, 0x5497421B, 0x6B942FD9,
+        0xF5F646C6, 0xCAF52B04, 0x8BF09D42, 0xB4F3F080, 0x09FBF1CE, 0x36F89C0C,
+        0x77FD2A4A, 0x48FE4788, 0x9048FE35, 0xAF4B93F7, 0xEE4E25B1, 0xD14D4873,
+        0x6C45493D, 0x534624FF, 0x124392B9, 0x2D40FF7B, 0xB3229664, 0x8C21FBA6,
+        0xCD244DE0, 0xF2272022, 0x4F2F216C, 0x702C4CAE, 0x3129FAE8, 0x0E2A972A,
+        0x9B17CB1A, 0xA414A6D8, 0xE511109E, 0xDA127D5C, 0x671A7C12, 0x581911D0,
+        0x191CA796, 0x261FCA54, 0xB87DA34B, 0x877ECE89, 0xC67B78CF, 0xF978150D,
+        0x44701443, 0x7B737981, 0x3A76CFC7, 0x0575A205, 0xDDC31BB8, 0xE2C0767A,
+        0xA3C5C03C, 0x9CC6ADFE, 0x21CEACB0, 0x1ECDC172, 0x5FC87734, 0x60CB1AF6,
+        0xFEA973E9, 0xC1AA1E2B, 0x80AFA86D, 0xBFACC5AF, 0x02A4C4E1, 0x3DA7A923,
+        0x7CA21F65, 0x43A172A7, 0x16BE6A5E, 0x29BD079C, 0x68B8B1DA, 0x57BBDC18,
+        0xEAB3DD56, 0xD5B0B094, 0x94B506D2, 0xABB66B10, 0x35D4020F, 0x0AD76FCD,
+        0x4BD2D98B, 0x74D1B449, 0xC9D9B507, 0xF6DAD8C5, 0xB7DF6E83, 0x88DC0341,
+        0x506ABAFC, 0x6F69D73E, 0x2E6C6178, 0x116F0CBA, 0xAC670DF4, 0x93646036,
+        0xD261D670, 0xED62BBB2, 0x7300D2AD, 0x4C03BF6F, 0x0D060929, 0x320564EB,
+        0x8F0D65A5, 0xB00E0867, 0xF10BBE21, 0xCE08D3E3
+    }
+};
+
+
+
+
 /******************************************************************************
  *
  * Function   :  Plx8000_EepromComputeNextCrc
@@ -951,28 +1498,16 @@ Plx8000_EepromComputeNextCrc(
     U32  NextEepromValue
     )
 {
-    U16 i;
-    U32 XorValue;
-
+    U32 Crc;
 
-    // Step through each bit of the CRC
-    for( i = 0; i < 32; ++i )
-    {
-        // Shift the CRC, XOR'ing in the constant as required
-        XorValue = ((*pCrc ^ (NextEepromValue << i)) & ((U32)1 << 31));
 
-        if (XorValue)
-        {
-            XorValue = CONST_CRC_XOR_VALUE;
-        }
-        else
-        {
-            XorValue = 0;
-        }
+    // Fold the next value into the CRC a byte at a time (slice-by-4)
+    Crc = *pCrc ^ NextEepromValue;
 
-        // XOR to update the CRC
-        *pCrc = (*pCrc << 1) ^ XorValue;
-    }
+    *pCrc = Plx8000_CrcTable[3][(Crc >> 24)       ] ^
+            Plx8000_CrcTable[2][(Crc >> 16) & 0xFF] ^
+            Plx8000_CrcTable[1][(Crc >>  8) & 0xFF] ^
+            Plx8000_CrcTable[0][(Crc      ) & 0xFF];
 }
 
 
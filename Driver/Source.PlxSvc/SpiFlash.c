@@ -0,0 +1,548 @@
+/*******************************************************************************
+ * Copyright 2013-2018 Avago Technologies
+ * Copyright (c) 2009 to 2012 PLX Technology Inc.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directorY of this source tree, or the
+ * BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * File Name:
+ *
+ *      SpiFlash.c
+ *
+ * Description:
+ *
+ *      This file contains SPI flash support functions. Page programs &
+ *      write-in-progress polling are performed in the driver to avoid a
+ *      user/kernel transition for every controller register access.
+ *
+ * Revision History:
+ *
+ *      03-01-20 : PCI/PCIe SDK v8.10
+ *
+ ******************************************************************************/
+
+
+#include <linux/delay.h>    // For msleep()
+#include <linux/slab.h>     // For kmalloc()
+#include <linux/uaccess.h>  // For copy_from_user()
+#include "ApiFunc.h"
+#include "SpiFlash.h"
+#include "SuppFunc.h"
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Spi_PageProgram
+ *
+ * Description:  Programs data from a user buffer into a single flash page &
+ *               waits for the program operation to complete
+ *
+ ******************************************************************************/
+PLX_STATUS
+Spi_PageProgram(
+    PLX_DEVICE_NODE *pdx,
+    PEX_SPI_OBJ     *pSpi,
+    U32              StartOffset,
+    VOID            *pBuffer,
+    U32              ByteCount
+    )
+{
+    U8         cmd[SPI_MAX_CMD_LEN];
+    U8        *pKernelBuffer;
+    U32        pageBytes;
+    PLX_STATUS status;
+
+
+    // 4B addressing not currently supported
+    if (StartOffset & 0xFF000000)
+    {
+        return PLX_STATUS_UNSUPPORTED;
+    }
+
+    if (pSpi->PageSize >= 32)
+    {
+        return PLX_STATUS_INVALID_DATA;
+    }
+
+    pageBytes = (1 << pSpi->PageSize);
+
+    // Data must fit within a single page
+    if ( (ByteCount == 0) || (ByteCount > PAGE_SIZE) ||
+         ((U64)(StartOffset & (pageBytes - 1)) + ByteCount > pageBytes) )
+    {
+        return PLX_STATUS_INVALID_SIZE;
+    }
+
+    // Copy data from user buffer
+    pKernelBuffer = kmalloc( ByteCount, GFP_KERNEL );
+    if (pKernelBuffer == NULL)
+    {
+        return PLX_STATUS_INSUFFICIENT_RES;
+    }
+
+    if (copy_from_user( pKernelBuffer, pBuffer, ByteCount ) != 0)
+    {
+        kfree( pKernelBuffer );
+        return PLX_STATUS_INVALID_ACCESS;
+    }
+
+    // Send WRITE ENABLE command
+    cmd[0] = SPI_FLASH_CMD_WRITE_ENABLE;
+    status =
+        Spi_CmdSendAndReply(
+            pdx,
+            pSpi,
+            SPI_CMD_FLAGS_OP_MORE_CMDS, // WRITE command to follow
+            cmd,
+            sizeof(U8),
+            NULL,       // No reply
+            0
+            );
+    if (status != PLX_STATUS_OK)
+    {
+        goto _Exit_Spi_PageProgram;
+    }
+
+    // Set command based on mode
+    if (pSpi->IoMode == PEX_SPI_IO_MODE_QUAD_IO)
+    {
+        cmd[0] = SPI_FLASH_CMD_3B_WRITE_QUAD_IO;
+    }
+    else
+    {
+        cmd[0] = SPI_FLASH_CMD_3B_WRITE;
+    }
+
+    // Add address
+    cmd[1] = (U8)(StartOffset >> 16);
+    cmd[2] = (U8)(StartOffset >>  8);
+    cmd[3] = (U8)(StartOffset >>  0);
+
+    // Send WRITE command + address
+    status =
+        Spi_CmdSendAndReply(
+            pdx,
+            pSpi,
+            SPI_CMD_FLAGS_OP_MORE_DATA,
+            cmd,
+            sizeof(U8) + (3 * sizeof(U8)),
+            NULL,       // No reply
+            0
+            );
+    if (status != PLX_STATUS_OK)
+    {
+        goto _Exit_Spi_PageProgram;
+    }
+
+    // Send data
+    status =
+        Spi_CmdSendAndReply(
+            pdx,
+            pSpi,
+            SPI_CMD_FLAGS_NONE,
+            pKernelBuffer,
+            ByteCount,
+            NULL,       // No reply
+            0
+            );
+    if (status != PLX_STATUS_OK)
+    {
+        goto _Exit_Spi_PageProgram;
+    }
+
+    // Poll status register to ensure completion
+    status =
+        Spi_WaitWriteComplete(
+            pdx,
+            pSpi,
+            SPI_MAX_WAIT_PAGE_PROG_MS
+            );
+
+_Exit_Spi_PageProgram:
+    kfree( pKernelBuffer );
+
+    return status;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Spi_WaitWriteComplete
+ *
+ * Description:  Polls the flash write-in-progress bit until a program or erase
+ *               operation completes
+ *
+ * Notes      :  Status is first polled back-to-back, then polls back off
+ *               exponentially & sleep, bounded by the given timeout.
+ *
+ ******************************************************************************/
+PLX_STATUS
+Spi_WaitWriteComplete(
+    PLX_DEVICE_NODE *pdx,
+    PEX_SPI_OBJ     *pSpi,
+    U32              Timeout_ms
+    )
+{
+    U32           delayMs;
+    U32           pollCount;
+    PLX_STATUS    status;
+    unsigned long timeout;
+
+
+    // Note end time
+    timeout = jiffies + msecs_to_jiffies( Timeout_ms );
+
+    delayMs   = 0;
+    pollCount = 0;
+
+    while (1)
+    {
+        // Done if operation complete or an error occurs
+        status = Spi_GetStatus( pdx, pSpi );
+        if (status != PLX_STATUS_IN_PROGRESS)
+        {
+            return status;
+        }
+
+        // Verify we don't exceed poll time
+        if (time_after( jiffies, timeout ))
+        {
+            DebugPrintf((
+                "ERROR - Timeout (%dms) waiting for SPI write/erase completion\n",
+                Timeout_ms
+                ));
+            return PLX_STATUS_TIMEOUT;
+        }
+
+        // Back off after initial polls
+        pollCount++;
+        if (pollCount >= SPI_WIP_POLL_SPIN_COUNT)
+        {
+            if (delayMs == 0)
+            {
+                delayMs = 1;
+            }
+            else if (delayMs < SPI_WIP_POLL_MAX_DELAY_MS)
+            {
+                delayMs = delayMs * 2;
+            }
+
+            msleep( delayMs );
+        }
+    }
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Spi_GetStatus
+ *
+ * Description:  Returns whether a flash write/erase operation is in-progress
+ *
+ ******************************************************************************/
+PLX_STATUS
+Spi_GetStatus(
+    PLX_DEVICE_NODE *pdx,
+    PEX_SPI_OBJ     *pSpi
+    )
+{
+    U8         cmd;
+    U8         regVal;
+    PLX_STATUS status;
+
+
+    // Get status register 1
+    cmd = SPI_FLASH_CMD_RD_STATUS_REG_1;
+    status =
+        Spi_CmdSendAndReply(
+            pdx,
+            pSpi,
+            SPI_CMD_FLAGS_NONE,
+            &cmd,
+            sizeof(U8),
+            &regVal,
+            sizeof(U8)
+            );
+    if (status != PLX_STATUS_OK)
+    {
+        return status;
+    }
+
+    if (regVal & SPI_FLASH_REG_SR1_WRITE_IN_PROG)
+    {
+        return PLX_STATUS_IN_PROGRESS;
+    }
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Spi_CmdSendAndReply
+ *
+ * Description:  Sends data to SPI and retrieves read data after, if requested
+ *
+ ******************************************************************************/
+PLX_STATUS
+Spi_CmdSendAndReply(
+    PLX_DEVICE_NODE *pdx,
+    PEX_SPI_OBJ     *pSpi,
+    U8               Flags,
+    U8              *pDataTx,
+    U32              SizeTx,
+    U8              *pDataRx,
+    U32              SizeRx
+    )
+{
+    U32        idx;
+    U32        regVal;
+    U32        byteCount;
+    PLX_STATUS status;
+
+
+    idx = 0;
+
+    while (SizeTx)
+    {
+        // Next transfer size
+        byteCount = PEX_MIN( SizeTx, sizeof(U32) );
+
+        // Adjust bytes remaining
+        SizeTx -= byteCount;
+
+        // Prepare register value
+        regVal = 0;
+        memcpy( &regVal, &pDataTx[idx], byteCount );
+
+        // For 32-bit value, must endian swap
+        if (byteCount == sizeof(U32))
+        {
+            regVal = EndianSwap32( regVal );
+        }
+
+        // Write value in data register
+        status =
+            PlxRegisterWrite(
+                pdx,
+                SPI_REG_ADDR( pSpi, PEX_REG_SPI_MANUAL_WR_DATA ),
+                regVal,
+                FALSE       // Don't adjust offset based on port
+                );
+        if (status != PLX_STATUS_OK)
+        {
+            return status;
+        }
+
+        // Prepare SPI command
+        regVal =
+            PLX_BYTE_TO_BIT_COUNT( byteCount ) << SPI_MAN_CTRL_LEN_SHIFT |
+            pSpi->ChipSel << SPI_MAN_CTRL_CS_SHIFT |
+            SPI_MAN_CTRL_VALID_MASK |
+              SPI_MAN_CTRL_WRITE_OP_MASK;
+
+        // If additional commands coming, put controller into atomic mode
+        if (Flags & SPI_CMD_FLAGS_OP_MORE_CMDS)
+        {
+            regVal |= SPI_MAN_CTRL_ATOMIC_OP_MASK;
+        }
+
+        // Set as last opertion if last write data & no reply requested
+        if ( ((Flags & SPI_CMD_FLAGS_OP_MORE_DATA) == 0) &&
+             (SizeTx == 0) &&
+             ((pDataRx == NULL) || (SizeRx == 0)) )
+        {
+            regVal |= SPI_MAN_CTRL_LAST_MASK;
+        }
+
+        // Send data
+        status =
+            PlxRegisterWrite(
+                pdx,
+                SPI_REG_ADDR( pSpi, PEX_REG_SPI_MANUAL_CTRL_STAT ),
+                regVal,
+                FALSE       // Don't adjust offset based on port
+                );
+        if (status != PLX_STATUS_OK)
+        {
+            return status;
+        }
+
+        // Wait for SPI controller completion
+        status = Spi_WaitControllerReady( pdx, pSpi );
+        if (status != PLX_STATUS_OK)
+        {
+            return status;
+        }
+
+        // Prepare for next transfer
+        idx += byteCount;
+    }
+
+    // Halt if no reply requested
+    if ( (pDataRx == NULL) || (SizeRx == 0) )
+    {
+        return PLX_STATUS_OK;
+    }
+
+    // Read requested reply
+    idx = 0;
+
+    while (SizeRx)
+    {
+        // Next transfer size
+        byteCount = PEX_MIN( SizeRx, sizeof(U32) );
+
+        // Adjust bytes remaining
+        SizeRx -= byteCount;
+
+        // Prepare SPI command
+        regVal =
+            PLX_BYTE_TO_BIT_COUNT( byteCount ) << SPI_MAN_CTRL_LEN_SHIFT |
+            pSpi->ChipSel << SPI_MAN_CTRL_CS_SHIFT |
+            SPI_MAN_CTRL_VALID_MASK;
+
+        // Set as last opertion if last read data
+        if (SizeRx == 0)
+        {
+            regVal |= SPI_MAN_CTRL_LAST_MASK;
+        }
+
+        // Issue read to populate data register
+        status =
+            PlxRegisterWrite(
+                pdx,
+                SPI_REG_ADDR( pSpi, PEX_REG_SPI_MANUAL_CTRL_STAT ),
+                regVal,
+                FALSE       // Don't adjust offset based on port
+                );
+        if (status != PLX_STATUS_OK)
+        {
+            return status;
+        }
+
+        // Wait for SPI controller completion
+        status = Spi_WaitControllerReady( pdx, pSpi );
+        if (status != PLX_STATUS_OK)
+        {
+            return status;
+        }
+
+        // Read data
+        regVal =
+            PlxRegisterRead(
+                pdx,
+                SPI_REG_ADDR( pSpi, PEX_REG_SPI_MANUAL_RD_DATA ),
+                &status,
+                FALSE       // Don't adjust offset based on port
+                );
+        if (status != PLX_STATUS_OK)
+        {
+            return status;
+        }
+
+        // If 32-bit. must endian swap
+        if (byteCount == sizeof(U32))
+        {
+            regVal = EndianSwap32( regVal );
+        }
+
+        // Copy to reply buffer
+        memcpy( &pDataRx[idx], &regVal, byteCount );
+
+        // Prepare for next transfer
+        idx += byteCount;
+    }
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Spi_WaitControllerReady
+ *
+ * Description:  Polls SPI controller until it's ready for next command
+ *
+ ******************************************************************************/
+PLX_STATUS
+Spi_WaitControllerReady(
+    PLX_DEVICE_NODE *pdx,
+    PEX_SPI_OBJ     *pSpi
+    )
+{
+    U32           regVal;
+    PLX_STATUS    status;
+    unsigned long timeout;
+
+
+    // Note end time
+    timeout = jiffies + msecs_to_jiffies( SPI_MAX_WAIT_CTRL_READY_MS );
+
+    // Wait until command valid is clear
+    do
+    {
+        regVal =
+            PlxRegisterRead(
+                pdx,
+                SPI_REG_ADDR( pSpi, PEX_REG_SPI_MANUAL_CTRL_STAT ),
+                &status,
+                FALSE       // Don't adjust offset based on port
+                );
+        if (status != PLX_STATUS_OK)
+        {
+            return status;
+        }
+
+        // Verify we don't exceed poll time
+        if (time_after( jiffies, timeout ))
+        {
+            DebugPrintf((
+                "ERROR - Timeout (%dms) waiting for SPI controller ready\n",
+                SPI_MAX_WAIT_CTRL_READY_MS
+                ));
+            return PLX_STATUS_TIMEOUT;
+        }
+    }
+    while (regVal & SPI_MAN_CTRL_VALID_MASK);
+
+    return PLX_STATUS_OK;
+}
@@ -0,0 +1,158 @@
+#ifndef __SPI_FLASH_H
+#define __SPI_FLASH_H
+
+/*******************************************************************************
+ * Copyright 2013-2015 Avago Technologies
+ * Copyright (c) 2009 to 2012 PLX Technology Inc.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directorY of this source tree, or the
+ * BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * File Name:
+ *
+ *      SpiFlash.h
+ *
+ * Description:
+ *
+ *      The include file for SPI flash support functions
+ *
+ * Revision History:
+ *
+ *      03-01-20 : PCI/PCIe SDK v8.10
+ *
+ ******************************************************************************/
+
+
+#include "DrvDefs.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+
+/**********************************************
+*               Definitions
+**********************************************/
+#define SPI_REG_ADDR( pSpi, offset )        ((pSpi)->CtrlBaseAddr + (offset))
+#define SPI_MAX_CMD_LEN                     (1 + 4) // 1B cmd + 4B addr
+
+// Max time to wait until controller is ready
+#define SPI_MAX_WAIT_CTRL_READY_MS          (1000)
+
+// Max time to wait for a page program to complete
+#define SPI_MAX_WAIT_PAGE_PROG_MS           (100)
+
+// Write-in-progress polling backoff
+#define SPI_WIP_POLL_SPIN_COUNT             8       // Back-to-back polls before delaying
+#define SPI_WIP_POLL_MAX_DELAY_MS           64      // Max delay between polls
+
+// PBAM SPI registers
+#define PEX_REG_SPI_MANUAL_RD_DATA          0x78
+#define PEX_REG_SPI_MANUAL_WR_DATA          0x80
+#define PEX_REG_SPI_MANUAL_CTRL_STAT        0x84
+
+// SPI flash command codes
+#define SPI_FLASH_CMD_3B_WRITE              0x02
+#define SPI_FLASH_CMD_3B_WRITE_QUAD_IO      0x32
+#define SPI_FLASH_CMD_WRITE_ENABLE          0x06
+#define SPI_FLASH_CMD_RD_STATUS_REG_1       0x05
+
+// SPI command additional flags
+#define SPI_CMD_FLAGS_NONE                  0
+#define SPI_CMD_FLAGS_OP_MORE_CMDS          (1 << 0)  // More commands coming for operation
+#define SPI_CMD_FLAGS_OP_MORE_DATA          (1 << 1)  // More data coming for operation
+
+// SPI Manual control reg fields
+#define SPI_MAN_CTRL_LEN_SHIFT              0
+#define SPI_MAN_CTRL_CS_SHIFT               7
+#define SPI_MAN_CTRL_LAST_MASK              ((U32)1 << 11)
+#define SPI_MAN_CTRL_WRITE_OP_MASK          ((U32)1 << 12)
+#define SPI_MAN_CTRL_ATOMIC_OP_MASK         ((U32)1 << 14)
+#define SPI_MAN_CTRL_VALID_MASK             ((U32)1 << 16)
+
+// Status register 1
+#define SPI_FLASH_REG_SR1_WRITE_IN_PROG     (1 << 0)
+
+
+
+
+/**********************************************
+*               Functions
+**********************************************/
+PLX_STATUS
+Spi_PageProgram(
+    PLX_DEVICE_NODE *pdx,
+    PEX_SPI_OBJ     *pSpi,
+    U32              StartOffset,
+    VOID            *pBuffer,
+    U32              ByteCount
+    );
+
+PLX_STATUS
+Spi_WaitWriteComplete(
+    PLX_DEVICE_NODE *pdx,
+    PEX_SPI_OBJ     *pSpi,
+    U32              Timeout_ms
+    );
+
+PLX_STATUS
+Spi_GetStatus(
+    PLX_DEVICE_NODE *pdx,
+    PEX_SPI_OBJ     *pSpi
+    );
+
+PLX_STATUS
+Spi_CmdSendAndReply(
+    PLX_DEVICE_NODE *pdx,
+    PEX_SPI_OBJ     *pSpi,
+    U8               Flags,
+    U8              *pDataTx,
+    U32              SizeTx,
+    U8              *pDataRx,
+    U32              SizeRx
+    );
+
+PLX_STATUS
+Spi_WaitControllerReady(
+    PLX_DEVICE_NODE *pdx,
+    PEX_SPI_OBJ     *pSpi
+    );
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -108,6 +108,15 @@ PlxPci_I2cGetPorts(
     U32          *pI2cPorts
     );
 
+PLX_STATUS EXPORT
+PlxPci_I2cTopologyScan(
+    PLX_API_MODE  ApiMode,
+    U32           ClockRate,
+    U32           CacheTtlSec,
+    U32           I2cPortMask,
+    U32          *pI2cPorts
+    );
+
 
 /******************************************
  *    Query for Information Functions
@@ -180,6 +189,12 @@ PlxPci_DeviceReset(
     PLX_DEVICE_OBJECT *pDevice
     );
 
+PLX_STATUS EXPORT
+PlxPci_DeviceGetStats(
+    PLX_DEVICE_OBJECT *pDevice,
+    PLX_DEVICE_STATS  *pStats
+    );
+
 
 /******************************************
  *        Register Access Functions
@@ -266,6 +281,32 @@ PlxPci_PlxMappedRegisterWrite(
     U32                value
     );
 
+PLX_STATUS EXPORT
+PlxPci_PlxMappedRegisterReadBuffer(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset,
+    VOID              *pBuffer,
+    U32                ByteCount
+    );
+
+PLX_STATUS EXPORT
+PlxPci_PlxRegisterAccessList(
+    PLX_DEVICE_OBJECT *pDevice,
+    PLX_REG_ACCESS    *pList,
+    U32                Count,
+    BOOLEAN            bMapped
+    );
+
+PLX_STATUS EXPORT
+PlxPci_RegisterCacheEnable(
+    BOOLEAN bEnable
+    );
+
+PLX_STATUS EXPORT
+PlxPci_RegisterCacheFlush(
+    PLX_DEVICE_OBJECT *pDevice
+    );
+
 U32 EXPORT
 PlxPci_PlxMailboxRead(
     PLX_DEVICE_OBJECT *pDevice,
@@ -377,6 +418,30 @@ PlxPci_PhysicalMemoryUnmap(
     PLX_PHYSICAL_MEM  *pMemoryInfo
     );
 
+PLX_STATUS EXPORT
+PlxPci_ScatterMemoryAllocate(
+    PLX_DEVICE_OBJECT *pDevice,
+    PLX_SCATTER_MEM   *pScatterMem
+    );
+
+PLX_STATUS EXPORT
+PlxPci_ScatterMemoryFree(
+    PLX_DEVICE_OBJECT *pDevice,
+    PLX_SCATTER_MEM   *pScatterMem
+    );
+
+PLX_STATUS EXPORT
+PlxPci_ScatterMemoryMap(
+    PLX_DEVICE_OBJECT *pDevice,
+    PLX_SCATTER_MEM   *pScatterMem
+    );
+
+PLX_STATUS EXPORT
+PlxPci_ScatterMemoryUnmap(
+    PLX_DEVICE_OBJECT *pDevice,
+    PLX_SCATTER_MEM   *pScatterMem
+    );
+
 PLX_STATUS EXPORT
 PlxPci_CommonBufferProperties(
     PLX_DEVICE_OBJECT *pDevice,
@@ -480,6 +545,13 @@ PlxPci_EepromCrcGet(
     U8                *pCrcStatus
     );
 
+PLX_STATUS EXPORT
+PlxPci_EepromCrcCompute(
+    VOID *pBuffer,
+    U32   ByteCount,
+    U32  *pCrc
+    );
+
 PLX_STATUS EXPORT
 PlxPci_EepromReadByOffset(
     PLX_DEVICE_OBJECT *pDevice,
@@ -508,6 +580,23 @@ PlxPci_EepromWriteByOffset_16(
     U16                value
     );
 
+PLX_STATUS EXPORT
+PlxPci_EepromReadBuffer(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset,
+    VOID              *pBuffer,
+    U32                ByteCount
+    );
+
+PLX_STATUS EXPORT
+PlxPci_EepromWriteBuffer(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset,
+    VOID              *pBuffer,
+    U32                ByteCount,
+    BOOLEAN            bVerify
+    );
+
 
 /******************************************
  *     SPI Flash Functions
@@ -567,6 +656,22 @@ PlxPci_SpiFlashGetStatus(
     PEX_SPI_OBJ       *PtrSpi
     );
 
+PLX_STATUS EXPORT
+PlxPci_SpiFlashPageProgram(
+    PLX_DEVICE_OBJECT *PtrDev,
+    PEX_SPI_OBJ       *PtrSpi,
+    U32                StartOffset,
+    U8                *PtrTxBuff,
+    U32                SizeTx
+    );
+
+PLX_STATUS EXPORT
+PlxPci_SpiFlashWaitWriteComplete(
+    PLX_DEVICE_OBJECT *PtrDev,
+    PEX_SPI_OBJ       *PtrSpi,
+    U32                TimeoutMs
+    );
+
 
 /******************************************
  *          PLX VPD Functions
@@ -639,6 +744,15 @@ PlxPci_DmaTransferUserBuffer(
     U64                Timeout_ms
     );
 
+PLX_STATUS EXPORT
+PlxPci_DmaTransferScatterMemory(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 channel,
+    PLX_SCATTER_MEM   *pScatterMem,
+    PLX_DMA_PARAMS    *pDmaParams,
+    U64                Timeout_ms
+    );
+
 PLX_STATUS EXPORT
 PlxPci_DmaChannelClose(
     PLX_DEVICE_OBJECT *pDevice,
@@ -646,6 +760,123 @@ PlxPci_DmaChannelClose(
     );
 
 
+/******************************************
+ *        Striped DMA Functions
+ *****************************************/
+PLX_STATUS EXPORT
+PlxPci_DmaTransferBlockStriped(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 ChannelMask,
+    PLX_DMA_PARAMS    *pDmaParams,
+    U64                Timeout_ms
+    );
+
+PLX_STATUS EXPORT
+PlxPci_DmaTransferUserBufferStriped(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 ChannelMask,
+    PLX_DMA_PARAMS    *pDmaParams,
+    U64                Timeout_ms
+    );
+
+PLX_STATUS EXPORT
+PlxPci_DmaStatusStriped(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 ChannelMask
+    );
+
+
+/******************************************
+ *     User-space (Bypass) DMA Functions
+ *****************************************/
+PLX_STATUS EXPORT
+PlxPci_UserDmaChannelOpen(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 channel,
+    PLX_DMA_PROP      *pDmaProp
+    );
+
+PLX_STATUS EXPORT
+PlxPci_UserDmaStatus(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 channel
+    );
+
+PLX_STATUS EXPORT
+PlxPci_UserDmaTransferBlock(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 channel,
+    PLX_DMA_PARAMS    *pDmaParams,
+    U64                Timeout_ms
+    );
+
+PLX_STATUS EXPORT
+PlxPci_UserDmaChannelClose(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 channel
+    );
+
+
+/******************************************
+ *       NT Message Ring Functions
+ *****************************************/
+PLX_STATUS EXPORT
+PlxPci_NtMsgRingOpen(
+    PLX_DEVICE_OBJECT    *pDevice,
+    PLX_NT_MSG_RING_PROP *pRingProp
+    );
+
+PLX_STATUS EXPORT
+PlxPci_NtMsgRingSend(
+    PLX_DEVICE_OBJECT *pDevice,
+    VOID              *pMsg,
+    U32                ByteCount,
+    U64                Timeout_ms
+    );
+
+PLX_STATUS EXPORT
+PlxPci_NtMsgRingReceive(
+    PLX_DEVICE_OBJECT *pDevice,
+    VOID              *pMsg,
+    U32               *pByteCount,
+    U64                Timeout_ms
+    );
+
+PLX_STATUS EXPORT
+PlxPci_NtMsgRingClose(
+    PLX_DEVICE_OBJECT *pDevice
+    );
+
+
+/******************************************
+ *          NT DMA Functions
+ *****************************************/
+PLX_STATUS EXPORT
+PlxPci_NtDmaConnect(
+    PLX_DEVICE_OBJECT *pNtDevice,
+    PLX_DEVICE_OBJECT *pDmaDevice,
+    U8                 DmaChannel,
+    PLX_PHYSICAL_MEM  *pLocalBuffer,
+    U64                Timeout_ms,
+    PLX_NT_DMA_TARGET *pTarget
+    );
+
+PLX_STATUS EXPORT
+PlxPci_NtDmaTransfer(
+    PLX_NT_DMA_TARGET *pTarget,
+    U64                LocalAddr,
+    U64                RemoteOffset,
+    U32                ByteCount,
+    BOOLEAN            bRead,
+    U64                Timeout_ms
+    );
+
+PLX_STATUS EXPORT
+PlxPci_NtDmaDisconnect(
+    PLX_NT_DMA_TARGET *pTarget
+    );
+
+
 /******************************************
  *   Performance Monitoring Functions
  *****************************************/
@@ -682,6 +913,14 @@ PlxPci_PerformanceCalcStatistics(
     U32             ElapsedTime_ms
     );
 
+PLX_STATUS EXPORT
+PlxPci_PerformanceCalcStatisticsBatch(
+    PLX_PERF_PROP        *pPerfProps,
+    U8                    NumOfObjects,
+    PLX_PERF_STATS_BATCH *pPerfStats,
+    U32                   ElapsedTime_ms
+    );
+
 
 /******************************************
  *    Multi-Host Switch Functions
@@ -712,6 +951,11 @@ PlxPci_Nt_ReqIdProbe(
     U16               *pReqId
     );
 
+PLX_STATUS EXPORT
+PlxPci_Nt_ReqIdCacheInvalidate(
+    PLX_DEVICE_OBJECT *pDevice
+    );
+
 PLX_STATUS EXPORT
 PlxPci_Nt_LutProperties(
     PLX_DEVICE_OBJECT *pDevice,
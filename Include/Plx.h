@@ -103,6 +103,8 @@ extern "C" {
 #define PERF_MAX_BPS_GEN_2_0             ((U64)500000000)               // 500 MB/s (5 Gbps)
 #define PERF_MAX_BPS_GEN_3_0             ((U64)1000000000)              //   1 GB/s (8 Gbps)
 #define PERF_MAX_BPS_GEN_4_0             ((U64)2000000000)              //   2 GB/s (16 Gbps)
+#define PERF_MAX_BPS_GEN_5_0             ((U64)4000000000)              //   4 GB/s (32 Gbps)
+#define PERF_MAX_BPS_GEN_6_0             ((U64)8000000000)              //   8 GB/s (64 Gbps)
 
 // Endian swap macros
 #define EndianSwap32(value)              ( ((((value) >>  0) & 0xff) << 24) | \
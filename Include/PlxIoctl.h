@@ -85,6 +85,7 @@ typedef struct _PLX_PARAMS
         U64                 ExData[5];
         PLX_INTERRUPT       PlxIntr;
         PLX_PHYSICAL_MEM    PciMemory;
+        PLX_SCATTER_MEM     ScatterMem;
         PLX_PORT_PROP       PortProp;
         PLX_PCI_BAR_PROP    BarProp;
         PLX_DMA_PROP        DmaProp;
@@ -195,7 +196,18 @@ typedef enum _DRIVER_MSGS
     MSG_NT_PROBE_REQ_ID,
     MSG_NT_LUT_PROPERTIES,
     MSG_NT_LUT_ADD,
-    MSG_NT_LUT_DISABLE
+    MSG_NT_LUT_DISABLE,
+    MSG_DEVICE_GET_STATS,
+    MSG_SCATTER_MEM_ALLOCATE,
+    MSG_SCATTER_MEM_FREE,
+    MSG_DMA_TRANSFER_SCATTER_MEM,
+    MSG_EEPROM_READ_BUFFER,
+    MSG_EEPROM_WRITE_BUFFER,
+    MSG_MAPPED_REGISTER_READ_BUFFER,
+    MSG_REGISTER_ACCESS_LIST,
+    MSG_NT_REQ_ID_CACHE_INVALIDATE,
+    MSG_SPI_FLASH_PAGE_PROGRAM,
+    MSG_SPI_FLASH_WAIT_WRITE_DONE
 } DRIVER_MSGS;
 
 
@@ -281,6 +293,19 @@ typedef enum _DRIVER_MSGS
 #define PLX_IOCTL_NT_LUT_ADD                    IOCTL_MSG( MSG_NT_LUT_ADD )
 #define PLX_IOCTL_NT_LUT_DISABLE                IOCTL_MSG( MSG_NT_LUT_DISABLE )
 
+#define PLX_IOCTL_DEVICE_GET_STATS              IOCTL_MSG( MSG_DEVICE_GET_STATS )
+
+#define PLX_IOCTL_SCATTER_MEM_ALLOCATE          IOCTL_MSG( MSG_SCATTER_MEM_ALLOCATE )
+#define PLX_IOCTL_SCATTER_MEM_FREE              IOCTL_MSG( MSG_SCATTER_MEM_FREE )
+#define PLX_IOCTL_DMA_TRANSFER_SCATTER_MEM      IOCTL_MSG( MSG_DMA_TRANSFER_SCATTER_MEM )
+#define PLX_IOCTL_EEPROM_READ_BUFFER            IOCTL_MSG( MSG_EEPROM_READ_BUFFER )
+#define PLX_IOCTL_EEPROM_WRITE_BUFFER           IOCTL_MSG( MSG_EEPROM_WRITE_BUFFER )
+#define PLX_IOCTL_MAPPED_REGISTER_READ_BUFFER   IOCTL_MSG( MSG_MAPPED_REGISTER_READ_BUFFER )
+#define PLX_IOCTL_REGISTER_ACCESS_LIST          IOCTL_MSG( MSG_REGISTER_ACCESS_LIST )
+#define PLX_IOCTL_NT_REQ_ID_CACHE_INVALIDATE    IOCTL_MSG( MSG_NT_REQ_ID_CACHE_INVALIDATE )
+#define PLX_IOCTL_SPI_FLASH_PAGE_PROGRAM        IOCTL_MSG( MSG_SPI_FLASH_PAGE_PROGRAM )
+#define PLX_IOCTL_SPI_FLASH_WAIT_WRITE_DONE     IOCTL_MSG( MSG_SPI_FLASH_WAIT_WRITE_DONE )
+
 
 // Restore previous pack value
 #pragma pack( pop )
@@ -266,7 +266,8 @@ typedef enum _PLX_API_MODE
     PLX_API_MODE_I2C_AARDVARK,          // Device accessed via Aardvark I2C USB
     PLX_API_MODE_MDIO_SPLICE,           // Device accessed via Splice MDIO USB
     PLX_API_MODE_SDB,                   // Device accessed via Serial Debug Port
-    PLX_API_MODE_TCP                    // Device accessed via TCP/IP
+    PLX_API_MODE_TCP,                   // Device accessed via TCP/IP
+    PLX_API_MODE_SIMULATED              // Device accessed via in-process simulated model
 } PLX_API_MODE;
 
 
@@ -284,7 +285,10 @@ typedef enum _SDB_BAUD_RATE
 {
     SDB_BAUD_RATE_DEFAULT      = 0,     // Default rate
     SDB_BAUD_RATE_19200        = 1,     // 19,200 BAUD
-    SDB_BAUD_RATE_115200       = 2      // 115,200 BAUD
+    SDB_BAUD_RATE_115200       = 2,     // 115,200 BAUD
+    SDB_BAUD_RATE_230400       = 3,     // 230,400 BAUD
+    SDB_BAUD_RATE_460800       = 4,     // 460,800 BAUD
+    SDB_BAUD_RATE_921600       = 5      // 921,600 BAUD
 } SDB_BAUD_RATE;
 
 
@@ -750,6 +754,18 @@ typedef struct _PLX_PHYSICAL_MEM
 } PLX_PHYSICAL_MEM;
 
 
+// Scatter buffer of multiple physically contiguous chunks
+typedef struct _PLX_SCATTER_MEM
+{
+    U64 UserAddr;                    // User-mode virtual address of entire buffer
+    U64 SglAddr;                     // Bus address of pre-built DMA SGL descriptors
+    U64 Size;                        // Total size of the buffer
+    U64 Tag;                         // Driver tag for buffer, also used as map offset
+    U32 ChunkSize;                   // Requested/largest chunk size (0 = driver default)
+    U32 NumChunks;                   // Number of chunks & SGL descriptors
+} PLX_SCATTER_MEM;
+
+
 // PLX Driver Properties
 typedef struct _PLX_DRIVER_PROP
 {
@@ -819,6 +835,15 @@ typedef struct _PEX_SPI_OBJ
 } PEX_SPI_OBJ;
 
 
+// Entry of a batched register access list
+typedef struct _PLX_REG_ACCESS
+{
+    U32 Offset;                      // Register offset
+    U32 Value;                       // Value to write or value read
+    U8  bWrite;                      // Write (TRUE) or read (FALSE) register
+} PLX_REG_ACCESS;
+
+
 // PCI Device Key Identifier
 typedef struct _PLX_DEVICE_KEY
 {
@@ -1050,6 +1075,85 @@ typedef struct _PLX_PERF_STATS
 } PLX_PERF_STATS;
 
 
+// Scale of fixed-point values in batch performance statistics (3 decimal places)
+#define PLX_PERF_FP_SCALE               1000
+
+// Performance statistics for one direction of multiple ports
+typedef struct _PLX_PERF_STATS_DIR
+{
+    S64 TotalBytes[PERF_MAX_PORTS];             // Total bytes including overhead
+    S64 TotalByteRate[PERF_MAX_PORTS];          // Total byte rate (bytes/s)
+    S64 PayloadReadBytes[PERF_MAX_PORTS];       // Payload bytes read (Completion TLPs)
+    S64 PayloadWriteBytes[PERF_MAX_PORTS];      // Payload bytes written (Posted TLPs)
+    S64 PayloadTotalBytes[PERF_MAX_PORTS];      // Payload total bytes
+    S64 PayloadByteRate[PERF_MAX_PORTS];        // Payload byte rate (bytes/s)
+    S64 PayloadAvgPerTlp_FP[PERF_MAX_PORTS];    // Payload average size per TLP (x PLX_PERF_FP_SCALE)
+    S64 LinkUtilization_FP[PERF_MAX_PORTS];     // Link utilization % (x PLX_PERF_FP_SCALE)
+} PLX_PERF_STATS_DIR;
+
+// Performance statistics for multiple ports (one entry per PLX_PERF_PROP)
+typedef struct _PLX_PERF_STATS_BATCH
+{
+    U8                 NumPorts;                // Number of valid array entries
+    U8                 bValid[PERF_MAX_PORTS];  // Link is up & statistics are valid
+    PLX_PERF_STATS_DIR Ingress;
+    PLX_PERF_STATS_DIR Egress;
+} PLX_PERF_STATS_BATCH;
+
+
+// Maximum DMA channels tracked in device statistics
+#define PLX_STATS_MAX_DMA_CHANNELS      4
+
+// Device driver statistics counters
+typedef struct _PLX_DEVICE_STATS
+{
+    U64 DmaBytes[PLX_STATS_MAX_DMA_CHANNELS];       // Bytes transferred per DMA channel
+    U64 DmaTransfers[PLX_STATS_MAX_DMA_CHANNELS];   // Transfers completed per DMA channel
+    U64 SglDescriptors;                             // SGL descriptors built
+    U64 PagesPinned;                                // User buffer pages locked for SGL DMA
+    U64 Interrupts;                                 // Device interrupts handled
+    U64 InterruptsSpurious;                         // Interrupts not claimed by device (IRQ_NONE)
+    U64 DpcCount;                                   // Deferred interrupt routines run
+    U64 NotifySignalled;                            // Notification wait objects signalled
+    U64 NotifyTimeouts;                             // Notification waits that timed out
+} PLX_DEVICE_STATS;
+
+
+// NT message ring doorbell setting for polled notification
+#define PLX_NT_MSG_RING_NO_DOORBELL     0xFF
+
+// NT message ring properties
+typedef struct _PLX_NT_MSG_RING_PROP
+{
+    PLX_PHYSICAL_MEM   LocalBuffer;       // Mapped local buffer the remote side writes into
+    U8                 BarIndex;          // NT BAR translated to the remote side's buffer
+    U32                RemoteBarOffset;   // Offset of the remote buffer within the BAR
+    U16                SlotCount;         // Number of message slots (power of 2)
+    U32                SlotSize;          // Bytes per slot, including header (multiple of 64)
+    U8                 DoorbellBit;       // Doorbell to notify receiver (or PLX_NT_MSG_RING_NO_DOORBELL)
+    PLX_DEVICE_OBJECT *pDmaDevice;        // Optional opened DMA device for large messages
+    U8                 DmaChannel;        // Opened DMA channel on pDmaDevice
+    U32                DmaThreshold;      // Messages of at least this size are sent by DMA
+} PLX_NT_MSG_RING_PROP;
+
+
+// NT DMA connection to the host on the opposite side of an NT port
+typedef struct _PLX_NT_DMA_TARGET
+{
+    PLX_DEVICE_OBJECT *pNtDevice;         // NT port the peer is reached through
+    PLX_DEVICE_OBJECT *pDmaDevice;        // 8000 DMA device performing transfers
+    U8                 DmaChannel;        // Opened DMA channel on pDmaDevice
+    U8                 NumWindows;        // NT BAR windows used (2 allows pipelining)
+    U8                 BarIndex[2];       // NT BAR of each window
+    U64                BarPhysical[2];    // Local bus address of each window
+    U64                WindowBase[2];     // Peer address translated by each window
+    U64                WindowSize;        // Size of each window
+    U64                RemoteAddr;        // Peer buffer bus address
+    U64                RemoteSize;        // Peer buffer size
+    U16                LutIndex;          // LUT entry added for the DMA Requester ID
+} PLX_NT_DMA_TARGET;
+
+
 
 // Restore previous pack value
 #pragma pack( pop )
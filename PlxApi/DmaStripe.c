@@ -0,0 +1,719 @@
+/*******************************************************************************
+ * Copyright 2013-2019 Broadcom Inc
+ * Copyright (c) 2009 to 2012 PLX Technology Inc.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directorY of this source tree, or the
+ * BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+/*******************************************************************************
+ *
+ * File Name:
+ *
+ *      DmaStripe.c
+ *
+ * Description:
+ *
+ *      Implements single transfers striped across several channels of an 8000
+ *      DMA device.  The block or user buffer is split into one contiguous
+ *      stripe per channel, all stripes are started without waiting, then the
+ *      channels are polled until every stripe is done so the caller sees one
+ *      completion for the whole transfer.
+ *
+ *      Stripe sizes are weighted by the throughput measured on each channel
+ *      during earlier striped transfers, so channels finish at about the same
+ *      time even when they are not equally fast.  Channels must be opened by
+ *      the caller & may not be used for other transfers while a striped
+ *      transfer is in flight.
+ *
+ *      State is kept per device key, so it is shared by all objects opened
+ *      for the same device, & is released when a channel or the device is
+ *      closed.  It is protected by a process-wide lock, which is not held
+ *      while waiting for stripes to complete.
+ *
+ * Revision History:
+ *
+ *      09-01-19 : PCI/PCIe SDK v8.10
+ *
+ ******************************************************************************/
+
+
+#if defined(PLX_LINUX)
+    #include <time.h>
+#endif
+#include "PexApi.h"
+#include "PlxApiDebug.h"
+#include "PlxApiDirect.h"
+#include "DmaStripe.h"
+
+
+
+
+/**********************************************
+ *           Global Variables
+ *********************************************/
+static BOOLEAN          Gbl_bDmaStripeLockInit = FALSE;
+static DMA_STRIPE_STATE Gbl_DmaStripe[DMA_STRIPE_MAX_DEVICES];
+
+#if defined(PLX_DOS)
+    #define DMA_STRIPE_LOCK()
+    #define DMA_STRIPE_UNLOCK()
+#else
+    static CRITICAL_SECTION Gbl_DmaStripeLock;
+
+    #define DMA_STRIPE_LOCK()           EnterCriticalSection( &Gbl_DmaStripeLock )
+    #define DMA_STRIPE_UNLOCK()         LeaveCriticalSection( &Gbl_DmaStripeLock )
+#endif
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  DmaStripe_Transfer
+ *
+ * Description:  Splits a block or user buffer transfer across the channels
+ *               in the mask & optionally waits for all stripes to complete
+ *
+ *****************************************************************************/
+PLX_STATUS
+DmaStripe_Transfer(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 ChannelMask,
+    PLX_DMA_PARAMS    *pDmaParams,
+    BOOLEAN            bUserBuffer,
+    U64                Timeout_ms
+    )
+{
+    U8                channel;
+    U32               offset;
+    PLX_STATUS        status;
+    PLX_DMA_PARAMS    DmaParams;
+    DMA_STRIPE_STATE *pState;
+
+
+    // Only 8000 DMA over the PLX driver is supported
+    if ((pDevice->Key.ApiMode != PLX_API_MODE_PCI) ||
+        ((pDevice->Key.PlxChip & 0xF000) != 0x8000))
+    {
+        return PLX_STATUS_UNSUPPORTED;
+    }
+
+    ChannelMask &= (1 << DMA_STRIPE_MAX_CHANNELS) - 1;
+
+    if (ChannelMask == 0)
+    {
+        return PLX_STATUS_INVALID_DATA;
+    }
+
+    if (pDmaParams->ByteCount == 0)
+    {
+        return PLX_STATUS_INVALID_SIZE;
+    }
+
+    if (Gbl_bDmaStripeLockInit == FALSE)
+    {
+#if !defined(PLX_DOS)
+        InitializeCriticalSection( &Gbl_DmaStripeLock );
+#endif
+        Gbl_bDmaStripeLockInit = TRUE;
+    }
+
+    DMA_STRIPE_LOCK();
+
+    pState = DmaStripe_StateGet( pDevice, TRUE );
+    if (pState == NULL)
+    {
+        DMA_STRIPE_UNLOCK();
+        return PLX_STATUS_INSUFFICIENT_RES;
+    }
+
+    // Verify no stripe of a previous transfer still pending on the channels
+    if (pState->PendingMask & ChannelMask)
+    {
+        DMA_STRIPE_UNLOCK();
+        return PLX_STATUS_IN_PROGRESS;
+    }
+
+    DmaStripe_Split( pState, ChannelMask, pDmaParams->ByteCount );
+
+    DebugPrintf((
+        "Stripe %d bytes: %d/%d/%d/%d\n",
+        pDmaParams->ByteCount,
+        pState->Bytes[0], pState->Bytes[1], pState->Bytes[2], pState->Bytes[3]
+        ));
+
+    offset = 0;
+    status = PLX_STATUS_OK;
+
+    pState->TimeStart_us = DmaStripe_TimeUs();
+
+    for (channel = 0; channel < DMA_STRIPE_MAX_CHANNELS; channel++)
+    {
+        if (pState->Bytes[channel] != 0)
+        {
+            pState->TimeRun_us[channel] = pState->TimeStart_us;
+        }
+    }
+
+    // Start a stripe on each selected channel without waiting
+    for (channel = 0; channel < DMA_STRIPE_MAX_CHANNELS; channel++)
+    {
+        if (pState->Bytes[channel] == 0)
+        {
+            continue;
+        }
+
+        DmaParams           = *pDmaParams;
+        DmaParams.ByteCount = pState->Bytes[channel];
+
+        if (bUserBuffer)
+        {
+            DmaParams.UserVa  += offset;
+            DmaParams.PciAddr += offset;
+
+            status =
+                PlxPci_DmaTransferUserBuffer(
+                    pDevice,
+                    channel,
+                    &DmaParams,
+                    0           // Don't wait for completion
+                    );
+        }
+        else
+        {
+            if (DmaParams.bConstAddrSrc == 0)
+            {
+                DmaParams.AddrSource += offset;
+            }
+
+            if (DmaParams.bConstAddrDest == 0)
+            {
+                DmaParams.AddrDest += offset;
+            }
+
+            status =
+                PlxPci_DmaTransferBlock(
+                    pDevice,
+                    channel,
+                    &DmaParams,
+                    0           // Don't wait for completion
+                    );
+        }
+
+        if (status != PLX_STATUS_OK)
+        {
+            DebugPrintf(("ERROR - Unable to start stripe on channel %d\n", channel));
+            break;
+        }
+
+        pState->PendingMask |= (1 << channel);
+
+        offset += pState->Bytes[channel];
+    }
+
+    DMA_STRIPE_UNLOCK();
+
+    // Don't wait for completion if requested not to. Any stripes started
+    // before an error remain pending & are reported by status polls.
+    if (Timeout_ms == 0)
+    {
+        return status;
+    }
+
+    if (status != PLX_STATUS_OK)
+    {
+        // Let stripes already started finish before reporting the error
+        if (DmaStripe_WaitComplete( pDevice, ChannelMask, Timeout_ms ) == PLX_STATUS_TIMEOUT)
+        {
+            return PLX_STATUS_TIMEOUT;
+        }
+        return status;
+    }
+
+    return DmaStripe_WaitComplete( pDevice, ChannelMask, Timeout_ms );
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  DmaStripe_Status
+ *
+ * Description:  Returns whether all stripes on the channels in the mask are
+ *               done & updates the throughput of channels just completed
+ *
+ * Note       :  A stripe completed between the last poll which found it in
+ *               progress & the poll which found it done. Its duration is
+ *               taken at the midpoint & only sampled if that window is small
+ *               relative to the duration, so late polling doesn't skew rates.
+ *               All channels are checked before any error is returned.
+ *
+ *****************************************************************************/
+PLX_STATUS
+DmaStripe_Status(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 ChannelMask
+    )
+{
+    U8                channel;
+    U64               Now_us;
+    U64               Window_us;
+    U64               Elapsed_us;
+    U64               sample;
+    PLX_STATUS        status;
+    PLX_STATUS        StatusError;
+    DMA_STRIPE_STATE *pState;
+
+
+    // No transfers started if lock not yet created
+    if (Gbl_bDmaStripeLockInit == FALSE)
+    {
+        return PLX_STATUS_COMPLETE;
+    }
+
+    DMA_STRIPE_LOCK();
+
+    pState = DmaStripe_StateGet( pDevice, FALSE );
+    if (pState == NULL)
+    {
+        DMA_STRIPE_UNLOCK();
+        return PLX_STATUS_COMPLETE;
+    }
+
+    StatusError = PLX_STATUS_OK;
+
+    for (channel = 0; channel < DMA_STRIPE_MAX_CHANNELS; channel++)
+    {
+        if ((pState->PendingMask & ChannelMask & (1 << channel)) == 0)
+        {
+            continue;
+        }
+
+        status =
+            PlxPci_DmaStatus(
+                pDevice,
+                channel
+                );
+
+        // Time status of this channel was read
+        Now_us = DmaStripe_TimeUs();
+
+        if ((status == PLX_STATUS_IN_PROGRESS) || (status == PLX_STATUS_PAUSED))
+        {
+            pState->TimeRun_us[channel] = Now_us;
+            continue;
+        }
+
+        pState->PendingMask &= ~(1 << channel);
+
+        if (status != PLX_STATUS_COMPLETE)
+        {
+            // Report first error once all channels are checked
+            if (StatusError == PLX_STATUS_OK)
+            {
+                StatusError = status;
+            }
+            continue;
+        }
+
+        // Completion occurred between last poll in progress & now
+        Window_us  = Now_us - pState->TimeRun_us[channel];
+        Elapsed_us = (Now_us - (Window_us / 2)) - pState->TimeStart_us;
+
+        // Skip short stripes, where call overhead would dominate the sample,
+        // & stripes whose completion time is not known precisely enough
+        if ((Elapsed_us < DMA_STRIPE_MIN_SAMPLE_US) ||
+            (pState->Bytes[channel] < DMA_STRIPE_MIN_SIZE) ||
+            (Window_us > (Elapsed_us / DMA_STRIPE_SAMPLE_ERR_DIV)))
+        {
+            continue;
+        }
+
+        // Average new sample with previous rate (3/4 old, 1/4 new)
+        sample = pState->Bytes[channel] / Elapsed_us;
+
+        pState->Rate[channel] =
+            (U32)(((U64)pState->Rate[channel] * 3 + sample) / 4);
+
+        if (pState->Rate[channel] == 0)
+        {
+            pState->Rate[channel] = 1;
+        }
+
+        DebugPrintf((
+            "Stripe on channel %d done in %lldus (rate=%d B/us)\n",
+            channel, (long long)Elapsed_us, pState->Rate[channel]
+            ));
+    }
+
+    if (StatusError != PLX_STATUS_OK)
+    {
+        status = StatusError;
+    }
+    else if (pState->PendingMask & ChannelMask)
+    {
+        status = PLX_STATUS_IN_PROGRESS;
+    }
+    else
+    {
+        status = PLX_STATUS_COMPLETE;
+    }
+
+    DMA_STRIPE_UNLOCK();
+
+    return status;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  DmaStripe_ChannelRelease
+ *
+ * Description:  Discards any pending stripe of a channel being closed
+ *
+ *****************************************************************************/
+VOID
+DmaStripe_ChannelRelease(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 channel
+    )
+{
+    DMA_STRIPE_STATE *pState;
+
+
+    if ((channel >= DMA_STRIPE_MAX_CHANNELS) || (Gbl_bDmaStripeLockInit == FALSE))
+    {
+        return;
+    }
+
+    DMA_STRIPE_LOCK();
+
+    pState = DmaStripe_StateGet( pDevice, FALSE );
+    if (pState != NULL)
+    {
+        pState->PendingMask &= ~(1 << channel);
+    }
+
+    DMA_STRIPE_UNLOCK();
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  DmaStripe_DeviceRelease
+ *
+ * Description:  Releases the striping state of a device being closed
+ *
+ *****************************************************************************/
+VOID
+DmaStripe_DeviceRelease(
+    PLX_DEVICE_OBJECT *pDevice
+    )
+{
+    DMA_STRIPE_STATE *pState;
+
+
+    // No state added if lock not yet created
+    if (Gbl_bDmaStripeLockInit == FALSE)
+    {
+        return;
+    }
+
+    DMA_STRIPE_LOCK();
+
+    pState = DmaStripe_StateGet( pDevice, FALSE );
+    if (pState != NULL)
+    {
+        RtlZeroMemory( pState, sizeof(DMA_STRIPE_STATE) );
+    }
+
+    DMA_STRIPE_UNLOCK();
+}
+
+
+
+
+/***********************************************************
+ *
+ *               PRIVATE SUPPORT FUNCTIONS
+ *
+ **********************************************************/
+
+
+/******************************************************************************
+ *
+ * Function   :  DmaStripe_WaitComplete
+ *
+ * Description:  Polls until all stripes on the channels in the mask are done
+ *               or the timeout expires
+ *
+ * Note       :  If a stripe fails, the remaining stripes are still waited on
+ *               & the first error is then returned
+ *
+ *****************************************************************************/
+PLX_STATUS
+DmaStripe_WaitComplete(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 ChannelMask,
+    U64                Timeout_ms
+    )
+{
+    U32        SpinCount;
+    U64        ElapsedMs;
+    PLX_STATUS status;
+    PLX_STATUS StatusError;
+
+
+    SpinCount   = 0;
+    ElapsedMs   = 0;
+    StatusError = PLX_STATUS_OK;
+
+    do
+    {
+        status = DmaStripe_Status( pDevice, ChannelMask );
+
+        if (status == PLX_STATUS_COMPLETE)
+        {
+            return StatusError;
+        }
+
+        if (status != PLX_STATUS_IN_PROGRESS)
+        {
+            // Failed channels are no longer pending, keep polling the rest
+            if (StatusError == PLX_STATUS_OK)
+            {
+                StatusError = status;
+            }
+            continue;
+        }
+
+        if (SpinCount < DMA_STRIPE_SPIN_COUNT)
+        {
+            SpinCount++;
+        }
+        else
+        {
+            if (ElapsedMs >= Timeout_ms)
+            {
+                return PLX_STATUS_TIMEOUT;
+            }
+
+            Plx_sleep( 1 );
+            ElapsedMs++;
+        }
+    }
+    while (1);
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  DmaStripe_StateGet
+ *
+ * Description:  Returns the striping state of a device, optionally adding it
+ *
+ * Note       :  Entries are matched by device location rather than object,
+ *               since objects may be copied or reused after a close. Must be
+ *               called with the striping lock held.
+ *
+ *****************************************************************************/
+DMA_STRIPE_STATE*
+DmaStripe_StateGet(
+    PLX_DEVICE_OBJECT *pDevice,
+    BOOLEAN            bAdd
+    )
+{
+    U8                channel;
+    U16               i;
+    DMA_STRIPE_STATE *pState;
+
+
+    pState = NULL;
+
+    for (i = 0; i < DMA_STRIPE_MAX_DEVICES; i++)
+    {
+        if (Gbl_DmaStripe[i].bInUse)
+        {
+            if ((Gbl_DmaStripe[i].Key.ApiMode  == pDevice->Key.ApiMode)  &&
+                (Gbl_DmaStripe[i].Key.domain   == pDevice->Key.domain)   &&
+                (Gbl_DmaStripe[i].Key.bus      == pDevice->Key.bus)      &&
+                (Gbl_DmaStripe[i].Key.slot     == pDevice->Key.slot)     &&
+                (Gbl_DmaStripe[i].Key.function == pDevice->Key.function))
+            {
+                return &Gbl_DmaStripe[i];
+            }
+        }
+        else if (pState == NULL)
+        {
+            pState = &Gbl_DmaStripe[i];
+        }
+    }
+
+    if ((bAdd == FALSE) || (pState == NULL))
+    {
+        return NULL;
+    }
+
+    RtlZeroMemory( pState, sizeof(DMA_STRIPE_STATE) );
+
+    pState->bInUse = TRUE;
+    pState->Key    = pDevice->Key;
+
+    // Until measured, treat all channels as equally fast
+    for (channel = 0; channel < DMA_STRIPE_MAX_CHANNELS; channel++)
+    {
+        pState->Rate[channel] = DMA_STRIPE_RATE_DEFAULT;
+    }
+
+    return pState;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  DmaStripe_Split
+ *
+ * Description:  Sizes the stripe of each channel in proportion to its rate
+ *
+ *****************************************************************************/
+VOID
+DmaStripe_Split(
+    DMA_STRIPE_STATE *pState,
+    U8                ChannelMask,
+    U32               ByteCount
+    )
+{
+    U8  channel;
+    U8  LastChannel;
+    U8  MaxChannels;
+    U8  NumChannels;
+    U32 remain;
+    U64 TotalRate;
+
+
+    // Limit channels so each stripe is large enough to be worth starting
+    if (ByteCount >= (DMA_STRIPE_MAX_CHANNELS * DMA_STRIPE_MIN_SIZE))
+    {
+        MaxChannels = DMA_STRIPE_MAX_CHANNELS;
+    }
+    else if (ByteCount >= DMA_STRIPE_MIN_SIZE)
+    {
+        MaxChannels = (U8)(ByteCount / DMA_STRIPE_MIN_SIZE);
+    }
+    else
+    {
+        MaxChannels = 1;
+    }
+
+    NumChannels = 0;
+    LastChannel = 0;
+    TotalRate   = 0;
+
+    for (channel = 0; channel < DMA_STRIPE_MAX_CHANNELS; channel++)
+    {
+        pState->Bytes[channel] = 0;
+
+        if ((ChannelMask & (1 << channel)) && (NumChannels < MaxChannels))
+        {
+            // Mark channel as used until its size is set below
+            pState->Bytes[channel] = 1;
+            TotalRate             += pState->Rate[channel];
+            LastChannel            = channel;
+            NumChannels++;
+        }
+    }
+
+    remain = ByteCount;
+
+    // Size all but the last stripe by rate & give the last one the remainder
+    for (channel = 0; channel < LastChannel; channel++)
+    {
+        if (pState->Bytes[channel] == 0)
+        {
+            continue;
+        }
+
+        pState->Bytes[channel] =
+            (U32)(((U64)ByteCount * pState->Rate[channel]) / TotalRate);
+
+        pState->Bytes[channel] &= ~(DMA_STRIPE_ALIGN - 1);
+
+        remain -= pState->Bytes[channel];
+    }
+
+    pState->Bytes[LastChannel] = remain;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  DmaStripe_TimeUs
+ *
+ * Description:  Returns a monotonic timestamp in microseconds
+ *
+ *****************************************************************************/
+U64
+DmaStripe_TimeUs(
+    VOID
+    )
+{
+#if defined(PLX_MSWINDOWS)
+    LARGE_INTEGER count;
+    LARGE_INTEGER freq;
+
+
+    QueryPerformanceFrequency( &freq );
+    QueryPerformanceCounter( &count );
+
+    return ((count.QuadPart / freq.QuadPart) * 1000000) +
+           (((count.QuadPart % freq.QuadPart) * 1000000) / freq.QuadPart);
+
+#elif defined(PLX_LINUX)
+    struct timespec ts;
+
+
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+
+    return ((U64)ts.tv_sec * 1000000) + (ts.tv_nsec / 1000);
+
+#else
+    return 0;
+#endif
+}
@@ -0,0 +1,154 @@
+#ifndef __DMA_STRIPE_H
+#define __DMA_STRIPE_H
+
+/*******************************************************************************
+ * Copyright 2013-2019 Broadcom, Inc
+ * Copyright (c) 2009 to 2012 PLX Technology Inc.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directorY of this source tree, or the
+ * BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+/*******************************************************************************
+ *
+ * File Name:
+ *
+ *     DmaStripe.h
+ *
+ * Description:
+ *
+ *     Header file for DMA transfers striped across multiple channels
+ *
+ * Revision History:
+ *
+ *     09-01-19: PCI/PCIe SDK v8.10
+ *
+ ******************************************************************************/
+
+
+#include "PlxIoctl.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/******************************************
+ *             Definitions
+ ******************************************/
+#define DMA_STRIPE_MAX_DEVICES          8           // Max devices tracked by a process
+#define DMA_STRIPE_MAX_CHANNELS         4           // 8000 DMA channels
+#define DMA_STRIPE_ALIGN                64          // Stripe boundary alignment
+#define DMA_STRIPE_MIN_SIZE             0x10000     // Min bytes per stripe (64KB)
+#define DMA_STRIPE_MIN_SAMPLE_US        100         // Min stripe duration for a rate sample
+#define DMA_STRIPE_SAMPLE_ERR_DIV       8           // Max completion time error (1/n of duration)
+#define DMA_STRIPE_RATE_DEFAULT         1000        // Initial channel rate (B/us), all equal
+#define DMA_STRIPE_SPIN_COUNT           1000        // Status polls before sleeping on a wait
+
+
+// Striped transfer state of a DMA device
+typedef struct _DMA_STRIPE_STATE
+{
+    BOOLEAN            bInUse;                              // Entry in use
+    PLX_DEVICE_KEY     Key;                                 // Key of DMA device
+    U8                 PendingMask;                         // Channels with a stripe in flight
+    U64                TimeStart_us;                        // Start time of current transfer
+    U64                TimeRun_us[DMA_STRIPE_MAX_CHANNELS]; // Last time stripe seen in progress
+    U32                Bytes[DMA_STRIPE_MAX_CHANNELS];      // Stripe size per channel
+    U32                Rate[DMA_STRIPE_MAX_CHANNELS];       // Measured throughput per channel (B/us)
+} DMA_STRIPE_STATE;
+
+
+
+
+/******************************************
+ *         Striped DMA Functions
+ *****************************************/
+PLX_STATUS
+DmaStripe_Transfer(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 ChannelMask,
+    PLX_DMA_PARAMS    *pDmaParams,
+    BOOLEAN            bUserBuffer,
+    U64                Timeout_ms
+    );
+
+PLX_STATUS
+DmaStripe_Status(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 ChannelMask
+    );
+
+VOID
+DmaStripe_ChannelRelease(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 channel
+    );
+
+VOID
+DmaStripe_DeviceRelease(
+    PLX_DEVICE_OBJECT *pDevice
+    );
+
+
+/******************************************
+ *      Striped DMA Support Functions
+ *****************************************/
+DMA_STRIPE_STATE*
+DmaStripe_StateGet(
+    PLX_DEVICE_OBJECT *pDevice,
+    BOOLEAN            bAdd
+    );
+
+PLX_STATUS
+DmaStripe_WaitComplete(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 ChannelMask,
+    U64                Timeout_ms
+    );
+
+VOID
+DmaStripe_Split(
+    DMA_STRIPE_STATE *pState,
+    U8                ChannelMask,
+    U32               ByteCount
+    );
+
+U64
+DmaStripe_TimeUs(
+    VOID
+    );
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -786,6 +786,361 @@ Plx8000_EepromWriteByOffset_16(
 
 
 
+/******************************************************************************
+ *
+ * Function   :  Plx8000_EepromReadBuffer
+ *
+ * Description:  Read a block of 32-bit values from the EEPROM
+ *
+ * Note       :  Reads do not make the EEPROM busy, so the controller idle
+ *               check is only performed once for the entire buffer.
+ *
+ ******************************************************************************/
+PLX_STATUS
+Plx8000_EepromReadBuffer(
+    PLX_DEVICE_OBJECT *pdx,
+    U32                offset,
+    U32               *pBuffer,
+    U32                ByteCount
+    )
+{
+    U16        OffsetCtrl;
+    U32        i;
+    U32        RegCmd;
+    U32        EepWidth;
+    U32        UpperAddr;
+    PLX_STATUS status;
+
+
+    // Get EEPROM control register offset
+    OffsetCtrl = Plx8000_EepromGetCtrlOffset( pdx );
+
+    // Verify access is supported
+    if (OffsetCtrl == 0x0)
+    {
+        return PLX_STATUS_UNSUPPORTED;
+    }
+
+    // Wait until EEPROM is ready
+    if (Plx8000_EepromWaitIdle( pdx ) == FALSE)
+    {
+        return PLX_STATUS_TIMEOUT;
+    }
+
+    // Get base command & verify range is addressable
+    status =
+        Plx8000_EepromBufferSetup(
+            pdx,
+            offset,
+            ByteCount,
+            &RegCmd,
+            &EepWidth
+            );
+
+    if (status != PLX_STATUS_OK)
+    {
+        return status;
+    }
+
+    // Force upper address byte update on first access
+    UpperAddr = (U32)-1;
+
+    for (i = 0; i < (ByteCount / sizeof(U32)); i++)
+    {
+        // For 3-byte addressing, set upper byte only when it changes
+        if ((EepWidth == 3) && (((offset >> 16) & 0xFF) != UpperAddr))
+        {
+            UpperAddr = (offset >> 16) & 0xFF;
+            Plx8000_EepromSetUpperAddress( pdx, OffsetCtrl, UpperAddr );
+        }
+
+        // Send EEPROM read command
+        if (Plx8000_EepromSendCommand(
+                pdx,
+                RegCmd |
+                ((((offset / sizeof(U32)) >>  0) & 0x1FFF) <<  0) |   // Bits [12:0] of index
+                ((((offset / sizeof(U32)) >> 13) & 1)      << 20) |   // Bit 13 of index
+                (PLX8000_EE_CMD_READ                       << 13)     // EEPROM command
+                ) == FALSE)
+        {
+            return PLX_STATUS_TIMEOUT;
+        }
+
+        // Get EEPROM data (x264h)
+        pBuffer[i] = PlxPci_PlxMappedRegisterRead( pdx, OffsetCtrl + 0x4, NULL );
+
+        offset += sizeof(U32);
+    }
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Plx8000_EepromWriteBuffer
+ *
+ * Description:  Write a block of 32-bit values to the EEPROM & optionally verify
+ *
+ * Note       :  The EEPROM controller only transfers a single 32-bit value per
+ *               write command, so each value still incurs an EEPROM write cycle.
+ *               The controller setup is performed once for the entire buffer.
+ *
+ ******************************************************************************/
+PLX_STATUS
+Plx8000_EepromWriteBuffer(
+    PLX_DEVICE_OBJECT *pdx,
+    U32                offset,
+    U32               *pBuffer,
+    U32                ByteCount,
+    BOOLEAN            bVerify
+    )
+{
+    U16        OffsetCtrl;
+    U32        i;
+    U32        j;
+    U32        count;
+    U32        RegCmd;
+    U32        EepWidth;
+    U32        UpperAddr;
+    U32        OffsetStart;
+    U32        Verify_Value[PLX8000_EE_VERIFY_COUNT];
+    PLX_STATUS status;
+
+
+    // Get EEPROM control register offset
+    OffsetCtrl = Plx8000_EepromGetCtrlOffset( pdx );
+
+    // Verify access is supported
+    if (OffsetCtrl == 0x0)
+    {
+        return PLX_STATUS_UNSUPPORTED;
+    }
+
+    // Wait until EEPROM is ready
+    if (Plx8000_EepromWaitIdle( pdx ) == FALSE)
+    {
+        return PLX_STATUS_TIMEOUT;
+    }
+
+    // Get base command & verify range is addressable
+    status =
+        Plx8000_EepromBufferSetup(
+            pdx,
+            offset,
+            ByteCount,
+            &RegCmd,
+            &EepWidth
+            );
+
+    if (status != PLX_STATUS_OK)
+    {
+        return status;
+    }
+
+    OffsetStart = offset;
+
+    // Force upper address byte update on first access
+    UpperAddr = (U32)-1;
+
+    for (i = 0; i < (ByteCount / sizeof(U32)); i++)
+    {
+        // Wait for previous write cycle to complete
+        if ((i != 0) && (Plx8000_EepromWaitIdle( pdx ) == FALSE))
+        {
+            return PLX_STATUS_TIMEOUT;
+        }
+
+        // For 3-byte addressing, set upper byte only when it changes
+        if ((EepWidth == 3) && (((offset >> 16) & 0xFF) != UpperAddr))
+        {
+            UpperAddr = (offset >> 16) & 0xFF;
+            Plx8000_EepromSetUpperAddress( pdx, OffsetCtrl, UpperAddr );
+        }
+
+        // Send EEPROM write enable command
+        Plx8000_EepromSendCommand(
+            pdx,
+            RegCmd | (PLX8000_EE_CMD_WRITE_ENABLE << 13)
+            );
+
+        // Prepare EEPROM data (264h)
+        PlxPci_PlxMappedRegisterWrite( pdx, OffsetCtrl + 0x4, pBuffer[i] );
+
+        // Send EEPROM write command
+        if (Plx8000_EepromSendCommand(
+                pdx,
+                RegCmd |
+                ((((offset / sizeof(U32)) >>  0) & 0x1FFF) <<  0) |   // Bits [12:0] of index
+                ((((offset / sizeof(U32)) >> 13) & 1)      << 20) |   // Bit 13 of index
+                (PLX8000_EE_CMD_WRITE                      << 13)     // EEPROM command
+                ) == FALSE)
+        {
+            return PLX_STATUS_TIMEOUT;
+        }
+
+        offset += sizeof(U32);
+    }
+
+    if (bVerify == FALSE)
+    {
+        return PLX_STATUS_OK;
+    }
+
+    // Read back values in groups & compare
+    for (i = 0; i < (ByteCount / sizeof(U32)); i += count)
+    {
+        count = (ByteCount / sizeof(U32)) - i;
+        if (count > PLX8000_EE_VERIFY_COUNT)
+        {
+            count = PLX8000_EE_VERIFY_COUNT;
+        }
+
+        status =
+            Plx8000_EepromReadBuffer(
+                pdx,
+                OffsetStart + (i * sizeof(U32)),
+                Verify_Value,
+                count * sizeof(U32)
+                );
+
+        if (status != PLX_STATUS_OK)
+        {
+            return status;
+        }
+
+        for (j = 0; j < count; j++)
+        {
+            if (Verify_Value[j] != pBuffer[i + j])
+            {
+                DebugPrintf((
+                    "ERROR - Verify failed at offset %02Xh (wrote %08X, read %08X)\n",
+                    (int)(OffsetStart + ((i + j) * sizeof(U32))),
+                    (int)pBuffer[i + j], (int)Verify_Value[j]
+                    ));
+                return PLX_STATUS_FAILED;
+            }
+        }
+    }
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Plx8000_EepromBufferSetup
+ *
+ * Description:  Returns the base EEPROM command & address width for a buffer
+ *               access & verifies the entire range is addressable
+ *
+ ******************************************************************************/
+PLX_STATUS
+Plx8000_EepromBufferSetup(
+    PLX_DEVICE_OBJECT *pdx,
+    U32                offset,
+    U32                ByteCount,
+    U32               *pRegCmd,
+    U32               *pEepWidth
+    )
+{
+    U16 OffsetCtrl;
+    U32 EepWidth;
+    U32 RegValue;
+
+
+    // Verify offset & size are 32-bit aligned
+    if (offset & 0x3)
+    {
+        return PLX_STATUS_INVALID_OFFSET;
+    }
+
+    if ((ByteCount == 0) || (ByteCount & 0x3))
+    {
+        return PLX_STATUS_INVALID_SIZE;
+    }
+
+    // Get EEPROM control register offset
+    OffsetCtrl = Plx8000_EepromGetCtrlOffset( pdx );
+
+    // Get EEPROM control register
+    RegValue = PlxPci_PlxMappedRegisterRead( pdx, OffsetCtrl, NULL );
+
+    // Some devices don't report byte addressing
+    if ((pdx->Key.PlxChip == 0x8114) ||
+        (pdx->Key.PlxFamily == PLX_FAMILY_VEGA) ||
+        (pdx->Key.PlxFamily == PLX_FAMILY_VEGA_LITE))
+    {
+        EepWidth = 2;
+    }
+    else
+    {
+        // Determine byte addressing ([23:22])
+        EepWidth = (RegValue >> 22) & 0x3;
+        if (EepWidth == 0)
+        {
+           EepWidth = 1;
+        }
+    }
+
+    // Verify entire buffer doesn't exceed byte addressing
+    if (((U64)offset + ByteCount) > ((U64)1 << (EepWidth * 8)))
+    {
+        DebugPrintf((
+            "ERROR - Range %02Xh-%02Xh exceeds %dB addressing\n",
+            (int)offset, (int)(offset + ByteCount - 1), (int)EepWidth
+            ));
+        return PLX_STATUS_INVALID_OFFSET;
+    }
+
+    // Clear command field [15:13]
+    RegValue &= ~(7 << 13);
+
+    // Clear offset field [20,12:0]
+    RegValue &= ~((1 << 20) | (0x1FFF << 0));
+
+    *pRegCmd   = RegValue;
+    *pEepWidth = EepWidth;
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Plx8000_EepromSetUpperAddress
+ *
+ * Description:  Sets the 3rd address byte used for 3-byte addressing
+ *
+ ******************************************************************************/
+VOID
+Plx8000_EepromSetUpperAddress(
+    PLX_DEVICE_OBJECT *pdx,
+    U16                OffsetCtrl,
+    U32                UpperAddr
+    )
+{
+    U32 RegUpper;
+
+
+    RegUpper = PlxPci_PlxMappedRegisterRead( pdx, OffsetCtrl + 0xC, NULL );
+
+    // Set 3rd address byte (26Ch[7:0])
+    RegUpper &= ~(0xFF << 0);
+    RegUpper |= UpperAddr & 0xFF;
+
+    PlxPci_PlxMappedRegisterWrite( pdx, OffsetCtrl + 0xC, RegUpper );
+}
+
+
+
+
 /******************************************************************************
  *
  * Function   :  Plx8000_EepromWaitIdle
@@ -945,6 +1300,378 @@ Plx8000_EepromSendCommand(
 
 
 
+/**********************************************************
+ * CRC lookup tables for CONST_CRC_XOR_VALUE (MSB first).
+ * Table [k] holds the CRC of byte n followed by k zero bytes
+ * so 8 bytes can be folded into the CRC per iteration.
+ *********************************************************/
+static const U32 Plx8000_CrcTable[8][256] =
+{
+    {
+        0x00000000, 0xDB710641, 0x6D930AC3, 0xB6E20C82, 0xDB261586, 0x005713C7,
+        0xB6B51F45, 0x6DC41904, 0x6D3D2D4D, 0xB64C2B0C, 0x00AE278E, 0xDBDF21CF,
+        0xB61B38CB, 0x6D6A3E8A, 0xDB883208, 0x00F93449, 0xDA7A5A9A, 0x010B5CDB,
+        0xB7E95059, 0x6C985618, 0x015C4F1C, 0xDA2D495D, 0x6CCF45DF, 0xB7BE439E,
+        0xB74777D7, 0x6C367196, 0xDAD47D14, 0x01A57B55, 0x6C616251, 0xB7106410,
+        0x01F26892, 0xDA836ED3, 0x6F85B375, 0xB4F4B534, 0x0216B9B6, 0xD967BFF7,
+        0xB4A3A6F3, 0x6FD2A0B2, 0xD930AC30, 0x0241AA71, 0x02B89E38, 0xD9C99879,
+        0x6F2B94FB, 0xB45A92BA, 0xD99E8BBE, 0x02EF8DFF, 0xB40D817D, 0x6F7C873C,
+        0xB5FFE9EF, 0x6E8EEFAE, 0xD86CE32C, 0x031DE56D, 0x6ED9FC69, 0xB5A8FA28,
+        0x034AF6AA, 0xD83BF0EB, 0xD8C2C4A2, 0x03B3C2E3, 0xB551CE61, 0x6E20C820,
+        0x03E4D124, 0xD895D765, 0x6E77DBE7, 0xB506DDA6, 0xDF0B66EA, 0x047A60AB,
+        0xB2986C29, 0x69E96A68, 0x042D736C, 0xDF5C752D, 0x69BE79AF, 0xB2CF7FEE,
+        0xB2364BA7, 0x69474DE6, 0xDFA54164, 0x04D44725, 0x69105E21, 0xB2615860,
+        0x048354E2, 0xDFF252A3, 0x05713C70, 0xDE003A31, 0x68E236B3, 0xB39330F2,
+        0xDE5729F6, 0x05262FB7, 0xB3C42335, 0x68B52574, 0x684C113D, 0xB33D177C,
+        0x05DF1BFE, 0xDEAE1DBF, 0xB36A04BB, 0x681B02FA, 0xDEF90E78, 0x05880839,
+        0xB08ED59F, 0x6BFFD3DE, 0xDD1DDF5C, 0x066CD91D, 0x6BA8C019, 0xB0D9C658,
+        0x063BCADA, 0xDD4ACC9B, 0xDDB3F8D2, 0x06C2FE93, 0xB020F211, 0x6B51F450,
+        0x0695ED54, 0xDDE4EB15, 0x6B06E797, 0xB077E1D6, 0x6AF48F05, 0xB1858944,
+        0x076785C6, 0xDC168387, 0xB1D29A83, 0x6AA39CC2, 0xDC419040, 0x07309601,
+        0x07C9A248, 0xDCB8A409, 0x6A5AA88B, 0xB12BAECA, 0xDCEFB7CE, 0x079EB18F,
+        0xB17CBD0D, 0x6A0DBB4C, 0x6567CB95, 0xBE16CDD4, 0x08F4C156, 0xD385C717,
+        0xBE41DE13, 0x6530D852, 0xD3D2D4D0, 0x08A3D291, 0x085AE6D8, 0xD32BE099,
+        0x65C9EC1B, 0xBEB8EA5A, 0xD37CF35E, 0x080DF51F, 0xBEEFF99D, 0x659EFFDC,
+        0xBF1D910F, 0x646C974E, 0xD28E9BCC, 0x09FF9D8D, 0x643B8489, 0xBF4A82C8,
+        0x09A88E4A, 0xD2D9880B, 0xD220BC42, 0x0951BA03, 0xBFB3B681, 0x64C2B0C0,
+        0x0906A9C4, 0xD277AF85, 0x6495A307, 0xBFE4A546, 0x0AE278E0, 0xD1937EA1,
+        0x67717223, 0xBC007462, 0xD1C46D66, 0x0AB56B27, 0xBC5767A5, 0x672661E4,
+        0x67DF55AD, 0xBCAE53EC, 0x0A4C5F6E, 0xD13D592F, 0xBCF9402B, 0x6788466A,
+        0xD16A4AE8, 0x0A1B4CA9, 0xD098227A, 0x0BE9243B, 0xBD0B28B9, 0x667A2EF8,
+        0x0BBE37FC, 0xD0CF31BD, 0x662D3D3F, 0xBD5C3B7E, 0xBDA50F37, 0x66D40976,
+        0xD03605F4, 0x0B4703B5, 0x66831AB1, 0xBDF21CF0, 0x0B101072, 0xD0611633,
+        0xBA6CAD7F, 0x611DAB3E, 0xD7FFA7BC, 0x0C8EA1FD, 0x614AB8F9, 0xBA3BBEB8,
+        0x0CD9B23A, 0xD7A8B47B, 0xD7518032, 0x0C208673, 0xBAC28AF1, 0x61B38CB0,
+        0x0C7795B4, 0xD70693F5, 0x61E49F77, 0xBA959936, 0x6016F7E5, 0xBB67F1A4,
+        0x0D85FD26, 0xD6F4FB67, 0xBB30E263, 0x6041E422, 0xD6A3E8A0, 0x0DD2EEE1,
+        0x0D2BDAA8, 0xD65ADCE9, 0x60B8D06B, 0xBBC9D62A, 0xD60DCF2E, 0x0D7CC96F,
+        0xBB9EC5ED, 0x60EFC3AC, 0xD5E91E0A, 0x0E98184B, 0xB87A14C9, 0x630B1288,
+        0x0ECF0B8C, 0xD5BE0DCD, 0x635C014F, 0xB82D070E, 0xB8D43347, 0x63A53506,
+        0xD5473984, 0x0E363FC5, 0x63F226C1, 0xB8832080, 0x0E612C02, 0xD5102A43,
+        0x0F934490, 0xD4E242D1, 0x62004E53, 0xB9714812, 0xD4B55116, 0x0FC45757,
+        0xB9265BD5, 0x62575D94, 0x62AE69DD, 0xB9DF6F9C, 0x0F3D631E, 0xD44C655F,
+        0xB9887C5B, 0x62F97A1A, 0xD41B7698, 0x0F6A70D9
+    },
+    {
+        0x00000000, 0xCACF972A, 0x4EEE2815, 0x8421BF3F, 0x9DDC502A, 0x5713C700,
+        0xD332783F, 0x19FDEF15, 0xE0C9A615, 0x2A06313F, 0xAE278E00, 0x64E8192A,
+        0x7D15F63F, 0xB7DA6115, 0x33FBDE2A, 0xF9344900, 0x1AE24A6B, 0xD02DDD41,
+        0x540C627E, 0x9EC3F554, 0x873E1A41, 0x4DF18D6B, 0xC9D03254, 0x031FA57E,
+        0xFA2BEC7E, 0x30E47B54, 0xB4C5C46B, 0x7E0A5341, 0x67F7BC54, 0xAD382B7E,
+        0x29199441, 0xE3D6036B, 0x35C494D6, 0xFF0B03FC, 0x7B2ABCC3, 0xB1E52BE9,
+        0xA818C4FC, 0x62D753D6, 0xE6F6ECE9, 0x2C397BC3, 0xD50D32C3, 0x1FC2A5E9,
+        0x9BE31AD6, 0x512C8DFC, 0x48D162E9, 0x821EF5C3, 0x063F4AFC, 0xCCF0DDD6,
+        0x2F26DEBD, 0xE5E94997, 0x61C8F6A8, 0xAB076182, 0xB2FA8E97, 0x783519BD,
+        0xFC14A682, 0x36DB31A8, 0xCFEF78A8, 0x0520EF82, 0x810150BD, 0x4BCEC797,
+        0x52332882, 0x98FCBFA8, 0x1CDD0097, 0xD61297BD, 0x6B8929AC, 0xA146BE86,
+        0x256701B9, 0xEFA89693, 0xF6557986, 0x3C9AEEAC, 0xB8BB5193, 0x7274C6B9,
+        0x8B408FB9, 0x418F1893, 0xC5AEA7AC, 0x0F613086, 0x169CDF93, 0xDC5348B9,
+        0x5872F786, 0x92BD60AC, 0x716B63C7, 0xBBA4F4ED, 0x3F854BD2, 0xF54ADCF8,
+        0xECB733ED, 0x2678A4C7, 0xA2591BF8, 0x68968CD2, 0x91A2C5D2, 0x5B6D52F8,
+        0xDF4CEDC7, 0x15837AED, 0x0C7E95F8, 0xC6B102D2, 0x4290BDED, 0x885F2AC7,
+        0x5E4DBD7A, 0x94822A50, 0x10A3956F, 0xDA6C0245, 0xC391ED50, 0x095E7A7A,
+        0x8D7FC545, 0x47B0526F, 0xBE841B6F, 0x744B8C45, 0xF06A337A, 0x3AA5A450,
+        0x23584B45, 0xE997DC6F, 0x6DB66350, 0xA779F47A, 0x44AFF711, 0x8E60603B,
+        0x0A41DF04, 0xC08E482E, 0xD973A73B, 0x13BC3011, 0x979D8F2E, 0x5D521804,
+        0xA4665104, 0x6EA9C62E, 0xEA887911, 0x2047EE3B, 0x39BA012E, 0xF3759604,
+        0x7754293B, 0xBD9BBE11, 0xD7125358, 0x1DDDC472, 0x99FC7B4D, 0x5333EC67,
+        0x4ACE0372, 0x80019458, 0x04202B67, 0xCEEFBC4D, 0x37DBF54D, 0xFD146267,
+        0x7935DD58, 0xB3FA4A72, 0xAA07A567, 0x60C8324D, 0xE4E98D72, 0x2E261A58,
+        0xCDF01933, 0x073F8E19, 0x831E3126, 0x49D1A60C, 0x502C4919, 0x9AE3DE33,
+        0x1EC2610C, 0xD40DF626, 0x2D39BF26, 0xE7F6280C, 0x63D79733, 0xA9180019,
+        0xB0E5EF0C, 0x7A2A7826, 0xFE0BC719, 0x34C45033, 0xE2D6C78E, 0x281950A4,
+        0xAC38EF9B, 0x66F778B1, 0x7F0A97A4, 0xB5C5008E, 0x31E4BFB1, 0xFB2B289B,
+        0x021F619B, 0xC8D0F6B1, 0x4CF1498E, 0x863EDEA4, 0x9FC331B1, 0x550CA69B,
+        0xD12D19A4, 0x1BE28E8E, 0xF8348DE5, 0x32FB1ACF, 0xB6DAA5F0, 0x7C1532DA,
+        0x65E8DDCF, 0xAF274AE5, 0x2B06F5DA, 0xE1C962F0, 0x18FD2BF0, 0xD232BCDA,
+        0x561303E5, 0x9CDC94CF, 0x85217BDA, 0x4FEEECF0, 0xCBCF53CF, 0x0100C4E5,
+        0xBC9B7AF4, 0x7654EDDE, 0xF27552E1, 0x38BAC5CB, 0x21472ADE, 0xEB88BDF4,
+        0x6FA902CB, 0xA56695E1, 0x5C52DCE1, 0x969D4BCB, 0x12BCF4F4, 0xD87363DE,
+        0xC18E8CCB, 0x0B411BE1, 0x8F60A4DE, 0x45AF33F4, 0xA679309F, 0x6CB6A7B5,
+        0xE897188A, 0x22588FA0, 0x3BA560B5, 0xF16AF79F, 0x754B48A0, 0xBF84DF8A,
+        0x46B0968A, 0x8C7F01A0, 0x085EBE9F, 0xC29129B5, 0xDB6CC6A0, 0x11A3518A,
+        0x9582EEB5, 0x5F4D799F, 0x895FEE22, 0x43907908, 0xC7B1C637, 0x0D7E511D,
+        0x1483BE08, 0xDE4C2922, 0x5A6D961D, 0x90A20137, 0x69964837, 0xA359DF1D,
+        0x27786022, 0xEDB7F708, 0xF44A181D, 0x3E858F37, 0xBAA43008, 0x706BA722,
+        0x93BDA449, 0x59723363, 0xDD538C5C, 0x179C1B76, 0x0E61F463, 0xC4AE6349,
+        0x408FDC76, 0x8A404B5C, 0x7374025C, 0xB9BB9576, 0x3D9A2A49, 0xF755BD63,
+        0xEEA85276, 0x2467C55C, 0xA0467A63, 0x6A89ED49
+    },
+    {
+        0x00000000, 0x7555A0F1, 0xEAAB41E2, 0x9FFEE113, 0x0E278585, 0x7B722574,
+        0xE48CC467, 0x91D96496, 0x1C4F0B0A, 0x691AABFB, 0xF6E44AE8, 0x83B1EA19,
+        0x12688E8F, 0x673D2E7E, 0xF8C3CF6D, 0x8D966F9C, 0x389E1614, 0x4DCBB6E5,
+        0xD23557F6, 0xA760F707, 0x36B99391, 0x43EC3360, 0xDC12D273, 0xA9477282,
+        0x24D11D1E, 0x5184BDEF, 0xCE7A5CFC, 0xBB2FFC0D, 0x2AF6989B, 0x5FA3386A,
+        0xC05DD979, 0xB5087988, 0x713C2C28, 0x04698CD9, 0x9B976DCA, 0xEEC2CD3B,
+        0x7F1BA9AD, 0x0A4E095C, 0x95B0E84F, 0xE0E548BE, 0x6D732722, 0x182687D3,
+        0x87D866C0, 0xF28DC631, 0x6354A2A7, 0x16010256, 0x89FFE345, 0xFCAA43B4,
+        0x49A23A3C, 0x3CF79ACD, 0xA3097BDE, 0xD65CDB2F, 0x4785BFB9, 0x32D01F48,
+        0xAD2EFE5B, 0xD87B5EAA, 0x55ED3136, 0x20B891C7, 0xBF4670D4, 0xCA13D025,
+        0x5BCAB4B3, 0x2E9F1442, 0xB161F551, 0xC43455A0, 0xE2785850, 0x972DF8A1,
+        0x08D319B2, 0x7D86B943, 0xEC5FDDD5, 0x990A7D24, 0x06F49C37, 0x73A13CC6,
+        0xFE37535A, 0x8B62F3AB, 0x149C12B8, 0x61C9B249, 0xF010D6DF, 0x8545762E,
+        0x1ABB973D, 0x6FEE37CC, 0xDAE64E44, 0xAFB3EEB5, 0x304D0FA6, 0x4518AF57,
+        0xD4C1CBC1, 0xA1946B30, 0x3E6A8A23, 0x4B3F2AD2, 0xC6A9454E, 0xB3FCE5BF,
+        0x2C0204AC, 0x5957A45D, 0xC88EC0CB, 0xBDDB603A, 0x22258129, 0x577021D8,
+        0x93447478, 0xE611D489, 0x79EF359A, 0x0CBA956B, 0x9D63F1FD, 0xE836510C,
+        0x77C8B01F, 0x029D10EE, 0x8F0B7F72, 0xFA5EDF83, 0x65A03E90, 0x10F59E61,
+        0x812CFAF7, 0xF4795A06, 0x6B87BB15, 0x1ED21BE4, 0xABDA626C, 0xDE8FC29D,
+        0x4171238E, 0x3424837F, 0xA5FDE7E9, 0xD0A84718, 0x4F56A60B, 0x3A0306FA,
+        0xB7956966, 0xC2C0C997, 0x5D3E2884, 0x286B8875, 0xB9B2ECE3, 0xCCE74C12,
+        0x5319AD01, 0x264C0DF0, 0x1F81B6E1, 0x6AD41610, 0xF52AF703, 0x807F57F2,
+        0x11A63364, 0x64F39395, 0xFB0D7286, 0x8E58D277, 0x03CEBDEB, 0x769B1D1A,
+        0xE965FC09, 0x9C305CF8, 0x0DE9386E, 0x78BC989F, 0xE742798C, 0x9217D97D,
+        0x271FA0F5, 0x524A0004, 0xCDB4E117, 0xB8E141E6, 0x29382570, 0x5C6D8581,
+        0xC3936492, 0xB6C6C463, 0x3B50ABFF, 0x4E050B0E, 0xD1FBEA1D, 0xA4AE4AEC,
+        0x35772E7A, 0x40228E8B, 0xDFDC6F98, 0xAA89CF69, 0x6EBD9AC9, 0x1BE83A38,
+        0x8416DB2B, 0xF1437BDA, 0x609A1F4C, 0x15CFBFBD, 0x8A315EAE, 0xFF64FE5F,
+        0x72F291C3, 0x07A73132, 0x9859D021, 0xED0C70D0, 0x7CD51446, 0x0980B4B7,
+        0x967E55A4, 0xE32BF555, 0x56238CDD, 0x23762C2C, 0xBC88CD3F, 0xC9DD6DCE,
+        0x58040958, 0x2D51A9A9, 0xB2AF48BA, 0xC7FAE84B, 0x4A6C87D7, 0x3F392726,
+        0xA0C7C635, 0xD59266C4, 0x444B0252, 0x311EA2A3, 0xAEE043B0, 0xDBB5E341,
+        0xFDF9EEB1, 0x88AC4E40, 0x1752AF53, 0x62070FA2, 0xF3DE6B34, 0x868BCBC5,
+        0x19752AD6, 0x6C208A27, 0xE1B6E5BB, 0x94E3454A, 0x0B1DA459, 0x7E4804A8,
+        0xEF91603E, 0x9AC4C0CF, 0x053A21DC, 0x706F812D, 0xC567F8A5, 0xB0325854,
+        0x2FCCB947, 0x5A9919B6, 0xCB407D20, 0xBE15DDD1, 0x21EB3CC2, 0x54BE9C33,
+        0xD928F3AF, 0xAC7D535E, 0x3383B24D, 0x46D612BC, 0xD70F762A, 0xA25AD6DB,
+        0x3DA437C8, 0x48F19739, 0x8CC5C299, 0xF9906268, 0x666E837B, 0x133B238A,
+        0x82E2471C, 0xF7B7E7ED, 0x684906FE, 0x1D1CA60F, 0x908AC993, 0xE5DF6962,
+        0x7A218871, 0x0F742880, 0x9EAD4C16, 0xEBF8ECE7, 0x74060DF4, 0x0153AD05,
+        0xB45BD48D, 0xC10E747C, 0x5EF0956F, 0x2BA5359E, 0xBA7C5108, 0xCF29F1F9,
+        0x50D710EA, 0x2582B01B, 0xA814DF87, 0xDD417F76, 0x42BF9E65, 0x37EA3E94,
+        0xA6335A02, 0xD366FAF3, 0x4C981BE0, 0x39CDBB11
+    },
+    {
+        0x00000000, 0x3F036DC2, 0x7E06DB84, 0x4105B646, 0xFC0DB708, 0xC30EDACA,
+        0x820B6C8C, 0xBD08014E, 0x236A6851, 0x1C690593, 0x5D6CB3D5, 0x626FDE17,
+        0xDF67DF59, 0xE064B29B, 0xA16104DD, 0x9E62691F, 0x46D4D0A2, 0x79D7BD60,
+        0x38D20B26, 0x07D166E4, 0xBAD967AA, 0x85DA0A68, 0xC4DFBC2E, 0xFBDCD1EC,
+        0x65BEB8F3, 0x5ABDD531, 0x1BB86377, 0x24BB0EB5, 0x99B30FFB, 0xA6B06239,
+        0xE7B5D47F, 0xD8B6B9BD, 0x8DA9A144, 0xB2AACC86, 0xF3AF7AC0, 0xCCAC1702,
+        0x71A4164C, 0x4EA77B8E, 0x0FA2CDC8, 0x30A1A00A, 0xAEC3C915, 0x91C0A4D7,
+        0xD0C51291, 0xEFC67F53, 0x52CE7E1D, 0x6DCD13DF, 0x2CC8A599, 0x13CBC85B,
+        0xCB7D71E6, 0xF47E1C24, 0xB57BAA62, 0x8A78C7A0, 0x3770C6EE, 0x0873AB2C,
+        0x49761D6A, 0x767570A8, 0xE81719B7, 0xD7147475, 0x9611C233, 0xA912AFF1,
+        0x141AAEBF, 0x2B19C37D, 0x6A1C753B, 0x551F18F9, 0xC02244C9, 0xFF21290B,
+        0xBE249F4D, 0x8127F28F, 0x3C2FF3C1, 0x032C9E03, 0x42292845, 0x7D2A4587,
+        0xE3482C98, 0xDC4B415A, 0x9D4EF71C, 0xA24D9ADE, 0x1F459B90, 0x2046F652,
+        0x61434014, 0x5E402DD6, 0x86F6946B, 0xB9F5F9A9, 0xF8F04FEF, 0xC7F3222D,
+        0x7AFB2363, 0x45F84EA1, 0x04FDF8E7, 0x3BFE9525, 0xA59CFC3A, 0x9A9F91F8,
+        0xDB9A27BE, 0xE4994A7C, 0x59914B32, 0x669226F0, 0x279790B6, 0x1894FD74,
+        0x4D8BE58D, 0x7288884F, 0x338D3E09, 0x0C8E53CB, 0xB1865285, 0x8E853F47,
+        0xCF808901, 0xF083E4C3, 0x6EE18DDC, 0x51E2E01E, 0x10E75658, 0x2FE43B9A,
+        0x92EC3AD4, 0xADEF5716, 0xECEAE150, 0xD3E98C92, 0x0B5F352F, 0x345C58ED,
+        0x7559EEAB, 0x4A5A8369, 0xF7528227, 0xC851EFE5, 0x895459A3, 0xB6573461,
+        0x28355D7E, 0x173630BC, 0x563386FA, 0x6930EB38, 0xD438EA76, 0xEB3B87B4,
+        0xAA3E31F2, 0x953D5C30, 0x5B358FD3, 0x6436E211, 0x25335457, 0x1A303995,
+        0xA73838DB, 0x983B5519, 0xD93EE35F, 0xE63D8E9D, 0x785FE782, 0x475C8A40,
+        0x06593C06, 0x395A51C4, 0x8452508A, 0xBB513D48, 0xFA548B0E, 0xC557E6CC,
+        0x1DE15F71, 0x22E232B3, 0x63E784F5, 0x5CE4E937, 0xE1ECE879, 0xDEEF85BB,
+        0x9FEA33FD, 0xA0E95E3F, 0x3E8B3720, 0x01885AE2, 0x408DECA4, 0x7F8E8166,
+        0xC2868028, 0xFD85EDEA, 0xBC805BAC, 0x8383366E, 0xD69C2E97, 0xE99F4355,
+        0xA89AF513, 0x979998D1, 0x2A91999F, 0x1592F45D, 0x5497421B, 0x6B942FD9,
+        0xF5F646C6, 0xCAF52B04, 0x8BF09D42, 0xB4F3F080, 0x09FBF1CE, 0x36F89C0C,
+        0x77FD2A4A, 0x48FE4788, 0x9048FE35, 0xAF4B93F7, 0xEE4E25B1, 0xD14D4873,
+        0x6C45493D, 0x534624FF, 0x124392B9, 0x2D40FF7B, 0xB3229664, 0x8C21FBA6,
+        0xCD244DE0, 0xF2272022, 0x4F2F216C, 0x702C4CAE, 0x3129FAE8, 0x0E2A972A,
+        0x9B17CB1A, 0xA414A6D8, 0xE511109E, 0xDA127D5C, 0x671A7C12, 0x581911D0,
+        0x191CA796, 0x261FCA54, 0xB87DA34B, 0x877ECE89, 0xC67B78CF, 0xF978150D,
+        0x44701443, 0x7B737981, 0x3A76CFC7, 0x0575A205, 0xDDC31BB8, 0xE2C0767A,
+        0xA3C5C03C, 0x9CC6ADFE, 0x21CEACB0, 0x1ECDC172, 0x5FC87734, 0x60CB1AF6,
+        0xFEA973E9, 0xC1AA1E2B, 0x80AFA86D, 0xBFACC5AF, 0x02A4C4E1, 0x3DA7A923,
+        0x7CA21F65, 0x43A172A7, 0x16BE6A5E, 0x29BD079C, 0x68B8B1DA, 0x57BBDC18,
+        0xEAB3DD56, 0xD5B0B094, 0x94B506D2, 0xABB66B10, 0x35D4020F, 0x0AD76FCD,
+        0x4BD2D98B, 0x74D1B449, 0xC9D9B507, 0xF6DAD8C5, 0xB7DF6E83, 0x88DC0341,
+        0x506ABAFC, 0x6F69D73E, 0x2E6C6178, 0x116F0CBA, 0xAC670DF4, 0x93646036,
+        0xD261D670, 0xED62BBB2, 0x7300D2AD, 0x4C03BF6F, 0x0D060929, 0x320564EB,
+        0x8F0D65A5, 0xB00E0867, 0xF10BBE21, 0xCE08D3E3
+    },
+    {
+        0x00000000, 0xB66B1FA6, 0xB7A7390D, 0x01CC26AB, 0xB43F745B, 0x02546BFD,
+        0x03984D56, 0xB5F352F0, 0xB30FEEF7, 0x0564F151, 0x04A8D7FA, 0xB2C3C85C,
+        0x07309AAC, 0xB15B850A, 0xB097A3A1, 0x06FCBC07, 0xBD6EDBAF, 0x0B05C409,
+        0x0AC9E2A2, 0xBCA2FD04, 0x0951AFF4, 0xBF3AB052, 0xBEF696F9, 0x089D895F,
+        0x0E613558, 0xB80A2AFE, 0xB9C60C55, 0x0FAD13F3, 0xBA5E4103, 0x0C355EA5,
+        0x0DF9780E, 0xBB9267A8, 0xA1ACB11F, 0x17C7AEB9, 0x160B8812, 0xA06097B4,
+        0x1593C544, 0xA3F8DAE2, 0xA234FC49, 0x145FE3EF, 0x12A35FE8, 0xA4C8404E,
+        0xA50466E5, 0x136F7943, 0xA69C2BB3, 0x10F73415, 0x113B12BE, 0xA7500D18,
+        0x1CC26AB0, 0xAAA97516, 0xAB6553BD, 0x1D0E4C1B, 0xA8FD1EEB, 0x1E96014D,
+        0x1F5A27E6, 0xA9313840, 0xAFCD8447, 0x19A69BE1, 0x186ABD4A, 0xAE01A2EC,
+        0x1BF2F01C, 0xAD99EFBA, 0xAC55C911, 0x1A3ED6B7, 0x9828647F, 0x2E437BD9,
+        0x2F8F5D72, 0x99E442D4, 0x2C171024, 0x9A7C0F82, 0x9BB02929, 0x2DDB368F,
+        0x2B278A88, 0x9D4C952E, 0x9C80B385, 0x2AEBAC23, 0x9F18FED3, 0x2973E175,
+        0x28BFC7DE, 0x9ED4D878, 0x2546BFD0, 0x932DA076, 0x92E186DD, 0x248A997B,
+        0x9179CB8B, 0x2712D42D, 0x26DEF286, 0x90B5ED20, 0x96495127, 0x20224E81,
+        0x21EE682A, 0x9785778C, 0x2276257C, 0x941D3ADA, 0x95D11C71, 0x23BA03D7,
+        0x3984D560, 0x8FEFCAC6, 0x8E23EC6D, 0x3848F3CB, 0x8DBBA13B, 0x3BD0BE9D,
+        0x3A1C9836, 0x8C778790, 0x8A8B3B97, 0x3CE02431, 0x3D2C029A, 0x8B471D3C,
+        0x3EB44FCC, 0x88DF506A, 0x891376C1, 0x3F786967, 0x84EA0ECF, 0x32811169,
+        0x334D37C2, 0x85262864, 0x30D57A94, 0x86BE6532, 0x87724399, 0x31195C3F,
+        0x37E5E038, 0x818EFF9E, 0x8042D935, 0x3629C693, 0x83DA9463, 0x35B18BC5,
+        0x347DAD6E, 0x8216B2C8, 0xEB21CEBF, 0x5D4AD119, 0x5C86F7B2, 0xEAEDE814,
+        0x5F1EBAE4, 0xE975A542, 0xE8B983E9, 0x5ED29C4F, 0x582E2048, 0xEE453FEE,
+        0xEF891945, 0x59E206E3, 0xEC115413, 0x5A7A4BB5, 0x5BB66D1E, 0xEDDD72B8,
+        0x564F1510, 0xE0240AB6, 0xE1E82C1D, 0x578333BB, 0xE270614B, 0x541B7EED,
+        0x55D75846, 0xE3BC47E0, 0xE540FBE7, 0x532BE441, 0x52E7C2EA, 0xE48CDD4C,
+        0x517F8FBC, 0xE714901A, 0xE6D8B6B1, 0x50B3A917, 0x4A8D7FA0, 0xFCE66006,
+        0xFD2A46AD, 0x4B41590B, 0xFEB20BFB, 0x48D9145D, 0x491532F6, 0xFF7E2D50,
+        0xF9829157, 0x4FE98EF1, 0x4E25A85A, 0xF84EB7FC, 0x4DBDE50C, 0xFBD6FAAA,
+        0xFA1ADC01, 0x4C71C3A7, 0xF7E3A40F, 0x4188BBA9, 0x40449D02, 0xF62F82A4,
+        0x43DCD054, 0xF5B7CFF2, 0xF47BE959, 0x4210F6FF, 0x44EC4AF8, 0xF287555E,
+        0xF34B73F5, 0x45206C53, 0xF0D33EA3, 0x46B82105, 0x477407AE, 0xF11F1808,
+        0x7309AAC0, 0xC562B566, 0xC4AE93CD, 0x72C58C6B, 0xC736DE9B, 0x715DC13D,
+        0x7091E796, 0xC6FAF830, 0xC0064437, 0x766D5B91, 0x77A17D3A, 0xC1CA629C,
+        0x7439306C, 0xC2522FCA, 0xC39E0961, 0x75F516C7, 0xCE67716F, 0x780C6EC9,
+        0x79C04862, 0xCFAB57C4, 0x7A580534, 0xCC331A92, 0xCDFF3C39, 0x7B94239F,
+        0x7D689F98, 0xCB03803E, 0xCACFA695, 0x7CA4B933, 0xC957EBC3, 0x7F3CF465,
+        0x7EF0D2CE, 0xC89BCD68, 0xD2A51BDF, 0x64CE0479, 0x650222D2, 0xD3693D74,
+        0x669A6F84, 0xD0F17022, 0xD13D5689, 0x6756492F, 0x61AAF528, 0xD7C1EA8E,
+        0xD60DCC25, 0x6066D383, 0xD5958173, 0x63FE9ED5, 0x6232B87E, 0xD459A7D8,
+        0x6FCBC070, 0xD9A0DFD6, 0xD86CF97D, 0x6E07E6DB, 0xDBF4B42B, 0x6D9FAB8D,
+        0x6C538D26, 0xDA389280, 0xDCC42E87, 0x6AAF3121, 0x6B63178A, 0xDD08082C,
+        0x68FB5ADC, 0xDE90457A, 0xDF5C63D1, 0x69377C77
+    },
+    {
+        0x00000000, 0x0D329B3F, 0x1A65367E, 0x1757AD41, 0x34CA6CFC, 0x39F8F7C3,
+        0x2EAF5A82, 0x239DC1BD, 0x6994D9F8, 0x64A642C7, 0x73F1EF86, 0x7EC374B9,
+        0x5D5EB504, 0x506C2E3B, 0x473B837A, 0x4A091845, 0xD329B3F0, 0xDE1B28CF,
+        0xC94C858E, 0xC47E1EB1, 0xE7E3DF0C, 0xEAD14433, 0xFD86E972, 0xF0B4724D,
+        0xBABD6A08, 0xB78FF137, 0xA0D85C76, 0xADEAC749, 0x8E7706F4, 0x83459DCB,
+        0x9412308A, 0x9920ABB5, 0x7D2261A1, 0x7010FA9E, 0x674757DF, 0x6A75CCE0,
+        0x49E80D5D, 0x44DA9662, 0x538D3B23, 0x5EBFA01C, 0x14B6B859, 0x19842366,
+        0x0ED38E27, 0x03E11518, 0x207CD4A5, 0x2D4E4F9A, 0x3A19E2DB, 0x372B79E4,
+        0xAE0BD251, 0xA339496E, 0xB46EE42F, 0xB95C7F10, 0x9AC1BEAD, 0x97F32592,
+        0x80A488D3, 0x8D9613EC, 0xC79F0BA9, 0xCAAD9096, 0xDDFA3DD7, 0xD0C8A6E8,
+        0xF3556755, 0xFE67FC6A, 0xE930512B, 0xE402CA14, 0xFA44C342, 0xF776587D,
+        0xE021F53C, 0xED136E03, 0xCE8EAFBE, 0xC3BC3481, 0xD4EB99C0, 0xD9D902FF,
+        0x93D01ABA, 0x9EE28185, 0x89B52CC4, 0x8487B7FB, 0xA71A7646, 0xAA28ED79,
+        0xBD7F4038, 0xB04DDB07, 0x296D70B2, 0x245FEB8D, 0x330846CC, 0x3E3ADDF3,
+        0x1DA71C4E, 0x10958771, 0x07C22A30, 0x0AF0B10F, 0x40F9A94A, 0x4DCB3275,
+        0x5A9C9F34, 0x57AE040B, 0x7433C5B6, 0x79015E89, 0x6E56F3C8, 0x636468F7,
+        0x8766A2E3, 0x8A5439DC, 0x9D03949D, 0x90310FA2, 0xB3ACCE1F, 0xBE9E5520,
+        0xA9C9F861, 0xA4FB635E, 0xEEF27B1B, 0xE3C0E024, 0xF4974D65, 0xF9A5D65A,
+        0xDA3817E7, 0xD70A8CD8, 0xC05D2199, 0xCD6FBAA6, 0x544F1113, 0x597D8A2C,
+        0x4E2A276D, 0x4318BC52, 0x60857DEF, 0x6DB7E6D0, 0x7AE04B91, 0x77D2D0AE,
+        0x3DDBC8EB, 0x30E953D4, 0x27BEFE95, 0x2A8C65AA, 0x0911A417, 0x04233F28,
+        0x13749269, 0x1E460956, 0x2FF880C5, 0x22CA1BFA, 0x359DB6BB, 0x38AF2D84,
+        0x1B32EC39, 0x16007706, 0x0157DA47, 0x0C654178, 0x466C593D, 0x4B5EC202,
+        0x5C096F43, 0x513BF47C, 0x72A635C1, 0x7F94AEFE, 0x68C303BF, 0x65F19880,
+        0xFCD13335, 0xF1E3A80A, 0xE6B4054B, 0xEB869E74, 0xC81B5FC9, 0xC529C4F6,
+        0xD27E69B7, 0xDF4CF288, 0x9545EACD, 0x987771F2, 0x8F20DCB3, 0x8212478C,
+        0xA18F8631, 0xACBD1D0E, 0xBBEAB04F, 0xB6D82B70, 0x52DAE164, 0x5FE87A5B,
+        0x48BFD71A, 0x458D4C25, 0x66108D98, 0x6B2216A7, 0x7C75BBE6, 0x714720D9,
+        0x3B4E389C, 0x367CA3A3, 0x212B0EE2, 0x2C1995DD, 0x0F845460, 0x02B6CF5F,
+        0x15E1621E, 0x18D3F921, 0x81F35294, 0x8CC1C9AB, 0x9B9664EA, 0x96A4FFD5,
+        0xB5393E68, 0xB80BA557, 0xAF5C0816, 0xA26E9329, 0xE8678B6C, 0xE5551053,
+        0xF202BD12, 0xFF30262D, 0xDCADE790, 0xD19F7CAF, 0xC6C8D1EE, 0xCBFA4AD1,
+        0xD5BC4387, 0xD88ED8B8, 0xCFD975F9, 0xC2EBEEC6, 0xE1762F7B, 0xEC44B444,
+        0xFB131905, 0xF621823A, 0xBC289A7F, 0xB11A0140, 0xA64DAC01, 0xAB7F373E,
+        0x88E2F683, 0x85D06DBC, 0x9287C0FD, 0x9FB55BC2, 0x0695F077, 0x0BA76B48,
+        0x1CF0C609, 0x11C25D36, 0x325F9C8B, 0x3F6D07B4, 0x283AAAF5, 0x250831CA,
+        0x6F01298F, 0x6233B2B0, 0x75641FF1, 0x785684CE, 0x5BCB4573, 0x56F9DE4C,
+        0x41AE730D, 0x4C9CE832, 0xA89E2226, 0xA5ACB919, 0xB2FB1458, 0xBFC98F67,
+        0x9C544EDA, 0x9166D5E5, 0x863178A4, 0x8B03E39B, 0xC10AFBDE, 0xCC3860E1,
+        0xDB6FCDA0, 0xD65D569F, 0xF5C09722, 0xF8F20C1D, 0xEFA5A15C, 0xE2973A63,
+        0x7BB791D6, 0x76850AE9, 0x61D2A7A8, 0x6CE03C97, 0x4F7DFD2A, 0x424F6615,
+        0x5518CB54, 0x582A506B, 0x1223482E, 0x1F11D311, 0x08467E50, 0x0574E56F,
+        0x26E924D2, 0x2BDBBFED, 0x3C8C12AC, 0x31BE8993
+    },
+    {
+        0x00000000, 0x5FF1018A, 0xBFE20314, 0xE013029E, 0xA4B50069, 0xFB4401E3,
+        0x1B57037D, 0x44A602F7, 0x921B0693, 0xCDEA0719, 0x2DF90587, 0x7208040D,
+        0x36AE06FA, 0x695F0770, 0x894C05EE, 0xD6BD0464, 0xFF470B67, 0xA0B60AED,
+        0x40A50873, 0x1F5409F9, 0x5BF20B0E, 0x04030A84, 0xE410081A, 0xBBE10990,
+        0x6D5C0DF4, 0x32AD0C7E, 0xD2BE0EE0, 0x8D4F0F6A, 0xC9E90D9D, 0x96180C17,
+        0x760B0E89, 0x29FA0F03, 0x25FF108F, 0x7A0E1105, 0x9A1D139B, 0xC5EC1211,
+        0x814A10E6, 0xDEBB116C, 0x3EA813F2, 0x61591278, 0xB7E4161C, 0xE8151796,
+        0x08061508, 0x57F71482, 0x13511675, 0x4CA017FF, 0xACB31561, 0xF34214EB,
+        0xDAB81BE8, 0x85491A62, 0x655A18FC, 0x3AAB1976, 0x7E0D1B81, 0x21FC1A0B,
+        0xC1EF1895, 0x9E1E191F, 0x48A31D7B, 0x17521CF1, 0xF7411E6F, 0xA8B01FE5,
+        0xEC161D12, 0xB3E71C98, 0x53F41E06, 0x0C051F8C, 0x4BFE211E, 0x140F2094,
+        0xF41C220A, 0xABED2380, 0xEF4B2177, 0xB0BA20FD, 0x50A92263, 0x0F5823E9,
+        0xD9E5278D, 0x86142607, 0x66072499, 0x39F62513, 0x7D5027E4, 0x22A1266E,
+        0xC2B224F0, 0x9D43257A, 0xB4B92A79, 0xEB482BF3, 0x0B5B296D, 0x54AA28E7,
+        0x100C2A10, 0x4FFD2B9A, 0xAFEE2904, 0xF01F288E, 0x26A22CEA, 0x79532D60,
+        0x99402FFE, 0xC6B12E74, 0x82172C83, 0xDDE62D09, 0x3DF52F97, 0x62042E1D,
+        0x6E013191, 0x31F0301B, 0xD1E33285, 0x8E12330F, 0xCAB431F8, 0x95453072,
+        0x755632EC, 0x2AA73366, 0xFC1A3702, 0xA3EB3688, 0x43F83416, 0x1C09359C,
+        0x58AF376B, 0x075E36E1, 0xE74D347F, 0xB8BC35F5, 0x91463AF6, 0xCEB73B7C,
+        0x2EA439E2, 0x71553868, 0x35F33A9F, 0x6A023B15, 0x8A11398B, 0xD5E03801,
+        0x035D3C65, 0x5CAC3DEF, 0xBCBF3F71, 0xE34E3EFB, 0xA7E83C0C, 0xF8193D86,
+        0x180A3F18, 0x47FB3E92, 0x97FC423C, 0xC80D43B6, 0x281E4128, 0x77EF40A2,
+        0x33494255, 0x6CB843DF, 0x8CAB4141, 0xD35A40CB, 0x05E744AF, 0x5A164525,
+        0xBA0547BB, 0xE5F44631, 0xA15244C6, 0xFEA3454C, 0x1EB047D2, 0x41414658,
+        0x68BB495B, 0x374A48D1, 0xD7594A4F, 0x88A84BC5, 0xCC0E4932, 0x93FF48B8,
+        0x73EC4A26, 0x2C1D4BAC, 0xFAA04FC8, 0xA5514E42, 0x45424CDC, 0x1AB34D56,
+        0x5E154FA1, 0x01E44E2B, 0xE1F74CB5, 0xBE064D3F, 0xB20352B3, 0xEDF25339,
+        0x0DE151A7, 0x5210502D, 0x16B652DA, 0x49475350, 0xA95451CE, 0xF6A55044,
+        0x20185420, 0x7FE955AA, 0x9FFA5734, 0xC00B56BE, 0x84AD5449, 0xDB5C55C3,
+        0x3B4F575D, 0x64BE56D7, 0x4D4459D4, 0x12B5585E, 0xF2A65AC0, 0xAD575B4A,
+        0xE9F159BD, 0xB6005837, 0x56135AA9, 0x09E25B23, 0xDF5F5F47, 0x80AE5ECD,
+        0x60BD5C53, 0x3F4C5DD9, 0x7BEA5F2E, 0x241B5EA4, 0xC4085C3A, 0x9BF95DB0,
+        0xDC026322, 0x83F362A8, 0x63E06036, 0x3C1161BC, 0x78B7634B, 0x274662C1,
+        0xC755605F, 0x98A461D5, 0x4E1965B1, 0x11E8643B, 0xF1FB66A5, 0xAE0A672F,
+        0xEAAC65D8, 0xB55D6452, 0x554E66CC, 0x0ABF6746, 0x23456845, 0x7CB469CF,
+        0x9CA76B51, 0xC3566ADB, 0x87F0682C, 0xD80169A6, 0x38126B38, 0x67E36AB2,
+        0xB15E6ED6, 0xEEAF6F5C, 0x0EBC6DC2, 0x514D6C48, 0x15EB6EBF, 0x4A1A6F35,
+        0xAA096DAB, 0xF5F86C21, 0xF9FD73AD, 0xA60C7227, 0x461F70B9, 0x19EE7133,
+        0x5D4873C4, 0x02B9724E, 0xE2AA70D0, 0xBD5B715A, 0x6BE6753E, 0x341774B4,
+        0xD404762A, 0x8BF577A0, 0xCF537557, 0x90A274DD, 0x70B17643, 0x2F4077C9,
+        0x06BA78CA, 0x594B7940, 0xB9587BDE, 0xE6A97A54, 0xA20F78A3, 0xFDFE7929,
+        0x1DED7BB7, 0x421C7A3D, 0x94A17E59, 0xCB507FD3, 0x2B437D4D, 0x74B27CC7,
+        0x30147E30, 0x6FE57FBA, 0x8FF67D24, 0xD0077CAE
+    },
+    {
+        0x00000000, 0xF4898239, 0x32620233, 0xC6EB800A, 0x64C40466, 0x904D865F,
+        0x56A60655, 0xA22F846C, 0xC98808CC, 0x3D018AF5, 0xFBEA0AFF, 0x0F6388C6,
+        0xAD4C0CAA, 0x59C58E93, 0x9F2E0E99, 0x6BA78CA0, 0x486117D9, 0xBCE895E0,
+        0x7A0315EA, 0x8E8A97D3, 0x2CA513BF, 0xD82C9186, 0x1EC7118C, 0xEA4E93B5,
+        0x81E91F15, 0x75609D2C, 0xB38B1D26, 0x47029F1F, 0xE52D1B73, 0x11A4994A,
+        0xD74F1940, 0x23C69B79, 0x90C22FB2, 0x644BAD8B, 0xA2A02D81, 0x5629AFB8,
+        0xF4062BD4, 0x008FA9ED, 0xC66429E7, 0x32EDABDE, 0x594A277E, 0xADC3A547,
+        0x6B28254D, 0x9FA1A774, 0x3D8E2318, 0xC907A121, 0x0FEC212B, 0xFB65A312,
+        0xD8A3386B, 0x2C2ABA52, 0xEAC13A58, 0x1E48B861, 0xBC673C0D, 0x48EEBE34,
+        0x8E053E3E, 0x7A8CBC07, 0x112B30A7, 0xE5A2B29E, 0x23493294, 0xD7C0B0AD,
+        0x75EF34C1, 0x8166B6F8, 0x478D36F2, 0xB304B4CB, 0xFAF55925, 0x0E7CDB1C,
+        0xC8975B16, 0x3C1ED92F, 0x9E315D43, 0x6AB8DF7A, 0xAC535F70, 0x58DADD49,
+        0x337D51E9, 0xC7F4D3D0, 0x011F53DA, 0xF596D1E3, 0x57B9558F, 0xA330D7B6,
+        0x65DB57BC, 0x9152D585, 0xB2944EFC, 0x461DCCC5, 0x80F64CCF, 0x747FCEF6,
+        0xD6504A9A, 0x22D9C8A3, 0xE43248A9, 0x10BBCA90, 0x7B1C4630, 0x8F95C409,
+        0x497E4403, 0xBDF7C63A, 0x1FD84256, 0xEB51C06F, 0x2DBA4065, 0xD933C25C,
+        0x6A377697, 0x9EBEF4AE, 0x585574A4, 0xACDCF69D, 0x0EF372F1, 0xFA7AF0C8,
+        0x3C9170C2, 0xC818F2FB, 0xA3BF7E5B, 0x5736FC62, 0x91DD7C68, 0x6554FE51,
+        0xC77B7A3D, 0x33F2F804, 0xF519780E, 0x0190FA37, 0x2256614E, 0xD6DFE377,
+        0x1034637D, 0xE4BDE144, 0x46926528, 0xB21BE711, 0x74F0671B, 0x8079E522,
+        0xEBDE6982, 0x1F57EBBB, 0xD9BC6BB1, 0x2D35E988, 0x8F1A6DE4, 0x7B93EFDD,
+        0xBD786FD7, 0x49F1EDEE, 0x2E9BB40B, 0xDA123632, 0x1CF9B638, 0xE8703401,
+        0x4A5FB06D, 0xBED63254, 0x783DB25E, 0x8CB43067, 0xE713BCC7, 0x139A3EFE,
+        0xD571BEF4, 0x21F83CCD, 0x83D7B8A1, 0x775E3A98, 0xB1B5BA92, 0x453C38AB,
+        0x66FAA3D2, 0x927321EB, 0x5498A1E1, 0xA01123D8, 0x023EA7B4, 0xF6B7258D,
+        0x305CA587, 0xC4D527BE, 0xAF72AB1E, 0x5BFB2927, 0x9D10A92D, 0x69992B14,
+        0xCBB6AF78, 0x3F3F2D41, 0xF9D4AD4B, 0x0D5D2F72, 0xBE599BB9, 0x4AD01980,
+        0x8C3B998A, 0x78B21BB3, 0xDA9D9FDF, 0x2E141DE6, 0xE8FF9DEC, 0x1C761FD5,
+        0x77D19375, 0x8358114C, 0x45B39146, 0xB13A137F, 0x13159713, 0xE79C152A,
+        0x21779520, 0xD5FE1719, 0xF6388C60, 0x02B10E59, 0xC45A8E53, 0x30D30C6A,
+        0x92FC8806, 0x66750A3F, 0xA09E8A35, 0x5417080C, 0x3FB084AC, 0xCB390695,
+        0x0DD2869F, 0xF95B04A6, 0x5B7480CA, 0xAFFD02F3, 0x691682F9, 0x9D9F00C0,
+        0xD46EED2E, 0x20E76F17, 0xE60CEF1D, 0x12856D24, 0xB0AAE948, 0x44236B71,
+        0x82C8EB7B, 0x76416942, 0x1DE6E5E2, 0xE96F67DB, 0x2F84E7D1, 0xDB0D65E8,
+        0x7922E184, 0x8DAB63BD, 0x4B40E3B7, 0xBFC9618E, 0x9C0FFAF7, 0x688678CE,
+        0xAE6DF8C4, 0x5AE47AFD, 0xF8CBFE91, 0x0C427CA8, 0xCAA9FCA2, 0x3E207E9B,
+        0x5587F23B, 0xA10E7002, 0x67E5F008, 0x936C7231, 0x3143F65D, 0xC5CA7464,
+        0x0321F46E, 0xF7A87657, 0x44ACC29C, 0xB02540A5, 0x76CEC0AF, 0x82474296,
+        0x2068C6FA, 0xD4E144C3, 0x120AC4C9, 0xE68346F0, 0x8D24CA50, 0x79AD4869,
+        0xBF46C863, 0x4BCF4A5A, 0xE9E0CE36, 0x1D694C0F, 0xDB82CC05, 0x2F0B4E3C,
+        0x0CCDD545, 0xF844577C, 0x3EAFD776, 0xCA26554F, 0x6809D123, 0x9C80531A,
+        0x5A6BD310, 0xAEE25129, 0xC545DD89, 0x31CC5FB0, 0xF727DFBA, 0x03AE5D83,
+        0xA181D9EF, 0x55085BD6, 0x93E3DBDC, 0x676A59E5
+    }
+};
+
+
+
+
 /******************************************************************************
  *
  * Function   :  Plx8000_EepromComputeNextCrc
@@ -958,28 +1685,94 @@ Plx8000_EepromComputeNextCrc(
     U32  NextEepromValue
     )
 {
-    U16 i;
-    U32 XorValue;
+    U32 Crc;
+
+
+    // Fold the next value into the CRC a byte at a time (slice-by-4)
+    Crc = *pCrc ^ NextEepromValue;
+
+    *pCrc = Plx8000_CrcTable[3][(Crc >> 24)       ] ^
+            Plx8000_CrcTable[2][(Crc >> 16) & 0xFF] ^
+            Plx8000_CrcTable[1][(Crc >>  8) & 0xFF] ^
+            Plx8000_CrcTable[0][(Crc      ) & 0xFF];
+}
+
 
 
-    // Step through each bit of the CRC
-    for( i = 0; i < 32; ++i )
+
+/******************************************************************************
+ *
+ * Function   :  Plx8000_EepromCrcCompute
+ *
+ * Description:  Updates the CRC over an EEPROM image held in memory
+ *
+ * Notes      :  Data is consumed as little-endian 32-bit values, matching
+ *               the EEPROM offset order. A partial final value is padded
+ *               with 0's, as done when the CRC is calculated from the EEPROM.
+ *
+ ******************************************************************************/
+VOID
+Plx8000_EepromCrcCompute(
+    U8  *pBuffer,
+    U32  ByteCount,
+    U32 *pCrc
+    )
+{
+    U32 i;
+    U32 Crc;
+    U32 Value_0;
+    U32 Value_1;
+
+
+    Crc = *pCrc;
+
+    // Fold two values per iteration (slice-by-8)
+    while (ByteCount >= (2 * sizeof(U32)))
     {
-        // Shift the CRC, XOR'ing in the constant as required
-        XorValue = ((*pCrc ^ (NextEepromValue << i)) & ((U32)1 << 31));
+        Value_0 = ((U32)pBuffer[0] <<  0) | ((U32)pBuffer[1] <<  8) |
+                  ((U32)pBuffer[2] << 16) | ((U32)pBuffer[3] << 24);
+        Value_1 = ((U32)pBuffer[4] <<  0) | ((U32)pBuffer[5] <<  8) |
+                  ((U32)pBuffer[6] << 16) | ((U32)pBuffer[7] << 24);
+
+        Crc ^= Value_0;
+
+        Crc = Plx8000_CrcTable[7][(Crc     >> 24)       ] ^
+              Plx8000_CrcTable[6][(Crc     >> 16) & 0xFF] ^
+              Plx8000_CrcTable[5][(Crc     >>  8) & 0xFF] ^
+              Plx8000_CrcTable[4][(Crc          ) & 0xFF] ^
+              Plx8000_CrcTable[3][(Value_1 >> 24)       ] ^
+              Plx8000_CrcTable[2][(Value_1 >> 16) & 0xFF] ^
+              Plx8000_CrcTable[1][(Value_1 >>  8) & 0xFF] ^
+              Plx8000_CrcTable[0][(Value_1      ) & 0xFF];
+
+        pBuffer   += 2 * sizeof(U32);
+        ByteCount -= 2 * sizeof(U32);
+    }
 
-        if (XorValue)
+    // Fold any remaining value, padding with 0's
+    if (ByteCount != 0)
+    {
+        Value_0 = 0;
+        for (i = 0; (i < sizeof(U32)) && (i < ByteCount); i++)
         {
-            XorValue = CONST_CRC_XOR_VALUE;
+            Value_0 |= (U32)pBuffer[i] << (i * 8);
         }
-        else
+
+        if (ByteCount > sizeof(U32))
         {
-            XorValue = 0;
+            Plx8000_EepromComputeNextCrc( &Crc, Value_0 );
+
+            Value_0 = 0;
+            for (i = sizeof(U32); i < ByteCount; i++)
+            {
+                Value_0 |= (U32)pBuffer[i] << ((i - sizeof(U32)) * 8);
+            }
         }
 
-        // XOR to update the CRC
-        *pCrc = (*pCrc << 1) ^ XorValue;
+        Plx8000_EepromComputeNextCrc( &Crc, Value_0 );
     }
+
+    *pCrc = Crc;
 }
 
 
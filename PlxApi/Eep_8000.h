@@ -74,6 +74,9 @@ extern "C" {
 #define PLX8000_EE_CMD_WRITE            2
 #define PLX8000_EE_CMD_WRITE_STATUS     1
 
+// Number of 32-bit values read back per group when verifying a buffer write
+#define PLX8000_EE_VERIFY_COUNT         16
+
 
 
 
@@ -140,6 +143,39 @@ Plx8000_EepromWriteByOffset_16(
     U16                value
     );
 
+PLX_STATUS
+Plx8000_EepromReadBuffer(
+    PLX_DEVICE_OBJECT *pdx,
+    U32                offset,
+    U32               *pBuffer,
+    U32                ByteCount
+    );
+
+PLX_STATUS
+Plx8000_EepromWriteBuffer(
+    PLX_DEVICE_OBJECT *pdx,
+    U32                offset,
+    U32               *pBuffer,
+    U32                ByteCount,
+    BOOLEAN            bVerify
+    );
+
+PLX_STATUS
+Plx8000_EepromBufferSetup(
+    PLX_DEVICE_OBJECT *pdx,
+    U32                offset,
+    U32                ByteCount,
+    U32               *pRegCmd,
+    U32               *pEepWidth
+    );
+
+VOID
+Plx8000_EepromSetUpperAddress(
+    PLX_DEVICE_OBJECT *pdx,
+    U16                OffsetCtrl,
+    U32                UpperAddr
+    );
+
 BOOLEAN
 Plx8000_EepromWaitIdle(
     PLX_DEVICE_OBJECT *pdx
@@ -157,6 +193,13 @@ Plx8000_EepromComputeNextCrc(
     U32  NextEepromValue
     );
 
+VOID
+Plx8000_EepromCrcCompute(
+    U8  *pBuffer,
+    U32  ByteCount,
+    U32 *pCrc
+    );
+
 U16
 Plx8000_EepromGetCtrlOffset(
     PLX_DEVICE_OBJECT *pdx
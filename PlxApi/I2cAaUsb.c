@@ -196,6 +196,8 @@
 #include "PlxApiDirect.h"
 #include "I2cAaUsb.h"
 
+#include <time.h>       // For time()
+
 #if !defined(PLX_DOS)
     #include "Aardvark.h"
 #endif
@@ -225,9 +227,69 @@
     #define I2C_KEY_HIGH_ADDR_GET(pDev)         Gbl_I2cProp[(pDev)->Key.ApiIndex].LastHighBits
     #define I2C_KEY_HIGH_ADDR_SAVE(pDev,addr)   Gbl_I2cProp[(pDev)->Key.ApiIndex].LastHighBits = (addr)
     #define I2C_KEY_HIGH_ADDR_RESET(pDev)       I2C_KEY_HIGH_ADDR_SAVE( (pDev), I2C_HIGH_ADDR_INIT )
+
+    // Devices found on each I2C USB device during last probe
+    typedef struct _I2C_TOPOLOGY
+    {
+        BOOLEAN        bValid;
+        U16            SlaveAddr;       // Address probed ((U16)-1 = all)
+        U32            UniqueId;        // Unique ID of I2C USB device probed
+        time_t         TimeProbed;
+        U16            KeyCount;
+        PLX_DEVICE_KEY Key[I2C_TOPOLOGY_MAX_KEYS];
+    } I2C_TOPOLOGY;
+
+    static I2C_TOPOLOGY Gbl_I2cTopology[I2C_MAX_DEVICES];
+
+    // Time in seconds a probed topology remains valid (0 = no caching)
+    static U32 Gbl_I2cTopologyTtl = 0;
+#endif
+
+
+/**********************************************
+ *        Portability Thread Support
+ *********************************************/
+#if defined(PLX_MSWINDOWS)
+    #define I2C_THREAD                          HANDLE
+    #define I2C_THREAD_RETURN                   DWORD WINAPI
+    #define I2C_THREAD_EXIT                     0
+    #define I2cThreadCreate(pThread, fn, arg)   ((*(pThread) = CreateThread(NULL, 0, (fn), (arg), 0, NULL)) != NULL)
+    #define I2cThreadJoin(thread)               do { WaitForSingleObject( (thread), INFINITE ); CloseHandle( (thread) ); } while (0)
+#elif defined(PLX_LINUX)
+    #define I2C_THREAD                          pthread_t
+    #define I2C_THREAD_RETURN                   void*
+    #define I2C_THREAD_EXIT                     NULL
+    #define I2cThreadCreate(pThread, fn, arg)   (pthread_create( (pThread), NULL, (fn), (arg) ) == 0)
+    #define I2cThreadJoin(thread)               pthread_join( (thread), NULL )
+#else
+    // No thread support, adapters are probed sequentially
+    #define I2C_THREAD                          int
+    #define I2C_THREAD_RETURN                   int
+    #define I2C_THREAD_EXIT                     0
+    #define I2cThreadCreate(pThread, fn, arg)   FALSE
+    #define I2cThreadJoin(thread)
 #endif
 
 
+static I2C_THREAD_RETURN
+PlxI2c_TopologyScanWorker(
+    VOID *pContext
+    );
+
+static BOOLEAN
+PlxI2c_TopologyKeyMatch(
+    PLX_DEVICE_KEY *pKey,
+    PLX_DEVICE_KEY *pKeyCached
+    );
+
+static PLX_STATUS
+PlxI2c_DeviceProbe(
+    PLX_DEVICE_KEY *pKey,
+    U16             DeviceNumber,
+    PLX_MODE_PROP  *pModeProp
+    );
+
+
 
 
 /******************************************************************************
@@ -386,21 +448,25 @@ PlxI2c_DeviceFindEx(
     PLX_MODE_PROP  *pModeProp
     )
 {
-    U8                i;
+    U16               i;
     int               PortCount;
-    U16               NumMatched;
     U16               TotalMatches;
     U16               Ports[I2C_MAX_DEVICES];
-    U32               RegValue;
-    BOOLEAN           bFound;
-    BOOLEAN           bAutoProbe;
+    U32               UniqueId;
+    U32               UniqueIds[I2C_MAX_DEVICES];
     PLX_STATUS        status;
+    PLX_DEVICE_KEY   *pKeyCached;
     PLX_DEVICE_OBJECT Device;
-    PLX_DEVICE_OBJECT DeviceTemp;
 
 
     // Find all I2C ports
-    PortCount = aa_find_devices( I2C_MAX_DEVICES, Ports );
+    PortCount =
+        aa_find_devices_ext(
+            I2C_MAX_DEVICES,
+            Ports,
+            I2C_MAX_DEVICES,
+            UniqueIds
+            );
     if (PortCount <= 0)
     {
         return PLX_STATUS_NO_DRIVER;
@@ -422,7 +488,7 @@ PlxI2c_DeviceFindEx(
     }
 
     // Verify port was found
-    if (i == PortCount)
+    if ((i == PortCount) || (pModeProp->I2c.I2cPort >= I2C_MAX_DEVICES))
     {
         return PLX_STATUS_INVALID_DATA;
     }
@@ -433,8 +499,7 @@ PlxI2c_DeviceFindEx(
         return PLX_STATUS_IN_USE;
     }
 
-    // Clear the device object
-    RtlZeroMemory( &Device, sizeof(PLX_DEVICE_OBJECT) );
+    UniqueId = UniqueIds[i];
 
     // Use default clock rate if not specified
     if (pModeProp->I2c.ClockRate == 0)
@@ -442,155 +507,209 @@ PlxI2c_DeviceFindEx(
         pModeProp->I2c.ClockRate = I2C_DEFAULT_CLOCK_RATE;
     }
 
-    // Open connection to driver
-    if (PlxI2c_Driver_Connect( &Device, pModeProp ) == FALSE)
+    // Without caching, probe only until the requested device is found
+    if (Gbl_I2cTopologyTtl == 0)
     {
-        return PLX_STATUS_INVALID_OBJECT;
+        return PlxI2c_DeviceProbe( pKey, DeviceNumber, pModeProp );
     }
 
-    TotalMatches = 0;
-
-    // Flag whether to auto-probe slave addresses
-    if (pModeProp->I2c.SlaveAddr == (U16)-1)
+    // Probe adapter only if devices not already cached
+    if (PlxI2c_TopologyIsCached(
+            pModeProp->I2c.I2cPort,
+            UniqueId,
+            pModeProp->I2c.SlaveAddr
+            ) == FALSE)
     {
-        bAutoProbe = TRUE;
+        // Clear the device object
+        RtlZeroMemory( &Device, sizeof(PLX_DEVICE_OBJECT) );
 
-        // Start probe at first I2C address
-        Device.Key.DeviceNumber = 0x38;
-    }
-    else
-    {
-        bAutoProbe = FALSE;
+        // Open connection to driver
+        if (PlxI2c_Driver_Connect( &Device, pModeProp ) == FALSE)
+        {
+            return PLX_STATUS_INVALID_OBJECT;
+        }
 
-        // Use requested slave address
-        Device.Key.DeviceNumber = pModeProp->I2c.SlaveAddr;
-    }
+        // Must validate object so probe API calls don't fail
+        ObjectValidate( &Device );
 
-    // Must validate object so probe API calls don't fail
-    ObjectValidate( &Device );
+        status = PlxI2c_TopologyProbe( &Device, pModeProp->I2c.SlaveAddr );
 
-    // Default to device not found
-    bFound = FALSE;
+        // Close the device
+        PlxI2c_DeviceClose( &Device );
 
-    // Probe devices to check if valid PLX device
-    do
-    {
-        DebugPrintf((" ---- Probe I2C at %02Xh ----\n", Device.Key.DeviceNumber));
+        if (status != PLX_STATUS_OK)
+        {
+            return status;
+        }
+    }
 
-        // Reset temporary device object
-        RtlCopyMemory( &DeviceTemp, &Device, sizeof(PLX_DEVICE_OBJECT) );
+    TotalMatches = 0;
 
-        // Attempt to read Device/Vendor ID
-        RegValue =
-            PlxI2c_PlxRegisterRead(
-                &DeviceTemp,
-                PCI_REG_DEV_VEN_ID, // Port 0 Device/Vendor ID
-                &status,
-                FALSE,              // Adjust for port?
-                FALSE               // Retry on error?
-                );
+    // Search cached devices for the requested match
+    for (i = 0; i < Gbl_I2cTopology[pModeProp->I2c.I2cPort].KeyCount; i++)
+    {
+        pKeyCached = &Gbl_I2cTopology[pModeProp->I2c.I2cPort].Key[i];
 
-        if (status == PLX_STATUS_OK)
+        // Skip devices at other addresses if slave address specified
+        if ( (pModeProp->I2c.SlaveAddr != (U16)-1) &&
+             (pModeProp->I2c.SlaveAddr != pKeyCached->DeviceNumber) )
         {
-            if ( ((RegValue & 0xFFFF) == PLX_PCI_VENDOR_ID_PLX) ||
-                 ((RegValue & 0xFFFF) == PLX_PCI_VENDOR_ID_LSI) )
+            continue;
+        }
+
+        if (PlxI2c_TopologyKeyMatch( pKey, pKeyCached ))
+        {
+            // Match found, check if it is the desired device
+            if (TotalMatches == DeviceNumber)
             {
-                DebugPrintf((
-                    "I2C: Detected device %08X at %02Xh\n",
-                    RegValue, Device.Key.DeviceNumber
-                    ));
+                *pKey = *pKeyCached;
 
-                if ((RegValue & 0xFFFF) == PLX_PCI_VENDOR_ID_LSI)
-                {
-                    // Device found, probe for active ports and compare
-                    status =
-                        PlxDir_ProbeSwitch(
-                            &DeviceTemp,
-                            pKey,
-                            (U16)(DeviceNumber - TotalMatches),
-                            &NumMatched
-                            );
-                }
-                else
-                {
-                    // Legacy device found, determine active ports and compare
-                    status =
-                        PlxI2c_ProbeSwitch(
-                            &DeviceTemp,
-                            pKey,
-                            (U16)(DeviceNumber - TotalMatches),
-                            &NumMatched
-                            );
-                }
+                // Use the requested bus speed
+                pKey->ApiInternal[0] = pModeProp->I2c.ClockRate;
 
-                if (status == PLX_STATUS_OK)
-                {
-                    bFound = TRUE;
-                    break;
-                }
+                // Store API mode
+                pKey->ApiMode = PLX_API_MODE_I2C_AARDVARK;
 
-                // Add number of matched devices
-                TotalMatches += NumMatched;
+                // Validate key
+                ObjectValidate( pKey );
+                return PLX_STATUS_OK;
             }
+
+            TotalMatches++;
         }
+    }
 
-        // Jump to next slave address
-        if (bAutoProbe)
-        {
-            /**************************************************
-             * Possible PLX I2C addresses:
-             *
-             *    38->3F
-             *    58->5F
-             *    68->6F
-             *    70->77
-             *    18->1F
-             *************************************************/
-
-            switch (Device.Key.DeviceNumber)
-            {
-                case 0x3F:
-                    Device.Key.DeviceNumber = 0x58;
-                    break;
+    return PLX_STATUS_INVALID_OBJECT;
+}
 
-                case 0x5F:
-                    Device.Key.DeviceNumber = 0x68;
-                    break;
 
-                case 0x6F:
-                    Device.Key.DeviceNumber = 0x70;
-                    break;
 
-                case 0x78:
-                    Device.Key.DeviceNumber = 0x18;
-                    break;
 
-                case 0x1F:
-                    bAutoProbe = FALSE;
-                    break;
+/******************************************************************************
+ *
+ * Function   :  PlxI2c_TopologyScan
+ *
+ * Description:  Probes the selected I2C USB devices concurrently and caches
+ *               the devices found for use by later device searches
+ *
+ * Note       :  Devices are only cached within the current process. A TTL
+ *               of 0 disables caching, so later searches probe the bus.
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxI2c_TopologyScan(
+    U32  ClockRate,
+    U32  CacheTtlSec,
+    U32  I2cPortMask,
+    U32 *pI2cPorts
+    )
+{
+    int               i;
+    int               PortCount;
+    U16               Ports[I2C_MAX_DEVICES];
+    BOOLEAN           bOpen[I2C_MAX_DEVICES];
+    BOOLEAN           bThreadStarted[I2C_MAX_DEVICES];
+    I2C_THREAD        hThread[I2C_MAX_DEVICES];
+    PLX_MODE_PROP     ModeProp;
+    PLX_DEVICE_OBJECT Device[I2C_MAX_DEVICES];
 
-                default:
-                    Device.Key.DeviceNumber++;
-                    break;
-            }
+
+    *pI2cPorts = 0;
+
+    // Update time devices remain cached
+    Gbl_I2cTopologyTtl = CacheTtlSec;
+
+    // Find all I2C ports
+    PortCount = aa_find_devices( I2C_MAX_DEVICES, Ports );
+    if (PortCount <= 0)
+    {
+        return PLX_STATUS_NO_DRIVER;
+    }
+
+    // Use default clock rate if not specified
+    if (ClockRate == 0)
+    {
+        ClockRate = I2C_DEFAULT_CLOCK_RATE;
+    }
+
+    /*********************************************************
+     * Connecting updates global adapter properties, so all
+     * adapters are opened & closed from this thread. Only
+     * the probes, which access per-adapter state, are run
+     * concurrently.
+     ********************************************************/
+    for (i = 0; i < PortCount; i++)
+    {
+        bOpen[i]          = FALSE;
+        bThreadStarted[i] = FALSE;
+
+        // Skip adapters in use by another application
+        if ( (Ports[i] & AA_PORT_NOT_FREE) ||
+             (Ports[i] >= I2C_MAX_DEVICES) )
+        {
+            continue;
+        }
+
+        // Skip adapters not selected
+        if ((I2cPortMask != 0) && ((I2cPortMask & (1 << Ports[i])) == 0))
+        {
+            continue;
+        }
+
+        RtlZeroMemory( &ModeProp, sizeof(PLX_MODE_PROP) );
+        ModeProp.I2c.I2cPort   = Ports[i];
+        ModeProp.I2c.SlaveAddr = (U16)-1;
+        ModeProp.I2c.ClockRate = ClockRate;
+
+        RtlZeroMemory( &Device[i], sizeof(PLX_DEVICE_OBJECT) );
+
+        if (PlxI2c_Driver_Connect( &Device[i], &ModeProp ))
+        {
+            ObjectValidate( &Device[i] );
+            bOpen[i] = TRUE;
         }
     }
-    while (bAutoProbe && (bFound == FALSE));
 
-    // Close the device
-    PlxI2c_DeviceClose( &Device );
+    // Start a probe of each adapter
+    for (i = 0; i < PortCount; i++)
+    {
+        if (bOpen[i])
+        {
+            bThreadStarted[i] =
+                (BOOLEAN)I2cThreadCreate(
+                    &hThread[i],
+                    PlxI2c_TopologyScanWorker,
+                    &Device[i]
+                    );
 
-    if (bFound)
+            // Revert to probe in current thread on failure
+            if (bThreadStarted[i] == FALSE)
+            {
+                PlxI2c_TopologyProbe( &Device[i], (U16)-1 );
+            }
+        }
+    }
+
+    // Wait for all probes to complete & release adapters
+    for (i = 0; i < PortCount; i++)
     {
-        // Store API mode
-        pKey->ApiMode = PLX_API_MODE_I2C_AARDVARK;
+        if (bThreadStarted[i])
+        {
+            I2cThreadJoin( hThread[i] );
+        }
 
-        // Validate key
-        ObjectValidate( pKey );
-        return PLX_STATUS_OK;
+        if (bOpen[i])
+        {
+            PlxI2c_DeviceClose( &Device[i] );
+
+            if (Gbl_I2cTopology[Device[i].Key.ApiIndex].bValid)
+            {
+                *pI2cPorts |= (1 << Device[i].Key.ApiIndex);
+            }
+        }
     }
 
-    return PLX_STATUS_INVALID_OBJECT;
+    return PLX_STATUS_OK;
 }
 
 
@@ -1133,35 +1252,80 @@ PlxI2c_PlxRegisterWrite(
 
 /*******************************************************************************
  *
- * Function   :  PlxI2c_EepromPresent
+ * Function   :  PlxI2c_PlxRegisterAccessList
  *
- * Description:  Returns the state of the EEPROM as reported by the PLX device
+ * Description:  Performs a list of PLX-specific register reads & writes
+ *
+ * Note       :  The Aardvark I2C master API is synchronous, so entries are
+ *               issued back-to-back in list order. Processing halts on the
+ *               first failed access.
+ *
+ *               The register access lock is held across the whole list, so
+ *               accesses from other threads can't interleave & change the
+ *               high address or AXI index registers between entries. The
+ *               cached values therefore stay valid & only entries that move
+ *               to a different region rewrite them. Port selection is part
+ *               of each I2C command, so it needs no separate write.
  *
  ******************************************************************************/
 PLX_STATUS
-PlxI2c_EepromPresent(
+PlxI2c_PlxRegisterAccessList(
     PLX_DEVICE_OBJECT *pDevice,
-    PLX_EEPROM_STATUS *pStatus
+    PLX_REG_ACCESS    *pList,
+    U32                Count,
+    BOOLEAN            bAdjustForPort
     )
 {
-    // Default to no EEPROM present
-    *pStatus = PLX_EEPROM_STATUS_NONE;
+    U32        idx;
+    PLX_STATUS status;
 
-    switch (pDevice->Key.PlxChip & 0xFF00)
+
+    // Keep other accesses out for the whole list
+    EnterCriticalSection(
+        &(Gbl_I2cProp[pDevice->Key.ApiIndex].Lock_RegAccess)
+        );
+
+    status = PLX_STATUS_OK;
+
+    for (idx = 0; idx < Count; idx++)
     {
-        case 0x2300:
-        case 0x3300:
-        case 0x8500:
-        case 0x8600:
-        case 0x8700:
-        case 0x9700:
-            return Plx8000_EepromPresent(
-                pDevice,
-                (U8*)pStatus
-                );
+        if (pList[idx].bWrite)
+        {
+            status =
+                PlxI2c_PlxRegisterWrite(
+                    pDevice,
+                    pList[idx].Offset,
+                    pList[idx].Value,
+                    bAdjustForPort
+                    );
+        }
+        else
+        {
+            pList[idx].Value =
+                PlxI2c_PlxRegisterRead(
+                    pDevice,
+                    pList[idx].Offset,
+                    &status,
+                    bAdjustForPort,
+                    TRUE        // Retry on error?
+                    );
+        }
+
+        if (status != PLX_STATUS_OK)
+        {
+            DebugPrintf((
+                "ERROR - Register list halted at entry %d (O:%02Xh)\n",
+                idx, pList[idx].Offset
+                ));
+            break;
+        }
     }
 
-    return PLX_STATUS_UNSUPPORTED;
+    LeaveCriticalSection(
+        &(Gbl_I2cProp[pDevice->Key.ApiIndex].Lock_RegAccess)
+        );
+
+    return status;
 }
 
 
@@ -1169,40 +1333,141 @@ PlxI2c_EepromPresent(
 
 /*******************************************************************************
  *
- * Function   :  PlxI2c_EepromProbe
+ * Function   :  PlxI2c_PlxRegisterReadBuffer
  *
- * Description:  Probes for the presence of an EEPROM
+ * Description:  Reads a block of consecutive PLX-specific registers
  *
  ******************************************************************************/
 PLX_STATUS
-PlxI2c_EepromProbe(
+PlxI2c_PlxRegisterReadBuffer(
     PLX_DEVICE_OBJECT *pDevice,
-    BOOLEAN           *pFlag
+    U32                offset,
+    VOID              *pBuffer,
+    U32                ByteCount,
+    BOOLEAN            bAdjustForPort
     )
 {
-    U16        OffsetProbe;
-    U32        TempChip;
-    U32        ValueRead;
-    U32        ValueWrite;
-    U32        ValueOriginal;
+    U32        idx;
     PLX_STATUS status;
 
 
-    // Default to no EEPROM present
-    *pFlag = FALSE;
+    // Verify register offset & size
+    if (offset & 0x3)
+    {
+        return PLX_STATUS_INVALID_OFFSET;
+    }
 
-    // Generalize by device type
-    switch (pDevice->Key.PlxChip & 0xFF00)
+    if ((ByteCount == 0) || (ByteCount & 0x3))
     {
-        case 0x2300:
-        case 0x3300:
-        case 0x8600:
-        case 0x8700:
-        case 0x9700:
-            TempChip = pDevice->Key.PlxChip & 0xFF00;
-            break;
+        return PLX_STATUS_INVALID_SIZE;
+    }
 
-        default:
+    // Keep other accesses out for the whole block
+    EnterCriticalSection(
+        &(Gbl_I2cProp[pDevice->Key.ApiIndex].Lock_RegAccess)
+        );
+
+    status = PLX_STATUS_OK;
+
+    for (idx = 0; idx < ByteCount; idx += sizeof(U32))
+    {
+        *(U32*)((U8*)pBuffer + idx) =
+            PlxI2c_PlxRegisterRead(
+                pDevice,
+                offset + idx,
+                &status,
+                bAdjustForPort,
+                TRUE        // Retry on error?
+                );
+
+        if (status != PLX_STATUS_OK)
+        {
+            break;
+        }
+    }
+
+    LeaveCriticalSection(
+        &(Gbl_I2cProp[pDevice->Key.ApiIndex].Lock_RegAccess)
+        );
+
+    return status;
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxI2c_EepromPresent
+ *
+ * Description:  Returns the state of the EEPROM as reported by the PLX device
+ *
+ ******************************************************************************/
+PLX_STATUS
+PlxI2c_EepromPresent(
+    PLX_DEVICE_OBJECT *pDevice,
+    PLX_EEPROM_STATUS *pStatus
+    )
+{
+    // Default to no EEPROM present
+    *pStatus = PLX_EEPROM_STATUS_NONE;
+
+    switch (pDevice->Key.PlxChip & 0xFF00)
+    {
+        case 0x2300:
+        case 0x3300:
+        case 0x8500:
+        case 0x8600:
+        case 0x8700:
+        case 0x9700:
+            return Plx8000_EepromPresent(
+                pDevice,
+                (U8*)pStatus
+                );
+    }
+
+    return PLX_STATUS_UNSUPPORTED;
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxI2c_EepromProbe
+ *
+ * Description:  Probes for the presence of an EEPROM
+ *
+ ******************************************************************************/
+PLX_STATUS
+PlxI2c_EepromProbe(
+    PLX_DEVICE_OBJECT *pDevice,
+    BOOLEAN           *pFlag
+    )
+{
+    U16        OffsetProbe;
+    U32        TempChip;
+    U32        ValueRead;
+    U32        ValueWrite;
+    U32        ValueOriginal;
+    PLX_STATUS status;
+
+
+    // Default to no EEPROM present
+    *pFlag = FALSE;
+
+    // Generalize by device type
+    switch (pDevice->Key.PlxChip & 0xFF00)
+    {
+        case 0x2300:
+        case 0x3300:
+        case 0x8600:
+        case 0x8700:
+        case 0x9700:
+            TempChip = pDevice->Key.PlxChip & 0xFF00;
+            break;
+
+        default:
             TempChip = pDevice->Key.PlxChip;
             break;
     }
@@ -1744,6 +2009,82 @@ PlxI2c_EepromWriteByOffset_16(
 
 
 
+/*******************************************************************************
+ *
+ * Function   :  PlxI2c_EepromReadBuffer
+ *
+ * Description:  Read a block of 32-bit values from the EEPROM
+ *
+ ******************************************************************************/
+PLX_STATUS
+PlxI2c_EepromReadBuffer(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset,
+    VOID              *pBuffer,
+    U32                ByteCount
+    )
+{
+    switch (pDevice->Key.PlxChip & 0xFF00)
+    {
+        case 0x2300:
+        case 0x3300:
+        case 0x8500:
+        case 0x8600:
+        case 0x8700:
+        case 0x9700:
+            return Plx8000_EepromReadBuffer(
+                pDevice,
+                offset,
+                (U32*)pBuffer,
+                ByteCount
+                );
+    }
+
+    return PLX_STATUS_UNSUPPORTED;
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  PlxI2c_EepromWriteBuffer
+ *
+ * Description:  Write a block of 32-bit values to the EEPROM
+ *
+ ******************************************************************************/
+PLX_STATUS
+PlxI2c_EepromWriteBuffer(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset,
+    VOID              *pBuffer,
+    U32                ByteCount,
+    BOOLEAN            bVerify
+    )
+{
+    switch (pDevice->Key.PlxChip & 0xFF00)
+    {
+        case 0x2300:
+        case 0x3300:
+        case 0x8500:
+        case 0x8600:
+        case 0x8700:
+        case 0x9700:
+            return Plx8000_EepromWriteBuffer(
+                pDevice,
+                offset,
+                (U32*)pBuffer,
+                ByteCount,
+                bVerify
+                );
+    }
+
+    return PLX_STATUS_UNSUPPORTED;
+}
+
+
+
+
 /*******************************************************************************
  *
  * Function   :  PlxI2c_MH_GetProperties
@@ -2552,12 +2893,16 @@ PlxI2c_GenerateCommand(
                 highAddrOffset += ATLAS_REGS_AXI_BASE_ADDR;
             }
 
-            PlxI2c_PlxRegisterWrite(
-                pDevice,
-                highAddrOffset,
-                highAddr,
-                FALSE               // Adjust for port?
-                );
+            if (PlxI2c_PlxRegisterWrite(
+                    pDevice,
+                    highAddrOffset,
+                    highAddr,
+                    FALSE               // Adjust for port?
+                    ) != PLX_STATUS_OK)
+            {
+                // Leave cached value so next access retries the update
+                return I2C_CMD_ERROR;
+            }
 
             // Store high bits to avoid future write if no change
             I2C_KEY_HIGH_ADDR_SAVE( pDevice, highAddr );
@@ -2693,9 +3038,26 @@ PlxI2c_Driver_Connect(
         Gbl_I2cProp[pDevice->Key.ApiIndex].IdxLastAddr = (U32)-1;
 
         // Initialize the register access lock
+#if defined(PLX_LINUX)
+        {
+            pthread_mutexattr_t lockAttr;
+
+
+            // Register lists hold the lock across single register accesses,
+            // so it must be re-entrant like a Windows critical section
+            pthread_mutexattr_init( &lockAttr );
+            pthread_mutexattr_settype( &lockAttr, PTHREAD_MUTEX_RECURSIVE );
+            pthread_mutex_init(
+                &(Gbl_I2cProp[pDevice->Key.ApiIndex].Lock_RegAccess),
+                &lockAttr
+                );
+            pthread_mutexattr_destroy( &lockAttr );
+        }
+#else
         InitializeCriticalSection(
             &(Gbl_I2cProp[pDevice->Key.ApiIndex].Lock_RegAccess)
             );
+#endif
 
         // Increment global open count
         Gbl_OpenCount++;
@@ -2788,12 +3150,10 @@ PlxI2c_Dispatch_IoControl(
             DebugPrintf_Cont(("PLX_IOCTL_PCI_REGISTER_READ\n"));
 
             pIoBuffer->value[1] =
-                PlxI2c_PlxRegisterRead(
+                PlxDir_PlxRegRead(
                     pDevice,
                     (U32)pIoBuffer->value[0],
-                    &(pIoBuffer->ReturnCode),
-                    TRUE,       // Adjust for port?
-                    TRUE        // Retry on error?
+                    &(pIoBuffer->ReturnCode)
                     );
 
             DebugPrintf((
@@ -2807,11 +3167,10 @@ PlxI2c_Dispatch_IoControl(
             DebugPrintf_Cont(("PLX_IOCTL_PCI_REGISTER_WRITE\n"));
 
             pIoBuffer->ReturnCode =
-                PlxI2c_PlxRegisterWrite(
+                PlxDir_PlxRegWrite(
                     pDevice,
                     (U32)pIoBuffer->value[0],
-                    (int)pIoBuffer->value[1],
-                    TRUE        // Adjust for port?
+                    (U32)pIoBuffer->value[1]
                     );
 
             DebugPrintf((
@@ -2829,12 +3188,10 @@ PlxI2c_Dispatch_IoControl(
             DebugPrintf_Cont(("PLX_IOCTL_REGISTER_READ\n"));
 
             pIoBuffer->value[1] =
-                PlxI2c_PlxRegisterRead(
+                PlxDir_PlxRegRead(
                     pDevice,
                     (U32)pIoBuffer->value[0],
-                    &(pIoBuffer->ReturnCode),
-                    TRUE,       // Adjust for port?
-                    TRUE        // Retry on error?
+                    &(pIoBuffer->ReturnCode)
                     );
 
             DebugPrintf((
@@ -2848,11 +3205,10 @@ PlxI2c_Dispatch_IoControl(
             DebugPrintf_Cont(("PLX_IOCTL_REGISTER_WRITE\n"));
 
             pIoBuffer->ReturnCode =
-                PlxI2c_PlxRegisterWrite(
+                PlxDir_PlxRegWrite(
                     pDevice,
                     (U32)pIoBuffer->value[0],
-                    (U32)pIoBuffer->value[1],
-                    TRUE        // Adjust for port?
+                    (U32)pIoBuffer->value[1]
                     );
 
             DebugPrintf((
@@ -2881,16 +3237,43 @@ PlxI2c_Dispatch_IoControl(
                 ));
             break;
 
-        case PLX_IOCTL_MAPPED_REGISTER_WRITE:
-            DebugPrintf_Cont(("PLX_IOCTL_MAPPED_REGISTER_WRITE\n"));
+        case PLX_IOCTL_MAPPED_REGISTER_READ_BUFFER:
+            DebugPrintf_Cont(("PLX_IOCTL_MAPPED_REGISTER_READ_BUFFER\n"));
 
             pIoBuffer->ReturnCode =
-                PlxI2c_PlxRegisterWrite(
+                PlxI2c_PlxRegisterReadBuffer(
                     pDevice,
                     (U32)pIoBuffer->value[0],
+                    PLX_INT_TO_PTR(pIoBuffer->value[2]),
                     (U32)pIoBuffer->value[1],
                     FALSE       // Adjust for port?
                     );
+            break;
+
+        case PLX_IOCTL_REGISTER_ACCESS_LIST:
+            DebugPrintf_Cont(("PLX_IOCTL_REGISTER_ACCESS_LIST\n"));
+
+            // List may contain writes, so drop any cached registers
+            PlxDir_RegCacheFlush( pDevice );
+
+            pIoBuffer->ReturnCode =
+                PlxI2c_PlxRegisterAccessList(
+                    pDevice,
+                    PLX_INT_TO_PTR(pIoBuffer->value[2]),
+                    (U32)pIoBuffer->value[0],
+                    (BOOLEAN)(pIoBuffer->value[1] == FALSE)     // Adjust for port if not mapped
+                    );
+            break;
+
+        case PLX_IOCTL_MAPPED_REGISTER_WRITE:
+            DebugPrintf_Cont(("PLX_IOCTL_MAPPED_REGISTER_WRITE\n"));
+
+            pIoBuffer->ReturnCode =
+                PlxDir_PlxMappedRegWrite(
+                    pDevice,
+                    (U32)pIoBuffer->value[0],
+                    (U32)pIoBuffer->value[1]
+                    );
 
             DebugPrintf((
                 "Wrote %08X to mapped reg %03X\n",
@@ -2983,159 +3366,639 @@ PlxI2c_Dispatch_IoControl(
         case PLX_IOCTL_EEPROM_READ_BY_OFFSET:
             DebugPrintf_Cont(("PLX_IOCTL_EEPROM_READ_BY_OFFSET\n"));
 
-            pIoBuffer->ReturnCode =
-                PlxI2c_EepromReadByOffset(
-                    pDevice,
-                    (U32)pIoBuffer->value[0],
-                    (U32*)&(pIoBuffer->value[1])
-                    );
+            pIoBuffer->ReturnCode =
+                PlxI2c_EepromReadByOffset(
+                    pDevice,
+                    (U32)pIoBuffer->value[0],
+                    (U32*)&(pIoBuffer->value[1])
+                    );
+
+            DebugPrintf((
+                "EEPROM Offset %02X = %08X\n",
+                (int)pIoBuffer->value[0],
+                (int)pIoBuffer->value[1]
+                ));
+            break;
+
+        case PLX_IOCTL_EEPROM_WRITE_BY_OFFSET:
+            DebugPrintf_Cont(("PLX_IOCTL_EEPROM_WRITE_BY_OFFSET\n"));
+
+            pIoBuffer->ReturnCode =
+                PlxI2c_EepromWriteByOffset(
+                    pDevice,
+                    (U32)pIoBuffer->value[0],
+                    (U32)pIoBuffer->value[1]
+                    );
+
+            DebugPrintf((
+                "Wrote %08X to EEPROM Offset %02X\n",
+                (int)pIoBuffer->value[1],
+                (int)pIoBuffer->value[0]
+                ));
+            break;
+
+        case PLX_IOCTL_EEPROM_READ_BY_OFFSET_16:
+            DebugPrintf_Cont(("PLX_IOCTL_EEPROM_READ_BY_OFFSET_16\n"));
+
+            pIoBuffer->ReturnCode =
+                PlxI2c_EepromReadByOffset_16(
+                    pDevice,
+                    (U32)pIoBuffer->value[0],
+                    (U16*)&(pIoBuffer->value[1])
+                    );
+
+            DebugPrintf((
+                "EEPROM Offset %02X = %04X\n",
+                (int)pIoBuffer->value[0],
+                (U16)pIoBuffer->value[1]
+                ));
+            break;
+
+        case PLX_IOCTL_EEPROM_WRITE_BY_OFFSET_16:
+            DebugPrintf_Cont(("PLX_IOCTL_EEPROM_WRITE_BY_OFFSET_16\n"));
+
+            pIoBuffer->ReturnCode =
+                PlxI2c_EepromWriteByOffset_16(
+                    pDevice,
+                    (U32)pIoBuffer->value[0],
+                    (U16)pIoBuffer->value[1]
+                    );
+
+            DebugPrintf((
+                "Wrote %04X to EEPROM Offset %02X\n",
+                (U16)pIoBuffer->value[1],
+                (int)pIoBuffer->value[0]
+                ));
+            break;
+
+        case PLX_IOCTL_EEPROM_READ_BUFFER:
+            DebugPrintf_Cont(("PLX_IOCTL_EEPROM_READ_BUFFER\n"));
+
+            pIoBuffer->ReturnCode =
+                PlxI2c_EepromReadBuffer(
+                    pDevice,
+                    (U32)pIoBuffer->value[0],
+                    PLX_INT_TO_PTR(pIoBuffer->value[2]),
+                    (U32)pIoBuffer->value[1]
+                    );
+            break;
+
+        case PLX_IOCTL_EEPROM_WRITE_BUFFER:
+            DebugPrintf_Cont(("PLX_IOCTL_EEPROM_WRITE_BUFFER\n"));
+
+            pIoBuffer->ReturnCode =
+                PlxI2c_EepromWriteBuffer(
+                    pDevice,
+                    (U32)pIoBuffer->value[0],
+                    PLX_INT_TO_PTR(pIoBuffer->value[2]),
+                    (U32)pIoBuffer->value[1],
+                    (BOOLEAN)pIoBuffer->u.ExData[0]
+                    );
+            break;
+
+
+        /******************************************
+         * Performance Monitor Functions
+         *****************************************/
+        case PLX_IOCTL_PERFORMANCE_INIT_PROPERTIES:
+            DebugPrintf_Cont(("PLX_IOCTL_PERFORMANCE_INIT_PROPERTIES\n"));
+
+            pIoBuffer->ReturnCode =
+                PlxDir_PerformanceInitializeProperties(
+                    pDevice,
+                    PLX_INT_TO_PTR(pIoBuffer->value[0])
+                    );
+            break;
+
+        case PLX_IOCTL_PERFORMANCE_MONITOR_CTRL:
+            DebugPrintf_Cont(("PLX_IOCTL_PERFORMANCE_MONITOR_CTRL\n"));
+
+            pIoBuffer->ReturnCode =
+                PlxDir_PerformanceMonitorControl(
+                    pDevice,
+                    (PLX_PERF_CMD)pIoBuffer->value[0]
+                    );
+            break;
+
+        case PLX_IOCTL_PERFORMANCE_RESET_COUNTERS:
+            DebugPrintf_Cont(("PLX_IOCTL_PERFORMANCE_RESET_COUNTERS\n"));
+
+            pIoBuffer->ReturnCode =
+                PlxDir_PerformanceResetCounters(
+                    pDevice
+                    );
+            break;
+
+        case PLX_IOCTL_PERFORMANCE_GET_COUNTERS:
+            DebugPrintf_Cont(("PLX_IOCTL_PERFORMANCE_GET_COUNTERS\n"));
+
+            pIoBuffer->ReturnCode =
+                PlxDir_PerformanceGetCounters(
+                    pDevice,
+                    PLX_INT_TO_PTR(pIoBuffer->value[0]),
+                    (U8)pIoBuffer->value[1]
+                    );
+            break;
+
+
+        /******************************************
+         * PLX Multi-Host Functions
+         *****************************************/
+        case PLX_IOCTL_MH_GET_PROPERTIES:
+            DebugPrintf_Cont(("PLX_IOCTL_MH_GET_PROPERTIES\n"));
+
+            pIoBuffer->ReturnCode =
+                PlxI2c_MH_GetProperties(
+                    pDevice,
+                    &pIoBuffer->u.MH_Prop
+                    );
+            break;
+
+        case PLX_IOCTL_MH_MIGRATE_DS_PORTS:
+            DebugPrintf_Cont(("PLX_IOCTL_MH_MIGRATE_DS_PORTS\n"));
+
+            pIoBuffer->ReturnCode =
+                PlxI2c_MH_MigrateDsPorts(
+                    pDevice,
+                    (U16)(pIoBuffer->value[0] >> 16),
+                    (U16)(pIoBuffer->value[0] & 0xFFFF),
+                    (U32)pIoBuffer->value[1],
+                    (BOOLEAN)pIoBuffer->value[2]
+                    );
+            break;
+
+
+        /******************************************
+         * Unsupported Messages
+         *****************************************/
+        default:
+            DebugPrintf_Cont((
+                "Unsupported PLX_IOCTL_Xxx (%08Xh)\n",
+                IoControlCode
+                ));
+
+            pIoBuffer->ReturnCode = PLX_STATUS_UNSUPPORTED;
+            break;
+    }
+
+    DebugPrintf(("...Completed message\n"));
+
+    return 0;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxI2c_ProbeAddressNext
+ *
+ * Description:  Returns the next possible PLX chip I2C slave address or 0
+ *               if no more addresses to probe
+ *
+ ******************************************************************************/
+U16
+PlxI2c_ProbeAddressNext(
+    U16 SlaveAddr
+    )
+{
+    /**************************************************
+     * Possible PLX I2C addresses:
+     *
+     *    38->3F
+     *    58->5F
+     *    68->6F
+     *    70->77
+     *    18->1F
+     *************************************************/
+    switch (SlaveAddr)
+    {
+        case 0x3F:
+            return 0x58;
+
+        case 0x5F:
+            return 0x68;
+
+        case 0x6F:
+            return 0x70;
+
+        case 0x78:
+            return 0x18;
+
+        case 0x1F:
+            return 0;
+    }
+
+    return (U16)(SlaveAddr + 1);
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxI2c_TopologyIsCached
+ *
+ * Description:  Determines whether devices at a slave address are available
+ *               from a previous probe of the I2C USB device
+ *
+ ******************************************************************************/
+BOOLEAN
+PlxI2c_TopologyIsCached(
+    U16 I2cPort,
+    U32 UniqueId,
+    U16 SlaveAddr
+    )
+{
+    U16 addr;
+
+
+    if ( (Gbl_I2cTopology[I2cPort].bValid == FALSE) ||
+         (Gbl_I2cTopology[I2cPort].UniqueId != UniqueId) ||
+         ((U32)(time(NULL) - Gbl_I2cTopology[I2cPort].TimeProbed) >= Gbl_I2cTopologyTtl) )
+    {
+        return FALSE;
+    }
+
+    // Cached devices valid if same address probed
+    if (Gbl_I2cTopology[I2cPort].SlaveAddr == SlaveAddr)
+    {
+        return TRUE;
+    }
+
+    // Any other address must be fully probed
+    if (Gbl_I2cTopology[I2cPort].SlaveAddr != (U16)-1)
+    {
+        return FALSE;
+    }
+
+    // Verify specific address is covered by a full probe
+    addr = I2C_PROBE_ADDR_FIRST;
+
+    while (addr != 0)
+    {
+        if (addr == SlaveAddr)
+        {
+            return TRUE;
+        }
+
+        addr = PlxI2c_ProbeAddressNext( addr );
+    }
+
+    return FALSE;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxI2c_TopologyProbe
+ *
+ * Description:  Probes all PLX chips on an I2C USB device & stores the keys
+ *               of all ports found
+ *
+ ******************************************************************************/
+PLX_STATUS
+PlxI2c_TopologyProbe(
+    PLX_DEVICE_OBJECT *pDevice,
+    U16                SlaveAddr
+    )
+{
+    U16               NumMatched;
+    U32               RegValue;
+    PLX_STATUS        status;
+    I2C_TOPOLOGY     *pTopo;
+    PLX_PROBE_LIST    List;
+    PLX_DEVICE_KEY    KeyAll;
+    PLX_DEVICE_OBJECT DeviceTemp;
+
+
+    pTopo = &Gbl_I2cTopology[pDevice->Key.ApiIndex];
+
+    // Invalidate any previous devices
+    pTopo->bValid   = FALSE;
+    pTopo->KeyCount = 0;
+
+    // Match all ports of each chip
+    memset( &KeyAll, PCI_FIELD_IGNORE, sizeof(PLX_DEVICE_KEY) );
+
+    List.pKeys   = pTopo->Key;
+    List.MaxKeys = I2C_TOPOLOGY_MAX_KEYS;
+    List.Count   = 0;
+
+    // Start probe at first I2C address if auto-probe requested
+    if (SlaveAddr == (U16)-1)
+    {
+        pDevice->Key.DeviceNumber = I2C_PROBE_ADDR_FIRST;
+    }
+    else
+    {
+        pDevice->Key.DeviceNumber = SlaveAddr;
+    }
+
+    // Probe devices to check if valid PLX device
+    do
+    {
+        DebugPrintf((" ---- Probe I2C at %02Xh ----\n", pDevice->Key.DeviceNumber));
+
+        // Reset temporary device object
+        RtlCopyMemory( &DeviceTemp, pDevice, sizeof(PLX_DEVICE_OBJECT) );
+
+        // Attempt to read Device/Vendor ID
+        RegValue =
+            PlxI2c_PlxRegisterRead(
+                &DeviceTemp,
+                PCI_REG_DEV_VEN_ID, // Port 0 Device/Vendor ID
+                &status,
+                FALSE,              // Adjust for port?
+                FALSE               // Retry on error?
+                );
+
+        if (status == PLX_STATUS_OK)
+        {
+            if ( ((RegValue & 0xFFFF) == PLX_PCI_VENDOR_ID_PLX) ||
+                 ((RegValue & 0xFFFF) == PLX_PCI_VENDOR_ID_LSI) )
+            {
+                DebugPrintf((
+                    "I2C: Detected device %08X at %02Xh\n",
+                    RegValue, pDevice->Key.DeviceNumber
+                    ));
+
+                if ((RegValue & 0xFFFF) == PLX_PCI_VENDOR_ID_LSI)
+                {
+                    // Device found, store all active ports
+                    PlxDir_ProbeSwitch(
+                        &DeviceTemp,
+                        &KeyAll,
+                        0,
+                        &NumMatched,
+                        &List
+                        );
+                }
+                else
+                {
+                    // Legacy device found, store all active ports
+                    PlxI2c_ProbeSwitch(
+                        &DeviceTemp,
+                        &KeyAll,
+                        0,
+                        &NumMatched,
+                        &List
+                        );
+                }
+
+                if (List.Count == List.MaxKeys)
+                {
+                    ErrorPrintf(("WARNING: I2C device list full, some ports not stored\n"));
+                }
+            }
+        }
+
+        // Jump to next slave address
+        if (SlaveAddr == (U16)-1)
+        {
+            pDevice->Key.DeviceNumber = PlxI2c_ProbeAddressNext( pDevice->Key.DeviceNumber );
+        }
+    }
+    while ((SlaveAddr == (U16)-1) && (pDevice->Key.DeviceNumber != 0));
+
+    pTopo->SlaveAddr  = SlaveAddr;
+    pTopo->UniqueId   = aa_unique_id( (Aardvark)PLX_PTR_TO_INT( pDevice->hDevice ) );
+    pTopo->KeyCount   = List.Count;
+    pTopo->TimeProbed = time(NULL);
+    pTopo->bValid     = TRUE;
+
+    DebugPrintf((
+        "I2C: Port %d probe found %d device(s)\n",
+        pDevice->Key.ApiIndex, pTopo->KeyCount
+        ));
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxI2c_TopologyKeyMatch
+ *
+ * Description:  Compares a cached device key against search criteria
+ *
+ ******************************************************************************/
+static BOOLEAN
+PlxI2c_TopologyKeyMatch(
+    PLX_DEVICE_KEY *pKey,
+    PLX_DEVICE_KEY *pKeyCached
+    )
+{
+    // Compare Domain, Bus, Slot, Fn numbers
+    if ( (pKey->domain   != (U8)PCI_FIELD_IGNORE) ||
+         (pKey->bus      != (U8)PCI_FIELD_IGNORE) ||
+         (pKey->slot     != (U8)PCI_FIELD_IGNORE) ||
+         (pKey->function != (U8)PCI_FIELD_IGNORE) )
+    {
+        if ( (pKey->domain   != pKeyCached->domain) ||
+             (pKey->bus      != pKeyCached->bus)    ||
+             (pKey->slot     != pKeyCached->slot)   ||
+             (pKey->function != pKeyCached->function) )
+        {
+            return FALSE;
+        }
+    }
+
+    // Compare Vendor & Device ID
+    if ( ((pKey->VendorId != (U16)PCI_FIELD_IGNORE) &&
+          (pKey->VendorId != pKeyCached->VendorId)) ||
+         ((pKey->DeviceId != (U16)PCI_FIELD_IGNORE) &&
+          (pKey->DeviceId != pKeyCached->DeviceId)) )
+    {
+        return FALSE;
+    }
 
-            DebugPrintf((
-                "EEPROM Offset %02X = %08X\n",
-                (int)pIoBuffer->value[0],
-                (int)pIoBuffer->value[1]
-                ));
-            break;
+    // Compare Subsystem ID only if valid in chip
+    if (pKeyCached->SubVendorId != 0)
+    {
+        if ( ((pKey->SubVendorId != (U16)PCI_FIELD_IGNORE) &&
+              (pKey->SubVendorId != pKeyCached->SubVendorId)) ||
+             ((pKey->SubDeviceId != (U16)PCI_FIELD_IGNORE) &&
+              (pKey->SubDeviceId != pKeyCached->SubDeviceId)) )
+        {
+            return FALSE;
+        }
+    }
 
-        case PLX_IOCTL_EEPROM_WRITE_BY_OFFSET:
-            DebugPrintf_Cont(("PLX_IOCTL_EEPROM_WRITE_BY_OFFSET\n"));
+    // Compare Revision
+    if ( (pKey->Revision != (U8)PCI_FIELD_IGNORE) &&
+         (pKey->Revision != pKeyCached->Revision) )
+    {
+        return FALSE;
+    }
 
-            pIoBuffer->ReturnCode =
-                PlxI2c_EepromWriteByOffset(
-                    pDevice,
-                    (U32)pIoBuffer->value[0],
-                    (U32)pIoBuffer->value[1]
-                    );
+    return TRUE;
+}
 
-            DebugPrintf((
-                "Wrote %08X to EEPROM Offset %02X\n",
-                (int)pIoBuffer->value[1],
-                (int)pIoBuffer->value[0]
-                ));
-            break;
 
-        case PLX_IOCTL_EEPROM_READ_BY_OFFSET_16:
-            DebugPrintf_Cont(("PLX_IOCTL_EEPROM_READ_BY_OFFSET_16\n"));
 
-            pIoBuffer->ReturnCode =
-                PlxI2c_EepromReadByOffset_16(
-                    pDevice,
-                    (U32)pIoBuffer->value[0],
-                    (U16*)&(pIoBuffer->value[1])
-                    );
 
-            DebugPrintf((
-                "EEPROM Offset %02X = %04X\n",
-                (int)pIoBuffer->value[0],
-                (U16)pIoBuffer->value[1]
-                ));
-            break;
+/******************************************************************************
+ *
+ * Function   :  PlxI2c_TopologyScanWorker
+ *
+ * Description:  Thread to probe a single I2C USB device
+ *
+ ******************************************************************************/
+static I2C_THREAD_RETURN
+PlxI2c_TopologyScanWorker(
+    VOID *pContext
+    )
+{
+    PlxI2c_TopologyProbe( (PLX_DEVICE_OBJECT*)pContext, (U16)-1 );
 
-        case PLX_IOCTL_EEPROM_WRITE_BY_OFFSET_16:
-            DebugPrintf_Cont(("PLX_IOCTL_EEPROM_WRITE_BY_OFFSET_16\n"));
+    return I2C_THREAD_EXIT;
+}
 
-            pIoBuffer->ReturnCode =
-                PlxI2c_EepromWriteByOffset_16(
-                    pDevice,
-                    (U32)pIoBuffer->value[0],
-                    (U16)pIoBuffer->value[1]
-                    );
 
-            DebugPrintf((
-                "Wrote %04X to EEPROM Offset %02X\n",
-                (U16)pIoBuffer->value[1],
-                (int)pIoBuffer->value[0]
-                ));
-            break;
 
 
-        /******************************************
-         * Performance Monitor Functions
-         *****************************************/
-        case PLX_IOCTL_PERFORMANCE_INIT_PROPERTIES:
-            DebugPrintf_Cont(("PLX_IOCTL_PERFORMANCE_INIT_PROPERTIES\n"));
+/******************************************************************************
+ *
+ * Function   :  PlxI2c_DeviceProbe
+ *
+ * Description:  Probes an I2C USB device for the requested device without
+ *               caching, halting as soon as the device is found
+ *
+ ******************************************************************************/
+static PLX_STATUS
+PlxI2c_DeviceProbe(
+    PLX_DEVICE_KEY *pKey,
+    U16             DeviceNumber,
+    PLX_MODE_PROP  *pModeProp
+    )
+{
+    U16               NumMatched;
+    U16               TotalMatches;
+    U32               RegValue;
+    BOOLEAN           bFound;
+    PLX_STATUS        status;
+    PLX_DEVICE_OBJECT Device;
+    PLX_DEVICE_OBJECT DeviceTemp;
 
-            pIoBuffer->ReturnCode =
-                PlxDir_PerformanceInitializeProperties(
-                    pDevice,
-                    PLX_INT_TO_PTR(pIoBuffer->value[0])
-                    );
-            break;
 
-        case PLX_IOCTL_PERFORMANCE_MONITOR_CTRL:
-            DebugPrintf_Cont(("PLX_IOCTL_PERFORMANCE_MONITOR_CTRL\n"));
+    // Clear the device object
+    RtlZeroMemory( &Device, sizeof(PLX_DEVICE_OBJECT) );
 
-            pIoBuffer->ReturnCode =
-                PlxDir_PerformanceMonitorControl(
-                    pDevice,
-                    (PLX_PERF_CMD)pIoBuffer->value[0]
-                    );
-            break;
+    // Open connection to driver
+    if (PlxI2c_Driver_Connect( &Device, pModeProp ) == FALSE)
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
 
-        case PLX_IOCTL_PERFORMANCE_RESET_COUNTERS:
-            DebugPrintf_Cont(("PLX_IOCTL_PERFORMANCE_RESET_COUNTERS\n"));
+    TotalMatches = 0;
 
-            pIoBuffer->ReturnCode =
-                PlxDir_PerformanceResetCounters(
-                    pDevice
-                    );
-            break;
+    // Start probe at first I2C address if auto-probe requested
+    if (pModeProp->I2c.SlaveAddr == (U16)-1)
+    {
+        Device.Key.DeviceNumber = I2C_PROBE_ADDR_FIRST;
+    }
+    else
+    {
+        Device.Key.DeviceNumber = pModeProp->I2c.SlaveAddr;
+    }
 
-        case PLX_IOCTL_PERFORMANCE_GET_COUNTERS:
-            DebugPrintf_Cont(("PLX_IOCTL_PERFORMANCE_GET_COUNTERS\n"));
+    // Must validate object so probe API calls don't fail
+    ObjectValidate( &Device );
 
-            pIoBuffer->ReturnCode =
-                PlxDir_PerformanceGetCounters(
-                    pDevice,
-                    PLX_INT_TO_PTR(pIoBuffer->value[0]),
-                    (U8)pIoBuffer->value[1]
-                    );
-            break;
+    // Default to device not found
+    bFound = FALSE;
 
+    // Probe devices to check if valid PLX device
+    do
+    {
+        DebugPrintf((" ---- Probe I2C at %02Xh ----\n", Device.Key.DeviceNumber));
 
-        /******************************************
-         * PLX Multi-Host Functions
-         *****************************************/
-        case PLX_IOCTL_MH_GET_PROPERTIES:
-            DebugPrintf_Cont(("PLX_IOCTL_MH_GET_PROPERTIES\n"));
+        // Reset temporary device object
+        RtlCopyMemory( &DeviceTemp, &Device, sizeof(PLX_DEVICE_OBJECT) );
 
-            pIoBuffer->ReturnCode =
-                PlxI2c_MH_GetProperties(
-                    pDevice,
-                    &pIoBuffer->u.MH_Prop
-                    );
-            break;
+        // Attempt to read Device/Vendor ID
+        RegValue =
+            PlxI2c_PlxRegisterRead(
+                &DeviceTemp,
+                PCI_REG_DEV_VEN_ID, // Port 0 Device/Vendor ID
+                &status,
+                FALSE,              // Adjust for port?
+                FALSE               // Retry on error?
+                );
 
-        case PLX_IOCTL_MH_MIGRATE_DS_PORTS:
-            DebugPrintf_Cont(("PLX_IOCTL_MH_MIGRATE_DS_PORTS\n"));
+        if (status == PLX_STATUS_OK)
+        {
+            if ( ((RegValue & 0xFFFF) == PLX_PCI_VENDOR_ID_PLX) ||
+                 ((RegValue & 0xFFFF) == PLX_PCI_VENDOR_ID_LSI) )
+            {
+                DebugPrintf((
+                    "I2C: Detected device %08X at %02Xh\n",
+                    RegValue, Device.Key.DeviceNumber
+                    ));
 
-            pIoBuffer->ReturnCode =
-                PlxI2c_MH_MigrateDsPorts(
-                    pDevice,
-                    (U16)(pIoBuffer->value[0] >> 16),
-                    (U16)(pIoBuffer->value[0] & 0xFFFF),
-                    (U32)pIoBuffer->value[1],
-                    (BOOLEAN)pIoBuffer->value[2]
-                    );
-            break;
+                if ((RegValue & 0xFFFF) == PLX_PCI_VENDOR_ID_LSI)
+                {
+                    // Device found, probe for active ports and compare
+                    status =
+                        PlxDir_ProbeSwitch(
+                            &DeviceTemp,
+                            pKey,
+                            (U16)(DeviceNumber - TotalMatches),
+                            &NumMatched,
+                            NULL        // No list of ports
+                            );
+                }
+                else
+                {
+                    // Legacy device found, determine active ports and compare
+                    status =
+                        PlxI2c_ProbeSwitch(
+                            &DeviceTemp,
+                            pKey,
+                            (U16)(DeviceNumber - TotalMatches),
+                            &NumMatched,
+                            NULL        // No list of ports
+                            );
+                }
 
+                if (status == PLX_STATUS_OK)
+                {
+                    bFound = TRUE;
+                    break;
+                }
 
-        /******************************************
-         * Unsupported Messages
-         *****************************************/
-        default:
-            DebugPrintf_Cont((
-                "Unsupported PLX_IOCTL_Xxx (%08Xh)\n",
-                IoControlCode
-                ));
+                // Add number of matched devices
+                TotalMatches += NumMatched;
+            }
+        }
 
-            pIoBuffer->ReturnCode = PLX_STATUS_UNSUPPORTED;
-            break;
+        // Jump to next slave address
+        if (pModeProp->I2c.SlaveAddr == (U16)-1)
+        {
+            Device.Key.DeviceNumber = PlxI2c_ProbeAddressNext( Device.Key.DeviceNumber );
+        }
     }
+    while ((pModeProp->I2c.SlaveAddr == (U16)-1) && (Device.Key.DeviceNumber != 0));
 
-    DebugPrintf(("...Completed message\n"));
+    // Close the device
+    PlxI2c_DeviceClose( &Device );
 
-    return 0;
+    if (bFound)
+    {
+        // Store API mode
+        pKey->ApiMode = PLX_API_MODE_I2C_AARDVARK;
+
+        // Validate key
+        ObjectValidate( pKey );
+        return PLX_STATUS_OK;
+    }
+
+    return PLX_STATUS_INVALID_OBJECT;
 }
 
 
@@ -3153,7 +4016,8 @@ PlxI2c_ProbeSwitch(
     PLX_DEVICE_OBJECT *pDevice,
     PLX_DEVICE_KEY    *pKey,
     U16                DeviceNumber,
-    U16               *pNumMatched
+    U16               *pNumMatched,
+    PLX_PROBE_LIST    *pList
     )
 {
     U8             port_Upstream;
@@ -4062,9 +4926,18 @@ PlxI2c_ProbeSwitch(
         // Check if match on location and ID
         if (bMatchLoc && bMatchId)
         {
-            // Match found, check if it is the desired device
-            if (devCount == DeviceNumber)
+            // Store all matches if building a device list
+            if (pList != NULL)
+            {
+                if (pList->Count < pList->MaxKeys)
+                {
+                    pList->pKeys[pList->Count] = pDevice->Key;
+                    pList->Count++;
+                }
+            }
+            else if (devCount == DeviceNumber)
             {
+                // Match found & is the desired device
                 DebugPrintf((
                     "Criteria matched device %04X %04X [%02X:%02X.%d]\n",
                     pDevice->Key.DeviceId, pDevice->Key.VendorId,
@@ -89,6 +89,9 @@ extern "C" {
 #define I2C_PEX_BASE_ADDR_MASK      0xFF800000  // PEX region base address mask
 #define I2C_PEX_MAX_OFFSET_MASK     0x007FFFFF  // Max I2C addressing (23 bits)
 
+#define I2C_PROBE_ADDR_FIRST        0x38        // First address of auto-probe
+#define I2C_TOPOLOGY_MAX_KEYS       128         // Max devices cached per I2C USB device
+
 
 
 
@@ -118,6 +121,14 @@ PlxI2c_DeviceFindEx(
     PLX_MODE_PROP  *pModeProp
     );
 
+PLX_STATUS
+PlxI2c_TopologyScan(
+    U32  ClockRate,
+    U32  CacheTtlSec,
+    U32  I2cPortMask,
+    U32 *pI2cPorts
+    );
+
 
 /******************************************
  *    Query for Information Functions
@@ -149,6 +160,23 @@ PlxI2c_PlxRegisterWrite(
     BOOLEAN            bAdjustForPort
     );
 
+PLX_STATUS
+PlxI2c_PlxRegisterAccessList(
+    PLX_DEVICE_OBJECT *pDevice,
+    PLX_REG_ACCESS    *pList,
+    U32                Count,
+    BOOLEAN            bAdjustForPort
+    );
+
+PLX_STATUS
+PlxI2c_PlxRegisterReadBuffer(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset,
+    VOID              *pBuffer,
+    U32                ByteCount,
+    BOOLEAN            bAdjustForPort
+    );
+
 
 /******************************************
  *     Serial EEPROM Access Functions
@@ -219,6 +247,23 @@ PlxI2c_EepromWriteByOffset_16(
     U16                value
     );
 
+PLX_STATUS
+PlxI2c_EepromReadBuffer(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset,
+    VOID              *pBuffer,
+    U32                ByteCount
+    );
+
+PLX_STATUS
+PlxI2c_EepromWriteBuffer(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset,
+    VOID              *pBuffer,
+    U32                ByteCount,
+    BOOLEAN            bVerify
+    );
+
 
 /******************************************
  *          Multi-VS Functions
@@ -264,12 +309,31 @@ PlxI2c_Dispatch_IoControl(
     U32                Size
     );
 
+U16
+PlxI2c_ProbeAddressNext(
+    U16 SlaveAddr
+    );
+
+BOOLEAN
+PlxI2c_TopologyIsCached(
+    U16 I2cPort,
+    U32 UniqueId,
+    U16 SlaveAddr
+    );
+
+PLX_STATUS
+PlxI2c_TopologyProbe(
+    PLX_DEVICE_OBJECT *pDevice,
+    U16                SlaveAddr
+    );
+
 PLX_STATUS
 PlxI2c_ProbeSwitch(
     PLX_DEVICE_OBJECT *pDevice,
     PLX_DEVICE_KEY    *pKey,
     U16                DeviceNumber,
-    U16               *pNumMatched
+    U16               *pNumMatched,
+    PLX_PROBE_LIST    *pList
     );
 
 
@@ -381,7 +381,8 @@ MdioSplice_DeviceFindEx(
                     &devObjTemp,
                     pKey,
                     (U16)(DeviceNumber - totalMatches),
-                    &numMatched
+                    &numMatched,
+                    NULL        // No device list
                     );
 
             if (status == PLX_STATUS_OK)
@@ -977,12 +978,10 @@ MdioSplice_Dispatch_IoControl(
             DebugPrintf_Cont(("PLX_IOCTL_PCI_REGISTER_READ\n"));
 
             pIoBuffer->value[1] =
-                MdioSplice_PlxRegisterRead(
+                PlxDir_PlxRegRead(
                     pDevice,
                     (U32)pIoBuffer->value[0],
-                    &(pIoBuffer->ReturnCode),
-                    TRUE,       // Adjust for port?
-                    TRUE        // Retry on error?
+                    &(pIoBuffer->ReturnCode)
                     );
 
             DebugPrintf((
@@ -996,11 +995,10 @@ MdioSplice_Dispatch_IoControl(
             DebugPrintf_Cont(("PLX_IOCTL_PCI_REGISTER_WRITE\n"));
 
             pIoBuffer->ReturnCode =
-                MdioSplice_PlxRegisterWrite(
+                PlxDir_PlxRegWrite(
                     pDevice,
                     (U32)pIoBuffer->value[0],
-                    (U32)pIoBuffer->value[1],
-                    TRUE        // Adjust for port?
+                    (U32)pIoBuffer->value[1]
                     );
 
             DebugPrintf((
@@ -1018,12 +1016,10 @@ MdioSplice_Dispatch_IoControl(
             DebugPrintf_Cont(("PLX_IOCTL_REGISTER_READ\n"));
 
             pIoBuffer->value[1] =
-                MdioSplice_PlxRegisterRead(
+                PlxDir_PlxRegRead(
                     pDevice,
                     (U32)pIoBuffer->value[0],
-                    &(pIoBuffer->ReturnCode),
-                    TRUE,       // Adjust for port?
-                    TRUE        // Retry on error?
+                    &(pIoBuffer->ReturnCode)
                     );
 
             DebugPrintf((
@@ -1037,11 +1033,10 @@ MdioSplice_Dispatch_IoControl(
             DebugPrintf_Cont(("PLX_IOCTL_REGISTER_WRITE\n"));
 
             pIoBuffer->ReturnCode =
-                MdioSplice_PlxRegisterWrite(
+                PlxDir_PlxRegWrite(
                     pDevice,
                     (U32)pIoBuffer->value[0],
-                    (U32)pIoBuffer->value[1],
-                    TRUE        // Adjust for port?
+                    (U32)pIoBuffer->value[1]
                     );
 
             DebugPrintf((
@@ -1074,11 +1069,10 @@ MdioSplice_Dispatch_IoControl(
             DebugPrintf_Cont(("PLX_IOCTL_MAPPED_REGISTER_WRITE\n"));
 
             pIoBuffer->ReturnCode =
-                MdioSplice_PlxRegisterWrite(
+                PlxDir_PlxMappedRegWrite(
                     pDevice,
                     (U32)pIoBuffer->value[0],
-                    (U32)pIoBuffer->value[1],
-                    FALSE       // Adjust for port?
+                    (U32)pIoBuffer->value[1]
                     );
 
             DebugPrintf((
@@ -0,0 +1,612 @@
+/*******************************************************************************
+ * Copyright 2013-2019 Broadcom Inc
+ * Copyright (c) 2009 to 2012 PLX Technology Inc.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directorY of this source tree, or the
+ * BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+/*******************************************************************************
+ *
+ * File Name:
+ *
+ *      NtDma.c
+ *
+ * Description:
+ *
+ *      Implements DMA transfers to & from the buffer of the host on the other
+ *      side of an 8000 NT port.  Connecting performs the steps otherwise done
+ *      by each NT application: the DMA engine Requester ID is added to the NT
+ *      LUT, local & peer buffer properties are exchanged through the NT
+ *      mailboxes, and the NT BARs are prepared as DMA windows.
+ *
+ *      Transfers are split at window boundaries & moved with 8000 block DMA.
+ *      If both BAR 2 & BAR 4 are available with the same size, the windows are
+ *      used alternately so the translation for the next chunk is programmed
+ *      while the current chunk is still in flight.
+ *
+ * Revision History:
+ *
+ *      09-01-19 : PCI/PCIe SDK v8.10
+ *
+ ******************************************************************************/
+
+
+#include "PciRegs.h"
+#include "PexApi.h"
+#include "PlxApiDebug.h"
+#include "PlxApiDirect.h"
+#include "NtDma.h"
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  NtDma_Connect
+ *
+ * Description:  Prepares DMA windows & exchanges buffer properties with the
+ *               host on the opposite side of the NT port
+ *
+ *****************************************************************************/
+PLX_STATUS
+NtDma_Connect(
+    PLX_DEVICE_OBJECT *pNtDevice,
+    PLX_DEVICE_OBJECT *pDmaDevice,
+    U8                 DmaChannel,
+    PLX_PHYSICAL_MEM  *pLocalBuffer,
+    U64                Timeout_ms,
+    PLX_NT_DMA_TARGET *pTarget
+    )
+{
+    U16              ReqId;
+    PLX_STATUS       status;
+    PLX_PCI_BAR_PROP BarProp;
+
+
+    // Only 8000 NT ports over the PLX driver are supported
+    if ((pNtDevice->Key.ApiMode != PLX_API_MODE_PCI) ||
+        ((pNtDevice->Key.PlxChip & 0xF000) != 0x8000) ||
+        ((pNtDevice->Key.PlxPortType != PLX_SPEC_PORT_NT_VIRTUAL) &&
+         (pNtDevice->Key.PlxPortType != PLX_SPEC_PORT_NT_LINK)))
+    {
+        return PLX_STATUS_UNSUPPORTED;
+    }
+
+    if ((pLocalBuffer->PhysicalAddr == 0) || (pLocalBuffer->Size == 0))
+    {
+        return PLX_STATUS_INVALID_ADDR;
+    }
+
+    RtlZeroMemory( pTarget, sizeof(PLX_NT_DMA_TARGET) );
+
+    pTarget->pNtDevice     = pNtDevice;
+    pTarget->pDmaDevice    = pDmaDevice;
+    pTarget->DmaChannel    = DmaChannel;
+    pTarget->LutIndex      = (U16)-1;
+    pTarget->WindowBase[0] = NTDMA_WINDOW_NONE;
+    pTarget->WindowBase[1] = NTDMA_WINDOW_NONE;
+
+    // BAR 2 is the primary window
+    status = PlxPci_PciBarProperties( pNtDevice, 2, &BarProp );
+    if ((status != PLX_STATUS_OK) || (BarProp.Size == 0))
+    {
+        DebugPrintf(("ERROR - NT BAR 2 not available for DMA window\n"));
+        return PLX_STATUS_INSUFFICIENT_RES;
+    }
+
+    pTarget->NumWindows     = 1;
+    pTarget->BarIndex[0]    = 2;
+    pTarget->BarPhysical[0] = BarProp.Physical;
+    pTarget->WindowSize     = BarProp.Size;
+
+    // Use BAR 4 as a second window to pipeline translation updates
+    status = PlxPci_PciBarProperties( pNtDevice, 4, &BarProp );
+    if ((status == PLX_STATUS_OK) && (BarProp.Size == pTarget->WindowSize))
+    {
+        pTarget->NumWindows     = 2;
+        pTarget->BarIndex[1]    = 4;
+        pTarget->BarPhysical[1] = BarProp.Physical;
+    }
+
+    // DMA engine requests must pass the NT port, so add its ReqID to the LUT
+    ReqId =
+        PCIE_REQID_BUILD(
+            pDmaDevice->Key.bus,
+            pDmaDevice->Key.slot,
+            pDmaDevice->Key.function
+            );
+
+    status =
+        PlxPci_Nt_LutAdd(
+            pNtDevice,
+            &pTarget->LutIndex,
+            ReqId,
+            FALSE       // Snoop must be disabled
+            );
+
+    if (status != PLX_STATUS_OK)
+    {
+        DebugPrintf(("ERROR - Unable to add DMA ReqID %04X to NT LUT\n", ReqId));
+        pTarget->LutIndex = (U16)-1;
+        return status;
+    }
+
+    // Exchange buffer properties with the peer
+    status =
+        NtDma_Negotiate(
+            pTarget,
+            pLocalBuffer,
+            Timeout_ms
+            );
+
+    if (status != PLX_STATUS_OK)
+    {
+        PlxPci_Nt_LutDisable( pNtDevice, pTarget->LutIndex );
+        pTarget->LutIndex = (U16)-1;
+        return status;
+    }
+
+    DebugPrintf((
+        "NT DMA connected: peer buffer %08X_%08X (%lld KB), %d window(s) of %lld KB\n",
+        PLX_64_HIGH_32(pTarget->RemoteAddr), PLX_64_LOW_32(pTarget->RemoteAddr),
+        (long long)(pTarget->RemoteSize >> 10), pTarget->NumWindows,
+        (long long)(pTarget->WindowSize >> 10)
+        ));
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  NtDma_Transfer
+ *
+ * Description:  Transfers data between a local bus address & the peer buffer,
+ *               splitting the transfer at NT window boundaries
+ *
+ *****************************************************************************/
+PLX_STATUS
+NtDma_Transfer(
+    PLX_NT_DMA_TARGET *pTarget,
+    U64                LocalAddr,
+    U64                RemoteOffset,
+    U32                ByteCount,
+    BOOLEAN            bRead,
+    U64                Timeout_ms
+    )
+{
+    U8             window;
+    U8             WindowActive;
+    U32            BytesToXfer;
+    U64            RemoteAddr;
+    U64            RemoteBase;
+    U64            WindowOffset;
+    BOOLEAN        bPending;
+    PLX_STATUS     status;
+    PLX_DMA_PARAMS DmaParams;
+
+
+    if ((ByteCount == 0) ||
+        ((RemoteOffset + ByteCount) > pTarget->RemoteSize))
+    {
+        return PLX_STATUS_INVALID_SIZE;
+    }
+
+    bPending     = FALSE;
+    WindowActive = 0;
+    RemoteAddr   = pTarget->RemoteAddr + RemoteOffset;
+
+    while (ByteCount != 0)
+    {
+        // Determine the window-aligned peer address & chunk size
+        RemoteBase   = RemoteAddr & ~(pTarget->WindowSize - 1);
+        WindowOffset = RemoteAddr - RemoteBase;
+
+        BytesToXfer = ByteCount;
+        if (BytesToXfer > (pTarget->WindowSize - WindowOffset))
+        {
+            BytesToXfer = (U32)(pTarget->WindowSize - WindowOffset);
+        }
+
+        if (BytesToXfer > NTDMA_MAX_CHUNK)
+        {
+            BytesToXfer = NTDMA_MAX_CHUNK;
+        }
+
+        // Use a window already translated to this address if possible
+        if (pTarget->WindowBase[0] == RemoteBase)
+        {
+            window = 0;
+        }
+        else if ((pTarget->NumWindows > 1) && (pTarget->WindowBase[1] == RemoteBase))
+        {
+            window = 1;
+        }
+        else
+        {
+            // Pick the window not used by the transfer in flight
+            window = 0;
+            if ((pTarget->NumWindows > 1) && (WindowActive == 0))
+            {
+                window = 1;
+            }
+
+            // Translation can't change under an active transfer
+            if (bPending && (window == WindowActive))
+            {
+                status = NtDma_WaitIdle( pTarget, Timeout_ms );
+                if (status != PLX_STATUS_OK)
+                {
+                    return status;
+                }
+
+                bPending = FALSE;
+            }
+
+            status = NtDma_WindowSet( pTarget, window, RemoteBase );
+            if (status != PLX_STATUS_OK)
+            {
+                if (bPending)
+                {
+                    NtDma_WaitIdle( pTarget, Timeout_ms );
+                }
+                return status;
+            }
+        }
+
+        // Block DMA allows a single transfer per channel
+        if (bPending)
+        {
+            status = NtDma_WaitIdle( pTarget, Timeout_ms );
+            if (status != PLX_STATUS_OK)
+            {
+                return status;
+            }
+
+            bPending = FALSE;
+        }
+
+        RtlZeroMemory( &DmaParams, sizeof(PLX_DMA_PARAMS) );
+
+        if (bRead)
+        {
+            DmaParams.AddrSource = pTarget->BarPhysical[window] + WindowOffset;
+            DmaParams.AddrDest   = LocalAddr;
+        }
+        else
+        {
+            DmaParams.AddrSource = LocalAddr;
+            DmaParams.AddrDest   = pTarget->BarPhysical[window] + WindowOffset;
+        }
+
+        DmaParams.ByteCount       = BytesToXfer;
+        DmaParams.bIgnoreBlockInt = TRUE;
+
+        // Start transfer without waiting for completion
+        status =
+            PlxPci_DmaTransferBlock(
+                pTarget->pDmaDevice,
+                pTarget->DmaChannel,
+                &DmaParams,
+                0
+                );
+
+        if (status != PLX_STATUS_OK)
+        {
+            return status;
+        }
+
+        bPending     = TRUE;
+        WindowActive = window;
+
+        LocalAddr  += BytesToXfer;
+        RemoteAddr += BytesToXfer;
+        ByteCount  -= BytesToXfer;
+    }
+
+    // Wait for the final chunk
+    if (bPending)
+    {
+        return NtDma_WaitIdle( pTarget, Timeout_ms );
+    }
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  NtDma_Disconnect
+ *
+ * Description:  Releases the LUT entry & withdraws the connection from the peer
+ *
+ *****************************************************************************/
+PLX_STATUS
+NtDma_Disconnect(
+    PLX_NT_DMA_TARGET *pTarget
+    )
+{
+    U16 MB_Write;
+
+
+    if (pTarget->pNtDevice->Key.PlxPortType == PLX_SPEC_PORT_NT_LINK)
+    {
+        MB_Write = NTDMA_MB_LINK_READY;
+    }
+    else
+    {
+        MB_Write = NTDMA_MB_VIRT_READY;
+    }
+
+    // Withdraw ready so the peer doesn't see a stale connection
+    PlxPci_PlxMailboxWrite( pTarget->pNtDevice, MB_Write, 0 );
+
+    if (pTarget->LutIndex != (U16)-1)
+    {
+        PlxPci_Nt_LutDisable( pTarget->pNtDevice, pTarget->LutIndex );
+    }
+
+    RtlZeroMemory( pTarget, sizeof(PLX_NT_DMA_TARGET) );
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/***********************************************************
+ *
+ *               PRIVATE SUPPORT FUNCTIONS
+ *
+ **********************************************************/
+
+
+/******************************************************************************
+ *
+ * Function   :  NtDma_Negotiate
+ *
+ * Description:  Posts the local buffer properties, waits for the peer to do
+ *               the same & retrieves the peer's buffer properties
+ *
+ *****************************************************************************/
+PLX_STATUS
+NtDma_Negotiate(
+    PLX_NT_DMA_TARGET *pTarget,
+    PLX_PHYSICAL_MEM  *pLocalBuffer,
+    U64                Timeout_ms
+    )
+{
+    U16                MB_Read;
+    U16                MB_Write;
+    U32                RegValue;
+    U64                ElapsedMs;
+    PLX_DEVICE_OBJECT *pDevice;
+
+
+    pDevice = pTarget->pNtDevice;
+
+    // Post local buffer properties, then signal ready
+    if (pDevice->Key.PlxPortType == PLX_SPEC_PORT_NT_LINK)
+    {
+        PlxPci_PlxMailboxWrite( pDevice, NTDMA_MB_LINK_ADDR_LOW, PLX_64_LOW_32(pLocalBuffer->PhysicalAddr) );
+        PlxPci_PlxMailboxWrite( pDevice, NTDMA_MB_LINK_ADDR_HIGH, PLX_64_HIGH_32(pLocalBuffer->PhysicalAddr) );
+        PlxPci_PlxMailboxWrite( pDevice, NTDMA_MB_LINK_SIZE, pLocalBuffer->Size );
+
+        MB_Read  = NTDMA_MB_VIRT_READY;
+        MB_Write = NTDMA_MB_LINK_READY;
+    }
+    else
+    {
+        PlxPci_PlxMailboxWrite( pDevice, NTDMA_MB_VIRT_ADDR_LOW, PLX_64_LOW_32(pLocalBuffer->PhysicalAddr) );
+        PlxPci_PlxMailboxWrite( pDevice, NTDMA_MB_VIRT_ADDR_HIGH, PLX_64_HIGH_32(pLocalBuffer->PhysicalAddr) );
+        PlxPci_PlxMailboxWrite( pDevice, NTDMA_MB_VIRT_SIZE, pLocalBuffer->Size );
+
+        MB_Read  = NTDMA_MB_LINK_READY;
+        MB_Write = NTDMA_MB_VIRT_READY;
+    }
+
+    PlxPci_PlxMailboxWrite( pDevice, MB_Write, NTDMA_MSG_SYSTEM_READY );
+
+    // Wait for the peer
+    ElapsedMs = 0;
+    do
+    {
+        RegValue = PlxPci_PlxMailboxRead( pDevice, MB_Read, NULL );
+        if (RegValue == NTDMA_MSG_SYSTEM_READY)
+        {
+            break;
+        }
+
+        if (ElapsedMs >= Timeout_ms)
+        {
+            // Withdraw ready on failure
+            PlxPci_PlxMailboxWrite( pDevice, MB_Write, 0 );
+            return PLX_STATUS_TIMEOUT;
+        }
+
+        Plx_sleep( NTDMA_CONNECT_POLL_MS );
+        ElapsedMs += NTDMA_CONNECT_POLL_MS;
+    }
+    while (1);
+
+    // Get peer buffer properties
+    if (pDevice->Key.PlxPortType == PLX_SPEC_PORT_NT_LINK)
+    {
+        pTarget->RemoteAddr =
+            ((U64)PlxPci_PlxMailboxRead( pDevice, NTDMA_MB_VIRT_ADDR_HIGH, NULL ) << 32) |
+            PlxPci_PlxMailboxRead( pDevice, NTDMA_MB_VIRT_ADDR_LOW, NULL );
+
+        pTarget->RemoteSize = PlxPci_PlxMailboxRead( pDevice, NTDMA_MB_VIRT_SIZE, NULL );
+    }
+    else
+    {
+        pTarget->RemoteAddr =
+            ((U64)PlxPci_PlxMailboxRead( pDevice, NTDMA_MB_LINK_ADDR_HIGH, NULL ) << 32) |
+            PlxPci_PlxMailboxRead( pDevice, NTDMA_MB_LINK_ADDR_LOW, NULL );
+
+        pTarget->RemoteSize = PlxPci_PlxMailboxRead( pDevice, NTDMA_MB_LINK_SIZE, NULL );
+    }
+
+    // Clear peer's ready message once consumed
+    PlxPci_PlxMailboxWrite( pDevice, MB_Read, 0 );
+
+    if ((pTarget->RemoteAddr == 0) || (pTarget->RemoteSize == 0))
+    {
+        return PLX_STATUS_INVALID_DATA;
+    }
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  NtDma_WindowSet
+ *
+ * Description:  Sets the NT BAR direct address translation of a DMA window
+ *
+ *****************************************************************************/
+PLX_STATUS
+NtDma_WindowSet(
+    PLX_NT_DMA_TARGET *pTarget,
+    U8                 window,
+    U64                RemoteBase
+    )
+{
+    U16                OffsetTranLow;
+    U16                OffsetTranHigh;
+    U16                OffsetLimitLow;
+    U16                OffsetLimitHigh;
+    PLX_DEVICE_OBJECT *pDevice;
+
+
+    pDevice = pTarget->pNtDevice;
+
+    // Link-side translation is limited to 32-bit
+    if ((pDevice->Key.PlxPortType == PLX_SPEC_PORT_NT_LINK) &&
+        ((RemoteBase >> 32) != 0))
+    {
+        return PLX_STATUS_INVALID_ADDR;
+    }
+
+    if (pTarget->BarIndex[window] == 2)
+    {
+        OffsetTranLow   = NTDMA_8000_BAR_2_TRAN_LOWER;
+        OffsetTranHigh  = NTDMA_8000_BAR_2_TRAN_UPPER;
+        OffsetLimitLow  = NTDMA_8500_BAR_2_LIMIT_LOWER;
+        OffsetLimitHigh = NTDMA_8500_BAR_2_LIMIT_UPPER;
+    }
+    else
+    {
+        OffsetTranLow   = NTDMA_8000_BAR_4_TRAN_LOWER;
+        OffsetTranHigh  = NTDMA_8000_BAR_4_TRAN_UPPER;
+        OffsetLimitLow  = NTDMA_8500_BAR_4_LIMIT_LOWER;
+        OffsetLimitHigh = NTDMA_8500_BAR_4_LIMIT_UPPER;
+    }
+
+    PlxPci_PlxRegisterWrite( pDevice, OffsetTranLow, PLX_64_LOW_32(RemoteBase) );
+    PlxPci_PlxRegisterWrite( pDevice, OffsetTranHigh, PLX_64_HIGH_32(RemoteBase) );
+
+    // Set limit registers to 0 on 8500 series
+    if ((pDevice->Key.PlxChip & 0xFF00) == 0x8500)
+    {
+        PlxPci_PlxRegisterWrite( pDevice, OffsetLimitLow, 0 );
+        PlxPci_PlxRegisterWrite( pDevice, OffsetLimitHigh, 0 );
+    }
+
+    pTarget->WindowBase[window] = RemoteBase;
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  NtDma_WaitIdle
+ *
+ * Description:  Polls the DMA channel until the transfer in flight completes
+ *
+ *****************************************************************************/
+PLX_STATUS
+NtDma_WaitIdle(
+    PLX_NT_DMA_TARGET *pTarget,
+    U64                Timeout_ms
+    )
+{
+    U32        SpinCount;
+    U64        ElapsedMs;
+    PLX_STATUS status;
+
+
+    SpinCount = 0;
+    ElapsedMs = 0;
+
+    do
+    {
+        status =
+            PlxPci_DmaStatus(
+                pTarget->pDmaDevice,
+                pTarget->DmaChannel
+                );
+
+        if (status == PLX_STATUS_COMPLETE)
+        {
+            return PLX_STATUS_OK;
+        }
+
+        if (status != PLX_STATUS_IN_PROGRESS)
+        {
+            return status;
+        }
+
+        if (SpinCount < NTDMA_SPIN_COUNT)
+        {
+            SpinCount++;
+        }
+        else
+        {
+            if (ElapsedMs >= Timeout_ms)
+            {
+                return PLX_STATUS_TIMEOUT;
+            }
+
+            Plx_sleep( 1 );
+            ElapsedMs++;
+        }
+    }
+    while (1);
+}
@@ -0,0 +1,152 @@
+#ifndef __NT_DMA_H
+#define __NT_DMA_H
+
+/*******************************************************************************
+ * Copyright 2013-2019 Broadcom, Inc
+ * Copyright (c) 2009 to 2012 PLX Technology Inc.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directorY of this source tree, or the
+ * BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+/*******************************************************************************
+ *
+ * File Name:
+ *
+ *     NtDma.h
+ *
+ * Description:
+ *
+ *     Header file for DMA transfers to a peer host across an NT port
+ *
+ * Revision History:
+ *
+ *     09-01-19: PCI/PCIe SDK v8.10
+ *
+ ******************************************************************************/
+
+
+#include "PlxIoctl.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/******************************************
+ *             Definitions
+ ******************************************/
+#define NTDMA_MAX_CHUNK                 0x04000000  // Max bytes per DMA block transfer
+#define NTDMA_SPIN_COUNT                1000        // Status polls before sleeping on a wait
+#define NTDMA_CONNECT_POLL_MS           10          // Mailbox poll period during connect
+#define NTDMA_WINDOW_NONE               ((U64)-1)   // Window translation not yet set
+#define NTDMA_MSG_SYSTEM_READY          0xFEEDFACE  // Code passed between systems to signal ready
+
+// Mailboxes used to exchange buffer properties (same as NT samples plus upper address)
+#define NTDMA_MB_VIRT_READY             2
+#define NTDMA_MB_VIRT_ADDR_LOW          3
+#define NTDMA_MB_VIRT_SIZE              4
+#define NTDMA_MB_VIRT_ADDR_HIGH         0
+#define NTDMA_MB_LINK_READY             5
+#define NTDMA_MB_LINK_ADDR_LOW          6
+#define NTDMA_MB_LINK_SIZE              7
+#define NTDMA_MB_LINK_ADDR_HIGH         1
+
+// NT BAR direct address translation registers
+#define NTDMA_8000_BAR_2_TRAN_LOWER     0xC3C
+#define NTDMA_8000_BAR_2_TRAN_UPPER     0xC40
+#define NTDMA_8000_BAR_4_TRAN_LOWER     0xC44
+#define NTDMA_8000_BAR_4_TRAN_UPPER     0xC48
+#define NTDMA_8500_BAR_2_LIMIT_LOWER    0xC4C
+#define NTDMA_8500_BAR_2_LIMIT_UPPER    0xC50
+#define NTDMA_8500_BAR_4_LIMIT_LOWER    0xC54
+#define NTDMA_8500_BAR_4_LIMIT_UPPER    0xC58
+
+
+
+
+/******************************************
+ *             NT DMA Functions
+ *****************************************/
+PLX_STATUS
+NtDma_Connect(
+    PLX_DEVICE_OBJECT *pNtDevice,
+    PLX_DEVICE_OBJECT *pDmaDevice,
+    U8                 DmaChannel,
+    PLX_PHYSICAL_MEM  *pLocalBuffer,
+    U64                Timeout_ms,
+    PLX_NT_DMA_TARGET *pTarget
+    );
+
+PLX_STATUS
+NtDma_Transfer(
+    PLX_NT_DMA_TARGET *pTarget,
+    U64                LocalAddr,
+    U64                RemoteOffset,
+    U32                ByteCount,
+    BOOLEAN            bRead,
+    U64                Timeout_ms
+    );
+
+PLX_STATUS
+NtDma_Disconnect(
+    PLX_NT_DMA_TARGET *pTarget
+    );
+
+
+/******************************************
+ *          NT DMA Support Functions
+ *****************************************/
+PLX_STATUS
+NtDma_Negotiate(
+    PLX_NT_DMA_TARGET *pTarget,
+    PLX_PHYSICAL_MEM  *pLocalBuffer,
+    U64                Timeout_ms
+    );
+
+PLX_STATUS
+NtDma_WindowSet(
+    PLX_NT_DMA_TARGET *pTarget,
+    U8                 window,
+    U64                RemoteBase
+    );
+
+PLX_STATUS
+NtDma_WaitIdle(
+    PLX_NT_DMA_TARGET *pTarget,
+    U64                Timeout_ms
+    );
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
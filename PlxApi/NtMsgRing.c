@@ -0,0 +1,628 @@
+/*******************************************************************************
+ * Copyright 2013-2019 Broadcom Inc
+ * Copyright (c) 2009 to 2012 PLX Technology Inc.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directorY of this source tree, or the
+ * BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+/*******************************************************************************
+ *
+ * File Name:
+ *
+ *      NtMsgRing.c
+ *
+ * Description:
+ *
+ *      Implements a single-producer/single-consumer message ring between two
+ *      hosts connected through an 8000 NT port.  Each host allocates a local
+ *      buffer which holds the ring of messages it receives, and the NT BAR of
+ *      each side is translated to the buffer of the opposite side.
+ *
+ *      Only posted writes cross the link.  The sender copies the payload into
+ *      a slot of the remote buffer through its NT BAR, then writes the slot
+ *      sequence to publish it.  The receiver polls the sequence in its local
+ *      memory and periodically returns credits (consumed count) by writing
+ *      them into the sender's buffer.  Neither side ever reads across the
+ *      link, so a message costs a few posted writes.
+ *
+ *      Receivers poll first, then optionally sleep on a doorbell interrupt.
+ *      A waiting receiver flags this in the sender's buffer so the sender
+ *      only rings the doorbell when needed.  Large messages can optionally be
+ *      moved by a DMA channel opened by the application.
+ *
+ *      The NT translation of both sides must be set up & both rings opened
+ *      before messages are sent. One thread may send while another receives.
+ *
+ * Revision History:
+ *
+ *      09-01-19 : PCI/PCIe SDK v8.10
+ *
+ ******************************************************************************/
+
+
+#include "PexApi.h"
+#include "PlxApiDebug.h"
+#include "PlxApiDirect.h"
+#include "NtMsgRing.h"
+
+
+
+
+/**********************************************
+ *               Definitions
+ *********************************************/
+// Ensure payload is visible before the slot is published
+#if defined(PLX_MSWINDOWS)
+    #define NTRING_WRITE_BARRIER()          MemoryBarrier()
+#elif defined(PLX_LINUX)
+    #define NTRING_WRITE_BARRIER()          __sync_synchronize()
+#else
+    #define NTRING_WRITE_BARRIER()
+#endif
+
+
+
+
+/**********************************************
+ *           Global Variables
+ *********************************************/
+static NTRING_OBJECT Gbl_NtRing[NTRING_MAX_RINGS];
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  NtRing_Open
+ *
+ * Description:  Sets up a message ring over an NT port
+ *
+ *****************************************************************************/
+PLX_STATUS
+NtRing_Open(
+    PLX_DEVICE_OBJECT    *pDevice,
+    PLX_NT_MSG_RING_PROP *pRingProp
+    )
+{
+    U16              i;
+    U32              RingSize;
+    PLX_STATUS       status;
+    PLX_INTERRUPT    PlxIntr;
+    NTRING_OBJECT   *pRing;
+    PLX_PCI_BAR_PROP BarProp;
+
+
+    // Only 8000 NT ports over the PLX driver are supported
+    if ((pDevice->Key.ApiMode != PLX_API_MODE_PCI) ||
+        ((pDevice->Key.PlxChip & 0xF000) != 0x8000) ||
+        ((pDevice->Key.PlxPortType != PLX_SPEC_PORT_NT_VIRTUAL) &&
+         (pDevice->Key.PlxPortType != PLX_SPEC_PORT_NT_LINK)))
+    {
+        return PLX_STATUS_UNSUPPORTED;
+    }
+
+    // Slot count must be a power of 2 & slots must hold a header plus data
+    if ((pRingProp->SlotCount == 0) ||
+        (pRingProp->SlotCount & (pRingProp->SlotCount - 1)) ||
+        (pRingProp->SlotSize <= NTRING_SLOT_HDR_SIZE) ||
+        (pRingProp->SlotSize & 0x3F))
+    {
+        return PLX_STATUS_INVALID_SIZE;
+    }
+
+    if ((pRingProp->DoorbellBit != PLX_NT_MSG_RING_NO_DOORBELL) &&
+        (pRingProp->DoorbellBit >= 32))
+    {
+        return PLX_STATUS_INVALID_DATA;
+    }
+
+    RingSize = NTRING_BUFFER_SIZE( pRingProp->SlotCount, pRingProp->SlotSize );
+
+    // Verify local buffer is mapped & large enough
+    if ((pRingProp->LocalBuffer.UserAddr == 0) ||
+        (pRingProp->LocalBuffer.Size < RingSize))
+    {
+        return PLX_STATUS_INSUFFICIENT_RES;
+    }
+
+    // Verify ring not already open by this process
+    if (NtRing_Find( pDevice ) != NULL)
+    {
+        return PLX_STATUS_IN_USE;
+    }
+
+    // Find a free entry
+    pRing = NULL;
+    for (i = 0; i < NTRING_MAX_RINGS; i++)
+    {
+        if (Gbl_NtRing[i].bInUse == FALSE)
+        {
+            pRing = &Gbl_NtRing[i];
+            break;
+        }
+    }
+
+    if (pRing == NULL)
+    {
+        return PLX_STATUS_INSUFFICIENT_RES;
+    }
+
+    // Verify remote ring fits in the NT BAR
+    status = PlxPci_PciBarProperties( pDevice, pRingProp->BarIndex, &BarProp );
+    if (status != PLX_STATUS_OK)
+    {
+        return status;
+    }
+
+    if (((U64)pRingProp->RemoteBarOffset + RingSize) > BarProp.Size)
+    {
+        DebugPrintf(("ERROR - Remote ring exceeds NT BAR %d space\n", pRingProp->BarIndex));
+        return PLX_STATUS_INVALID_OFFSET;
+    }
+
+    RtlZeroMemory( pRing, sizeof(NTRING_OBJECT) );
+
+    status = PlxPci_PciBarMap( pDevice, pRingProp->BarIndex, (VOID**)&pRing->pBarVa );
+    if (status != PLX_STATUS_OK)
+    {
+        return status;
+    }
+
+    pRing->Prop        = *pRingProp;
+    pRing->BarPhysical = BarProp.Physical;
+    pRing->pLocalVa    = PLX_INT_TO_PTR( pRingProp->LocalBuffer.UserAddr );
+    pRing->pRemoteVa   = pRing->pBarVa + pRingProp->RemoteBarOffset;
+
+    // Return credits in batches to limit writes across the link
+    pRing->CreditBatch = pRingProp->SlotCount / 4;
+    if (pRing->CreditBatch == 0)
+    {
+        pRing->CreditBatch = 1;
+    }
+
+    // Clear control block & slots so no message appears valid
+    RtlZeroMemory( pRing->pLocalVa, RingSize );
+
+    // The doorbell raised is the IRQ set register of the opposite NT side
+    if ((pDevice->Key.PlxChip & 0xFF00) == 0x8500)
+    {
+        pRing->OffsetDoorbell = NTRING_DB_IRQ_BASE_8500;
+    }
+    else
+    {
+        pRing->OffsetDoorbell = NTRING_DB_IRQ_BASE_8600;
+    }
+
+    if (pDevice->Key.PlxPortType == PLX_SPEC_PORT_NT_VIRTUAL)
+    {
+        pRing->OffsetDoorbell += NTRING_DB_IRQ_SET_LINK;
+    }
+    else
+    {
+        pRing->OffsetDoorbell += NTRING_DB_IRQ_SET_VIRTUAL;
+    }
+
+    // Register for the receive doorbell
+    if (pRingProp->DoorbellBit != PLX_NT_MSG_RING_NO_DOORBELL)
+    {
+        RtlZeroMemory( &PlxIntr, sizeof(PLX_INTERRUPT) );
+
+        PlxIntr.Doorbell = ((U32)1 << pRingProp->DoorbellBit);
+
+        status = PlxPci_NotificationRegisterFor( pDevice, &PlxIntr, &pRing->Event );
+        if (status == PLX_STATUS_OK)
+        {
+            status = PlxPci_InterruptEnable( pDevice, &PlxIntr );
+            if (status != PLX_STATUS_OK)
+            {
+                PlxPci_NotificationCancel( pDevice, &pRing->Event );
+            }
+        }
+
+        if (status != PLX_STATUS_OK)
+        {
+            PlxPci_PciBarUnmap( pDevice, (VOID**)&pRing->pBarVa );
+            return status;
+        }
+
+        pRing->bNotifyEnabled = TRUE;
+    }
+
+    // Entry now in use
+    pRing->Key    = pDevice->Key;
+    pRing->bInUse = TRUE;
+
+    DebugPrintf((
+        "NT msg ring: %d slots x %dB, remote at BAR %d + %08X\n",
+        pRingProp->SlotCount, pRingProp->SlotSize,
+        pRingProp->BarIndex, pRingProp->RemoteBarOffset
+        ));
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  NtRing_Send
+ *
+ * Description:  Writes a message into the next free slot of the remote ring
+ *
+ *****************************************************************************/
+PLX_STATUS
+NtRing_Send(
+    PLX_DEVICE_OBJECT *pDevice,
+    VOID              *pMsg,
+    U32                ByteCount,
+    U64                Timeout_ms
+    )
+{
+    U8              *pSlot;
+    U32              SpinCount;
+    U64              ElapsedMs;
+    PLX_STATUS       status;
+    NTRING_OBJECT   *pRing;
+    NTRING_SLOT_HDR *pHdr;
+    PLX_DMA_PARAMS   DmaParams;
+
+
+    pRing = NtRing_Find( pDevice );
+    if (pRing == NULL)
+    {
+        return PLX_STATUS_INVALID_ACCESS;
+    }
+
+    if (ByteCount > (pRing->Prop.SlotSize - NTRING_SLOT_HDR_SIZE))
+    {
+        return PLX_STATUS_INVALID_SIZE;
+    }
+
+    SpinCount = 0;
+    ElapsedMs = 0;
+
+    // Wait for a slot released by the remote receiver
+    while ((pRing->TxProduced -
+            NTRING_CTRL( pRing->pLocalVa, NTRING_CTRL_TX_CONSUMED )) >= pRing->Prop.SlotCount)
+    {
+        if (SpinCount < NTRING_SPIN_COUNT)
+        {
+            SpinCount++;
+        }
+        else
+        {
+            if (ElapsedMs >= Timeout_ms)
+            {
+                return PLX_STATUS_TIMEOUT;
+            }
+
+            Plx_sleep( 1 );
+            ElapsedMs++;
+        }
+    }
+
+    pSlot = pRing->pRemoteVa + NTRING_CTRL_SIZE +
+            ((pRing->TxProduced & (pRing->Prop.SlotCount - 1)) * pRing->Prop.SlotSize);
+
+    pHdr = (NTRING_SLOT_HDR*)pSlot;
+
+    if ((pRing->Prop.pDmaDevice != NULL) && (ByteCount != 0) &&
+        (ByteCount >= pRing->Prop.DmaThreshold))
+    {
+        // Move payload to the slot's bus address with the DMA engine
+        RtlZeroMemory( &DmaParams, sizeof(PLX_DMA_PARAMS) );
+
+        DmaParams.UserVa    = (PLX_UINT_PTR)pMsg;
+        DmaParams.PciAddr   = pRing->BarPhysical + pRing->Prop.RemoteBarOffset +
+                              (pSlot - pRing->pRemoteVa) + NTRING_SLOT_HDR_SIZE;
+        DmaParams.ByteCount = ByteCount;
+        DmaParams.Direction = PLX_DMA_USER_TO_PCI;
+
+        status =
+            PlxPci_DmaTransferUserBuffer(
+                pRing->Prop.pDmaDevice,
+                pRing->Prop.DmaChannel,
+                &DmaParams,
+                NTRING_DMA_TIMEOUT_MS
+                );
+
+        if (status != PLX_STATUS_OK)
+        {
+            return status;
+        }
+    }
+    else
+    {
+        // Copy payload with posted writes through the NT BAR
+        RtlCopyMemory( pSlot + NTRING_SLOT_HDR_SIZE, pMsg, ByteCount );
+    }
+
+    pHdr->ByteCount = ByteCount;
+
+    NTRING_WRITE_BARRIER();
+
+    // Publish the slot, written last since it passes ownership to receiver
+    pHdr->Seq = pRing->TxProduced + 1;
+
+    NTRING_WRITE_BARRIER();
+
+    pRing->TxProduced++;
+
+    // Ring doorbell only if the receiver went to sleep
+    if (pRing->Prop.DoorbellBit != PLX_NT_MSG_RING_NO_DOORBELL)
+    {
+        if (NTRING_CTRL( pRing->pLocalVa, NTRING_CTRL_TX_WAITING ) != 0)
+        {
+            NTRING_CTRL( pRing->pLocalVa, NTRING_CTRL_TX_WAITING ) = 0;
+
+            // Offset is relative to the NT port, so use the port-adjusted write
+            PlxPci_PlxRegisterWrite(
+                pDevice,
+                pRing->OffsetDoorbell,
+                ((U32)1 << pRing->Prop.DoorbellBit)
+                );
+        }
+    }
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  NtRing_Receive
+ *
+ * Description:  Copies the next message from the local ring
+ *
+ *****************************************************************************/
+PLX_STATUS
+NtRing_Receive(
+    PLX_DEVICE_OBJECT *pDevice,
+    VOID              *pMsg,
+    U32               *pByteCount,
+    U64                Timeout_ms
+    )
+{
+    U8              *pSlot;
+    U32              ByteCount;
+    U32              SeqExpected;
+    U32              SpinCount;
+    U64              ElapsedMs;
+    NTRING_OBJECT   *pRing;
+    NTRING_SLOT_HDR *pHdr;
+
+
+    pRing = NtRing_Find( pDevice );
+    if (pRing == NULL)
+    {
+        return PLX_STATUS_INVALID_ACCESS;
+    }
+
+    pSlot = pRing->pLocalVa + NTRING_CTRL_SIZE +
+            ((pRing->RxConsumed & (pRing->Prop.SlotCount - 1)) * pRing->Prop.SlotSize);
+
+    pHdr        = (NTRING_SLOT_HDR*)pSlot;
+    SeqExpected = pRing->RxConsumed + 1;
+
+    SpinCount = 0;
+    ElapsedMs = 0;
+
+    // Poll for the slot, then sleep on the doorbell or yield the CPU
+    while (*(volatile U32*)&pHdr->Seq != SeqExpected)
+    {
+        if (SpinCount < NTRING_SPIN_COUNT)
+        {
+            SpinCount++;
+        }
+        else
+        {
+            if (ElapsedMs >= Timeout_ms)
+            {
+                return PLX_STATUS_TIMEOUT;
+            }
+
+            if (pRing->bNotifyEnabled)
+            {
+                NtRing_WaitForDoorbell(
+                    pDevice,
+                    pRing,
+                    (volatile U32*)&pHdr->Seq,
+                    SeqExpected
+                    );
+
+                ElapsedMs += NTRING_WAIT_SLICE_MS;
+            }
+            else
+            {
+                Plx_sleep( 1 );
+                ElapsedMs++;
+            }
+        }
+    }
+
+    // Header is written by the remote host, so read it once & verify it
+    ByteCount = *(volatile U32*)&pHdr->ByteCount;
+
+    if (ByteCount > (pRing->Prop.SlotSize - NTRING_SLOT_HDR_SIZE))
+    {
+        DebugPrintf(("ERROR - Message size (%d B) exceeds ring slot\n", ByteCount));
+        return PLX_STATUS_INVALID_SIZE;
+    }
+
+    // Leave message in the ring if caller's buffer can't hold it
+    if (ByteCount > *pByteCount)
+    {
+        *pByteCount = ByteCount;
+        return PLX_STATUS_BUFF_TOO_SMALL;
+    }
+
+    *pByteCount = ByteCount;
+
+    RtlCopyMemory( pMsg, pSlot + NTRING_SLOT_HDR_SIZE, ByteCount );
+
+    pRing->RxConsumed++;
+
+    // Return credits to the sender
+    if ((pRing->RxConsumed % pRing->CreditBatch) == 0)
+    {
+        NTRING_WRITE_BARRIER();
+
+        NTRING_CTRL( pRing->pRemoteVa, NTRING_CTRL_TX_CONSUMED ) = pRing->RxConsumed;
+    }
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  NtRing_Close
+ *
+ * Description:  Closes a message ring & releases its resources
+ *
+ *****************************************************************************/
+PLX_STATUS
+NtRing_Close(
+    PLX_DEVICE_OBJECT *pDevice
+    )
+{
+    NTRING_OBJECT *pRing;
+    PLX_INTERRUPT  PlxIntr;
+
+
+    pRing = NtRing_Find( pDevice );
+    if (pRing == NULL)
+    {
+        return PLX_STATUS_INVALID_ACCESS;
+    }
+
+    if (pRing->bNotifyEnabled)
+    {
+        RtlZeroMemory( &PlxIntr, sizeof(PLX_INTERRUPT) );
+
+        PlxIntr.Doorbell = ((U32)1 << pRing->Prop.DoorbellBit);
+
+        PlxPci_InterruptDisable( pDevice, &PlxIntr );
+        PlxPci_NotificationCancel( pDevice, &pRing->Event );
+    }
+
+    // Local buffer belongs to the application & is left mapped
+    PlxPci_PciBarUnmap( pDevice, (VOID**)&pRing->pBarVa );
+
+    // Mark entry as free
+    pRing->bInUse = FALSE;
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/***********************************************************
+ *
+ *               PRIVATE SUPPORT FUNCTIONS
+ *
+ **********************************************************/
+
+
+/******************************************************************************
+ *
+ * Function   :  NtRing_Find
+ *
+ * Description:  Returns the state of the ring open on a device
+ *
+ * Note       :  Entries are matched by device location rather than object,
+ *               since objects may be copied or reused after a close
+ *
+ *****************************************************************************/
+NTRING_OBJECT*
+NtRing_Find(
+    PLX_DEVICE_OBJECT *pDevice
+    )
+{
+    U16 i;
+
+
+    for (i = 0; i < NTRING_MAX_RINGS; i++)
+    {
+        if ((Gbl_NtRing[i].bInUse)                                &&
+            (Gbl_NtRing[i].Key.ApiMode  == pDevice->Key.ApiMode)  &&
+            (Gbl_NtRing[i].Key.domain   == pDevice->Key.domain)   &&
+            (Gbl_NtRing[i].Key.bus      == pDevice->Key.bus)      &&
+            (Gbl_NtRing[i].Key.slot     == pDevice->Key.slot)     &&
+            (Gbl_NtRing[i].Key.function == pDevice->Key.function))
+        {
+            return &Gbl_NtRing[i];
+        }
+    }
+
+    return NULL;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  NtRing_WaitForDoorbell
+ *
+ * Description:  Asks the sender for a doorbell & sleeps until it arrives. The
+ *               flag & slot can race across the link, so the wait is limited
+ *               to a short slice after which the caller re-checks the ring.
+ *
+ *****************************************************************************/
+PLX_STATUS
+NtRing_WaitForDoorbell(
+    PLX_DEVICE_OBJECT *pDevice,
+    NTRING_OBJECT     *pRing,
+    volatile U32      *pSeq,
+    U32                SeqExpected
+    )
+{
+    NTRING_CTRL( pRing->pRemoteVa, NTRING_CTRL_TX_WAITING ) = 1;
+
+    NTRING_WRITE_BARRIER();
+
+    // Message may have arrived before the flag was seen
+    if (*pSeq == SeqExpected)
+    {
+        return PLX_STATUS_OK;
+    }
+
+    return PlxPci_NotificationWait(
+        pDevice,
+        &pRing->Event,
+        NTRING_WAIT_SLICE_MS
+        );
+}
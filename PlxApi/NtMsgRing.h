@@ -0,0 +1,171 @@
+#ifndef __NT_MSG_RING_H
+#define __NT_MSG_RING_H
+
+/*******************************************************************************
+ * Copyright 2013-2019 Broadcom, Inc
+ * Copyright (c) 2009 to 2012 PLX Technology Inc.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directorY of this source tree, or the
+ * BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+/*******************************************************************************
+ *
+ * File Name:
+ *
+ *     NtMsgRing.h
+ *
+ * Description:
+ *
+ *     Header file for the NT host-to-host message ring functions
+ *
+ * Revision History:
+ *
+ *     09-01-19: PCI/PCIe SDK v8.10
+ *
+ ******************************************************************************/
+
+
+#include "PlxIoctl.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/******************************************
+ *             Definitions
+ ******************************************/
+#define NTRING_MAX_RINGS                8           // Max rings open at once by a process
+#define NTRING_CTRL_SIZE                0x100       // Control block at start of each ring buffer
+#define NTRING_SLOT_HDR_SIZE            8           // Slot header (byte count & sequence)
+#define NTRING_SPIN_COUNT               1000        // Status polls before sleeping on a wait
+#define NTRING_WAIT_SLICE_MS            10          // Max doorbell wait before re-checking ring
+#define NTRING_DMA_TIMEOUT_MS           1000        // Timeout for DMA of a message payload
+
+// Control block fields, written only by the remote side
+#define NTRING_CTRL_TX_CONSUMED         0x00        // Messages remote side consumed from our TX ring
+#define NTRING_CTRL_TX_WAITING          0x40        // Remote receiver waiting on doorbell
+
+// Ring buffer size for a given slot configuration
+#define NTRING_BUFFER_SIZE(count, size) (NTRING_CTRL_SIZE + ((U32)(count) * (size)))
+
+// 8000 NT doorbell IRQ register block, relative to NT port registers
+#define NTRING_DB_IRQ_BASE_8500         0x90
+#define NTRING_DB_IRQ_BASE_8600         0xC4C
+#define NTRING_DB_IRQ_SET_VIRTUAL       0x00        // Virtual-side IRQ set
+#define NTRING_DB_IRQ_SET_LINK          0x10        // Link-side IRQ set
+
+// Access to a ring control field
+#define NTRING_CTRL(pBase, offset)      (*(volatile U32*)((U8*)(pBase) + (offset)))
+
+
+// Message slot header
+typedef struct _NTRING_SLOT_HDR
+{
+    U32 ByteCount;                      // Message size in bytes
+    U32 Seq;                            // Message sequence, written last to publish slot
+} NTRING_SLOT_HDR;
+
+
+// State of an open message ring
+typedef struct _NTRING_OBJECT
+{
+    BOOLEAN               bInUse;           // Entry in use
+    PLX_DEVICE_KEY        Key;              // Key of NT device
+    PLX_NT_MSG_RING_PROP  Prop;             // Ring properties
+    U8                   *pBarVa;           // User mapping of NT BAR
+    U64                   BarPhysical;      // Bus address of NT BAR
+    U8                   *pLocalVa;         // Local ring buffer (RX slots, written by remote)
+    U8                   *pRemoteVa;        // Remote ring buffer through NT BAR (TX slots)
+    U32                   OffsetDoorbell;   // Register to ring remote side's doorbell
+    U32                   CreditBatch;      // Consumed messages between credit updates
+    U32                   TxProduced;       // Messages sent
+    U32                   RxConsumed;       // Messages received
+    BOOLEAN               bNotifyEnabled;   // Doorbell notification registered
+    PLX_NOTIFY_OBJECT     Event;            // Doorbell notification
+} NTRING_OBJECT;
+
+
+
+
+/******************************************
+ *       NT Message Ring Functions
+ *****************************************/
+PLX_STATUS
+NtRing_Open(
+    PLX_DEVICE_OBJECT    *pDevice,
+    PLX_NT_MSG_RING_PROP *pRingProp
+    );
+
+PLX_STATUS
+NtRing_Send(
+    PLX_DEVICE_OBJECT *pDevice,
+    VOID              *pMsg,
+    U32                ByteCount,
+    U64                Timeout_ms
+    );
+
+PLX_STATUS
+NtRing_Receive(
+    PLX_DEVICE_OBJECT *pDevice,
+    VOID              *pMsg,
+    U32               *pByteCount,
+    U64                Timeout_ms
+    );
+
+PLX_STATUS
+NtRing_Close(
+    PLX_DEVICE_OBJECT *pDevice
+    );
+
+
+/******************************************
+ *    NT Message Ring Support Functions
+ *****************************************/
+NTRING_OBJECT*
+NtRing_Find(
+    PLX_DEVICE_OBJECT *pDevice
+    );
+
+PLX_STATUS
+NtRing_WaitForDoorbell(
+    PLX_DEVICE_OBJECT *pDevice,
+    NTRING_OBJECT     *pRing,
+    volatile U32      *pSeq,
+    U32                SeqExpected
+    );
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -84,7 +84,7 @@
 #endif
 
 #include <stdarg.h>         // For va_start/va_end
-#include <math.h>           // For pow()
+#include "Eep_8000.h"
 #include "PciRegs.h"
 #include "PlxApi.h"
 #include "PlxApiDebug.h"
@@ -93,6 +93,12 @@
 #include "I2cAaUsb.h"
 #include "MdioSpliceUsb.h"
 #include "SdbComPort.h"
+#include "SimDevice.h"
+#include "SpiFlash.h"
+#include "UserDma.h"
+#include "DmaStripe.h"
+#include "NtDma.h"
+#include "NtMsgRing.h"
 
 
 
@@ -194,6 +200,41 @@
 #endif
 
 
+// Simulated devices are only supported in Linux
+#if !defined(PLX_LINUX)
+
+    PLX_STATUS Sim_DeviceOpen(PLX_DEVICE_OBJECT *pDev)
+    {
+        return PLX_STATUS_UNSUPPORTED;
+    }
+
+    PLX_STATUS Sim_DeviceClose(PLX_DEVICE_OBJECT *pDev)
+    {
+        return PLX_STATUS_UNSUPPORTED;
+    }
+
+    PLX_STATUS Sim_DeviceFindEx(
+        PLX_DEVICE_KEY *pKey,
+        U16             DeviceNumber,
+        PLX_MODE_PROP  *pModeProp
+        )
+    {
+        return PLX_STATUS_UNSUPPORTED;
+    }
+
+    S32 Sim_Dispatch_IoControl(
+        PLX_DEVICE_OBJECT *pDevice,
+        U32                IoControlCode,
+        PLX_PARAMS        *pIoBuffer,
+        U32                Size
+        )
+    {
+        return 0;
+    }
+
+#endif
+
+
 // List of PLX drivers to search for
 static char *PlxDrivers[] =
 {
@@ -213,6 +254,20 @@ static char *PlxDrivers[] =
     "0"                     // Must be last item to mark end of list
 };
 
+// Theoretical max link byte rate per lane for 1 second, indexed by link speed
+#define PLX_PERF_LINK_RATE_ENTRIES      7
+
+static const U64 Gbl_PerfMaxLinkRate[PLX_PERF_LINK_RATE_ENTRIES] =
+{
+    0,                          // Link down
+    PERF_MAX_BPS_GEN_1_0,       // Gen 1
+    PERF_MAX_BPS_GEN_2_0,       // Gen 2
+    PERF_MAX_BPS_GEN_3_0,       // Gen 3
+    PERF_MAX_BPS_GEN_4_0,       // Gen 4
+    PERF_MAX_BPS_GEN_5_0,       // Gen 5
+    PERF_MAX_BPS_GEN_6_0        // Gen 6
+};
+
 
 
 
@@ -233,6 +288,21 @@ PlxIoMessage(
     VOID              *pBuffer
     );
 
+static VOID
+PlxPerf_CalcDirStats(
+    U8                  NumPorts,
+    const U8           *bValid,
+    S64                *pMaxLinkRate,
+    S64                *pPostedHeader,
+    S64                *pPostedDW,
+    S64                *pNonpostedDW,
+    S64                *pCplHeader,
+    S64                *pCplDW,
+    S64                *pDllp,
+    U32                 ElapsedTime_ms,
+    PLX_PERF_STATS_DIR *pStats
+    );
+
 
 
 
@@ -273,9 +343,14 @@ DllMain(
                 (U32)(sizeof(PLX_UINT_PTR) * 8),
                 __DATE__, __TIME__
                 ));
+
+            // Create library-wide locks before any thread uses them
+            PlxDir_RegCacheInit();
             break;
 
         case DLL_PROCESS_DETACH:
+            PlxDir_RegCacheCleanup();
+
             DebugPrintf(("DllMain( DLL_PROCESS_DETACH )\n"));
             DebugPrintf(("<=======================================>\n"));
             break;
@@ -352,6 +427,10 @@ PlxPci_DeviceOpen(
         {
             return Sdb_DeviceOpen( pDevice );
         }
+        else if (pKey->ApiMode == PLX_API_MODE_SIMULATED)
+        {
+            return Sim_DeviceOpen( pDevice );
+        }
     }
     else
     {
@@ -428,8 +507,15 @@ PlxPci_DeviceClose(
     {
         Sdb_DeviceClose( pDevice );
     }
+    else if (pDevice->Key.ApiMode == PLX_API_MODE_SIMULATED)
+    {
+        Sim_DeviceClose( pDevice );
+    }
     else
     {
+        // Release any striped DMA state of the device
+        DmaStripe_DeviceRelease( pDevice );
+
         // Close the handle
         Driver_Disconnect( pDevice->hDevice );
     }
@@ -604,6 +690,16 @@ PlxPci_DeviceFindEx(
             );
     }
 
+    // Access in-process simulated device models
+    if (ApiMode == PLX_API_MODE_SIMULATED)
+    {
+        return Sim_DeviceFindEx(
+            pKey,
+            DeviceNumber,
+            pModeProp
+            );
+    }
+
     if (ApiMode == PLX_API_MODE_TCP)
     {
         // Not yet supported
@@ -644,6 +740,47 @@ PlxPci_I2cGetPorts(
 
 
 
+/******************************************************************************
+ *
+ * Function   :  PlxPci_I2cTopologyScan
+ *
+ * Description:  Probes free I2C ports selected by I2cPortMask (0 = all) in
+ *               parallel & caches the devices found, so later device searches
+ *               avoid re-probing the bus. Devices remain cached in this process
+ *               for CacheTtlSec (0 = no caching). On return, bits of probed ports are set in pI2cPorts.
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_I2cTopologyScan(
+    PLX_API_MODE  ApiMode,
+    U32           ClockRate,
+    U32           CacheTtlSec,
+    U32           I2cPortMask,
+    U32          *pI2cPorts
+    )
+{
+    if (pI2cPorts == NULL)
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
+    // Only Aardvark I2C currently supported
+    if (ApiMode != PLX_API_MODE_I2C_AARDVARK)
+    {
+        return PLX_STATUS_INVALID_ACCESS;
+    }
+
+    return PlxI2c_TopologyScan(
+        ClockRate,
+        CacheTtlSec,
+        I2cPortMask,
+        pI2cPorts
+        );
+}
+
+
+
+
 /******************************************************************************
  *
  * Function   :  PlxPci_ApiVersion
@@ -849,6 +986,12 @@ PlxPci_DriverProperties(
         pDriverProp->bIsServiceDriver = TRUE;
         strcpy( pDriverProp->Name, "SdbComPort" );
     }
+    else if (pDevice->Key.ApiMode == PLX_API_MODE_SIMULATED)
+    {
+        // Fill in properties for simulated device
+        pDriverProp->bIsServiceDriver = TRUE;
+        strcpy( pDriverProp->Name, "PlxSim" );
+    }
 #endif
 
     return IoBuffer.ReturnCode;
@@ -1948,6 +2091,50 @@ PlxPci_DeviceReset(
 
 
 
+/******************************************************************************
+ *
+ * Function   :  PlxPci_DeviceGetStats
+ *
+ * Description:  Returns the driver statistics counters for a device
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_DeviceGetStats(
+    PLX_DEVICE_OBJECT *pDevice,
+    PLX_DEVICE_STATS  *pStats
+    )
+{
+    PLX_PARAMS IoBuffer;
+
+
+    if (pStats == NULL)
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    RtlZeroMemory( &IoBuffer, sizeof(PLX_PARAMS) );
+
+    IoBuffer.Key      = pDevice->Key;
+    IoBuffer.value[0] = (PLX_UINT_PTR)pStats;
+
+    PlxIoMessage(
+        pDevice,
+        PLX_IOCTL_DEVICE_GET_STATS,
+        &IoBuffer
+        );
+
+    return IoBuffer.ReturnCode;
+}
+
+
+
+
 /******************************************************************************
  *
  * Function   :  PlxPci_PciRegisterRead
@@ -2436,48 +2623,81 @@ PlxPci_PlxMappedRegisterWrite(
 
 /******************************************************************************
  *
- * Function   :  PlxPci_PlxMailboxRead
+ * Function   :  PlxPci_PlxMappedRegisterReadBuffer
  *
- * Description:  Reads a PLX mailbox register
+ * Description:  Reads a block of consecutive PLX-specific registers mapped from
+ *               upstream port BAR 0 (e.g. a memory-mapped flash window)
  *
  *****************************************************************************/
-U32
-PlxPci_PlxMailboxRead(
+PLX_STATUS
+PlxPci_PlxMappedRegisterReadBuffer(
     PLX_DEVICE_OBJECT *pDevice,
-    U16                mailbox,
-    PLX_STATUS        *pStatus
+    U32                offset,
+    VOID              *pBuffer,
+    U32                ByteCount
     )
 {
+    U32        idx;
+    PLX_STATUS status;
     PLX_PARAMS IoBuffer;
 
 
+    if (pBuffer == NULL)
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
     // Verify device object
     if (!IsObjectValid(pDevice))
     {
-        if (pStatus != NULL)
-        {
-            *pStatus = PLX_STATUS_INVALID_OBJECT;
-        }
-        return PCI_CFG_RD_ERR_VAL_32;
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    // Registers are accessed as 32-bit values
+    if (offset & 0x3)
+    {
+        return PLX_STATUS_INVALID_OFFSET;
+    }
+
+    if ((ByteCount == 0) || (ByteCount & 0x3))
+    {
+        return PLX_STATUS_INVALID_SIZE;
     }
 
     RtlZeroMemory( &IoBuffer, sizeof(PLX_PARAMS) );
 
     IoBuffer.Key      = pDevice->Key;
-    IoBuffer.value[0] = mailbox;
+    IoBuffer.value[0] = offset;
+    IoBuffer.value[1] = ByteCount;
+    IoBuffer.value[2] = PLX_PTR_TO_INT( pBuffer );
 
     PlxIoMessage(
         pDevice,
-        PLX_IOCTL_MAILBOX_READ,
+        PLX_IOCTL_MAPPED_REGISTER_READ_BUFFER,
         &IoBuffer
         );
 
-    if (pStatus != NULL)
+    if (IoBuffer.ReturnCode != PLX_STATUS_UNSUPPORTED)
     {
-        *pStatus = IoBuffer.ReturnCode;
+        return IoBuffer.ReturnCode;
     }
 
-    return (U32)IoBuffer.value[1];
+    // Driver doesn't support buffer access, revert to single register reads
+    for (idx = 0; idx < ByteCount; idx += sizeof(U32))
+    {
+        *(U32*)((U8*)pBuffer + idx) =
+            PlxPci_PlxMappedRegisterRead(
+                pDevice,
+                offset + idx,
+                &status
+                );
+        if (status != PLX_STATUS_OK)
+        {
+            return status;
+        }
+    }
+
+    return PLX_STATUS_OK;
 }
 
 
@@ -2485,40 +2705,121 @@ PlxPci_PlxMailboxRead(
 
 /******************************************************************************
  *
- * Function   :  PlxPci_PlxMailboxWrite
+ * Function   :  PlxPci_PlxRegisterAccessList
  *
- * Description:  Writes to a PLX mailbox register
+ * Description:  Performs a list of PLX-specific register reads & writes in a
+ *               single request. Read values are returned in the list.
  *
  *****************************************************************************/
 PLX_STATUS
-PlxPci_PlxMailboxWrite(
+PlxPci_PlxRegisterAccessList(
     PLX_DEVICE_OBJECT *pDevice,
-    U16                mailbox,
-    U32                value
+    PLX_REG_ACCESS    *pList,
+    U32                Count,
+    BOOLEAN            bMapped
     )
 {
+    U32        idx;
+    PLX_STATUS status;
     PLX_PARAMS IoBuffer;
 
 
+    if (pList == NULL)
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
     // Verify device object
     if (!IsObjectValid(pDevice))
     {
         return PLX_STATUS_INVALID_OBJECT;
     }
 
+    if (Count == 0)
+    {
+        return PLX_STATUS_INVALID_SIZE;
+    }
+
+    // Registers are accessed as 32-bit values
+    for (idx = 0; idx < Count; idx++)
+    {
+        if (pList[idx].Offset & 0x3)
+        {
+            return PLX_STATUS_INVALID_OFFSET;
+        }
+    }
+
     RtlZeroMemory( &IoBuffer, sizeof(PLX_PARAMS) );
 
     IoBuffer.Key      = pDevice->Key;
-    IoBuffer.value[0] = mailbox;
-    IoBuffer.value[1] = value;
+    IoBuffer.value[0] = Count;
+    IoBuffer.value[1] = bMapped;
+    IoBuffer.value[2] = PLX_PTR_TO_INT( pList );
 
     PlxIoMessage(
         pDevice,
-        PLX_IOCTL_MAILBOX_WRITE,
+        PLX_IOCTL_REGISTER_ACCESS_LIST,
         &IoBuffer
         );
 
-    return IoBuffer.ReturnCode;
+    if (IoBuffer.ReturnCode != PLX_STATUS_UNSUPPORTED)
+    {
+        return IoBuffer.ReturnCode;
+    }
+
+    // Driver doesn't support register lists, revert to single accesses
+    for (idx = 0; idx < Count; idx++)
+    {
+        if (pList[idx].bWrite)
+        {
+            if (bMapped)
+            {
+                status =
+                    PlxPci_PlxMappedRegisterWrite(
+                        pDevice,
+                        pList[idx].Offset,
+                        pList[idx].Value
+                        );
+            }
+            else
+            {
+                status =
+                    PlxPci_PlxRegisterWrite(
+                        pDevice,
+                        pList[idx].Offset,
+                        pList[idx].Value
+                        );
+            }
+        }
+        else
+        {
+            if (bMapped)
+            {
+                pList[idx].Value =
+                    PlxPci_PlxMappedRegisterRead(
+                        pDevice,
+                        pList[idx].Offset,
+                        &status
+                        );
+            }
+            else
+            {
+                pList[idx].Value =
+                    PlxPci_PlxRegisterRead(
+                        pDevice,
+                        pList[idx].Offset,
+                        &status
+                        );
+            }
+        }
+
+        if (status != PLX_STATUS_OK)
+        {
+            return status;
+        }
+    }
+
+    return PLX_STATUS_OK;
 }
 
 
@@ -2526,49 +2827,187 @@ PlxPci_PlxMailboxWrite(
 
 /******************************************************************************
  *
- * Function   :  PlxPci_PciBarProperties
+ * Function   :  PlxPci_RegisterCacheEnable
  *
- * Description:  Returns the properties of a PCI BAR space
+ * Description:  Enables caching of read-only registers (IDs, capabilities)
+ *               for devices accessed over I2C, MDIO or SDB. Disabled by default.
  *
  *****************************************************************************/
 PLX_STATUS
-PlxPci_PciBarProperties(
-    PLX_DEVICE_OBJECT *pDevice,
-    U8                 BarIndex,
-    PLX_PCI_BAR_PROP  *pBarProp
+PlxPci_RegisterCacheEnable(
+    BOOLEAN bEnable
     )
 {
-    PLX_PARAMS IoBuffer;
+    PlxDir_RegCacheEnable( bEnable );
+
+    return PLX_STATUS_OK;
+}
 
 
-    if (pBarProp == NULL)
-    {
-        return PLX_STATUS_NULL_PARAM;
-    }
 
-    // Set default value
-    RtlZeroMemory( pBarProp, sizeof(PLX_PCI_BAR_PROP) );
 
-    // Verify device object
-    if (!IsObjectValid(pDevice))
+/******************************************************************************
+ *
+ * Function   :  PlxPci_RegisterCacheFlush
+ *
+ * Description:  Discards cached registers of a device, or of all devices
+ *               if no device is provided
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_RegisterCacheFlush(
+    PLX_DEVICE_OBJECT *pDevice
+    )
+{
+    // Verify device object if provided
+    if ((pDevice != NULL) && !IsObjectValid(pDevice))
     {
         return PLX_STATUS_INVALID_OBJECT;
     }
 
-    // Verify BAR number
-    switch (BarIndex)
-    {
-        case 0:
-        case 1:
-        case 2:
-        case 3:
-        case 4:
-        case 5:
-            break;
-
-        default:
-            return PLX_STATUS_INVALID_ACCESS;
-    }
+    PlxDir_RegCacheFlush( pDevice );
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxPci_PlxMailboxRead
+ *
+ * Description:  Reads a PLX mailbox register
+ *
+ *****************************************************************************/
+U32
+PlxPci_PlxMailboxRead(
+    PLX_DEVICE_OBJECT *pDevice,
+    U16                mailbox,
+    PLX_STATUS        *pStatus
+    )
+{
+    PLX_PARAMS IoBuffer;
+
+
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+    {
+        if (pStatus != NULL)
+        {
+            *pStatus = PLX_STATUS_INVALID_OBJECT;
+        }
+        return PCI_CFG_RD_ERR_VAL_32;
+    }
+
+    RtlZeroMemory( &IoBuffer, sizeof(PLX_PARAMS) );
+
+    IoBuffer.Key      = pDevice->Key;
+    IoBuffer.value[0] = mailbox;
+
+    PlxIoMessage(
+        pDevice,
+        PLX_IOCTL_MAILBOX_READ,
+        &IoBuffer
+        );
+
+    if (pStatus != NULL)
+    {
+        *pStatus = IoBuffer.ReturnCode;
+    }
+
+    return (U32)IoBuffer.value[1];
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxPci_PlxMailboxWrite
+ *
+ * Description:  Writes to a PLX mailbox register
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_PlxMailboxWrite(
+    PLX_DEVICE_OBJECT *pDevice,
+    U16                mailbox,
+    U32                value
+    )
+{
+    PLX_PARAMS IoBuffer;
+
+
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    RtlZeroMemory( &IoBuffer, sizeof(PLX_PARAMS) );
+
+    IoBuffer.Key      = pDevice->Key;
+    IoBuffer.value[0] = mailbox;
+    IoBuffer.value[1] = value;
+
+    PlxIoMessage(
+        pDevice,
+        PLX_IOCTL_MAILBOX_WRITE,
+        &IoBuffer
+        );
+
+    return IoBuffer.ReturnCode;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxPci_PciBarProperties
+ *
+ * Description:  Returns the properties of a PCI BAR space
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_PciBarProperties(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 BarIndex,
+    PLX_PCI_BAR_PROP  *pBarProp
+    )
+{
+    PLX_PARAMS IoBuffer;
+
+
+    if (pBarProp == NULL)
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
+    // Set default value
+    RtlZeroMemory( pBarProp, sizeof(PLX_PCI_BAR_PROP) );
+
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    // Verify BAR number
+    switch (BarIndex)
+    {
+        case 0:
+        case 1:
+        case 2:
+        case 3:
+        case 4:
+        case 5:
+            break;
+
+        default:
+            return PLX_STATUS_INVALID_ACCESS;
+    }
 
     RtlZeroMemory( &IoBuffer, sizeof(PLX_PARAMS) );
 
@@ -2675,6 +3114,17 @@ PlxPci_PciBarMap(
     // Calculate starting offset from page boundary
     BarOffset = BarProp.Physical & ~PAGE_MASK;
 
+    // Simulated device spaces are already in process memory
+    if (pDevice->Key.ApiMode == PLX_API_MODE_SIMULATED)
+    {
+        pDevice->PciBar[BarIndex]    = BarProp;
+        pDevice->PciBarVa[BarIndex]  = (PLX_UINT_PTR)BarProp.Physical;
+        pDevice->BarMapRef[BarIndex] = 1;
+
+        *(PLX_UINT_PTR*)pVa = pDevice->PciBarVa[BarIndex];
+        return PLX_STATUS_OK;
+    }
+
     // For service driver, need to send additional data before mmap
     if (strcmp(
             PlxDrivers[pDevice->Key.ApiIndex],
@@ -2782,19 +3232,23 @@ PlxPci_PciBarUnmap(
             // Unmap the space if no longer referenced
             if (pDevice->BarMapRef[BarIndex] == 0)
             {
-                // Remove offset
-                BarVa = BarVa & PAGE_MASK;
-
-                // Unmap the space
-                rc =
-                    munmap(
-                        (VOID*)BarVa,
-                        PAGE_ALIGN((PLX_UINT_PTR)pDevice->PciBar[BarIndex].Size)
-                        );
-
-                if (rc != 0)
+                // Simulated device spaces are not mapped
+                if (pDevice->Key.ApiMode != PLX_API_MODE_SIMULATED)
                 {
-                    return PLX_STATUS_INVALID_ADDR;
+                    // Remove offset
+                    BarVa = BarVa & PAGE_MASK;
+
+                    // Unmap the space
+                    rc =
+                        munmap(
+                            (VOID*)BarVa,
+                            PAGE_ALIGN((PLX_UINT_PTR)pDevice->PciBar[BarIndex].Size)
+                            );
+
+                    if (rc != 0)
+                    {
+                        return PLX_STATUS_INVALID_ADDR;
+                    }
                 }
 
                 // Clear internal data
@@ -2961,6 +3415,40 @@ PlxPci_EepromCrcGet(
 
 
 
+/******************************************************************************
+ *
+ * Function   :  PlxPci_EepromCrcCompute
+ *
+ * Description:  Calculates the 8000-series EEPROM CRC over an image in memory
+ *
+ * Notes      :  The buffer should start at the first byte covered by the CRC,
+ *               which is offset 2 for devices with an EEPROM byte count header
+ *               and offset 0 otherwise. No device access is performed.
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_EepromCrcCompute(
+    VOID *pBuffer,
+    U32   ByteCount,
+    U32  *pCrc
+    )
+{
+    if ((pBuffer == NULL) || (pCrc == NULL))
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
+    // Initialize CRC
+    *pCrc = (U32)-1;
+
+    Plx8000_EepromCrcCompute( (U8*)pBuffer, ByteCount, pCrc );
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
 /******************************************************************************
  *
  * Function   :  PlxPci_EepromCrcUpdate
@@ -3286,51 +3774,84 @@ PlxPci_EepromWriteByOffset_16(
 
 /******************************************************************************
  *
- * Function   : PlxPci_SpiFlashPropGet
+ * Function   :  PlxPci_EepromReadBuffer
  *
- * Description: Returns the SPI flash properties at specified chip select
+ * Description:  Read a block of 32-bit aligned data from the EEPROM
+ *
+ * Note       :  If the device or driver does not support buffer access, the
+ *               data is read one 32-bit value at a time.
  *
  *****************************************************************************/
 PLX_STATUS
-PlxPci_SpiFlashPropGet(
-    PLX_DEVICE_OBJECT *PtrDev,
-    U8                 ChipSel,
-    PEX_SPI_OBJ       *PtrSpi
+PlxPci_EepromReadBuffer(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset,
+    VOID              *pBuffer,
+    U32                ByteCount
     )
 {
+    U32        i;
+    PLX_STATUS status;
+    PLX_PARAMS IoBuffer;
+
+
+    if (pBuffer == NULL)
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
     // Verify device object
-    if (!IsObjectValid(PtrDev))
+    if (!IsObjectValid(pDevice))
     {
         return PLX_STATUS_INVALID_OBJECT;
     }
 
-    if (PtrSpi == NULL)
+    // Verify offset & size are 32-bit aligned
+    if (offset & 0x3)
     {
-        return PLX_STATUS_NULL_PARAM;
+        return PLX_STATUS_INVALID_OFFSET;
     }
 
-    return PlxDir_SpiFlashPropGet( PtrDev, ChipSel, PtrSpi );
-}
+    if ((ByteCount == 0) || (ByteCount & 0x3))
+    {
+        return PLX_STATUS_INVALID_SIZE;
+    }
 
+    RtlZeroMemory( &IoBuffer, sizeof(PLX_PARAMS) );
 
+    IoBuffer.Key      = pDevice->Key;
+    IoBuffer.value[0] = offset;
+    IoBuffer.value[1] = ByteCount;
+    IoBuffer.value[2] = PLX_PTR_TO_INT( pBuffer );
 
+    PlxIoMessage(
+        pDevice,
+        PLX_IOCTL_EEPROM_READ_BUFFER,
+        &IoBuffer
+        );
 
-/******************************************************************************
- *
- * Function   : PlxPci_SpiFlashErase
- *
- * Description: Erase all or a portion of flash
- *
- *****************************************************************************/
-PLX_STATUS
-PlxPci_SpiFlashErase(
-    PLX_DEVICE_OBJECT *PtrDev,
-    PEX_SPI_OBJ       *PtrSpi,
-    U32                StartOffset,
-    U8                 BoolWaitComplete
-    )
-{
-    return PlxDir_SpiFlashErase( PtrDev, PtrSpi, StartOffset, BoolWaitComplete );
+    if (IoBuffer.ReturnCode != PLX_STATUS_UNSUPPORTED)
+    {
+        return IoBuffer.ReturnCode;
+    }
+
+    // Buffer access not supported, revert to individual reads
+    for (i = 0; i < ByteCount; i += sizeof(U32))
+    {
+        status =
+            PlxPci_EepromReadByOffset(
+                pDevice,
+                offset + i,
+                (U32*)((U8*)pBuffer + i)
+                );
+
+        if (status != PLX_STATUS_OK)
+        {
+            return status;
+        }
+    }
+
+    return PLX_STATUS_OK;
 }
 
 
@@ -3338,25 +3859,185 @@ PlxPci_SpiFlashErase(
 
 /******************************************************************************
  *
- * Function   : PlxPci_SpiFlashReadBuffer
+ * Function   :  PlxPci_EepromWriteBuffer
  *
- * Description: Reads data from flash
+ * Description:  Write a block of 32-bit aligned data to the EEPROM
+ *
+ * Note       :  If verify is requested, PLX_STATUS_FAILED is returned if any
+ *               value does not read back as written.
  *
  *****************************************************************************/
 PLX_STATUS
-PlxPci_SpiFlashReadBuffer(
-    PLX_DEVICE_OBJECT *PtrDev,
-    PEX_SPI_OBJ       *PtrSpi,
-    U32                StartOffset,
-    U8                *PtrRxBuff,
-    U32                SizeRx
+PlxPci_EepromWriteBuffer(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset,
+    VOID              *pBuffer,
+    U32                ByteCount,
+    BOOLEAN            bVerify
     )
 {
-    // Verify objects
-    if ( !IsObjectValid(PtrDev) || !IsObjectValid(PtrSpi) )
-    {
-        return PLX_STATUS_INVALID_OBJECT;
-    }
+    U32        i;
+    U32        value;
+    PLX_STATUS status;
+    PLX_PARAMS IoBuffer;
+
+
+    if (pBuffer == NULL)
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    // Verify offset & size are 32-bit aligned
+    if (offset & 0x3)
+    {
+        return PLX_STATUS_INVALID_OFFSET;
+    }
+
+    if ((ByteCount == 0) || (ByteCount & 0x3))
+    {
+        return PLX_STATUS_INVALID_SIZE;
+    }
+
+    RtlZeroMemory( &IoBuffer, sizeof(PLX_PARAMS) );
+
+    IoBuffer.Key         = pDevice->Key;
+    IoBuffer.value[0]    = offset;
+    IoBuffer.value[1]    = ByteCount;
+    IoBuffer.value[2]    = PLX_PTR_TO_INT( pBuffer );
+    IoBuffer.u.ExData[0] = bVerify;
+
+    PlxIoMessage(
+        pDevice,
+        PLX_IOCTL_EEPROM_WRITE_BUFFER,
+        &IoBuffer
+        );
+
+    if (IoBuffer.ReturnCode != PLX_STATUS_UNSUPPORTED)
+    {
+        return IoBuffer.ReturnCode;
+    }
+
+    // Buffer access not supported, revert to individual writes
+    for (i = 0; i < ByteCount; i += sizeof(U32))
+    {
+        status =
+            PlxPci_EepromWriteByOffset(
+                pDevice,
+                offset + i,
+                *(U32*)((U8*)pBuffer + i)
+                );
+
+        if (status != PLX_STATUS_OK)
+        {
+            return status;
+        }
+
+        if (bVerify)
+        {
+            status =
+                PlxPci_EepromReadByOffset(
+                    pDevice,
+                    offset + i,
+                    &value
+                    );
+
+            if (status != PLX_STATUS_OK)
+            {
+                return status;
+            }
+
+            if (value != *(U32*)((U8*)pBuffer + i))
+            {
+                return PLX_STATUS_FAILED;
+            }
+        }
+    }
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   : PlxPci_SpiFlashPropGet
+ *
+ * Description: Returns the SPI flash properties at specified chip select
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_SpiFlashPropGet(
+    PLX_DEVICE_OBJECT *PtrDev,
+    U8                 ChipSel,
+    PEX_SPI_OBJ       *PtrSpi
+    )
+{
+    // Verify device object
+    if (!IsObjectValid(PtrDev))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    if (PtrSpi == NULL)
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
+    return PlxDir_SpiFlashPropGet( PtrDev, ChipSel, PtrSpi );
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   : PlxPci_SpiFlashErase
+ *
+ * Description: Erase all or a portion of flash
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_SpiFlashErase(
+    PLX_DEVICE_OBJECT *PtrDev,
+    PEX_SPI_OBJ       *PtrSpi,
+    U32                StartOffset,
+    U8                 BoolWaitComplete
+    )
+{
+    return PlxDir_SpiFlashErase( PtrDev, PtrSpi, StartOffset, BoolWaitComplete );
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   : PlxPci_SpiFlashReadBuffer
+ *
+ * Description: Reads data from flash
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_SpiFlashReadBuffer(
+    PLX_DEVICE_OBJECT *PtrDev,
+    PEX_SPI_OBJ       *PtrSpi,
+    U32                StartOffset,
+    U8                *PtrRxBuff,
+    U32                SizeRx
+    )
+{
+    // Verify objects
+    if ( !IsObjectValid(PtrDev) || !IsObjectValid(PtrSpi) )
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
 
     return PlxDir_SpiFlashReadBuffer( PtrDev, PtrSpi, StartOffset, PtrRxBuff, SizeRx );
 }
@@ -3477,6 +4158,109 @@ PlxPci_SpiFlashGetStatus(
 
 
 
+/******************************************************************************
+ *
+ * Function   : PlxPci_SpiFlashPageProgram
+ *
+ * Description: Programs data into a single flash page & waits for completion
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_SpiFlashPageProgram(
+    PLX_DEVICE_OBJECT *PtrDev,
+    PEX_SPI_OBJ       *PtrSpi,
+    U32                StartOffset,
+    U8                *PtrTxBuff,
+    U32                SizeTx
+    )
+{
+    PLX_PARAMS IoBuffer;
+
+
+    // Verify objects
+    if ( !IsObjectValid(PtrDev) || !IsObjectValid(PtrSpi) )
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    if (PtrTxBuff == NULL)
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
+    RtlZeroMemory( &IoBuffer, sizeof(PLX_PARAMS) );
+
+    IoBuffer.Key       = PtrDev->Key;
+    IoBuffer.value[0]  = StartOffset;
+    IoBuffer.value[1]  = SizeTx;
+    IoBuffer.value[2]  = PLX_PTR_TO_INT( PtrTxBuff );
+    IoBuffer.u.SpiProp = *PtrSpi;
+
+    PlxIoMessage(
+        PtrDev,
+        PLX_IOCTL_SPI_FLASH_PAGE_PROGRAM,
+        &IoBuffer
+        );
+
+    if (IoBuffer.ReturnCode != PLX_STATUS_UNSUPPORTED)
+    {
+        return IoBuffer.ReturnCode;
+    }
+
+    // Driver or transport doesn't support SPI messages, program from API
+    return Spi_PageProgram( PtrDev, PtrSpi, StartOffset, PtrTxBuff, SizeTx );
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   : PlxPci_SpiFlashWaitWriteComplete
+ *
+ * Description: Waits for a flash program or erase operation to complete
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_SpiFlashWaitWriteComplete(
+    PLX_DEVICE_OBJECT *PtrDev,
+    PEX_SPI_OBJ       *PtrSpi,
+    U32                TimeoutMs
+    )
+{
+    PLX_PARAMS IoBuffer;
+
+
+    // Verify objects
+    if ( !IsObjectValid(PtrDev) || !IsObjectValid(PtrSpi) )
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    RtlZeroMemory( &IoBuffer, sizeof(PLX_PARAMS) );
+
+    IoBuffer.Key       = PtrDev->Key;
+    IoBuffer.value[0]  = TimeoutMs;
+    IoBuffer.u.SpiProp = *PtrSpi;
+
+    PlxIoMessage(
+        PtrDev,
+        PLX_IOCTL_SPI_FLASH_WAIT_WRITE_DONE,
+        &IoBuffer
+        );
+
+    if (IoBuffer.ReturnCode != PLX_STATUS_UNSUPPORTED)
+    {
+        return IoBuffer.ReturnCode;
+    }
+
+    // Driver or transport doesn't support SPI messages, poll from API
+    return Spi_WaitWriteComplete( PtrDev, PtrSpi, TimeoutMs );
+}
+
+
+
+
 /******************************************************************************
  *
  * Function   :  PlxPci_IoPortRead
@@ -3853,6 +4637,13 @@ PlxPci_PhysicalMemoryMap(
         return PLX_STATUS_INVALID_DATA;
     }
 
+    // Simulated device buffers are already in process memory
+    if (pDevice->Key.ApiMode == PLX_API_MODE_SIMULATED)
+    {
+        pMemoryInfo->UserAddr = pMemoryInfo->CpuPhysical;
+        return PLX_STATUS_OK;
+    }
+
     // Map the buffer to user space
     pMemoryInfo->UserAddr =
         (PLX_UINT_PTR)mmap(
@@ -3916,16 +4707,20 @@ PlxPci_PhysicalMemoryUnmap(
         return PLX_STATUS_INVALID_ADDR;
     }
 
-    // Unmap buffer from virtual space
-    rc =
-        munmap(
-            PLX_INT_TO_PTR(pMemoryInfo->UserAddr),
-            pMemoryInfo->Size
-            );
-
-    if (rc != 0)
+    // Simulated device buffers are not mapped
+    if (pDevice->Key.ApiMode != PLX_API_MODE_SIMULATED)
     {
-        return PLX_STATUS_INVALID_ADDR;
+        // Unmap buffer from virtual space
+        rc =
+            munmap(
+                PLX_INT_TO_PTR(pMemoryInfo->UserAddr),
+                pMemoryInfo->Size
+                );
+
+        if (rc != 0)
+        {
+            return PLX_STATUS_INVALID_ADDR;
+        }
     }
 
     // Clear buffer address
@@ -3939,21 +4734,22 @@ PlxPci_PhysicalMemoryUnmap(
 
 /******************************************************************************
  *
- * Function   :  PlxPci_CommonBufferProperties
+ * Function   :  PlxPci_ScatterMemoryAllocate
  *
- * Description:  Retrieves the common buffer properties for a given device
+ * Description:  Allocate a page-locked buffer made of multiple physically
+ *               contiguous chunks, along with an SGL describing the chunks
  *
  *****************************************************************************/
 PLX_STATUS
-PlxPci_CommonBufferProperties(
+PlxPci_ScatterMemoryAllocate(
     PLX_DEVICE_OBJECT *pDevice,
-    PLX_PHYSICAL_MEM  *pMemoryInfo
+    PLX_SCATTER_MEM   *pScatterMem
     )
 {
     PLX_PARAMS IoBuffer;
 
 
-    if (pMemoryInfo == NULL)
+    if (pScatterMem == NULL)
     {
         return PLX_STATUS_NULL_PARAM;
     }
@@ -3964,33 +4760,251 @@ PlxPci_CommonBufferProperties(
         return PLX_STATUS_INVALID_OBJECT;
     }
 
-    // If we already have the information, just copy it
-    if (pDevice->CommonBuffer.PhysicalAddr != 0)
+    // Verify size
+    if (pScatterMem->Size == 0)
     {
-        *pMemoryInfo = pDevice->CommonBuffer;
-        return PLX_STATUS_OK;
+        return PLX_STATUS_INVALID_SIZE;
     }
 
-    // Clear properties in case not supported in driver
-    RtlZeroMemory( pMemoryInfo, sizeof(PLX_PHYSICAL_MEM) );
-
     RtlZeroMemory( &IoBuffer, sizeof(PLX_PARAMS) );
 
+    IoBuffer.Key          = pDevice->Key;
+    IoBuffer.u.ScatterMem = *pScatterMem;
+
     PlxIoMessage(
         pDevice,
-        PLX_IOCTL_COMMON_BUFFER_PROPERTIES,
+        PLX_IOCTL_SCATTER_MEM_ALLOCATE,
         &IoBuffer
         );
 
-    if (IoBuffer.ReturnCode != PLX_STATUS_OK)
-    {
-        return IoBuffer.ReturnCode;
-    }
+    // Copy buffer information
+    *pScatterMem = IoBuffer.u.ScatterMem;
 
-    // Copy buffer properties
-    *pMemoryInfo = IoBuffer.u.PciMemory;
+    return IoBuffer.ReturnCode;
+}
 
-    // Make sure virtual address is clear
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxPci_ScatterMemoryFree
+ *
+ * Description:  Free a previously allocated scatter buffer
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_ScatterMemoryFree(
+    PLX_DEVICE_OBJECT *pDevice,
+    PLX_SCATTER_MEM   *pScatterMem
+    )
+{
+    PLX_PARAMS IoBuffer;
+
+
+    if (pScatterMem == NULL)
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    // Unmap the buffer if it was previously mapped to user space
+    if (pScatterMem->UserAddr != 0)
+    {
+        PlxPci_ScatterMemoryUnmap( pDevice, pScatterMem );
+    }
+
+    RtlZeroMemory( &IoBuffer, sizeof(PLX_PARAMS) );
+
+    IoBuffer.Key          = pDevice->Key;
+    IoBuffer.u.ScatterMem = *pScatterMem;
+
+    PlxIoMessage(
+        pDevice,
+        PLX_IOCTL_SCATTER_MEM_FREE,
+        &IoBuffer
+        );
+
+    // Clear buffer information
+    RtlZeroMemory( pScatterMem, sizeof(PLX_SCATTER_MEM) );
+
+    return IoBuffer.ReturnCode;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxPci_ScatterMemoryMap
+ *
+ * Description:  Maps all chunks of a scatter buffer into one contiguous
+ *               range of user virtual space
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_ScatterMemoryMap(
+    PLX_DEVICE_OBJECT *pDevice,
+    PLX_SCATTER_MEM   *pScatterMem
+    )
+{
+    if (pScatterMem == NULL)
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
+    // Set default return value
+    pScatterMem->UserAddr = 0;
+
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    // Verify buffer object
+    if ((pScatterMem->Tag  == 0) ||
+        (pScatterMem->Size == 0))
+    {
+        return PLX_STATUS_INVALID_DATA;
+    }
+
+    // Driver maps the chunks in order when the buffer tag is the offset
+    pScatterMem->UserAddr =
+        (PLX_UINT_PTR)mmap(
+            0,
+            (size_t)pScatterMem->Size,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED,
+            pDevice->hDevice,
+            pScatterMem->Tag
+            );
+
+    if (pScatterMem->UserAddr == (PLX_UINT_PTR)MAP_FAILED)
+    {
+        pScatterMem->UserAddr = 0;
+        return PLX_STATUS_INSUFFICIENT_RES;
+    }
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxPci_ScatterMemoryUnmap
+ *
+ * Description:  Unmaps a scatter buffer from user virtual space
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_ScatterMemoryUnmap(
+    PLX_DEVICE_OBJECT *pDevice,
+    PLX_SCATTER_MEM   *pScatterMem
+    )
+{
+    int rc;
+
+
+    if (pScatterMem == NULL)
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    // Verify virtual address
+    if (pScatterMem->UserAddr == 0)
+    {
+        return PLX_STATUS_INVALID_ADDR;
+    }
+
+    // Unmap buffer from virtual space
+    rc =
+        munmap(
+            PLX_INT_TO_PTR(pScatterMem->UserAddr),
+            (size_t)pScatterMem->Size
+            );
+
+    if (rc != 0)
+    {
+        return PLX_STATUS_INVALID_ADDR;
+    }
+
+    // Clear buffer address
+    pScatterMem->UserAddr = 0;
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxPci_CommonBufferProperties
+ *
+ * Description:  Retrieves the common buffer properties for a given device
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_CommonBufferProperties(
+    PLX_DEVICE_OBJECT *pDevice,
+    PLX_PHYSICAL_MEM  *pMemoryInfo
+    )
+{
+    PLX_PARAMS IoBuffer;
+
+
+    if (pMemoryInfo == NULL)
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    // If we already have the information, just copy it
+    if (pDevice->CommonBuffer.PhysicalAddr != 0)
+    {
+        *pMemoryInfo = pDevice->CommonBuffer;
+        return PLX_STATUS_OK;
+    }
+
+    // Clear properties in case not supported in driver
+    RtlZeroMemory( pMemoryInfo, sizeof(PLX_PHYSICAL_MEM) );
+
+    RtlZeroMemory( &IoBuffer, sizeof(PLX_PARAMS) );
+
+    PlxIoMessage(
+        pDevice,
+        PLX_IOCTL_COMMON_BUFFER_PROPERTIES,
+        &IoBuffer
+        );
+
+    if (IoBuffer.ReturnCode != PLX_STATUS_OK)
+    {
+        return IoBuffer.ReturnCode;
+    }
+
+    // Copy buffer properties
+    *pMemoryInfo = IoBuffer.u.PciMemory;
+
+    // Make sure virtual address is clear
     pMemoryInfo->UserAddr = 0;
 
     // Save the data for any future calls
@@ -5016,10 +6030,630 @@ PlxPci_DmaTransferUserBuffer(
         }
     }
 
-    // Cancel event notification
-    PlxPci_NotificationCancel( pDevice, &Event );
+    // Cancel event notification
+    PlxPci_NotificationCancel( pDevice, &Event );
+
+    return status;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxPci_DmaTransferScatterMemory
+ *
+ * Description:  Transfers an entire scatter buffer using its pre-built SGL
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_DmaTransferScatterMemory(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 channel,
+    PLX_SCATTER_MEM   *pScatterMem,
+    PLX_DMA_PARAMS    *pDmaParams,
+    U64                Timeout_ms
+    )
+{
+    PLX_PARAMS        IoBuffer;
+    PLX_STATUS        status;
+    PLX_INTERRUPT     PlxIntr;
+    PLX_NOTIFY_OBJECT Event;
+
+
+    if ((pScatterMem == NULL) || (pDmaParams == NULL))
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    // Setup to wait for interrupt if requested
+    if (Timeout_ms != 0)
+    {
+        // Clear interrupt fields
+        RtlZeroMemory( &PlxIntr, sizeof(PLX_INTERRUPT) );
+
+        // Setup for DMA done interrupt
+        if (((S8)channel >= 0) && ((S8)channel < 4))
+        {
+            PlxIntr.DmaDone = (1 << channel);
+        }
+        else
+        {
+            return PLX_STATUS_INVALID_ADDR;
+        }
+
+        // Register to wait for DMA interrupt
+        PlxPci_NotificationRegisterFor(
+            pDevice,
+            &PlxIntr,
+            &Event
+            );
+    }
+
+    RtlZeroMemory( &IoBuffer, sizeof(PLX_PARAMS) );
+
+    IoBuffer.value[0]   = channel;
+    IoBuffer.value[1]   = pScatterMem->Tag;
+    IoBuffer.u.TxParams = *pDmaParams;
+
+    PlxIoMessage(
+        pDevice,
+        PLX_IOCTL_DMA_TRANSFER_SCATTER_MEM,
+        &IoBuffer
+        );
+
+    status = IoBuffer.ReturnCode;
+
+    // Don't wait for completion if requested not to
+    if (Timeout_ms == 0)
+    {
+        return status;
+    }
+
+    // Wait for completion if requested
+    if (status == PLX_STATUS_OK)
+    {
+        status =
+            PlxPci_NotificationWait(
+                pDevice,
+                &Event,
+                Timeout_ms
+                );
+
+        switch (status)
+        {
+            case PLX_STATUS_OK:
+                // DMA transfer completed
+                break;
+
+            case PLX_STATUS_TIMEOUT:
+                status = PLX_STATUS_TIMEOUT;
+                break;
+
+            case PLX_STATUS_CANCELED:
+                status = PLX_STATUS_FAILED;
+                break;
+
+            default:
+                // Added to avoid compiler warning
+                break;
+        }
+    }
+
+    // Cancel event notification
+    PlxPci_NotificationCancel( pDevice, &Event );
+
+    return status;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxPci_DmaChannelClose
+ *
+ * Description:  Close a previously opened DMA channel.
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_DmaChannelClose(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 channel
+    )
+{
+    PLX_PARAMS IoBuffer;
+
+
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    RtlZeroMemory( &IoBuffer, sizeof(PLX_PARAMS) );
+
+    IoBuffer.value[0] = channel;
+
+    PlxIoMessage(
+        pDevice,
+        PLX_IOCTL_DMA_CHANNEL_CLOSE,
+        &IoBuffer
+        );
+
+    // Discard any striped transfer state of the channel
+    if (IoBuffer.ReturnCode == PLX_STATUS_OK)
+    {
+        DmaStripe_ChannelRelease( pDevice, channel );
+    }
+
+    return IoBuffer.ReturnCode;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxPci_DmaTransferBlockStriped
+ *
+ * Description:  Performs a Block DMA transfer split across multiple channels.
+ *               Stripe sizes follow the throughput measured on each channel.
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_DmaTransferBlockStriped(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 ChannelMask,
+    PLX_DMA_PARAMS    *pDmaParams,
+    U64                Timeout_ms
+    )
+{
+    if (pDmaParams == NULL)
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    return DmaStripe_Transfer(
+        pDevice,
+        ChannelMask,
+        pDmaParams,
+        FALSE,
+        Timeout_ms
+        );
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxPci_DmaTransferUserBufferStriped
+ *
+ * Description:  Transfers a user-mode buffer using DMA split across multiple
+ *               channels
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_DmaTransferUserBufferStriped(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 ChannelMask,
+    PLX_DMA_PARAMS    *pDmaParams,
+    U64                Timeout_ms
+    )
+{
+    if (pDmaParams == NULL)
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    return DmaStripe_Transfer(
+        pDevice,
+        ChannelMask,
+        pDmaParams,
+        TRUE,
+        Timeout_ms
+        );
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxPci_DmaStatusStriped
+ *
+ * Description:  Returns whether all stripes of a striped transfer are done
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_DmaStatusStriped(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 ChannelMask
+    )
+{
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    return DmaStripe_Status(
+        pDevice,
+        ChannelMask
+        );
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxPci_UserDmaChannelOpen
+ *
+ * Description:  Opens a DMA channel for transfers driven from user space.
+ *               The channel is reserved in the driver, then its descriptor
+ *               ring & registers are accessed through user mappings.
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_UserDmaChannelOpen(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 channel,
+    PLX_DMA_PROP      *pDmaProp
+    )
+{
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    return UDma_ChannelOpen(
+        pDevice,
+        channel,
+        pDmaProp
+        );
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxPci_UserDmaStatus
+ *
+ * Description:  Returns whether all queued user-space DMA transfers are done
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_UserDmaStatus(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 channel
+    )
+{
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    return UDma_Status(
+        pDevice,
+        channel
+        );
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxPci_UserDmaTransferBlock
+ *
+ * Description:  Queues a block transfer on a user-space DMA channel. If a
+ *               timeout is provided, completion is polled without waiting
+ *               on an interrupt.
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_UserDmaTransferBlock(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 channel,
+    PLX_DMA_PARAMS    *pDmaParams,
+    U64                Timeout_ms
+    )
+{
+    if (pDmaParams == NULL)
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    return UDma_TransferBlock(
+        pDevice,
+        channel,
+        pDmaParams,
+        Timeout_ms
+        );
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxPci_UserDmaChannelClose
+ *
+ * Description:  Closes a user-space DMA channel & releases it to the driver
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_UserDmaChannelClose(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 channel
+    )
+{
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    return UDma_ChannelClose(
+        pDevice,
+        channel
+        );
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxPci_NtMsgRingOpen
+ *
+ * Description:  Opens a message ring to the host on the other side of an
+ *               NT port, using a local buffer & a translated NT BAR
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_NtMsgRingOpen(
+    PLX_DEVICE_OBJECT    *pDevice,
+    PLX_NT_MSG_RING_PROP *pRingProp
+    )
+{
+    if (pRingProp == NULL)
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    // Verify optional DMA device object
+    if ((pRingProp->pDmaDevice != NULL) && !IsObjectValid(pRingProp->pDmaDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    return NtRing_Open(
+        pDevice,
+        pRingProp
+        );
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxPci_NtMsgRingSend
+ *
+ * Description:  Sends a message to the remote host, waiting for a free slot
+ *               up to the timeout
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_NtMsgRingSend(
+    PLX_DEVICE_OBJECT *pDevice,
+    VOID              *pMsg,
+    U32                ByteCount,
+    U64                Timeout_ms
+    )
+{
+    if ((pMsg == NULL) && (ByteCount != 0))
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    return NtRing_Send(
+        pDevice,
+        pMsg,
+        ByteCount,
+        Timeout_ms
+        );
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxPci_NtMsgRingReceive
+ *
+ * Description:  Receives the next message from the remote host. On entry
+ *               the byte count holds the buffer size & on exit the size of
+ *               the message.
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_NtMsgRingReceive(
+    PLX_DEVICE_OBJECT *pDevice,
+    VOID              *pMsg,
+    U32               *pByteCount,
+    U64                Timeout_ms
+    )
+{
+    if ((pMsg == NULL) || (pByteCount == NULL))
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    return NtRing_Receive(
+        pDevice,
+        pMsg,
+        pByteCount,
+        Timeout_ms
+        );
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxPci_NtMsgRingClose
+ *
+ * Description:  Closes the message ring open on an NT port
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_NtMsgRingClose(
+    PLX_DEVICE_OBJECT *pDevice
+    )
+{
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    return NtRing_Close(
+        pDevice
+        );
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxPci_NtDmaConnect
+ *
+ * Description:  Connects to the host on the other side of an NT port for DMA,
+ *               exchanging buffer properties & preparing NT windows & LUT
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_NtDmaConnect(
+    PLX_DEVICE_OBJECT *pNtDevice,
+    PLX_DEVICE_OBJECT *pDmaDevice,
+    U8                 DmaChannel,
+    PLX_PHYSICAL_MEM  *pLocalBuffer,
+    U64                Timeout_ms,
+    PLX_NT_DMA_TARGET *pTarget
+    )
+{
+    if ((pLocalBuffer == NULL) || (pTarget == NULL))
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
+    // Verify device objects
+    if (!IsObjectValid(pNtDevice) || !IsObjectValid(pDmaDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    return NtDma_Connect(
+        pNtDevice,
+        pDmaDevice,
+        DmaChannel,
+        pLocalBuffer,
+        Timeout_ms,
+        pTarget
+        );
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  PlxPci_NtDmaTransfer
+ *
+ * Description:  Transfers data between a local bus address & an offset in
+ *               the peer buffer of an NT DMA connection
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_NtDmaTransfer(
+    PLX_NT_DMA_TARGET *pTarget,
+    U64                LocalAddr,
+    U64                RemoteOffset,
+    U32                ByteCount,
+    BOOLEAN            bRead,
+    U64                Timeout_ms
+    )
+{
+    if (pTarget == NULL)
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
+    // Verify connection
+    if (!IsObjectValid(pTarget->pNtDevice) || !IsObjectValid(pTarget->pDmaDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
 
-    return status;
+    return NtDma_Transfer(
+        pTarget,
+        LocalAddr,
+        RemoteOffset,
+        ByteCount,
+        bRead,
+        Timeout_ms
+        );
 }
 
 
@@ -5027,37 +6661,30 @@ PlxPci_DmaTransferUserBuffer(
 
 /******************************************************************************
  *
- * Function   :  PlxPci_DmaChannelClose
+ * Function   :  PlxPci_NtDmaDisconnect
  *
- * Description:  Close a previously opened DMA channel.
+ * Description:  Closes an NT DMA connection
  *
  *****************************************************************************/
 PLX_STATUS
-PlxPci_DmaChannelClose(
-    PLX_DEVICE_OBJECT *pDevice,
-    U8                 channel
+PlxPci_NtDmaDisconnect(
+    PLX_NT_DMA_TARGET *pTarget
     )
 {
-    PLX_PARAMS IoBuffer;
-
+    if (pTarget == NULL)
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
 
-    // Verify device object
-    if (!IsObjectValid(pDevice))
+    // Verify connection
+    if (!IsObjectValid(pTarget->pNtDevice))
     {
         return PLX_STATUS_INVALID_OBJECT;
     }
 
-    RtlZeroMemory( &IoBuffer, sizeof(PLX_PARAMS) );
-
-    IoBuffer.value[0] = channel;
-
-    PlxIoMessage(
-        pDevice,
-        PLX_IOCTL_DMA_CHANNEL_CLOSE,
-        &IoBuffer
+    return NtDma_Disconnect(
+        pTarget
         );
-
-    return IoBuffer.ReturnCode;
 }
 
 
@@ -5296,296 +6923,193 @@ PlxPci_PerformanceCalcStatistics(
     U32             ElapsedTime_ms
     )
 {
-    S64 TotalBytes;
-    S64 MaxLinkRate;
-    S64 PayloadAvg;
-    S64 Counter_PostedHeader;
-    S64 Counter_PostedDW;
-    S64 Counter_NonpostedDW;
-    S64 Counter_CplHeader;
-    S64 Counter_CplDW;
-    S64 Counter_Dllp;
+    PLX_STATUS           status;
+    PLX_PERF_STATS_BATCH StatsBatch;
 
 
+    RtlZeroMemory( pPerfStats, sizeof(PLX_PERF_STATS) );
+
     // Verify elapsed time and link is up
     if ( (ElapsedTime_ms == 0) || (pPerfProp->LinkWidth == 0) )
     {
-        RtlZeroMemory( pPerfStats, sizeof(PLX_PERF_STATS) );
         return PLX_STATUS_INVALID_DATA;
     }
 
-    // Determine theoretical max link rate for 1 second (Gen1 bps * link_width * 2^(link_speed - 1) )
-    MaxLinkRate = PERF_MAX_BPS_GEN_1_0 * pPerfProp->LinkWidth * (S64)pow( 2, (pPerfProp->LinkSpeed - 1) );
-
-    // Adjust rate for specified elapsed period (ms)
-    MaxLinkRate = (MaxLinkRate * ElapsedTime_ms) / 1000;
-
-    //
-    // Calculate Ingress actual counters, adjusting for counter wrapping
-    //
-    Counter_PostedHeader = pPerfProp->IngressPostedHeader;
-    Counter_PostedDW     = pPerfProp->IngressPostedDW;
-    Counter_NonpostedDW  = pPerfProp->IngressNonpostedDW;
-    Counter_CplHeader    = pPerfProp->IngressCplHeader;
-    Counter_CplDW        = pPerfProp->IngressCplDW;
-    Counter_Dllp         = pPerfProp->IngressDllp;
-
-    // Add 4GB in case counter wrapped
-    if (Counter_PostedHeader < pPerfProp->Prev_IngressPostedHeader)
-    {
-        Counter_PostedHeader += ((S64)1 << 32);
-    }
-
-    if (Counter_PostedDW < pPerfProp->Prev_IngressPostedDW)
+    // Calculate statistics as a batch of one
+    status =
+        PlxPci_PerformanceCalcStatisticsBatch(
+            pPerfProp,
+            1,
+            &StatsBatch,
+            ElapsedTime_ms
+            );
+    if (status != PLX_STATUS_OK)
     {
-        Counter_PostedDW += ((S64)1 << 32);
+        return status;
     }
 
-    if (Counter_NonpostedDW < pPerfProp->Prev_IngressNonpostedDW)
-    {
-        Counter_NonpostedDW += ((S64)1 << 32);
-    }
+    // Convert ingress statistics
+    pPerfStats->IngressTotalBytes        = StatsBatch.Ingress.TotalBytes[0];
+    pPerfStats->IngressTotalByteRate     = (long double)StatsBatch.Ingress.TotalByteRate[0];
+    pPerfStats->IngressPayloadReadBytes  = StatsBatch.Ingress.PayloadReadBytes[0];
+    pPerfStats->IngressPayloadWriteBytes = StatsBatch.Ingress.PayloadWriteBytes[0];
+    pPerfStats->IngressPayloadTotalBytes = StatsBatch.Ingress.PayloadTotalBytes[0];
+    pPerfStats->IngressPayloadByteRate   = (long double)StatsBatch.Ingress.PayloadByteRate[0];
+    pPerfStats->IngressPayloadAvgPerTlp  =
+        (double)StatsBatch.Ingress.PayloadAvgPerTlp_FP[0] / PLX_PERF_FP_SCALE;
+    pPerfStats->IngressLinkUtilization   =
+        (long double)StatsBatch.Ingress.LinkUtilization_FP[0] / PLX_PERF_FP_SCALE;
+
+    // Convert egress statistics
+    pPerfStats->EgressTotalBytes         = StatsBatch.Egress.TotalBytes[0];
+    pPerfStats->EgressTotalByteRate      = (long double)StatsBatch.Egress.TotalByteRate[0];
+    pPerfStats->EgressPayloadReadBytes   = StatsBatch.Egress.PayloadReadBytes[0];
+    pPerfStats->EgressPayloadWriteBytes  = StatsBatch.Egress.PayloadWriteBytes[0];
+    pPerfStats->EgressPayloadTotalBytes  = StatsBatch.Egress.PayloadTotalBytes[0];
+    pPerfStats->EgressPayloadByteRate    = (long double)StatsBatch.Egress.PayloadByteRate[0];
+    pPerfStats->EgressPayloadAvgPerTlp   =
+        (double)StatsBatch.Egress.PayloadAvgPerTlp_FP[0] / PLX_PERF_FP_SCALE;
+    pPerfStats->EgressLinkUtilization    =
+        (long double)StatsBatch.Egress.LinkUtilization_FP[0] / PLX_PERF_FP_SCALE;
 
-    if (Counter_CplHeader < pPerfProp->Prev_IngressCplHeader)
-    {
-        Counter_CplHeader += ((S64)1 << 32);
-    }
+    return PLX_STATUS_OK;
+}
 
-    if (Counter_CplDW < pPerfProp->Prev_IngressCplDW)
-    {
-        Counter_CplDW += ((S64)1 << 32);
-    }
 
-    if (Counter_Dllp < pPerfProp->Prev_IngressDllp)
-    {
-        Counter_Dllp += ((S64)1 << 32);
-    }
 
-    // Determine counter differences
-    Counter_PostedHeader = Counter_PostedHeader - pPerfProp->Prev_IngressPostedHeader;
-    Counter_PostedDW     = Counter_PostedDW     - pPerfProp->Prev_IngressPostedDW;
-    Counter_NonpostedDW  = Counter_NonpostedDW  - pPerfProp->Prev_IngressNonpostedDW;
-    Counter_CplHeader    = Counter_CplHeader    - pPerfProp->Prev_IngressCplHeader;
-    Counter_CplDW        = Counter_CplDW        - pPerfProp->Prev_IngressCplDW;
-    Counter_Dllp         = Counter_Dllp         - pPerfProp->Prev_IngressDllp;
 
+/******************************************************************************
+ *
+ * Function   :  PlxPci_PerformanceCalcStatisticsBatch
+ *
+ * Description:  Calculate performance statistics for multiple ports at once
+ *
+ * Notes      :  Results are stored as integer or fixed-point values in
+ *               per-statistic arrays, indexed in the same order as the
+ *               performance properties.
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_PerformanceCalcStatisticsBatch(
+    PLX_PERF_PROP        *pPerfProps,
+    U8                    NumOfObjects,
+    PLX_PERF_STATS_BATCH *pPerfStats,
+    U32                   ElapsedTime_ms
+    )
+{
+    U8             i;
+    U8             LinkSpeed;
+    S64            MaxLinkRate[PERF_MAX_PORTS];
+    S64            PostedHeader[PERF_MAX_PORTS];
+    S64            PostedDW[PERF_MAX_PORTS];
+    S64            NonpostedDW[PERF_MAX_PORTS];
+    S64            CplHeader[PERF_MAX_PORTS];
+    S64            CplDW[PERF_MAX_PORTS];
+    S64            Dllp[PERF_MAX_PORTS];
+    PLX_PERF_PROP *pProp;
 
-    //
-    // Calculate Ingress statistics
-    //
 
-    /*************************************************************************
-     * Periodically, the chip counters report less TLP Posted DW than expected
-     * in comparison to the total number of TLP Posted Headers.  We need an
-     * error check for this, otherwise the Posted Payload becomes incorrect.
-     * The fix involves changing the posted header count based on the number of
-     * posted DW, assuming a 4 byte Payload.
-     ************************************************************************/
-    if ((Counter_PostedHeader * PERF_TLP_DW) > Counter_PostedDW)
+    if ((pPerfProps == NULL) || (pPerfStats == NULL))
     {
-        Counter_PostedHeader = Counter_PostedDW / (PERF_TLP_DW + 1);
+        return PLX_STATUS_NULL_PARAM;
     }
 
-    // Posted Payload bytes ((P_DW * size(DW) - (P_TLP * size(P_TLP))
-    pPerfStats->IngressPayloadWriteBytes =
-        (Counter_PostedDW * sizeof(U32)) -
-        (Counter_PostedHeader * PERF_TLP_SIZE);
-
-    // Completion Payload ((CPL_DW * size(DW) - (CPL_TLP * size(TLP))
-    pPerfStats->IngressPayloadReadBytes =
-        (Counter_CplDW * sizeof(U32)) -
-        (Counter_CplHeader * PERF_TLP_SIZE);
-
-    // Total payload
-    pPerfStats->IngressPayloadTotalBytes =
-        pPerfStats->IngressPayloadWriteBytes + pPerfStats->IngressPayloadReadBytes;
-
-    // Average payload size (Payload / (P_TLP + CPL_TLP))
-    PayloadAvg = Counter_PostedHeader + Counter_CplHeader;
-
-    if (PayloadAvg != 0)
-    {
-        pPerfStats->IngressPayloadAvgPerTlp =
-            (long double)pPerfStats->IngressPayloadTotalBytes / PayloadAvg;
-    }
-    else
+    if ((NumOfObjects == 0) || (NumOfObjects > PERF_MAX_PORTS))
     {
-        pPerfStats->IngressPayloadAvgPerTlp = 0;
+        return PLX_STATUS_INVALID_SIZE;
     }
 
-    // Total number of TLP data ((P_DW + NP_DW + CPL_DW) * size(DW))
-    TotalBytes = (Counter_PostedDW    +
-                  Counter_NonpostedDW +
-                  Counter_CplDW) * sizeof(U32);
-
-    // Add DLLPs to total bytes
-    TotalBytes += (Counter_Dllp * PERF_DLLP_SIZE);
-
-    // Total bytes
-    pPerfStats->IngressTotalBytes = TotalBytes;
+    pPerfStats->NumPorts = NumOfObjects;
 
-    // Total byte rate
-    pPerfStats->IngressTotalByteRate =
-        (long double)((TotalBytes * 1000) / ElapsedTime_ms);
-
-    // Payload rate
-    pPerfStats->IngressPayloadByteRate =
-        ((long double)pPerfStats->IngressPayloadTotalBytes * 1000) / ElapsedTime_ms;
-
-    // Link Utilization
-    if (MaxLinkRate == 0)
-    {
-        pPerfStats->IngressLinkUtilization = 0;
-    }
-    else
+    // Verify elapsed time
+    if (ElapsedTime_ms == 0)
     {
-        pPerfStats->IngressLinkUtilization =
-            ((long double)TotalBytes * 100) / MaxLinkRate;
-
-        // Account for error margin
-        if (pPerfStats->IngressLinkUtilization > (double)100)
-        {
-            pPerfStats->IngressLinkUtilization = 100;
-        }
+        RtlZeroMemory( pPerfStats->bValid, sizeof(pPerfStats->bValid) );
+        return PLX_STATUS_INVALID_DATA;
     }
 
     //
-    // Calculate Egress actual counters, adjusting for counter wrapping
+    // Determine max link rates & Ingress counter differences
     //
-    Counter_PostedHeader = pPerfProp->EgressPostedHeader;
-    Counter_PostedDW     = pPerfProp->EgressPostedDW;
-    Counter_NonpostedDW  = pPerfProp->EgressNonpostedDW;
-    Counter_CplHeader    = pPerfProp->EgressCplHeader;
-    Counter_CplDW        = pPerfProp->EgressCplDW;
-    Counter_Dllp         = pPerfProp->EgressDllp;
-
-    // Add 4GB in case counter wrapped
-    if (Counter_PostedHeader < pPerfProp->Prev_EgressPostedHeader)
-    {
-        Counter_PostedHeader += ((S64)1 << 32);
-    }
-
-    if (Counter_PostedDW < pPerfProp->Prev_EgressPostedDW)
-    {
-        Counter_PostedDW += ((S64)1 << 32);
-    }
-
-    if (Counter_NonpostedDW < pPerfProp->Prev_EgressNonpostedDW)
-    {
-        Counter_NonpostedDW += ((S64)1 << 32);
-    }
-
-    if (Counter_CplHeader < pPerfProp->Prev_EgressCplHeader)
-    {
-        Counter_CplHeader += ((S64)1 << 32);
-    }
-
-    if (Counter_CplDW < pPerfProp->Prev_EgressCplDW)
-    {
-        Counter_CplDW += ((S64)1 << 32);
-    }
-
-    if (Counter_Dllp < pPerfProp->Prev_EgressDllp)
+    for (i = 0; i < NumOfObjects; i++)
     {
-        Counter_Dllp += ((S64)1 << 32);
-    }
+        pProp = &pPerfProps[i];
 
-    // Determine counter differences
-    Counter_PostedHeader = Counter_PostedHeader - pPerfProp->Prev_EgressPostedHeader;
-    Counter_PostedDW     = Counter_PostedDW     - pPerfProp->Prev_EgressPostedDW;
-    Counter_NonpostedDW  = Counter_NonpostedDW  - pPerfProp->Prev_EgressNonpostedDW;
-    Counter_CplHeader    = Counter_CplHeader    - pPerfProp->Prev_EgressCplHeader;
-    Counter_CplDW        = Counter_CplDW        - pPerfProp->Prev_EgressCplDW;
-    Counter_Dllp         = Counter_Dllp         - pPerfProp->Prev_EgressDllp;
+        pPerfStats->bValid[i] = (pProp->LinkWidth != 0);
 
-    /*************************************************************************
-     * Capella-2 does not count the 2DW overhead for egress DW. The DW counts
-     * are adjusted by adding 2DW per TLP to account for the overhead.
-     ************************************************************************/
-    if (pPerfProp->PlxFamily == PLX_FAMILY_CAPELLA_2)
-    {
-        Counter_PostedDW += (Counter_PostedHeader * PERF_TLP_OH_DW);
-        Counter_CplDW    += (Counter_CplHeader * PERF_TLP_OH_DW);
+        // Theoretical max link rate adjusted for elapsed period (ms)
+        LinkSpeed = pProp->LinkSpeed;
+        if (LinkSpeed >= PLX_PERF_LINK_RATE_ENTRIES)
+        {
+            LinkSpeed = 0;
+        }
 
-        // No TLP count is provided for non-posted, unable to adjust
-        Counter_NonpostedDW += 0;
-    }
+        MaxLinkRate[i] =
+            ((S64)Gbl_PerfMaxLinkRate[LinkSpeed] * pProp->LinkWidth * ElapsedTime_ms) / 1000;
+
+        // Unsigned 32-bit difference accounts for a counter wrap
+        PostedHeader[i] = (U32)(pProp->IngressPostedHeader - pProp->Prev_IngressPostedHeader);
+        PostedDW[i]     = (U32)(pProp->IngressPostedDW     - pProp->Prev_IngressPostedDW);
+        NonpostedDW[i]  = (U32)(pProp->IngressNonpostedDW  - pProp->Prev_IngressNonpostedDW);
+        CplHeader[i]    = (U32)(pProp->IngressCplHeader    - pProp->Prev_IngressCplHeader);
+        CplDW[i]        = (U32)(pProp->IngressCplDW        - pProp->Prev_IngressCplDW);
+        Dllp[i]         = (U32)(pProp->IngressDllp         - pProp->Prev_IngressDllp);
+    }
+
+    PlxPerf_CalcDirStats(
+        NumOfObjects,
+        pPerfStats->bValid,
+        MaxLinkRate,
+        PostedHeader,
+        PostedDW,
+        NonpostedDW,
+        CplHeader,
+        CplDW,
+        Dllp,
+        ElapsedTime_ms,
+        &pPerfStats->Ingress
+        );
 
     //
-    // Calculate Egress statistics
+    // Determine Egress counter differences
     //
-
-    /*************************************************************************
-     * Refer to comment above for handling Ingress posted header count issue.
-     ************************************************************************/
-    if ((Counter_PostedHeader * PERF_TLP_DW) > Counter_PostedDW)
-    {
-        Counter_PostedHeader = Counter_PostedDW / (PERF_TLP_DW + 1);
-    }
-
-    // Posted Payload bytes ((P_DW * size(DW) - (P_TLP * size(P_TLP))
-    pPerfStats->EgressPayloadWriteBytes =
-        (Counter_PostedDW * sizeof(U32)) -
-        (Counter_PostedHeader * PERF_TLP_SIZE);
-
-    // Completion Payload ((CPL_DW * size(DW) - (CPL_TLP * size(CPL_TLP))
-    pPerfStats->EgressPayloadReadBytes =
-        (Counter_CplDW * sizeof(U32)) -
-        (Counter_CplHeader * PERF_TLP_SIZE);
-
-    // Total payload
-    pPerfStats->EgressPayloadTotalBytes =
-        pPerfStats->EgressPayloadWriteBytes + pPerfStats->EgressPayloadReadBytes;
-
-    // Average payload size (Payload / (P_TLP + CPL_TLP))
-    PayloadAvg = Counter_PostedHeader + Counter_CplHeader;
-
-    if (PayloadAvg != 0)
-    {
-        pPerfStats->EgressPayloadAvgPerTlp =
-            (long double)pPerfStats->EgressPayloadTotalBytes / PayloadAvg;
-    }
-    else
-    {
-        pPerfStats->EgressPayloadAvgPerTlp = 0;
-    }
-
-    // Total number of TLP data ((P_DW + NP_DW + CPL_DW) * size(DW))
-    TotalBytes = (Counter_PostedDW    +
-                  Counter_NonpostedDW +
-                  Counter_CplDW) * sizeof(U32);
-
-    // Add DLLPs to total bytes
-    TotalBytes += (Counter_Dllp * PERF_DLLP_SIZE);
-
-    // Total bytes
-    pPerfStats->EgressTotalBytes = TotalBytes;
-
-    // Total byte rate
-    pPerfStats->EgressTotalByteRate =
-        ((long double)TotalBytes * 1000) / ElapsedTime_ms;
-
-    // Payload rate
-    pPerfStats->EgressPayloadByteRate =
-        ((long double)pPerfStats->EgressPayloadTotalBytes * 1000) / ElapsedTime_ms;
-
-    // Link Utilization
-    if (MaxLinkRate == 0)
-    {
-        pPerfStats->EgressLinkUtilization = 0;
-    }
-    else
+    for (i = 0; i < NumOfObjects; i++)
     {
-        pPerfStats->EgressLinkUtilization =
-            ((long double)TotalBytes * 100) / MaxLinkRate;
-
-        // Account for error margin
-        if (pPerfStats->EgressLinkUtilization > (double)100)
+        pProp = &pPerfProps[i];
+
+        PostedHeader[i] = (U32)(pProp->EgressPostedHeader - pProp->Prev_EgressPostedHeader);
+        PostedDW[i]     = (U32)(pProp->EgressPostedDW     - pProp->Prev_EgressPostedDW);
+        NonpostedDW[i]  = (U32)(pProp->EgressNonpostedDW  - pProp->Prev_EgressNonpostedDW);
+        CplHeader[i]    = (U32)(pProp->EgressCplHeader    - pProp->Prev_EgressCplHeader);
+        CplDW[i]        = (U32)(pProp->EgressCplDW        - pProp->Prev_EgressCplDW);
+        Dllp[i]         = (U32)(pProp->EgressDllp         - pProp->Prev_EgressDllp);
+
+        /*********************************************************************
+         * Capella-2 does not count the 2DW overhead for egress DW. The DW
+         * counts are adjusted by adding 2DW per TLP to account for the
+         * overhead. No TLP count is provided for non-posted, unable to adjust.
+         ********************************************************************/
+        if (pProp->PlxFamily == PLX_FAMILY_CAPELLA_2)
         {
-            pPerfStats->EgressLinkUtilization = 100;
+            PostedDW[i] += (PostedHeader[i] * PERF_TLP_OH_DW);
+            CplDW[i]    += (CplHeader[i] * PERF_TLP_OH_DW);
         }
     }
 
+    PlxPerf_CalcDirStats(
+        NumOfObjects,
+        pPerfStats->bValid,
+        MaxLinkRate,
+        PostedHeader,
+        PostedDW,
+        NonpostedDW,
+        CplHeader,
+        CplDW,
+        Dllp,
+        ElapsedTime_ms,
+        &pPerfStats->Egress
+        );
+
     return PLX_STATUS_OK;
 }
 
@@ -5746,6 +7270,49 @@ PlxPci_Nt_ReqIdProbe(
 
 
 
+/******************************************************************************
+ *
+ * Function   :  PlxPci_Nt_ReqIdCacheInvalidate
+ *
+ * Description:  Discards the ReqIDs cached by the driver, so the next call to
+ *               PlxPci_Nt_ReqIdProbe() probes the hardware again
+ *
+ *****************************************************************************/
+PLX_STATUS
+PlxPci_Nt_ReqIdCacheInvalidate(
+    PLX_DEVICE_OBJECT *pDevice
+    )
+{
+    PLX_PARAMS IoBuffer;
+
+
+    if (pDevice == NULL)
+    {
+        return PLX_STATUS_NULL_PARAM;
+    }
+
+    // Verify device object
+    if (!IsObjectValid(pDevice))
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    RtlZeroMemory( &IoBuffer, sizeof(PLX_PARAMS) );
+
+    IoBuffer.Key = pDevice->Key;
+
+    PlxIoMessage(
+        pDevice,
+        PLX_IOCTL_NT_REQ_ID_CACHE_INVALIDATE,
+        &IoBuffer
+        );
+
+    return IoBuffer.ReturnCode;
+}
+
+
+
+
 /******************************************************************************
  *
  * Function   :  PlxPci_Nt_LutProperties
@@ -6181,6 +7748,16 @@ PlxIoMessage(
                 sizeof(PLX_PARAMS)      // Size of buffer
                 );
     }
+    else if (pDevice->Key.ApiMode == PLX_API_MODE_SIMULATED)
+    {
+        status =
+            Sim_Dispatch_IoControl(
+                pDevice,                // Device
+                IoControlCode,          // Control code
+                pBuffer,                // Pointer to buffer
+                sizeof(PLX_PARAMS)      // Size of buffer
+                );
+    }
     else
     {
         return -1;
@@ -6191,6 +7768,129 @@ PlxIoMessage(
 
 
 
+/******************************************************************************
+ *
+ * Function   :  PlxPerf_CalcDirStats
+ *
+ * Description:  Calculates statistics for one direction of multiple ports
+ *               from counter differences. Counter arrays are modified.
+ *
+ * Notes      :  Each pass is a simple loop over contiguous arrays so the
+ *               compiler is able to vectorize the non-divide operations.
+ *
+ *****************************************************************************/
+static VOID
+PlxPerf_CalcDirStats(
+    U8                  NumPorts,
+    const U8           *bValid,
+    S64                *pMaxLinkRate,
+    S64                *pPostedHeader,
+    S64                *pPostedDW,
+    S64                *pNonpostedDW,
+    S64                *pCplHeader,
+    S64                *pCplDW,
+    S64                *pDllp,
+    U32                 ElapsedTime_ms,
+    PLX_PERF_STATS_DIR *pStats
+    )
+{
+    U8  i;
+    S64 TlpCount;
+
+
+    // Ignore counters of ports with link down
+    for (i = 0; i < NumPorts; i++)
+    {
+        if (bValid[i] == FALSE)
+        {
+            pPostedHeader[i] = 0;
+            pPostedDW[i]     = 0;
+            pNonpostedDW[i]  = 0;
+            pCplHeader[i]    = 0;
+            pCplDW[i]        = 0;
+            pDllp[i]         = 0;
+        }
+    }
+
+    /*************************************************************************
+     * Periodically, the chip counters report less TLP Posted DW than expected
+     * in comparison to the total number of TLP Posted Headers.  We need an
+     * error check for this, otherwise the Posted Payload becomes incorrect.
+     * The fix involves changing the posted header count based on the number of
+     * posted DW, assuming a 4 byte Payload.
+     ************************************************************************/
+    for (i = 0; i < NumPorts; i++)
+    {
+        if ((pPostedHeader[i] * PERF_TLP_DW) > pPostedDW[i])
+        {
+            pPostedHeader[i] = pPostedDW[i] / (PERF_TLP_DW + 1);
+        }
+    }
+
+    // Byte counts
+    for (i = 0; i < NumPorts; i++)
+    {
+        // Posted Payload bytes ((P_DW * size(DW) - (P_TLP * size(P_TLP))
+        pStats->PayloadWriteBytes[i] =
+            (pPostedDW[i] * sizeof(U32)) - (pPostedHeader[i] * PERF_TLP_SIZE);
+
+        // Completion Payload ((CPL_DW * size(DW) - (CPL_TLP * size(TLP))
+        pStats->PayloadReadBytes[i] =
+            (pCplDW[i] * sizeof(U32)) - (pCplHeader[i] * PERF_TLP_SIZE);
+
+        // Total payload
+        pStats->PayloadTotalBytes[i] =
+            pStats->PayloadWriteBytes[i] + pStats->PayloadReadBytes[i];
+
+        // Total TLP data ((P_DW + NP_DW + CPL_DW) * size(DW)) plus DLLPs
+        pStats->TotalBytes[i] =
+            ((pPostedDW[i] + pNonpostedDW[i] + pCplDW[i]) * sizeof(U32)) +
+            (pDllp[i] * PERF_DLLP_SIZE);
+    }
+
+    // Rates, averages & utilization
+    for (i = 0; i < NumPorts; i++)
+    {
+        pStats->TotalByteRate[i] =
+            (pStats->TotalBytes[i] * 1000) / ElapsedTime_ms;
+
+        pStats->PayloadByteRate[i] =
+            (pStats->PayloadTotalBytes[i] * 1000) / ElapsedTime_ms;
+
+        // Average payload size (Payload / (P_TLP + CPL_TLP))
+        TlpCount = pPostedHeader[i] + pCplHeader[i];
+
+        if (TlpCount != 0)
+        {
+            pStats->PayloadAvgPerTlp_FP[i] =
+                (pStats->PayloadTotalBytes[i] * PLX_PERF_FP_SCALE) / TlpCount;
+        }
+        else
+        {
+            pStats->PayloadAvgPerTlp_FP[i] = 0;
+        }
+
+        // Link utilization
+        if (pMaxLinkRate[i] != 0)
+        {
+            pStats->LinkUtilization_FP[i] =
+                (pStats->TotalBytes[i] * 100 * PLX_PERF_FP_SCALE) / pMaxLinkRate[i];
+
+            // Account for error margin
+            if (pStats->LinkUtilization_FP[i] > (100 * PLX_PERF_FP_SCALE))
+            {
+                pStats->LinkUtilization_FP[i] = 100 * PLX_PERF_FP_SCALE;
+            }
+        }
+        else
+        {
+            pStats->LinkUtilization_FP[i] = 0;
+        }
+    }
+}
+
+
+
 
 /******************************************************************************
  *
@@ -62,6 +62,56 @@
 
 
 
+/**********************************************
+ *           Global Variables
+ *********************************************/
+// Register cache for slow out-of-band links (disabled by default)
+static BOOLEAN             Gbl_bRegCacheEnable   = FALSE;
+static U16                 Gbl_RegCacheNext      = 0;
+static PLX_REG_CACHE_ENTRY Gbl_RegCache[PLX_REG_CACHE_MAX_ENTRIES];
+
+#if defined(PLX_DOS)
+    #define PLX_REG_CACHE_LOCK()
+    #define PLX_REG_CACHE_UNLOCK()
+#else
+    #if defined(PLX_LINUX)
+        // Statically initialized so threads can't race its creation
+        static CRITICAL_SECTION Gbl_RegCacheLock = PTHREAD_MUTEX_INITIALIZER;
+    #else
+        // Initialized once at library load (see PlxDir_RegCacheInit)
+        static CRITICAL_SECTION Gbl_RegCacheLock;
+    #endif
+
+    #define PLX_REG_CACHE_LOCK()        EnterCriticalSection( &Gbl_RegCacheLock )
+    #define PLX_REG_CACHE_UNLOCK()      LeaveCriticalSection( &Gbl_RegCacheLock )
+#endif
+
+// Read-only registers which never change once a chip is probed
+static const PLX_REG_CACHE_RULE Gbl_RegCacheRules[] =
+{
+    { PLX_FAMILY_NONE     , PCI_REG_DEV_VEN_ID   },
+    { PLX_FAMILY_NONE     , PCI_REG_CLASS_REV    },
+    { PLX_FAMILY_NONE     , PCI_REG_CAP_PTR      },
+    { PLX_FAMILY_SCOUT    , 0x68 },     // PCIe capability header
+    { PLX_FAMILY_SCOUT    , 0x6C },     // PCIe device capabilities
+    { PLX_FAMILY_SCOUT    , 0x74 },     // PCIe link capabilities
+    { PLX_FAMILY_DRACO_1  , 0x68 },
+    { PLX_FAMILY_DRACO_1  , 0x6C },
+    { PLX_FAMILY_DRACO_1  , 0x74 },
+    { PLX_FAMILY_DRACO_2  , 0x68 },
+    { PLX_FAMILY_DRACO_2  , 0x6C },
+    { PLX_FAMILY_DRACO_2  , 0x74 },
+    { PLX_FAMILY_CAPELLA_1, 0x68 },
+    { PLX_FAMILY_CAPELLA_1, 0x6C },
+    { PLX_FAMILY_CAPELLA_1, 0x74 },
+    { PLX_FAMILY_CAPELLA_2, 0x68 },
+    { PLX_FAMILY_CAPELLA_2, 0x6C },
+    { PLX_FAMILY_CAPELLA_2, 0x74 }
+};
+
+
+
+
 /*******************************************************************************
  *
  * Function   : PlxDir_ChipTypeGet
@@ -2430,7 +2480,8 @@ PlxDir_ProbeSwitch(
     PLX_DEVICE_OBJECT *pDevice,
     PLX_DEVICE_KEY    *pKey,
     U16                DeviceNumber,
-    U16               *pNumMatched
+    U16               *pNumMatched,
+    PLX_PROBE_LIST    *pList
     )
 {
     U8             port_Upstream;
@@ -2959,9 +3010,18 @@ PlxDir_ProbeSwitch(
         // Check if match on location and ID
         if (bMatchLoc && bMatchId)
         {
-            // Match found, check if it is the desired device
-            if (devCount == DeviceNumber)
+            // Store all matches if building a device list
+            if (pList != NULL)
+            {
+                if (pList->Count < pList->MaxKeys)
+                {
+                    pList->pKeys[pList->Count] = pDevice->Key;
+                    pList->Count++;
+                }
+            }
+            else if (devCount == DeviceNumber)
             {
+                // Match found & is the desired device
                 DebugPrintf((
                     "Criteria matched device %04X %04X [%02X:%02X.%d]\n",
                     pDevice->Key.DeviceId, pDevice->Key.VendorId,
@@ -2990,6 +3050,297 @@ PlxDir_ProbeSwitch(
 
 
 
+/***********************************************************
+ *
+ *               REGISTER CACHE FUNCTIONS
+ *
+ **********************************************************/
+
+/******************************************************************************
+ *
+ * Function   : PlxDir_RegCacheInit
+ *
+ * Description: Creates the register cache lock, called once on library load
+ *
+ ******************************************************************************/
+VOID
+PlxDir_RegCacheInit(
+    VOID
+    )
+{
+#if defined(PLX_MSWINDOWS)
+    InitializeCriticalSection( &Gbl_RegCacheLock );
+#endif
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   : PlxDir_RegCacheCleanup
+ *
+ * Description: Deletes the register cache lock, called once on library unload
+ *
+ ******************************************************************************/
+VOID
+PlxDir_RegCacheCleanup(
+    VOID
+    )
+{
+#if defined(PLX_MSWINDOWS)
+    DeleteCriticalSection( &Gbl_RegCacheLock );
+#endif
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   : PlxDir_RegCacheEnable
+ *
+ * Description: Enables or disables caching of static registers for
+ *              out-of-band access modes
+ *
+ ******************************************************************************/
+VOID
+PlxDir_RegCacheEnable(
+    BOOLEAN bEnable
+    )
+{
+    // Drop all entries when disabled to avoid stale data on re-enable
+    if (bEnable == FALSE)
+    {
+        PlxDir_RegCacheFlush( NULL );
+    }
+
+    Gbl_bRegCacheEnable = bEnable;
+
+    DebugPrintf((
+        "Register cache %s\n",
+        (bEnable) ? "enabled" : "disabled"
+        ));
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   : PlxDir_RegCacheFlush
+ *
+ * Description: Invalidates all cached registers of a chip, or all chips if
+ *              no device is provided
+ *
+ ******************************************************************************/
+VOID
+PlxDir_RegCacheFlush(
+    PLX_DEVICE_OBJECT *pDevice
+    )
+{
+    U16                  i;
+    PLX_REG_CACHE_ENTRY *pEntry;
+
+
+    PLX_REG_CACHE_LOCK();
+
+    for (i = 0; i < PLX_REG_CACHE_MAX_ENTRIES; i++)
+    {
+        pEntry = &Gbl_RegCache[i];
+
+        if ( (pDevice == NULL) ||
+             ((pEntry->ApiMode      == pDevice->Key.ApiMode)  &&
+              (pEntry->ApiIndex     == pDevice->Key.ApiIndex) &&
+              (pEntry->DeviceNumber == pDevice->Key.DeviceNumber)) )
+        {
+            pEntry->bValid = FALSE;
+        }
+    }
+
+    PLX_REG_CACHE_UNLOCK();
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   : PlxDir_RegCacheIsStatic
+ *
+ * Description: Determines whether a port register is read-only & safe to cache
+ *
+ ******************************************************************************/
+BOOLEAN
+PlxDir_RegCacheIsStatic(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset
+    )
+{
+    U16 i;
+
+
+    for (i = 0; i < (sizeof(Gbl_RegCacheRules) / sizeof(PLX_REG_CACHE_RULE)); i++)
+    {
+        if ( (Gbl_RegCacheRules[i].Offset == offset) &&
+             ((Gbl_RegCacheRules[i].PlxFamily == PLX_FAMILY_NONE) ||
+              (Gbl_RegCacheRules[i].PlxFamily == pDevice->Key.PlxFamily)) )
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   : PlxDir_RegCacheRead
+ *
+ * Description: Returns a cached register value if available
+ *
+ ******************************************************************************/
+BOOLEAN
+PlxDir_RegCacheRead(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset,
+    U32               *pValue
+    )
+{
+    U16                  i;
+    BOOLEAN              bFound;
+    PLX_REG_CACHE_ENTRY *pEntry;
+
+
+    if ( (Gbl_bRegCacheEnable == FALSE) ||
+         !PLX_REG_CACHE_MODE_SUPPORTED( pDevice ) ||
+         (PlxDir_RegCacheIsStatic( pDevice, offset ) == FALSE) )
+    {
+        return FALSE;
+    }
+
+    bFound = FALSE;
+
+    PLX_REG_CACHE_LOCK();
+
+    for (i = 0; i < PLX_REG_CACHE_MAX_ENTRIES; i++)
+    {
+        pEntry = &Gbl_RegCache[i];
+
+        if ( pEntry->bValid &&
+             (pEntry->Offset       == offset)                   &&
+             (pEntry->PlxPort      == pDevice->Key.PlxPort)     &&
+             (pEntry->DeviceNumber == pDevice->Key.DeviceNumber) &&
+             (pEntry->ApiIndex     == pDevice->Key.ApiIndex)    &&
+             (pEntry->ApiMode      == pDevice->Key.ApiMode) )
+        {
+            *pValue = pEntry->Value;
+            bFound  = TRUE;
+            break;
+        }
+    }
+
+    PLX_REG_CACHE_UNLOCK();
+
+    return bFound;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   : PlxDir_RegCacheUpdate
+ *
+ * Description: Stores a register value read from the chip
+ *
+ ******************************************************************************/
+VOID
+PlxDir_RegCacheUpdate(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset,
+    U32                value
+    )
+{
+    PLX_REG_CACHE_ENTRY *pEntry;
+
+
+    // Skip error values, which may be returned while a link is unstable
+    if ( (Gbl_bRegCacheEnable == FALSE) ||
+         (value == PCI_CFG_RD_ERR_VAL) ||
+         !PLX_REG_CACHE_MODE_SUPPORTED( pDevice ) ||
+         (PlxDir_RegCacheIsStatic( pDevice, offset ) == FALSE) )
+    {
+        return;
+    }
+
+    // Remove any existing entry before adding the new one
+    PlxDir_RegCacheInvalidate( pDevice, offset );
+
+    PLX_REG_CACHE_LOCK();
+
+    // Replace entries in round-robin order once full
+    pEntry = &Gbl_RegCache[Gbl_RegCacheNext];
+
+    Gbl_RegCacheNext = (Gbl_RegCacheNext + 1) % PLX_REG_CACHE_MAX_ENTRIES;
+
+    pEntry->ApiMode      = (U8)pDevice->Key.ApiMode;
+    pEntry->ApiIndex     = pDevice->Key.ApiIndex;
+    pEntry->DeviceNumber = pDevice->Key.DeviceNumber;
+    pEntry->PlxPort      = pDevice->Key.PlxPort;
+    pEntry->Offset       = offset;
+    pEntry->Value        = value;
+    pEntry->bValid       = TRUE;
+
+    PLX_REG_CACHE_UNLOCK();
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   : PlxDir_RegCacheInvalidate
+ *
+ * Description: Invalidates a single cached port register
+ *
+ ******************************************************************************/
+VOID
+PlxDir_RegCacheInvalidate(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset
+    )
+{
+    U16                  i;
+    PLX_REG_CACHE_ENTRY *pEntry;
+
+
+    PLX_REG_CACHE_LOCK();
+
+    for (i = 0; i < PLX_REG_CACHE_MAX_ENTRIES; i++)
+    {
+        pEntry = &Gbl_RegCache[i];
+
+        if ( pEntry->bValid &&
+             (pEntry->Offset       == offset)                   &&
+             (pEntry->PlxPort      == pDevice->Key.PlxPort)     &&
+             (pEntry->DeviceNumber == pDevice->Key.DeviceNumber) &&
+             (pEntry->ApiIndex     == pDevice->Key.ApiIndex)    &&
+             (pEntry->ApiMode      == pDevice->Key.ApiMode) )
+        {
+            pEntry->bValid = FALSE;
+        }
+    }
+
+    PLX_REG_CACHE_UNLOCK();
+}
+
+
+
+
 
 /***********************************************************
  *
@@ -3007,10 +3358,14 @@ PlxDir_ProbeSwitch(
 U32
 PlxDir_PlxRegRead(
     PLX_DEVICE_OBJECT *pDevice,
-    U16                offset,
+    U32                offset,
     PLX_STATUS        *pStatus
     )
 {
+    U32        regVal;
+    PLX_STATUS status;
+
+
     if (pDevice->Key.ApiMode == PLX_API_MODE_PCI)
     {
         return PlxPci_PlxRegisterRead(
@@ -3019,38 +3374,67 @@ PlxDir_PlxRegRead(
             pStatus
             );
     }
-    else if (pDevice->Key.ApiMode == PLX_API_MODE_I2C_AARDVARK)
+
+    // Avoid slow link access if register is cached
+    if (PlxDir_RegCacheRead( pDevice, offset, &regVal ))
     {
-        return PlxI2c_PlxRegisterRead(
-            pDevice,
-            offset,
-            pStatus,
-            TRUE,       // Adjust for port?
-            TRUE        // Retry on error?
-            );
+        if (pStatus != NULL)
+        {
+            *pStatus = PLX_STATUS_OK;
+        }
+        return regVal;
+    }
+
+    if (pDevice->Key.ApiMode == PLX_API_MODE_I2C_AARDVARK)
+    {
+        regVal =
+            PlxI2c_PlxRegisterRead(
+                pDevice,
+                offset,
+                &status,
+                TRUE,       // Adjust for port?
+                TRUE        // Retry on error?
+                );
     }
     else if (pDevice->Key.ApiMode == PLX_API_MODE_MDIO_SPLICE)
     {
-        return MdioSplice_PlxRegisterRead(
-            pDevice,
-            offset,
-            pStatus,
-            TRUE,       // Adjust for port?
-            TRUE        // Retry on error?
-            );
+        regVal =
+            MdioSplice_PlxRegisterRead(
+                pDevice,
+                offset,
+                &status,
+                TRUE,       // Adjust for port?
+                TRUE        // Retry on error?
+                );
     }
     else if (pDevice->Key.ApiMode == PLX_API_MODE_SDB)
     {
-        return Sdb_PlxRegisterRead(
-            pDevice,
-            offset,
-            pStatus,
-            TRUE,       // Adjust for port?
-            TRUE        // Retry on error?
-            );
+        regVal =
+            Sdb_PlxRegisterRead(
+                pDevice,
+                offset,
+                &status,
+                TRUE,       // Adjust for port?
+                TRUE        // Retry on error?
+                );
+    }
+    else
+    {
+        regVal = PCI_CFG_RD_ERR_VAL;
+        status = PLX_STATUS_UNSUPPORTED;
+    }
+
+    if (status == PLX_STATUS_OK)
+    {
+        PlxDir_RegCacheUpdate( pDevice, offset, regVal );
+    }
+
+    if (pStatus != NULL)
+    {
+        *pStatus = status;
     }
 
-    return PCI_CFG_RD_ERR_VAL;
+    return regVal;
 }
 
 
@@ -3066,7 +3450,7 @@ PlxDir_PlxRegRead(
 PLX_STATUS
 PlxDir_PlxRegWrite(
     PLX_DEVICE_OBJECT *pDevice,
-    U16                offset,
+    U32                offset,
     U32                value
     )
 {
@@ -3078,7 +3462,11 @@ PlxDir_PlxRegWrite(
             value
             );
     }
-    else if (pDevice->Key.ApiMode == PLX_API_MODE_I2C_AARDVARK)
+
+    // Cached value no longer valid
+    PlxDir_RegCacheInvalidate( pDevice, offset );
+
+    if (pDevice->Key.ApiMode == PLX_API_MODE_I2C_AARDVARK)
     {
         return PlxI2c_PlxRegisterWrite(
             pDevice,
@@ -3193,7 +3581,11 @@ PlxDir_PlxMappedRegWrite(
             value
             );
     }
-    else if (pDevice->Key.ApiMode == PLX_API_MODE_I2C_AARDVARK)
+
+    // Mapped writes may affect any port, so drop all cached chip registers
+    PlxDir_RegCacheFlush( pDevice );
+
+    if (pDevice->Key.ApiMode == PLX_API_MODE_I2C_AARDVARK)
     {
         return PlxI2c_PlxRegisterWrite(
             pDevice,
@@ -3223,3 +3615,67 @@ PlxDir_PlxMappedRegWrite(
 
     return PLX_STATUS_UNSUPPORTED;
 }
+
+
+
+
+/******************************************************************************
+ *
+ * Function   : PlxDir_PlxMappedRegReadBuffer
+ *
+ * Description: Reads a block of consecutive mapped registers
+ *
+ ******************************************************************************/
+PLX_STATUS
+PlxDir_PlxMappedRegReadBuffer(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset,
+    VOID              *pBuffer,
+    U32                ByteCount
+    )
+{
+    U32        idx;
+    PLX_STATUS status;
+
+
+    // PCIe mode performs the full read in a single driver call
+    if (pDevice->Key.ApiMode == PLX_API_MODE_PCI)
+    {
+        return PlxPci_PlxMappedRegisterReadBuffer(
+            pDevice,
+            offset,
+            pBuffer,
+            ByteCount
+            );
+    }
+    else if (pDevice->Key.ApiMode == PLX_API_MODE_SDB)
+    {
+        // SDB pipelines sequential reads over the UART
+        return Sdb_PlxRegisterReadBuffer(
+            pDevice,
+            offset,
+            pBuffer,
+            ByteCount,
+            FALSE       // Adjust for port?
+            );
+    }
+
+    // Other modes read each register over the transport
+    for (idx = 0; idx < ByteCount; idx += sizeof(U32))
+    {
+        status = PLX_STATUS_UNSUPPORTED;
+
+        *(U32*)((U8*)pBuffer + idx) =
+            PlxDir_PlxMappedRegRead(
+                pDevice,
+                offset + idx,
+                &status
+                );
+        if (status != PLX_STATUS_OK)
+        {
+            return status;
+        }
+    }
+
+    return PLX_STATUS_OK;
+}
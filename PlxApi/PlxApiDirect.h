@@ -77,6 +77,7 @@ extern "C" {
           ((pDev)->Key.ApiMode == PLX_API_MODE_SDB) ? "SDB" : \
           ((pDev)->Key.ApiMode == PLX_API_MODE_I2C_AARDVARK) ? "I2C" : \
           ((pDev)->Key.ApiMode == PLX_API_MODE_MDIO_SPLICE) ? "MDIO" : \
+          ((pDev)->Key.ApiMode == PLX_API_MODE_SIMULATED) ? "SIM" : \
           "??" )
 
 // Addresses used for probe, register, & flash accesses
@@ -124,6 +125,44 @@ extern "C" {
 #define ATLAS_REG_MAV_HOST_DIAG             0x08     // Maverick host diag reg
 #define ATLAS_MAV_HOST_DIAG_CPU_RESET_MASK  (1 << 1) // Hold CPU in reset
 
+// Register cache for out-of-band (I2C/MDIO/SDB) access modes
+#define PLX_REG_CACHE_MAX_ENTRIES           256
+
+#define PLX_REG_CACHE_MODE_SUPPORTED( pDev ) \
+        ( ((pDev)->Key.ApiMode == PLX_API_MODE_I2C_AARDVARK) || \
+          ((pDev)->Key.ApiMode == PLX_API_MODE_MDIO_SPLICE)  || \
+          ((pDev)->Key.ApiMode == PLX_API_MODE_SDB) )
+
+
+// Cached register value
+typedef struct _PLX_REG_CACHE_ENTRY
+{
+    U8  bValid;                      // Entry contains valid data
+    U8  ApiMode;                     // Access mode of chip
+    U8  ApiIndex;                    // Adapter/COM port of chip
+    U16 DeviceNumber;                // Chip address on adapter
+    U8  PlxPort;                     // Port number of register
+    U32 Offset;                      // Port register offset
+    U32 Value;                       // Register value
+} PLX_REG_CACHE_ENTRY;
+
+
+// List of device keys found during a switch probe
+typedef struct _PLX_PROBE_LIST
+{
+    PLX_DEVICE_KEY *pKeys;           // Buffer to store keys
+    U16             MaxKeys;         // Max number of keys in buffer
+    U16             Count;           // Number of keys stored
+} PLX_PROBE_LIST;
+
+
+// Static (cacheable) register offset
+typedef struct _PLX_REG_CACHE_RULE
+{
+    U8  PlxFamily;                   // Chip family (PLX_FAMILY_NONE = all)
+    U16 Offset;                      // Port register offset
+} PLX_REG_CACHE_RULE;
+
 
 
 
@@ -155,8 +194,8 @@ extern "C" {
 
 #if !defined(PLX_8000_REG_READ)
     // Macros for PLX chip register access
-    #define PLX_PCI_REG_READ(pDevice, offset, pValue)   *(pValue) = PlxDir_PlxRegRead( (pDevice), (U16)(offset), NULL )
-    #define PLX_PCI_REG_WRITE(pDevice, offset, value)   PlxDir_PlxRegWrite( (pDevice), (U16)(offset), (value) )
+    #define PLX_PCI_REG_READ(pDevice, offset, pValue)   *(pValue) = PlxDir_PlxRegRead( (pDevice), (U32)(offset), NULL )
+    #define PLX_PCI_REG_WRITE(pDevice, offset, value)   PlxDir_PlxRegWrite( (pDevice), (U32)(offset), (value) )
     #define PLX_8000_REG_READ(pDevice, offset)          PlxDir_PlxMappedRegRead( (pDevice), (offset), NULL )
     #define PLX_8000_REG_WRITE(pDevice, offset, value)  PlxDir_PlxMappedRegWrite( (pDevice), (offset), (value) )
 #endif
@@ -302,7 +341,58 @@ PlxDir_ProbeSwitch(
     PLX_DEVICE_OBJECT *pDevice,
     PLX_DEVICE_KEY    *pKey,
     U16                DeviceNumber,
-    U16               *pNumMatched
+    U16               *pNumMatched,
+    PLX_PROBE_LIST    *pList
+    );
+
+
+/******************************************
+ *        Register Cache Functions
+ *****************************************/
+VOID
+PlxDir_RegCacheInit(
+    VOID
+    );
+
+VOID
+PlxDir_RegCacheCleanup(
+    VOID
+    );
+
+VOID
+PlxDir_RegCacheEnable(
+    BOOLEAN bEnable
+    );
+
+VOID
+PlxDir_RegCacheFlush(
+    PLX_DEVICE_OBJECT *pDevice
+    );
+
+BOOLEAN
+PlxDir_RegCacheIsStatic(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset
+    );
+
+BOOLEAN
+PlxDir_RegCacheRead(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset,
+    U32               *pValue
+    );
+
+VOID
+PlxDir_RegCacheUpdate(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset,
+    U32                value
+    );
+
+VOID
+PlxDir_RegCacheInvalidate(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset
     );
 
 
@@ -312,14 +402,14 @@ PlxDir_ProbeSwitch(
 U32
 PlxDir_PlxRegRead(
     PLX_DEVICE_OBJECT *pDevice,
-    U16                offset,
+    U32                offset,
     PLX_STATUS        *pStatus
     );
 
 PLX_STATUS
 PlxDir_PlxRegWrite(
     PLX_DEVICE_OBJECT *pDevice,
-    U16                offset,
+    U32                offset,
     U32                value
     );
 
@@ -337,6 +427,14 @@ PlxDir_PlxMappedRegWrite(
     U32                value
     );
 
+PLX_STATUS
+PlxDir_PlxMappedRegReadBuffer(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset,
+    VOID              *pBuffer,
+    U32                ByteCount
+    );
+
 
 
 #ifdef __cplusplus
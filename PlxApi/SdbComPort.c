@@ -232,7 +232,8 @@ Sdb_DeviceFindEx(
                     &devObjTemp,
                     pKey,
                     DeviceNumber,
-                    &numMatched
+                    &numMatched,
+                    NULL        // No device list
                     );
 
             if (status == PLX_STATUS_OK)
@@ -573,6 +574,173 @@ Sdb_PlxRegisterWrite(
 
 
 
+/*******************************************************************************
+ *
+ * Function   :  Sdb_PlxRegisterAccessList
+ *
+ * Description:  Performs a list of PLX-specific register reads & writes
+ *
+ * Note       :  Consecutive reads are pipelined. Each write is sent alone &
+ *               its ACK received before the next command, since the UART has
+ *               no flow control & a write may not be safely repeated.
+ *
+ ******************************************************************************/
+PLX_STATUS
+Sdb_PlxRegisterAccessList(
+    PLX_DEVICE_OBJECT *pDevice,
+    PLX_REG_ACCESS    *pList,
+    U32                Count,
+    BOOLEAN            bAdjustForPort
+    )
+{
+    U32            idx;
+    U32            entry;
+    U32            burst;
+    U32            portBase;
+    PLX_STATUS     status;
+    PLX_REG_ACCESS burstList[SDB_PIPELINE_DEPTH];
+
+
+    // Set offset of port-specific register region if requested
+    portBase = 0;
+    if (bAdjustForPort)
+    {
+        portBase = ATLAS_REGS_AXI_BASE_ADDR + (pDevice->Key.PlxPort * 0x1000);
+    }
+
+    for (idx = 0; idx < Count; idx += burst)
+    {
+        // Perform writes singly & wait for ACK
+        if (pList[idx].bWrite)
+        {
+            status =
+                Sdb_PlxRegisterWrite(
+                    pDevice,
+                    pList[idx].Offset,
+                    pList[idx].Value,
+                    bAdjustForPort
+                    );
+
+            if (status != PLX_STATUS_OK)
+            {
+                return status;
+            }
+
+            burst = 1;
+            continue;
+        }
+
+        // Copy consecutive reads with absolute offsets
+        burst = 0;
+        while ( ((idx + burst) < Count) &&
+                (burst < SDB_PIPELINE_DEPTH) &&
+                (pList[idx + burst].bWrite == FALSE) )
+        {
+            if (pList[idx + burst].Offset & 0x3)
+            {
+                DebugPrintf(("SDB: ERROR - Invalid register offset (0x%x)\n", pList[idx + burst].Offset));
+                return PLX_STATUS_INVALID_OFFSET;
+            }
+
+            burstList[burst]         = pList[idx + burst];
+            burstList[burst].Offset += portBase;
+            burst++;
+        }
+
+        status = Sdb_Pipeline_Reads( pDevice, burstList, burst );
+        if (status != PLX_STATUS_OK)
+        {
+            return status;
+        }
+
+        // Return read values
+        for (entry = 0; entry < burst; entry++)
+        {
+            pList[idx + entry].Value = burstList[entry].Value;
+        }
+    }
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  Sdb_PlxRegisterReadBuffer
+ *
+ * Description:  Reads a block of consecutive PLX-specific registers
+ *
+ ******************************************************************************/
+PLX_STATUS
+Sdb_PlxRegisterReadBuffer(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset,
+    VOID              *pBuffer,
+    U32                ByteCount,
+    BOOLEAN            bAdjustForPort
+    )
+{
+    U32            idx;
+    U32            entry;
+    U32            burst;
+    PLX_STATUS     status;
+    PLX_REG_ACCESS burstList[SDB_PIPELINE_DEPTH];
+
+
+    // Verify register offset & size
+    if (offset & 0x3)
+    {
+        DebugPrintf(("SDB: ERROR - Invalid register offset (0x%x)\n", offset));
+        return PLX_STATUS_INVALID_OFFSET;
+    }
+
+    if ((ByteCount == 0) || (ByteCount & 0x3))
+    {
+        return PLX_STATUS_INVALID_SIZE;
+    }
+
+    // Adjust offset for port if requested
+    if (bAdjustForPort)
+    {
+        offset += ATLAS_REGS_AXI_BASE_ADDR + (pDevice->Key.PlxPort * 0x1000);
+    }
+
+    // Sequential reads are pipelined as READ_NEXT commands
+    for (idx = 0; idx < (ByteCount / sizeof(U32)); idx += burst)
+    {
+        burst = (ByteCount / sizeof(U32)) - idx;
+        if (burst > SDB_PIPELINE_DEPTH)
+        {
+            burst = SDB_PIPELINE_DEPTH;
+        }
+
+        for (entry = 0; entry < burst; entry++)
+        {
+            burstList[entry].Offset = offset + ((idx + entry) * sizeof(U32));
+            burstList[entry].Value  = 0;
+            burstList[entry].bWrite = FALSE;
+        }
+
+        status = Sdb_Pipeline_Reads( pDevice, burstList, burst );
+        if (status != PLX_STATUS_OK)
+        {
+            return status;
+        }
+
+        for (entry = 0; entry < burst; entry++)
+        {
+            *((U32*)pBuffer + idx + entry) = burstList[entry].Value;
+        }
+    }
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
 /***********************************************************
  *
  *               PRIVATE SUPPORT FUNCTIONS
@@ -628,10 +796,27 @@ Sdb_Driver_Connect(
         pDevice->Key.ApiIndex = (U8)pModeProp->Sdb.Port;
 
         // Set baud rate
-        pDevice->Key.ApiInternal[0] = SDB_OS_BAUD_115200;
-        if (pModeProp->Sdb.Baud == SDB_BAUD_RATE_19200)
+        switch (pModeProp->Sdb.Baud)
         {
-            pDevice->Key.ApiInternal[0] = SDB_OS_BAUD_19200;
+            case SDB_BAUD_RATE_19200:
+                pDevice->Key.ApiInternal[0] = SDB_OS_BAUD_19200;
+                break;
+
+            case SDB_BAUD_RATE_230400:
+                pDevice->Key.ApiInternal[0] = SDB_OS_BAUD_230400;
+                break;
+
+            case SDB_BAUD_RATE_460800:
+                pDevice->Key.ApiInternal[0] = SDB_OS_BAUD_460800;
+                break;
+
+            case SDB_BAUD_RATE_921600:
+                pDevice->Key.ApiInternal[0] = SDB_OS_BAUD_921600;
+                break;
+
+            default:
+                pDevice->Key.ApiInternal[0] = SDB_OS_BAUD_115200;
+                break;
         }
 
         // Set cable type
@@ -938,6 +1123,189 @@ Sdb_Sync_Connection(
 
 
 
+/******************************************************************************
+ *
+ * Function   :  Sdb_Pipeline_Reads
+ *
+ * Description:  Issues a set of register reads without waiting for each
+ *               reply, then collects all replies at once
+ *
+ * Note       :  Offsets must be absolute. Only reads are pipelined, since
+ *               they have no side effects & may safely be repeated. If any
+ *               reply is invalid, the connection is re-synced & remaining
+ *               entries are read individually, starting with the first
+ *               failed entry.
+ *
+ ******************************************************************************/
+PLX_STATUS
+Sdb_Pipeline_Reads(
+    PLX_DEVICE_OBJECT *pDevice,
+    PLX_REG_ACCESS    *pList,
+    U32                Count
+    )
+{
+    U8         *pCmd;
+    U8          sdbCmd[SDB_PIPELINE_DEPTH * SDB_READ_CMD_LEN];
+    U8          sdbReply[SDB_PIPELINE_DEPTH * SDB_READ_REPLY_LEN];
+    U32         idx;
+    U32         pos;
+    U32         offset;
+    U32         rxBytes;
+    U32         cmdLen;
+    U32         replyLen;
+    U32         byteCount;
+    U32         nextOffset;
+    PLX_STATUS  status;
+
+
+    if (Count > SDB_PIPELINE_DEPTH)
+    {
+        return PLX_STATUS_INVALID_SIZE;
+    }
+
+    // Check for first operation
+    if (pDevice->Key.ApiInternal[1] == SDB_NEEDS_INIT_CMD)
+    {
+        if (Sdb_Sync_Connection( pDevice ) == FALSE)
+        {
+            return PLX_STATUS_INVALID_STATE;
+        }
+    }
+
+    // Build command stream
+    cmdLen     = 0;
+    replyLen   = 0;
+    nextOffset = pDevice->Key.ApiInternal[1];
+
+    for (idx = 0; idx < Count; idx++)
+    {
+        // Writes must not be pipelined
+        if (pList[idx].bWrite)
+        {
+            return PLX_STATUS_INVALID_DATA;
+        }
+
+        pCmd   = &sdbCmd[cmdLen];
+        offset = pList[idx].Offset;
+
+        // Use READ_NEXT command if sequential read
+        if (offset == nextOffset)
+        {
+            pCmd[0] = SDB_CMD_READ_NEXT;            // Read next operation
+            pCmd[1] = SDB_CMD_END;                  // End of command
+
+            cmdLen += SDB_READ_NEXT_CMD_LEN;
+        }
+        else
+        {
+            pCmd[0] = SDB_CMD_READ;                 // Read operation
+            pCmd[1] = sizeof(U32);                  // 4 bytes
+            pCmd[2] = (U8)(offset >> 24);           // 4B address
+            pCmd[3] = (U8)(offset >> 16);
+            pCmd[4] = (U8)(offset >>  8);
+            pCmd[5] = (U8)(offset >>  0);
+            pCmd[6] = SDB_CMD_END;                  // End of command
+
+            cmdLen += SDB_READ_CMD_LEN;
+        }
+
+        replyLen  += SDB_READ_REPLY_LEN;
+        nextOffset = offset + sizeof(U32);
+    }
+
+    // Send all commands
+    WriteFile(
+        pDevice->hDevice,
+        sdbCmd,
+        cmdLen,
+        &byteCount,
+        NULL
+        );
+
+    if (byteCount != cmdLen)
+    {
+        ErrorPrintf((
+            "SDB: ERROR: Pipelined commands failed, sent %dB of %dB\n",
+            byteCount, cmdLen
+            ));
+    }
+
+    // Get all replies by combining received data
+    byteCount = 0;
+    do
+    {
+        // Reset Rx bytes
+        rxBytes = 0;
+
+        ReadFile(
+            pDevice->hDevice,
+            &(sdbReply[byteCount]),
+            replyLen - byteCount,
+            &rxBytes,
+            NULL
+            );
+
+        // Update total bytes
+        byteCount += rxBytes;
+    }
+    while ( (byteCount != replyLen) && (rxBytes != 0) );
+
+    // Verify & extract each reply in order
+    pos = 0;
+    for (idx = 0; idx < Count; idx++)
+    {
+        if ( ((pos + SDB_READ_REPLY_LEN) > byteCount) ||
+             (sdbReply[pos + SDB_READ_REPLY_LEN - 1] != SDB_CMD_ACK) )
+        {
+            break;
+        }
+
+        pList[idx].Value = ((U32)sdbReply[pos + 0] << 24) |
+                           ((U32)sdbReply[pos + 1] << 16) |
+                           ((U32)sdbReply[pos + 2] <<  8) |
+                           ((U32)sdbReply[pos + 3] <<  0);
+
+        pos += SDB_READ_REPLY_LEN;
+    }
+
+    if (idx == Count)
+    {
+        // Update offset for next read command
+        pDevice->Key.ApiInternal[1] = nextOffset;
+        return PLX_STATUS_OK;
+    }
+
+    DebugPrintf((
+        "SDB: Pipelined reply %d of %d invalid (%dB of %dB), revert to single access\n",
+        idx, Count, byteCount, replyLen
+        ));
+
+    // Re-sync & complete remaining reads individually with retry
+    Sdb_Sync_Connection( pDevice );
+
+    for (; idx < Count; idx++)
+    {
+        pList[idx].Value =
+            Sdb_PlxRegisterRead(
+                pDevice,
+                pList[idx].Offset,
+                &status,
+                FALSE,      // Adjust for port?
+                TRUE        // Retry on error?
+                );
+
+        if (status != PLX_STATUS_OK)
+        {
+            return status;
+        }
+    }
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
 /******************************************************************************
  *
  * Function   :  Sdb_Dispatch_IoControl
@@ -1000,12 +1368,10 @@ Sdb_Dispatch_IoControl(
             DebugPrintf_Cont(("PLX_IOCTL_PCI_REGISTER_READ\n"));
 
             pIoBuffer->value[1] =
-                Sdb_PlxRegisterRead(
+                PlxDir_PlxRegRead(
                     pDevice,
                     (U32)pIoBuffer->value[0],
-                    &(pIoBuffer->ReturnCode),
-                    TRUE,       // Adjust for port?
-                    TRUE        // Retry on error?
+                    &(pIoBuffer->ReturnCode)
                     );
 
             DebugPrintf((
@@ -1019,11 +1385,10 @@ Sdb_Dispatch_IoControl(
             DebugPrintf_Cont(("PLX_IOCTL_PCI_REGISTER_WRITE\n"));
 
             pIoBuffer->ReturnCode =
-                Sdb_PlxRegisterWrite(
+                PlxDir_PlxRegWrite(
                     pDevice,
                     (U32)pIoBuffer->value[0],
-                    (U32)pIoBuffer->value[1],
-                    TRUE        // Adjust for port?
+                    (U32)pIoBuffer->value[1]
                     );
 
             DebugPrintf((
@@ -1041,12 +1406,10 @@ Sdb_Dispatch_IoControl(
             DebugPrintf_Cont(("PLX_IOCTL_REGISTER_READ\n"));
 
             pIoBuffer->value[1] =
-                Sdb_PlxRegisterRead(
+                PlxDir_PlxRegRead(
                     pDevice,
                     (U32)pIoBuffer->value[0],
-                    &(pIoBuffer->ReturnCode),
-                    TRUE,       // Adjust for port?
-                    TRUE        // Retry on error?
+                    &(pIoBuffer->ReturnCode)
                     );
 
             DebugPrintf((
@@ -1060,11 +1423,10 @@ Sdb_Dispatch_IoControl(
             DebugPrintf_Cont(("PLX_IOCTL_REGISTER_WRITE\n"));
 
             pIoBuffer->ReturnCode =
-                Sdb_PlxRegisterWrite(
+                PlxDir_PlxRegWrite(
                     pDevice,
                     (U32)pIoBuffer->value[0],
-                    (U32)pIoBuffer->value[1],
-                    TRUE        // Adjust for port?
+                    (U32)pIoBuffer->value[1]
                     );
 
             DebugPrintf((
@@ -1093,16 +1455,43 @@ Sdb_Dispatch_IoControl(
                 ));
             break;
 
-        case PLX_IOCTL_MAPPED_REGISTER_WRITE:
-            DebugPrintf_Cont(("PLX_IOCTL_MAPPED_REGISTER_WRITE\n"));
+        case PLX_IOCTL_MAPPED_REGISTER_READ_BUFFER:
+            DebugPrintf_Cont(("PLX_IOCTL_MAPPED_REGISTER_READ_BUFFER\n"));
 
             pIoBuffer->ReturnCode =
-                Sdb_PlxRegisterWrite(
+                Sdb_PlxRegisterReadBuffer(
                     pDevice,
                     (U32)pIoBuffer->value[0],
+                    PLX_INT_TO_PTR(pIoBuffer->value[2]),
                     (U32)pIoBuffer->value[1],
                     FALSE       // Adjust for port?
                     );
+            break;
+
+        case PLX_IOCTL_REGISTER_ACCESS_LIST:
+            DebugPrintf_Cont(("PLX_IOCTL_REGISTER_ACCESS_LIST\n"));
+
+            // List may contain writes, so drop any cached registers
+            PlxDir_RegCacheFlush( pDevice );
+
+            pIoBuffer->ReturnCode =
+                Sdb_PlxRegisterAccessList(
+                    pDevice,
+                    PLX_INT_TO_PTR(pIoBuffer->value[2]),
+                    (U32)pIoBuffer->value[0],
+                    (BOOLEAN)(pIoBuffer->value[1] == FALSE)     // Adjust for port if not mapped
+                    );
+            break;
+
+        case PLX_IOCTL_MAPPED_REGISTER_WRITE:
+            DebugPrintf_Cont(("PLX_IOCTL_MAPPED_REGISTER_WRITE\n"));
+
+            pIoBuffer->ReturnCode =
+                PlxDir_PlxMappedRegWrite(
+                    pDevice,
+                    (U32)pIoBuffer->value[0],
+                    (U32)pIoBuffer->value[1]
+                    );
 
             DebugPrintf((
                 "Wrote %08X to mapped reg %03X\n",
@@ -68,16 +68,23 @@ extern "C" {
     #define SDB_OS_COM_PORT_USB         SDB_OS_COM_PORT_UART
     #define SDB_OS_BAUD_19200           CBR_19200
     #define SDB_OS_BAUD_115200          CBR_115200
+    #define SDB_OS_BAUD_230400          230400
+    #define SDB_OS_BAUD_460800          460800
+    #define SDB_OS_BAUD_921600          921600
 #elif defined(PLX_LINUX)
     #define SDB_OS_COM_PORT_UART        "/dev/ttyS"
     #define SDB_OS_COM_PORT_USB         "/dev/ttyUSB"
     #define SDB_OS_BAUD_19200           B19200
     #define SDB_OS_BAUD_115200          B115200
+    #define SDB_OS_BAUD_230400          B230400
+    #define SDB_OS_BAUD_460800          B460800
+    #define SDB_OS_BAUD_921600          B921600
 #endif
 
 #define SDB_MAX_ATTEMPTS                2            // Max num of attempts if failure
 #define SDB_NEEDS_INIT_CMD              (0xFFFFFFFE) // Needs initial sync command
 #define SDB_NEXT_READ_OFFSET_INIT       (0xFFFFFFFF) // Init offset to force full read cmd
+#define SDB_PIPELINE_DEPTH              8            // Max reads issued before waiting for replies
 
 // SDB command & reply sizes
 #define SDB_READ_CMD_LEN                (1 + 1 + 4 + 1)     // Cmd + size + addr + end
@@ -133,6 +140,13 @@ Sdb_Sync_Connection(
     PLX_DEVICE_OBJECT *pDevice
     );
 
+PLX_STATUS
+Sdb_Pipeline_Reads(
+    PLX_DEVICE_OBJECT *pDevice,
+    PLX_REG_ACCESS    *pList,
+    U32                Count
+    );
+
 S32
 Sdb_Dispatch_IoControl(
     PLX_DEVICE_OBJECT *pDevice,
@@ -162,6 +176,23 @@ Sdb_PlxRegisterWrite(
     BOOLEAN            bAdjustForPort
     );
 
+PLX_STATUS
+Sdb_PlxRegisterAccessList(
+    PLX_DEVICE_OBJECT *pDevice,
+    PLX_REG_ACCESS    *pList,
+    U32                Count,
+    BOOLEAN            bAdjustForPort
+    );
+
+PLX_STATUS
+Sdb_PlxRegisterReadBuffer(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset,
+    VOID              *pBuffer,
+    U32                ByteCount,
+    BOOLEAN            bAdjustForPort
+    );
+
 
 
 #ifdef __cplusplus
@@ -0,0 +1,2038 @@
+/*******************************************************************************
+ * Copyright 2013-2019 Broadcom Inc
+ * Copyright (c) 2009 to 2012 PLX Technology Inc.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directorY of this source tree, or the
+ * BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+/*******************************************************************************
+ *
+ * File Name:
+ *
+ *      SimDevice.c
+ *
+ * Description:
+ *
+ *      Implements the PLX API functions over an in-process device model.  The
+ *      model covers a 9054 PCI-to-Local bridge and an 8000 DMA function with
+ *      register spaces, mailboxes, doorbells, a DMA engine, notifications and
+ *      performance counters, so applications and the API itself can be run
+ *      without PLX hardware or a kernel driver.
+ *
+ *      Buffers allocated through the simulated device use their process
+ *      address as the bus address, so DMA is performed with memory copies.
+ *
+ *      The model relies on pthreads & is only built for Linux.  Other
+ *      platforms use the stubs in PlxApi.c, which report simulated mode as
+ *      unsupported.
+ *
+ * Revision History:
+ *
+ *      09-01-19 : PCI/PCIe SDK v8.10
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ *
+ * Simulated device API utilization of fields in PLX_DEVICE_KEY
+ *
+ *  ApiIndex        - Index of simulated device model (SIM_DEVICE_xxx)
+ *  DeviceNumber    - Not used
+ *
+ ******************************************************************************/
+
+
+#include "PciRegs.h"
+#include "PexApi.h"
+#include "PlxApiDebug.h"
+#include "PlxApiDirect.h"
+#include "SimDevice.h"
+
+#if defined(PLX_LINUX)
+    #include <stdlib.h>     // For posix_memalign() & free()
+    #include <string.h>     // For memcpy()
+    #include <sys/time.h>   // For gettimeofday()
+#endif
+
+
+// Simulated devices are only supported in Linux
+#if defined(PLX_LINUX)
+
+
+
+
+/**********************************************
+ *               Definitions
+ *********************************************/
+// Index of each counter in the performance counter set (matches PLX_PERF_PROP)
+#define SIM_PERF_IN_POSTED_HDR          0
+#define SIM_PERF_IN_POSTED_DW           1
+#define SIM_PERF_IN_CPL_HDR             4
+#define SIM_PERF_IN_CPL_DW              5
+#define SIM_PERF_IN_DLLP                6
+#define SIM_PERF_EG_POSTED_HDR          7
+#define SIM_PERF_EG_POSTED_DW           8
+#define SIM_PERF_EG_NONPOSTED_HDR       9
+#define SIM_PERF_EG_DLLP                13
+
+// Number of TLPs required to move a byte count
+#define SIM_TLP_COUNT(bytes, size)      (((bytes) + (size) - 1) / (size))
+
+// Register access to model register space
+#define SIM_REG(pSim, offset)           (pSim)->pRegs[(offset) / sizeof(U32)]
+
+// Owner of resources is the handle of the opening device object
+#define SIM_OWNER(pDev)                 ((U64)(pDev)->hDevice)
+
+
+// Simulated page-locked buffer
+typedef struct _SIM_PHYS_MEM
+{
+    struct _SIM_PHYS_MEM *pNext;
+    U64                   Owner;            // Handle of owning device object
+    U8                   *pBuffer;          // Buffer address, also used as bus address
+    U32                   Size;
+} SIM_PHYS_MEM;
+
+
+// Simulated notification wait object
+typedef struct _SIM_WAIT_OBJECT
+{
+    struct _SIM_WAIT_OBJECT *pNext;
+    U64                      Owner;         // Handle of owning device object
+    PLX_INTERRUPT            Notify;        // Interrupts registered for
+    PLX_INTERRUPT            Source;        // Interrupts which have triggered
+    BOOLEAN                  bSignalled;
+    BOOLEAN                  bCanceled;
+    S32                      WaitCount;     // Number of threads waiting
+    pthread_cond_t           Cond;
+} SIM_WAIT_OBJECT;
+
+
+// State of a simulated device
+typedef struct _SIM_DEVICE_PROP
+{
+    CRITICAL_SECTION  Lock_Model;           // Serializes access to model state
+    S32               OpenCount;
+    U8                Index;                // Model index (SIM_DEVICE_xxx)
+    U32              *pRegs;                // BAR 0 register space
+    U8               *pLocalSpace;          // 9054 local space 0 (BAR 2)
+    U8               *pCommonBuffer;
+    U32               PciCfg[PCIE_CONFIG_SPACE_SIZE / sizeof(U32)];
+    PLX_INTERRUPT     IntrEnable;           // Currently enabled interrupts
+    U64               DmaOwner[SIM_MAX_DMA_CHANNELS];
+    BOOLEAN           bDmaPaused[SIM_MAX_DMA_CHANNELS];
+    PLX_DMA_PROP      DmaProp[SIM_MAX_DMA_CHANNELS];
+    SIM_PHYS_MEM     *pPhysMemList;
+    SIM_WAIT_OBJECT  *pWaitList;
+    BOOLEAN           bPerfEnabled;
+    U32               PerfCounter[PERF_COUNTERS_PER_PORT];
+    PLX_DEVICE_STATS  Stats;                // Driver statistics counters
+} SIM_DEVICE_PROP;
+
+
+// Identity of each simulated device model
+static const struct _SIM_MODEL
+{
+    U16 DeviceId;
+    U8  Revision;
+    U16 PlxChip;
+    U8  PlxRevision;
+    U8  PlxFamily;
+    U8  PlxPort;
+    U8  PlxPortType;
+    U8  bus;
+    U8  function;
+    U8  NumDmaChannels;
+} Sim_Model[SIM_MAX_DEVICES] =
+{
+    // DevID  Rev   Chip    ChipRev Family                 Port Port Type              Bus   Fn  DMA
+    { 0x9054, 0x0B, 0x9054, 0xAC,   PLX_FAMILY_BRIDGE_P2L, 0,   PLX_SPEC_PORT_UNKNOWN, 0xF0, 0,  2 },
+    { 0x87D0, 0xCA, 0x8733, 0xCA,   PLX_FAMILY_DRACO_2,    0,   PLX_SPEC_PORT_DMA,     0xF1, 1,  4 }
+};
+
+
+
+
+/**********************************************
+ *           Global Variables
+ *********************************************/
+// Serializes device open & close
+static pthread_mutex_t Gbl_SimLock_Open = PTHREAD_MUTEX_INITIALIZER;
+
+// Next handle to assign to an opened device object
+static S32 Gbl_SimNextHandle = 1;
+
+// State of each simulated device
+static SIM_DEVICE_PROP Gbl_SimProp[SIM_MAX_DEVICES];
+
+
+
+
+/**********************************************
+ *       Private Function Prototypes
+ *********************************************/
+static VOID
+Sim_KeyFill(
+    U8              index,
+    PLX_DEVICE_KEY *pKey
+    );
+
+static PLX_STATUS
+Sim_ModelInitialize(
+    SIM_DEVICE_PROP *pSim
+    );
+
+static VOID
+Sim_ModelRelease(
+    SIM_DEVICE_PROP *pSim
+    );
+
+static VOID
+Sim_RegWrite_Locked(
+    SIM_DEVICE_PROP *pSim,
+    U32              offset,
+    U32              value
+    );
+
+static U8*
+Sim_BusAddrToVa(
+    SIM_DEVICE_PROP *pSim,
+    U64              BusAddr,
+    U32              ByteCount
+    );
+
+static PLX_STATUS
+Sim_DmaExecute_Locked(
+    SIM_DEVICE_PROP *pSim,
+    U8               channel
+    );
+
+static VOID
+Sim_InterruptTrigger_Locked(
+    SIM_DEVICE_PROP *pSim,
+    PLX_INTERRUPT   *pSource
+    );
+
+static VOID
+Sim_PerfAccount_Locked(
+    SIM_DEVICE_PROP *pSim,
+    U32              BytesRead,
+    U32              BytesWritten
+    );
+
+static SIM_WAIT_OBJECT*
+Sim_WaitObjectFind_Locked(
+    SIM_DEVICE_PROP *pSim,
+    U64              pWaitObject
+    );
+
+static VOID
+Sim_WaitObjectRemove_Locked(
+    SIM_DEVICE_PROP *pSim,
+    SIM_WAIT_OBJECT *pWait
+    );
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Sim_DeviceOpen
+ *
+ * Description:  Selects a device
+ *
+ *****************************************************************************/
+PLX_STATUS
+Sim_DeviceOpen(
+    PLX_DEVICE_OBJECT *pDevice
+    )
+{
+    PLX_STATUS       status;
+    SIM_DEVICE_PROP *pSim;
+
+
+    // Verify model index
+    if (pDevice->Key.ApiIndex >= SIM_MAX_DEVICES)
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    pSim = &Gbl_SimProp[pDevice->Key.ApiIndex];
+
+    pthread_mutex_lock( &Gbl_SimLock_Open );
+
+    // Create the device model on first open
+    if (pSim->OpenCount == 0)
+    {
+        pSim->Index = pDevice->Key.ApiIndex;
+
+        status = Sim_ModelInitialize( pSim );
+        if (status != PLX_STATUS_OK)
+        {
+            pthread_mutex_unlock( &Gbl_SimLock_Open );
+            return status;
+        }
+    }
+
+    // Assign a unique handle to identify resource owner
+    pDevice->hDevice = (PLX_DRIVER_HANDLE)Gbl_SimNextHandle++;
+
+    pSim->OpenCount++;
+
+    pthread_mutex_unlock( &Gbl_SimLock_Open );
+
+    DebugPrintf((
+        "SIM: Opened %04X device (handle=%d count=%d)\n",
+        pDevice->Key.PlxChip, (int)pDevice->hDevice, pSim->OpenCount
+        ));
+
+    // Mark object as valid
+    ObjectValidate( pDevice );
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Sim_DeviceClose
+ *
+ * Description:  Closes a previously opened device & releases its resources
+ *
+ *****************************************************************************/
+PLX_STATUS
+Sim_DeviceClose(
+    PLX_DEVICE_OBJECT *pDevice
+    )
+{
+    U8                channel;
+    SIM_PHYS_MEM    **ppMem;
+    SIM_PHYS_MEM     *pMem;
+    SIM_WAIT_OBJECT  *pWait;
+    SIM_WAIT_OBJECT  *pWaitNext;
+    SIM_DEVICE_PROP  *pSim;
+
+
+    // Verify model index
+    if (pDevice->Key.ApiIndex >= SIM_MAX_DEVICES)
+    {
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    pSim = &Gbl_SimProp[pDevice->Key.ApiIndex];
+
+    pthread_mutex_lock( &Gbl_SimLock_Open );
+
+    // Verify model was opened
+    if (pSim->OpenCount == 0)
+    {
+        pthread_mutex_unlock( &Gbl_SimLock_Open );
+        return PLX_STATUS_INVALID_OBJECT;
+    }
+
+    EnterCriticalSection( &pSim->Lock_Model );
+
+    // Close any DMA channels still owned by the device object
+    for (channel = 0; channel < SIM_MAX_DMA_CHANNELS; channel++)
+    {
+        if (pSim->DmaOwner[channel] == SIM_OWNER(pDevice))
+        {
+            pSim->DmaOwner[channel]   = 0;
+            pSim->bDmaPaused[channel] = FALSE;
+        }
+    }
+
+    // Release buffers owned by the device object
+    ppMem = &pSim->pPhysMemList;
+    while (*ppMem != NULL)
+    {
+        pMem = *ppMem;
+        if (pMem->Owner == SIM_OWNER(pDevice))
+        {
+            *ppMem = pMem->pNext;
+            free( pMem->pBuffer );
+            free( pMem );
+        }
+        else
+        {
+            ppMem = &pMem->pNext;
+        }
+    }
+
+    // Cancel notifications owned by the device object
+    pWait = pSim->pWaitList;
+    while (pWait != NULL)
+    {
+        pWaitNext = pWait->pNext;
+        if (pWait->Owner == SIM_OWNER(pDevice))
+        {
+            Sim_WaitObjectRemove_Locked( pSim, pWait );
+        }
+        pWait = pWaitNext;
+    }
+
+    LeaveCriticalSection( &pSim->Lock_Model );
+
+    // Release the device model on last close
+    pSim->OpenCount--;
+    if (pSim->OpenCount == 0)
+    {
+        Sim_ModelRelease( pSim );
+    }
+
+    pthread_mutex_unlock( &Gbl_SimLock_Open );
+
+    // Clear handle
+    pDevice->hDevice = 0;
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Sim_DeviceFindEx
+ *
+ * Description:  Locates a specific simulated device
+ *
+ *****************************************************************************/
+PLX_STATUS
+Sim_DeviceFindEx(
+    PLX_DEVICE_KEY *pKey,
+    U16             DeviceNumber,
+    PLX_MODE_PROP  *pModeProp
+    )
+{
+    U8             index;
+    U16            devCount;
+    BOOLEAN        bMatch;
+    PLX_DEVICE_KEY SimKey;
+
+
+    devCount = 0;
+
+    for (index = 0; index < SIM_MAX_DEVICES; index++)
+    {
+        Sim_KeyFill( index, &SimKey );
+
+        bMatch = TRUE;
+
+        // Compare Bus, Slot, Fn numbers
+        if ( (pKey->domain   != (U8)PCI_FIELD_IGNORE) ||
+             (pKey->bus      != (U8)PCI_FIELD_IGNORE) ||
+             (pKey->slot     != (U8)PCI_FIELD_IGNORE) ||
+             (pKey->function != (U8)PCI_FIELD_IGNORE) )
+        {
+            if ( (pKey->domain   != SimKey.domain) ||
+                 (pKey->bus      != SimKey.bus)    ||
+                 (pKey->slot     != SimKey.slot)   ||
+                 (pKey->function != SimKey.function) )
+            {
+                bMatch = FALSE;
+            }
+        }
+
+        // Compare device ID information
+        if ( ((pKey->VendorId    != (U16)PCI_FIELD_IGNORE) && (pKey->VendorId    != SimKey.VendorId))    ||
+             ((pKey->DeviceId    != (U16)PCI_FIELD_IGNORE) && (pKey->DeviceId    != SimKey.DeviceId))    ||
+             ((pKey->SubVendorId != (U16)PCI_FIELD_IGNORE) && (pKey->SubVendorId != SimKey.SubVendorId)) ||
+             ((pKey->SubDeviceId != (U16)PCI_FIELD_IGNORE) && (pKey->SubDeviceId != SimKey.SubDeviceId)) ||
+             ((pKey->Revision    != (U8)PCI_FIELD_IGNORE)  && (pKey->Revision    != SimKey.Revision)) )
+        {
+            bMatch = FALSE;
+        }
+
+        if (bMatch)
+        {
+            // Match found, check if it is the desired device
+            if (devCount == DeviceNumber)
+            {
+                DebugPrintf((
+                    "SIM: Criteria matched device %04X %04X [%02X:%02X.%d]\n",
+                    SimKey.DeviceId, SimKey.VendorId,
+                    SimKey.bus, SimKey.slot, SimKey.function
+                    ));
+
+                *pKey = SimKey;
+                return PLX_STATUS_OK;
+            }
+
+            devCount++;
+        }
+    }
+
+    DebugPrintf(("SIM: Criteria did not match any devices\n"));
+    return PLX_STATUS_INVALID_OBJECT;
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  Sim_PlxRegisterRead
+ *
+ * Description:  Reads a register from the simulated BAR 0 register space
+ *
+ ******************************************************************************/
+U32
+Sim_PlxRegisterRead(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset,
+    PLX_STATUS        *pStatus
+    )
+{
+    U32              regVal;
+    SIM_DEVICE_PROP *pSim;
+
+
+    // Verify register offset
+    if ((offset & 0x3) || (offset >= SIM_REG_SPACE_SIZE))
+    {
+        if (pStatus != NULL)
+        {
+            *pStatus = PLX_STATUS_INVALID_OFFSET;
+        }
+        return 0;
+    }
+
+    pSim = &Gbl_SimProp[pDevice->Key.ApiIndex];
+
+    EnterCriticalSection( &pSim->Lock_Model );
+    regVal = SIM_REG( pSim, offset );
+    LeaveCriticalSection( &pSim->Lock_Model );
+
+    if (pStatus != NULL)
+    {
+        *pStatus = PLX_STATUS_OK;
+    }
+
+    return regVal;
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   :  Sim_PlxRegisterWrite
+ *
+ * Description:  Writes a register in the simulated BAR 0 register space
+ *
+ ******************************************************************************/
+PLX_STATUS
+Sim_PlxRegisterWrite(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset,
+    U32                value
+    )
+{
+    SIM_DEVICE_PROP *pSim;
+
+
+    // Verify register offset
+    if ((offset & 0x3) || (offset >= SIM_REG_SPACE_SIZE))
+    {
+        return PLX_STATUS_INVALID_OFFSET;
+    }
+
+    pSim = &Gbl_SimProp[pDevice->Key.ApiIndex];
+
+    EnterCriticalSection( &pSim->Lock_Model );
+    Sim_RegWrite_Locked( pSim, offset, value );
+    LeaveCriticalSection( &pSim->Lock_Model );
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Sim_Dispatch_IoControl
+ *
+ * Description:  Processes the IOCTL messages against the device model
+ *
+ ******************************************************************************/
+S32
+Sim_Dispatch_IoControl(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                IoControlCode,
+    PLX_PARAMS        *pIoBuffer,
+    U32                Size
+    )
+{
+    U8               i;
+    U8               channel;
+    U8              *pVa;
+    U8              *pBuffer;
+    U16              offset;
+    U32              NumPages;
+    U32              BufferSize;
+    U32              OffsetMode;
+    U32              regVal;
+    U64              Owner;
+    SIM_PHYS_MEM    *pMem;
+    SIM_PHYS_MEM   **ppMem;
+    SIM_WAIT_OBJECT *pWait;
+    PLX_DMA_PARAMS  *pDma;
+    PLX_PERF_PROP   *pPerfProp;
+    PLX_INTERRUPT    IntrDone;
+    SIM_DEVICE_PROP *pSim;
+    struct timeval   tv;
+    struct timespec  ts;
+
+
+    DebugPrintf_Cont(("\n"));
+    DebugPrintf(("Received PLX SIM message ===> "));
+
+    pSim  = &Gbl_SimProp[pDevice->Key.ApiIndex];
+    Owner = SIM_OWNER(pDevice);
+
+    // Default to success
+    pIoBuffer->ReturnCode = PLX_STATUS_OK;
+
+    // Get DMA channel for DMA messages
+    channel = (U8)pIoBuffer->value[0];
+
+    EnterCriticalSection( &pSim->Lock_Model );
+
+    // Handle the PLX specific message
+    switch (IoControlCode)
+    {
+        /******************************************
+         * Driver Query Functions
+         *****************************************/
+        case PLX_IOCTL_DRIVER_VERSION:
+            DebugPrintf_Cont(("PLX_IOCTL_DRIVER_VERSION\n"));
+
+            pIoBuffer->value[0] =
+                (PLX_SDK_VERSION_MAJOR << 16) |
+                (PLX_SDK_VERSION_MINOR <<  8) |
+                (0                     <<  0);
+            break;
+
+        case PLX_IOCTL_CHIP_TYPE_GET:
+            DebugPrintf_Cont(("PLX_IOCTL_CHIP_TYPE_GET\n"));
+
+            pIoBuffer->value[0] = Sim_Model[pSim->Index].PlxChip;
+            pIoBuffer->value[1] = Sim_Model[pSim->Index].PlxRevision;
+            break;
+
+        case PLX_IOCTL_GET_PORT_PROPERTIES:
+            DebugPrintf_Cont(("PLX_IOCTL_GET_PORT_PROPERTIES\n"));
+
+            RtlZeroMemory( &pIoBuffer->u.PortProp, sizeof(PLX_PORT_PROP) );
+
+            if (pSim->Index == SIM_DEVICE_9054)
+            {
+                pIoBuffer->u.PortProp.PortType       = PLX_PORT_UNKNOWN;
+                pIoBuffer->u.PortProp.bNonPcieDevice = TRUE;
+            }
+            else
+            {
+                pIoBuffer->u.PortProp.PortType            = PLX_PORT_ENDPOINT;
+                pIoBuffer->u.PortProp.PortNumber          = Sim_Model[pSim->Index].PlxPort;
+                pIoBuffer->u.PortProp.LinkWidth           = 4;
+                pIoBuffer->u.PortProp.MaxLinkWidth        = 4;
+                pIoBuffer->u.PortProp.LinkSpeed           = PLX_LINK_SPEED_5_GBPS;
+                pIoBuffer->u.PortProp.MaxLinkSpeed        = PLX_LINK_SPEED_8_GBPS;
+                pIoBuffer->u.PortProp.MaxReadReqSize      = SIM_PERF_READ_REQ_SIZE;
+                pIoBuffer->u.PortProp.MaxPayloadSize      = SIM_PERF_TLP_PAYLOAD;
+                pIoBuffer->u.PortProp.MaxPayloadSupported = 256;
+            }
+            break;
+
+
+        /******************************************
+         * PCI Register Access Functions
+         *****************************************/
+        case PLX_IOCTL_PCI_REGISTER_READ:
+            DebugPrintf_Cont(("PLX_IOCTL_PCI_REGISTER_READ\n"));
+
+            offset = (U16)pIoBuffer->value[0];
+            if ((offset & 0x3) || (offset >= PCIE_CONFIG_SPACE_SIZE))
+            {
+                pIoBuffer->ReturnCode = PLX_STATUS_INVALID_OFFSET;
+                break;
+            }
+            pIoBuffer->value[1] = pSim->PciCfg[offset / sizeof(U32)];
+            break;
+
+        case PLX_IOCTL_PCI_REGISTER_WRITE:
+            DebugPrintf_Cont(("PLX_IOCTL_PCI_REGISTER_WRITE\n"));
+
+            offset = (U16)pIoBuffer->value[0];
+            if ((offset & 0x3) || (offset >= PCIE_CONFIG_SPACE_SIZE))
+            {
+                pIoBuffer->ReturnCode = PLX_STATUS_INVALID_OFFSET;
+                break;
+            }
+
+            // ID, class & BAR registers are read-only in the model
+            if ((offset != PCI_REG_DEV_VEN_ID) &&
+                (offset != PCI_REG_CLASS_REV) &&
+                ((offset < PCI_REG_BAR_0) || (offset > PCI_REG_T0_BAR_5)))
+            {
+                pSim->PciCfg[offset / sizeof(U32)] = (U32)pIoBuffer->value[1];
+            }
+            break;
+
+
+        /******************************************
+         * PLX-specific Register Access Functions
+         *****************************************/
+        case PLX_IOCTL_REGISTER_READ:
+        case PLX_IOCTL_MAPPED_REGISTER_READ:
+            DebugPrintf_Cont(("PLX_IOCTL_REGISTER_READ\n"));
+
+            offset = (U16)pIoBuffer->value[0];
+            if ((pIoBuffer->value[0] & 0x3) || (pIoBuffer->value[0] >= SIM_REG_SPACE_SIZE))
+            {
+                pIoBuffer->ReturnCode = PLX_STATUS_INVALID_OFFSET;
+                pIoBuffer->value[1]   = 0;
+                break;
+            }
+            pIoBuffer->value[1] = SIM_REG( pSim, offset );
+            break;
+
+        case PLX_IOCTL_REGISTER_WRITE:
+        case PLX_IOCTL_MAPPED_REGISTER_WRITE:
+            DebugPrintf_Cont(("PLX_IOCTL_REGISTER_WRITE\n"));
+
+            offset = (U16)pIoBuffer->value[0];
+            if ((pIoBuffer->value[0] & 0x3) || (pIoBuffer->value[0] >= SIM_REG_SPACE_SIZE))
+            {
+                pIoBuffer->ReturnCode = PLX_STATUS_INVALID_OFFSET;
+                break;
+            }
+            Sim_RegWrite_Locked( pSim, offset, (U32)pIoBuffer->value[1] );
+            break;
+
+        case PLX_IOCTL_MAILBOX_READ:
+        case PLX_IOCTL_MAILBOX_WRITE:
+            DebugPrintf_Cont(("PLX_IOCTL_MAILBOX_READ/WRITE\n"));
+
+            // Mailboxes only exist in 9054 model
+            if (pSim->Index != SIM_DEVICE_9054)
+            {
+                pIoBuffer->ReturnCode = PLX_STATUS_UNSUPPORTED;
+                break;
+            }
+
+            if (pIoBuffer->value[0] > 7)
+            {
+                pIoBuffer->ReturnCode = PLX_STATUS_INVALID_DATA;
+                break;
+            }
+
+            // Mailboxes 0 & 1 are located in the I2O region
+            if (pIoBuffer->value[0] <= 1)
+            {
+                offset = SIM_9054_MAILBOX_BASE_I2O;
+            }
+            else
+            {
+                offset = SIM_9054_MAILBOX_BASE;
+            }
+            offset += (U16)(pIoBuffer->value[0] * sizeof(U32));
+
+            if (IoControlCode == PLX_IOCTL_MAILBOX_READ)
+            {
+                pIoBuffer->value[1] = SIM_REG( pSim, offset );
+            }
+            else
+            {
+                Sim_RegWrite_Locked( pSim, offset, (U32)pIoBuffer->value[1] );
+            }
+            break;
+
+
+        /******************************************
+         * PCI BAR Functions
+         *****************************************/
+        case PLX_IOCTL_PCI_BAR_PROPERTIES:
+            DebugPrintf_Cont(("PLX_IOCTL_PCI_BAR_PROPERTIES\n"));
+
+            RtlZeroMemory( &pIoBuffer->u.BarProp, sizeof(PLX_PCI_BAR_PROP) );
+
+            // BAR 0 is the register space, 9054 BAR 2 is local space 0
+            if (pIoBuffer->value[0] == 0)
+            {
+                pIoBuffer->u.BarProp.Physical = PLX_PTR_TO_INT( pSim->pRegs );
+                pIoBuffer->u.BarProp.Size     = SIM_REG_SPACE_SIZE;
+            }
+            else if ((pIoBuffer->value[0] == 2) && (pSim->pLocalSpace != NULL))
+            {
+                pIoBuffer->u.BarProp.Physical = PLX_PTR_TO_INT( pSim->pLocalSpace );
+                pIoBuffer->u.BarProp.Size     = SIM_LOCAL_SPACE_SIZE;
+            }
+
+            if (pIoBuffer->u.BarProp.Physical != 0)
+            {
+                pIoBuffer->u.BarProp.BarValue = pSim->PciCfg[(PCI_REG_BAR_0 / sizeof(U32)) + pIoBuffer->value[0]];
+                pIoBuffer->u.BarProp.Flags    = PLX_BAR_FLAG_MEM | PLX_BAR_FLAG_32_BIT | PLX_BAR_FLAG_PROBED;
+            }
+            break;
+
+
+        /******************************************
+         * Physical Memory Functions
+         *****************************************/
+        case PLX_IOCTL_PHYSICAL_MEM_ALLOCATE:
+            DebugPrintf_Cont(("PLX_IOCTL_PHYSICAL_MEM_ALLOCATE\n"));
+
+            BufferSize = PEX_P2_ROUND_UP( pIoBuffer->u.PciMemory.Size, getpagesize() );
+            pBuffer    = NULL;
+
+            // Attempt allocation, reducing size if allowed
+            while (BufferSize >= (U32)getpagesize())
+            {
+                if (posix_memalign( (VOID**)&pBuffer, getpagesize(), BufferSize ) == 0)
+                {
+                    break;
+                }
+
+                pBuffer = NULL;
+                if (pIoBuffer->value[0] == FALSE)
+                {
+                    break;
+                }
+                BufferSize = BufferSize >> 1;
+            }
+
+            pMem = malloc( sizeof(SIM_PHYS_MEM) );
+            if ((pBuffer == NULL) || (pMem == NULL))
+            {
+                free( pBuffer );
+                free( pMem );
+                RtlZeroMemory( &pIoBuffer->u.PciMemory, sizeof(PLX_PHYSICAL_MEM) );
+                pIoBuffer->ReturnCode = PLX_STATUS_INSUFFICIENT_RES;
+                break;
+            }
+
+            RtlZeroMemory( pBuffer, BufferSize );
+
+            pMem->Owner   = Owner;
+            pMem->pBuffer = pBuffer;
+            pMem->Size    = BufferSize;
+            pMem->pNext   = pSim->pPhysMemList;
+            pSim->pPhysMemList = pMem;
+
+            pIoBuffer->u.PciMemory.UserAddr     = 0;
+            pIoBuffer->u.PciMemory.PhysicalAddr = PLX_PTR_TO_INT( pBuffer );
+            pIoBuffer->u.PciMemory.CpuPhysical  = PLX_PTR_TO_INT( pBuffer );
+            pIoBuffer->u.PciMemory.Size         = BufferSize;
+            break;
+
+        case PLX_IOCTL_PHYSICAL_MEM_FREE:
+            DebugPrintf_Cont(("PLX_IOCTL_PHYSICAL_MEM_FREE\n"));
+
+            pIoBuffer->ReturnCode = PLX_STATUS_INVALID_DATA;
+
+            ppMem = &pSim->pPhysMemList;
+            while (*ppMem != NULL)
+            {
+                pMem = *ppMem;
+                if (PLX_PTR_TO_INT( pMem->pBuffer ) == pIoBuffer->u.PciMemory.PhysicalAddr)
+                {
+                    *ppMem = pMem->pNext;
+                    free( pMem->pBuffer );
+                    free( pMem );
+                    pIoBuffer->ReturnCode = PLX_STATUS_OK;
+                    break;
+                }
+                ppMem = &pMem->pNext;
+            }
+            break;
+
+        case PLX_IOCTL_COMMON_BUFFER_PROPERTIES:
+            DebugPrintf_Cont(("PLX_IOCTL_COMMON_BUFFER_PROPERTIES\n"));
+
+            pIoBuffer->u.PciMemory.UserAddr     = 0;
+            pIoBuffer->u.PciMemory.PhysicalAddr = PLX_PTR_TO_INT( pSim->pCommonBuffer );
+            pIoBuffer->u.PciMemory.CpuPhysical  = PLX_PTR_TO_INT( pSim->pCommonBuffer );
+            pIoBuffer->u.PciMemory.Size         = SIM_COMMON_BUFFER_SIZE;
+            break;
+
+
+        /******************************************
+         * Interrupt Support Functions
+         *****************************************/
+        case PLX_IOCTL_INTR_ENABLE:
+        case PLX_IOCTL_INTR_DISABLE:
+            DebugPrintf_Cont(("PLX_IOCTL_INTR_ENABLE/DISABLE\n"));
+
+            // PLX_INTERRUPT is bitfields only, so merge it byte-wise
+            for (i = 0; i < sizeof(PLX_INTERRUPT); i++)
+            {
+                if (IoControlCode == PLX_IOCTL_INTR_ENABLE)
+                {
+                    ((U8*)&pSim->IntrEnable)[i] |= ((U8*)&pIoBuffer->u.PlxIntr)[i];
+                }
+                else
+                {
+                    ((U8*)&pSim->IntrEnable)[i] &= ~((U8*)&pIoBuffer->u.PlxIntr)[i];
+                }
+            }
+            break;
+
+        case PLX_IOCTL_NOTIFICATION_REGISTER_FOR:
+            DebugPrintf_Cont(("PLX_IOCTL_NOTIFICATION_REGISTER_FOR\n"));
+
+            pWait = malloc( sizeof(SIM_WAIT_OBJECT) );
+            if (pWait == NULL)
+            {
+                pIoBuffer->ReturnCode = PLX_STATUS_INSUFFICIENT_RES;
+                break;
+            }
+
+            RtlZeroMemory( pWait, sizeof(SIM_WAIT_OBJECT) );
+            pWait->Owner  = Owner;
+            pWait->Notify = pIoBuffer->u.PlxIntr;
+            pthread_cond_init( &pWait->Cond, NULL );
+
+            pWait->pNext    = pSim->pWaitList;
+            pSim->pWaitList = pWait;
+
+            pIoBuffer->value[0] = PLX_PTR_TO_INT( pWait );
+            break;
+
+        case PLX_IOCTL_NOTIFICATION_WAIT:
+            DebugPrintf_Cont(("PLX_IOCTL_NOTIFICATION_WAIT\n"));
+
+            pWait = Sim_WaitObjectFind_Locked( pSim, pIoBuffer->value[0] );
+            if (pWait == NULL)
+            {
+                pIoBuffer->ReturnCode = PLX_STATUS_INVALID_OBJECT;
+                break;
+            }
+
+            // Calculate absolute time to stop waiting
+            gettimeofday( &tv, NULL );
+            ts.tv_sec  = tv.tv_sec + (pIoBuffer->value[1] / 1000);
+            ts.tv_nsec = (tv.tv_usec * 1000) + ((pIoBuffer->value[1] % 1000) * 1000000);
+            if (ts.tv_nsec >= 1000000000)
+            {
+                ts.tv_sec++;
+                ts.tv_nsec -= 1000000000;
+            }
+
+            pWait->WaitCount++;
+
+            while ((pWait->bSignalled == FALSE) && (pWait->bCanceled == FALSE))
+            {
+                if (pIoBuffer->value[1] == PLX_TIMEOUT_INFINITE)
+                {
+                    pthread_cond_wait( &pWait->Cond, &pSim->Lock_Model );
+                }
+                else if (pthread_cond_timedwait(
+                             &pWait->Cond,
+                             &pSim->Lock_Model,
+                             &ts
+                             ) != 0)
+                {
+                    break;
+                }
+            }
+
+            pWait->WaitCount--;
+
+            if (pWait->bCanceled)
+            {
+                pIoBuffer->ReturnCode = PLX_STATUS_CANCELED;
+
+                // Last waiter releases a cancelled object
+                if (pWait->WaitCount == 0)
+                {
+                    pthread_cond_destroy( &pWait->Cond );
+                    free( pWait );
+                }
+            }
+            else if (pWait->bSignalled)
+            {
+                // Reset for next wait
+                pWait->bSignalled = FALSE;
+            }
+            else
+            {
+                pSim->Stats.NotifyTimeouts++;
+                pIoBuffer->ReturnCode = PLX_STATUS_TIMEOUT;
+            }
+            break;
+
+        case PLX_IOCTL_NOTIFICATION_STATUS:
+            DebugPrintf_Cont(("PLX_IOCTL_NOTIFICATION_STATUS\n"));
+
+            pWait = Sim_WaitObjectFind_Locked( pSim, pIoBuffer->value[0] );
+            if (pWait == NULL)
+            {
+                pIoBuffer->ReturnCode = PLX_STATUS_INVALID_OBJECT;
+                break;
+            }
+
+            // Report & clear triggered sources
+            pIoBuffer->u.PlxIntr = pWait->Source;
+            RtlZeroMemory( &pWait->Source, sizeof(PLX_INTERRUPT) );
+            break;
+
+        case PLX_IOCTL_NOTIFICATION_CANCEL:
+            DebugPrintf_Cont(("PLX_IOCTL_NOTIFICATION_CANCEL\n"));
+
+            pWait = Sim_WaitObjectFind_Locked( pSim, pIoBuffer->value[0] );
+            if (pWait == NULL)
+            {
+                pIoBuffer->ReturnCode = PLX_STATUS_INVALID_OBJECT;
+                break;
+            }
+
+            Sim_WaitObjectRemove_Locked( pSim, pWait );
+            break;
+
+
+        /******************************************
+         * DMA Functions
+         *****************************************/
+        case PLX_IOCTL_DMA_CHANNEL_OPEN:
+            DebugPrintf_Cont(("PLX_IOCTL_DMA_CHANNEL_OPEN\n"));
+
+            if (channel >= Sim_Model[pSim->Index].NumDmaChannels)
+            {
+                pIoBuffer->ReturnCode = PLX_STATUS_INVALID_ACCESS;
+                break;
+            }
+
+            if (pSim->DmaOwner[channel] != 0)
+            {
+                pIoBuffer->ReturnCode = PLX_STATUS_IN_USE;
+                break;
+            }
+
+            pSim->DmaOwner[channel]   = Owner;
+            pSim->bDmaPaused[channel] = FALSE;
+            RtlZeroMemory( &pSim->DmaProp[channel], sizeof(PLX_DMA_PROP) );
+            break;
+
+        case PLX_IOCTL_DMA_GET_PROPERTIES:
+        case PLX_IOCTL_DMA_SET_PROPERTIES:
+        case PLX_IOCTL_DMA_CONTROL:
+        case PLX_IOCTL_DMA_STATUS:
+        case PLX_IOCTL_DMA_TRANSFER_BLOCK:
+        case PLX_IOCTL_DMA_TRANSFER_USER_BUFFER:
+        case PLX_IOCTL_DMA_CHANNEL_CLOSE:
+            DebugPrintf_Cont(("PLX_IOCTL_DMA_xxx (%08Xh)\n", IoControlCode));
+
+            // Verify channel & ownership common to all DMA messages
+            if (channel >= Sim_Model[pSim->Index].NumDmaChannels)
+            {
+                pIoBuffer->ReturnCode = PLX_STATUS_INVALID_ACCESS;
+                break;
+            }
+
+            if (pSim->DmaOwner[channel] == 0)
+            {
+                pIoBuffer->ReturnCode = PLX_STATUS_INVALID_ACCESS;
+                break;
+            }
+
+            if (pSim->DmaOwner[channel] != Owner)
+            {
+                pIoBuffer->ReturnCode = PLX_STATUS_IN_USE;
+                break;
+            }
+
+            if (IoControlCode == PLX_IOCTL_DMA_GET_PROPERTIES)
+            {
+                pIoBuffer->u.DmaProp = pSim->DmaProp[channel];
+            }
+            else if (IoControlCode == PLX_IOCTL_DMA_SET_PROPERTIES)
+            {
+                pSim->DmaProp[channel] = pIoBuffer->u.DmaProp;
+            }
+            else if (IoControlCode == PLX_IOCTL_DMA_CONTROL)
+            {
+                switch (pIoBuffer->value[1])
+                {
+                    case DmaPause:
+                    case DmaPauseImmediate:
+                        pSim->bDmaPaused[channel] = TRUE;
+                        break;
+
+                    case DmaResume:
+                    case DmaAbort:
+                        pSim->bDmaPaused[channel] = FALSE;
+                        break;
+
+                    default:
+                        pIoBuffer->ReturnCode = PLX_STATUS_INVALID_DATA;
+                        break;
+                }
+            }
+            else if (IoControlCode == PLX_IOCTL_DMA_STATUS)
+            {
+                // Model transfers complete synchronously
+                if (pSim->bDmaPaused[channel])
+                {
+                    pIoBuffer->ReturnCode = PLX_STATUS_PAUSED;
+                }
+                else
+                {
+                    pIoBuffer->ReturnCode = PLX_STATUS_COMPLETE;
+                }
+            }
+            else if (IoControlCode == PLX_IOCTL_DMA_CHANNEL_CLOSE)
+            {
+                pSim->DmaOwner[channel]   = 0;
+                pSim->bDmaPaused[channel] = FALSE;
+            }
+            else if (pSim->bDmaPaused[channel])
+            {
+                pIoBuffer->ReturnCode = PLX_STATUS_PAUSED;
+            }
+            else if (IoControlCode == PLX_IOCTL_DMA_TRANSFER_BLOCK)
+            {
+                pDma = &pIoBuffer->u.TxParams;
+
+                // Program the registers as the driver would, then start DMA
+                if (pSim->Index == SIM_DEVICE_9054)
+                {
+                    // Verify addresses before starting engine
+                    if ( (Sim_BusAddrToVa( pSim, pDma->PciAddr, pDma->ByteCount ) == NULL) ||
+                         (((U64)pDma->LocalAddr + pDma->ByteCount) > SIM_LOCAL_SPACE_SIZE) )
+                    {
+                        pIoBuffer->ReturnCode = PLX_STATUS_INVALID_ADDR;
+                        break;
+                    }
+
+                    OffsetMode = (channel == 0) ? SIM_9054_DMA0_MODE : SIM_9054_DMA1_MODE;
+
+                    // Route interrupt to PCI ([17]) & set done interrupt ([10])
+                    regVal = SIM_REG( pSim, OffsetMode ) & ~((1 << 9) | (1 << 10) | (1 << 18));
+                    regVal |= (1 << 17);
+                    if (pDma->bIgnoreBlockInt == FALSE)
+                    {
+                        regVal |= (1 << 10);
+                    }
+
+                    Sim_RegWrite_Locked( pSim, OffsetMode, regVal );
+                    Sim_RegWrite_Locked( pSim, OffsetMode + 0x4, PLX_64_LOW_32(pDma->PciAddr) );
+                    Sim_RegWrite_Locked( pSim, OffsetMode + 0x8, pDma->LocalAddr );
+                    Sim_RegWrite_Locked( pSim, OffsetMode + 0xC, pDma->ByteCount );
+                    Sim_RegWrite_Locked(
+                        pSim,
+                        OffsetMode + 0x10,
+                        (pDma->Direction == PLX_DMA_LOC_TO_PCI) ? (1 << 3) : 0
+                        );
+                    Sim_RegWrite_Locked(
+                        pSim,
+                        SIM_9054_DMA0_PCI_DAC + (channel * sizeof(U32)),
+                        PLX_64_HIGH_32(pDma->PciAddr)
+                        );
+
+                    // Enable ([0]) & start ([1]) channel
+                    regVal = SIM_REG( pSim, SIM_9054_DMA_COMMAND_STAT );
+                    Sim_RegWrite_Locked(
+                        pSim,
+                        SIM_9054_DMA_COMMAND_STAT,
+                        regVal | (((1 << 0) | (1 << 1)) << (channel * 8))
+                        );
+                }
+                else
+                {
+                    // Verify addresses before starting engine
+                    if ( (Sim_BusAddrToVa(
+                              pSim,
+                              pDma->AddrSource,
+                              pDma->bConstAddrSrc ? sizeof(U32) : pDma->ByteCount
+                              ) == NULL) ||
+                         (Sim_BusAddrToVa(
+                              pSim,
+                              pDma->AddrDest,
+                              pDma->bConstAddrDest ? sizeof(U32) : pDma->ByteCount
+                              ) == NULL) )
+                    {
+                        pIoBuffer->ReturnCode = PLX_STATUS_INVALID_ADDR;
+                        break;
+                    }
+
+                    OffsetMode = SIM_8000_DMA_BASE(channel);
+
+                    Sim_RegWrite_Locked( pSim, OffsetMode + SIM_8000_DMA_SRC_LOW,   PLX_64_LOW_32(pDma->AddrSource) );
+                    Sim_RegWrite_Locked( pSim, OffsetMode + SIM_8000_DMA_SRC_HIGH,  PLX_64_HIGH_32(pDma->AddrSource) );
+                    Sim_RegWrite_Locked( pSim, OffsetMode + SIM_8000_DMA_DEST_LOW,  PLX_64_LOW_32(pDma->AddrDest) );
+                    Sim_RegWrite_Locked( pSim, OffsetMode + SIM_8000_DMA_DEST_HIGH, PLX_64_HIGH_32(pDma->AddrDest) );
+
+                    // Valid ([31]), interrupt ([30]), constant addresses ([29:28]) & count
+                    regVal =
+                        ((U32)1                   << 31) |
+                        ((U32)pDma->bConstAddrSrc  << 29) |
+                        ((U32)pDma->bConstAddrDest << 28) |
+                        (pDma->ByteCount & 0x07FFFFFF);
+                    if (pDma->bIgnoreBlockInt == FALSE)
+                    {
+                        regVal |= (1 << 30);
+                    }
+                    Sim_RegWrite_Locked( pSim, OffsetMode + SIM_8000_DMA_COUNT, regVal );
+
+                    // Start DMA ([3])
+                    regVal = SIM_REG( pSim, OffsetMode + SIM_8000_DMA_CTRL_STAT );
+                    Sim_RegWrite_Locked(
+                        pSim,
+                        OffsetMode + SIM_8000_DMA_CTRL_STAT,
+                        regVal | (1 << 3)
+                        );
+                }
+            }
+            else
+            {
+                // PLX_IOCTL_DMA_TRANSFER_USER_BUFFER
+                pDma    = &pIoBuffer->u.TxParams;
+                pBuffer = PLX_INT_TO_PTR( pDma->UserVa );
+
+                if ((pBuffer == NULL) || (pDma->ByteCount == 0))
+                {
+                    pIoBuffer->ReturnCode = PLX_STATUS_INVALID_DATA;
+                    break;
+                }
+
+                // Get the device side of the transfer
+                if (pSim->Index == SIM_DEVICE_9054)
+                {
+                    if (((U64)pDma->LocalAddr + pDma->ByteCount) > SIM_LOCAL_SPACE_SIZE)
+                    {
+                        pVa = NULL;
+                    }
+                    else
+                    {
+                        pVa = pSim->pLocalSpace + pDma->LocalAddr;
+                    }
+                }
+                else
+                {
+                    pVa = Sim_BusAddrToVa( pSim, pDma->PciAddr, pDma->ByteCount );
+                }
+
+                if (pVa == NULL)
+                {
+                    pIoBuffer->ReturnCode = PLX_STATUS_INVALID_ADDR;
+                    break;
+                }
+
+                // PLX_DMA_PCI_TO_LOC & PLX_DMA_USER_TO_PCI share the same value
+                if (pDma->Direction == PLX_DMA_USER_TO_PCI)
+                {
+                    memcpy( pVa, pBuffer, pDma->ByteCount );
+                    Sim_PerfAccount_Locked( pSim, pDma->ByteCount, pDma->ByteCount );
+                }
+                else
+                {
+                    memcpy( pBuffer, pVa, pDma->ByteCount );
+                    Sim_PerfAccount_Locked( pSim, pDma->ByteCount, pDma->ByteCount );
+                }
+
+                // Account for the user buffer pages & SGL as the driver would
+                NumPages =
+                    (U32)(((pDma->UserVa & (SIM_PAGE_SIZE - 1)) + pDma->ByteCount +
+                           (SIM_PAGE_SIZE - 1)) / SIM_PAGE_SIZE);
+                pSim->Stats.DmaBytes[channel] += pDma->ByteCount;
+                pSim->Stats.DmaTransfers[channel]++;
+                pSim->Stats.PagesPinned       += NumPages;
+                pSim->Stats.SglDescriptors    += NumPages;
+
+                // SGL transfers always signal completion
+                RtlZeroMemory( &IntrDone, sizeof(PLX_INTERRUPT) );
+                IntrDone.DmaDone = (1 << channel);
+                Sim_InterruptTrigger_Locked( pSim, &IntrDone );
+            }
+            break;
+
+
+        /******************************************
+         * Performance Monitor Functions
+         *****************************************/
+        case PLX_IOCTL_PERFORMANCE_INIT_PROPERTIES:
+        case PLX_IOCTL_PERFORMANCE_MONITOR_CTRL:
+        case PLX_IOCTL_PERFORMANCE_RESET_COUNTERS:
+        case PLX_IOCTL_PERFORMANCE_GET_COUNTERS:
+            DebugPrintf_Cont(("PLX_IOCTL_PERFORMANCE_xxx (%08Xh)\n", IoControlCode));
+
+            // Only the PCIe model implements performance counters
+            if (pSim->Index != SIM_DEVICE_8000_DMA)
+            {
+                pIoBuffer->ReturnCode = PLX_STATUS_UNSUPPORTED;
+                break;
+            }
+
+            if (IoControlCode == PLX_IOCTL_PERFORMANCE_INIT_PROPERTIES)
+            {
+                pPerfProp = PLX_INT_TO_PTR( pIoBuffer->value[0] );
+
+                RtlZeroMemory( pPerfProp, sizeof(PLX_PERF_PROP) );
+                pPerfProp->PlxFamily   = Sim_Model[pSim->Index].PlxFamily;
+                pPerfProp->PortNumber  = Sim_Model[pSim->Index].PlxPort;
+                pPerfProp->LinkWidth   = 4;
+                pPerfProp->LinkSpeed   = PLX_LINK_SPEED_5_GBPS;
+                pPerfProp->Station     = 0;
+                pPerfProp->StationPort = Sim_Model[pSim->Index].PlxPort;
+            }
+            else if (IoControlCode == PLX_IOCTL_PERFORMANCE_MONITOR_CTRL)
+            {
+                pSim->bPerfEnabled = (pIoBuffer->value[0] == PLX_PERF_CMD_START);
+            }
+            else if (IoControlCode == PLX_IOCTL_PERFORMANCE_RESET_COUNTERS)
+            {
+                RtlZeroMemory( pSim->PerfCounter, sizeof(pSim->PerfCounter) );
+            }
+            else
+            {
+                pPerfProp = PLX_INT_TO_PTR( pIoBuffer->value[0] );
+
+                for (i = 0; i < (U8)pIoBuffer->value[1]; i++)
+                {
+                    // Save current values to previous
+                    RtlCopyMemory(
+                        &(pPerfProp[i].Prev_IngressPostedHeader),
+                        &(pPerfProp[i].IngressPostedHeader),
+                        PERF_COUNTERS_PER_PORT * sizeof(U32)
+                        );
+
+                    // Only the model port has traffic
+                    if (pPerfProp[i].PortNumber == Sim_Model[pSim->Index].PlxPort)
+                    {
+                        RtlCopyMemory(
+                            &(pPerfProp[i].IngressPostedHeader),
+                            pSim->PerfCounter,
+                            PERF_COUNTERS_PER_PORT * sizeof(U32)
+                            );
+                    }
+                }
+            }
+            break;
+
+
+        /******************************************
+         * Driver Statistics
+         *****************************************/
+        case PLX_IOCTL_DEVICE_GET_STATS:
+            DebugPrintf_Cont(("PLX_IOCTL_DEVICE_GET_STATS\n"));
+
+            RtlCopyMemory(
+                PLX_INT_TO_PTR( pIoBuffer->value[0] ),
+                &pSim->Stats,
+                sizeof(PLX_DEVICE_STATS)
+                );
+            break;
+
+
+        /******************************************
+         * Unsupported Messages
+         *****************************************/
+        default:
+            DebugPrintf_Cont((
+                "Unsupported PLX_IOCTL_Xxx (%08Xh)\n",
+                IoControlCode
+                ));
+
+            pIoBuffer->ReturnCode = PLX_STATUS_UNSUPPORTED;
+            break;
+    }
+
+    LeaveCriticalSection( &pSim->Lock_Model );
+
+    DebugPrintf(("...Completed message\n"));
+    return 0;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Sim_KeyFill
+ *
+ * Description:  Fills in the device key of a simulated device model
+ *
+ *****************************************************************************/
+static VOID
+Sim_KeyFill(
+    U8              index,
+    PLX_DEVICE_KEY *pKey
+    )
+{
+    RtlZeroMemory( pKey, sizeof(PLX_DEVICE_KEY) );
+
+    pKey->domain      = 0;
+    pKey->bus         = Sim_Model[index].bus;
+    pKey->slot        = 0;
+    pKey->function    = Sim_Model[index].function;
+    pKey->VendorId    = PLX_PCI_VENDOR_ID_PLX;
+    pKey->DeviceId    = Sim_Model[index].DeviceId;
+    pKey->SubVendorId = PLX_PCI_VENDOR_ID_PLX;
+    pKey->SubDeviceId = Sim_Model[index].DeviceId;
+    pKey->Revision    = Sim_Model[index].Revision;
+    pKey->PlxChip     = Sim_Model[index].PlxChip;
+    pKey->ChipID      = Sim_Model[index].PlxChip;
+    pKey->PlxRevision = Sim_Model[index].PlxRevision;
+    pKey->PlxFamily   = Sim_Model[index].PlxFamily;
+    pKey->PlxPort     = Sim_Model[index].PlxPort;
+    pKey->PlxPortType = Sim_Model[index].PlxPortType;
+    pKey->ApiIndex    = index;
+    pKey->ApiMode     = PLX_API_MODE_SIMULATED;
+
+    ObjectValidate( pKey );
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Sim_ModelInitialize
+ *
+ * Description:  Allocates resources of a device model & sets reset values
+ *
+ *****************************************************************************/
+static PLX_STATUS
+Sim_ModelInitialize(
+    SIM_DEVICE_PROP *pSim
+    )
+{
+    U8 index;
+
+
+    index = pSim->Index;
+
+    RtlZeroMemory( pSim, sizeof(SIM_DEVICE_PROP) );
+    pSim->Index = index;
+
+    // Allocate page-aligned spaces so they can be provided as BAR mappings
+    if (posix_memalign( (VOID**)&pSim->pRegs, getpagesize(), SIM_REG_SPACE_SIZE ) != 0)
+    {
+        pSim->pRegs = NULL;
+    }
+
+    if (posix_memalign( (VOID**)&pSim->pCommonBuffer, getpagesize(), SIM_COMMON_BUFFER_SIZE ) != 0)
+    {
+        pSim->pCommonBuffer = NULL;
+    }
+
+    if (index == SIM_DEVICE_9054)
+    {
+        if (posix_memalign( (VOID**)&pSim->pLocalSpace, getpagesize(), SIM_LOCAL_SPACE_SIZE ) != 0)
+        {
+            pSim->pLocalSpace = NULL;
+        }
+    }
+
+    if ( (pSim->pRegs == NULL) || (pSim->pCommonBuffer == NULL) ||
+         ((index == SIM_DEVICE_9054) && (pSim->pLocalSpace == NULL)) )
+    {
+        Sim_ModelRelease( pSim );
+        return PLX_STATUS_INSUFFICIENT_RES;
+    }
+
+    RtlZeroMemory( pSim->pRegs, SIM_REG_SPACE_SIZE );
+    RtlZeroMemory( pSim->pCommonBuffer, SIM_COMMON_BUFFER_SIZE );
+    if (pSim->pLocalSpace != NULL)
+    {
+        RtlZeroMemory( pSim->pLocalSpace, SIM_LOCAL_SPACE_SIZE );
+    }
+
+    // PCI configuration space header
+    pSim->PciCfg[PCI_REG_DEV_VEN_ID / sizeof(U32)] =
+        ((U32)Sim_Model[index].DeviceId << 16) | PLX_PCI_VENDOR_ID_PLX;
+    pSim->PciCfg[PCI_REG_CMD_STAT / sizeof(U32)] = 0x00100006;
+    pSim->PciCfg[PCI_REG_CLASS_REV / sizeof(U32)] =
+        ((U32)0x068000 << 8) | Sim_Model[index].Revision;
+    pSim->PciCfg[PCI_REG_TO_SUBSYS_ID / sizeof(U32)] =
+        ((U32)Sim_Model[index].DeviceId << 16) | PLX_PCI_VENDOR_ID_PLX;
+
+    // BAR registers reflect the low 32-bits of the process address of each space
+    pSim->PciCfg[PCI_REG_BAR_0 / sizeof(U32)] = PLX_64_LOW_32( PLX_PTR_TO_INT(pSim->pRegs) );
+    if (pSim->pLocalSpace != NULL)
+    {
+        pSim->PciCfg[PCI_REG_T0_BAR_2 / sizeof(U32)] = PLX_64_LOW_32( PLX_PTR_TO_INT(pSim->pLocalSpace) );
+    }
+
+    // All DMA channels idle
+    if (index == SIM_DEVICE_9054)
+    {
+        // Channel done ([4],[12])
+        SIM_REG( pSim, SIM_9054_DMA_COMMAND_STAT ) = (1 << 4) | (1 << 12);
+    }
+
+    InitializeCriticalSection( &pSim->Lock_Model );
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Sim_ModelRelease
+ *
+ * Description:  Releases all resources of a device model
+ *
+ *****************************************************************************/
+static VOID
+Sim_ModelRelease(
+    SIM_DEVICE_PROP *pSim
+    )
+{
+    SIM_PHYS_MEM    *pMem;
+    SIM_WAIT_OBJECT *pWait;
+
+
+    while (pSim->pPhysMemList != NULL)
+    {
+        pMem = pSim->pPhysMemList;
+        pSim->pPhysMemList = pMem->pNext;
+        free( pMem->pBuffer );
+        free( pMem );
+    }
+
+    while (pSim->pWaitList != NULL)
+    {
+        pWait = pSim->pWaitList;
+        pSim->pWaitList = pWait->pNext;
+        pthread_cond_destroy( &pWait->Cond );
+        free( pWait );
+    }
+
+    free( pSim->pRegs );
+    free( pSim->pLocalSpace );
+    free( pSim->pCommonBuffer );
+
+    pSim->pRegs         = NULL;
+    pSim->pLocalSpace   = NULL;
+    pSim->pCommonBuffer = NULL;
+
+    DeleteCriticalSection( &pSim->Lock_Model );
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Sim_RegWrite_Locked
+ *
+ * Description:  Writes a model register & applies any hardware side-effects
+ *
+ * Note       :  Caller must hold the model lock
+ *
+ *****************************************************************************/
+static VOID
+Sim_RegWrite_Locked(
+    SIM_DEVICE_PROP *pSim,
+    U32              offset,
+    U32              value
+    )
+{
+    U8            channel;
+    U32           regVal;
+    U32           shift;
+    U32           OffsetBase;
+    PLX_INTERRUPT IntrSource;
+
+
+    RtlZeroMemory( &IntrSource, sizeof(PLX_INTERRUPT) );
+
+    if (pSim->Index == SIM_DEVICE_9054)
+    {
+        switch (offset)
+        {
+            case SIM_9054_P2L_DOORBELL:
+                // Local CPU model echoes PCI-to-Local doorbells back to PCI
+                SIM_REG( pSim, SIM_9054_L2P_DOORBELL ) |= value;
+                if (pSim->IntrEnable.Doorbell != 0)
+                {
+                    IntrSource.Doorbell = value;
+                    Sim_InterruptTrigger_Locked( pSim, &IntrSource );
+                }
+                return;
+
+            case SIM_9054_L2P_DOORBELL:
+                // Local-to-PCI doorbells are write-1-to-clear from PCI
+                SIM_REG( pSim, SIM_9054_L2P_DOORBELL ) &= ~value;
+                return;
+
+            case SIM_9054_DMA_COMMAND_STAT:
+                for (channel = 0; channel < 2; channel++)
+                {
+                    shift  = channel * 8;
+                    regVal = (value >> shift) & 0xFF;
+
+                    // Preserve read-only channel done ([4]) & self-clear ([3:1])
+                    regVal = (regVal & (1 << 0)) |
+                             ((SIM_REG( pSim, offset ) >> shift) & (1 << 4));
+
+                    SIM_REG( pSim, offset ) &= ~(0xFF << shift);
+                    SIM_REG( pSim, offset ) |= (regVal << shift);
+
+                    // Start ([1]) an enabled ([0]) channel
+                    if ((value & (((1 << 0) | (1 << 1)) << shift)) == (((1 << 0) | (1 << 1)) << shift))
+                    {
+                        Sim_DmaExecute_Locked( pSim, channel );
+                    }
+                }
+                return;
+
+            default:
+                break;
+        }
+    }
+    else
+    {
+        // Check for DMA channel control/status registers
+        for (channel = 0; channel < SIM_MAX_DMA_CHANNELS; channel++)
+        {
+            OffsetBase = SIM_8000_DMA_BASE(channel);
+
+            if (offset == (OffsetBase + SIM_8000_DMA_CTRL_STAT))
+            {
+                // Status bits ([31,12:8]) are write-1-to-clear, in progress ([30]) is read-only
+                regVal = SIM_REG( pSim, offset ) & (((U32)1 << 31) | (0x1F << 8));
+                regVal &= ~(value & (((U32)1 << 31) | (0x1F << 8)));
+                regVal |= value & ~(((U32)1 << 31) | (1 << 30) | (0x1F << 8) | (1 << 3));
+                SIM_REG( pSim, offset ) = regVal;
+
+                // Start ([3]) unless paused ([0])
+                if ((value & (1 << 3)) && ((value & (1 << 0)) == 0))
+                {
+                    Sim_DmaExecute_Locked( pSim, channel );
+                }
+                return;
+            }
+
+            if (offset == (OffsetBase + SIM_8000_DMA_INT_CTRL_STAT))
+            {
+                // Interrupt status ([21:16]) is write-1-to-clear
+                regVal = SIM_REG( pSim, offset ) & (0x3F << 16);
+                regVal &= ~(value & (0x3F << 16));
+                SIM_REG( pSim, offset ) = regVal | (value & ~(0x3F << 16));
+                return;
+            }
+        }
+    }
+
+    // No side-effects, just store value
+    SIM_REG( pSim, offset ) = value;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Sim_BusAddrToVa
+ *
+ * Description:  Translates a simulated bus address range to a process address
+ *
+ *****************************************************************************/
+static U8*
+Sim_BusAddrToVa(
+    SIM_DEVICE_PROP *pSim,
+    U64              BusAddr,
+    U32              ByteCount
+    )
+{
+    SIM_PHYS_MEM *pMem;
+
+
+    // Verify range does not wrap
+    if ((BusAddr == 0) || ((BusAddr + ByteCount) < BusAddr))
+    {
+        return NULL;
+    }
+
+    // Check common buffer
+    if ( (BusAddr >= PLX_PTR_TO_INT(pSim->pCommonBuffer)) &&
+         ((BusAddr + ByteCount) <= (PLX_PTR_TO_INT(pSim->pCommonBuffer) + SIM_COMMON_BUFFER_SIZE)) )
+    {
+        return PLX_INT_TO_PTR( BusAddr );
+    }
+
+    // Check allocated buffers of all owners
+    pMem = pSim->pPhysMemList;
+    while (pMem != NULL)
+    {
+        if ( (BusAddr >= PLX_PTR_TO_INT(pMem->pBuffer)) &&
+             ((BusAddr + ByteCount) <= (PLX_PTR_TO_INT(pMem->pBuffer) + pMem->Size)) )
+        {
+            return PLX_INT_TO_PTR( BusAddr );
+        }
+        pMem = pMem->pNext;
+    }
+
+    DebugPrintf((
+        "SIM: ERROR - Bus address %08llX (%d bytes) not in a simulated buffer\n",
+        (unsigned long long)BusAddr, ByteCount
+        ));
+
+    return NULL;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Sim_DmaExecute_Locked
+ *
+ * Description:  Runs a block DMA from the channel registers to completion
+ *
+ * Note       :  Caller must hold the model lock
+ *
+ *****************************************************************************/
+static PLX_STATUS
+Sim_DmaExecute_Locked(
+    SIM_DEVICE_PROP *pSim,
+    U8               channel
+    )
+{
+    U8           *pSrc;
+    U8           *pDest;
+    U32           i;
+    U32           count;
+    U32           OffsetBase;
+    U32           regCount;
+    U64           AddrSrc;
+    U64           AddrDest;
+    BOOLEAN       bConstSrc;
+    BOOLEAN       bConstDest;
+    BOOLEAN       bIntEnable;
+    PLX_INTERRUPT IntrSource;
+
+
+    RtlZeroMemory( &IntrSource, sizeof(PLX_INTERRUPT) );
+
+    if (pSim->Index == SIM_DEVICE_9054)
+    {
+        OffsetBase = (channel == 0) ? SIM_9054_DMA0_MODE : SIM_9054_DMA1_MODE;
+
+        count   = SIM_REG( pSim, OffsetBase + 0xC ) & 0x7FFFFF;
+        AddrSrc = ((U64)SIM_REG( pSim, SIM_9054_DMA0_PCI_DAC + (channel * sizeof(U32)) ) << 32) |
+                  SIM_REG( pSim, OffsetBase + 0x4 );
+
+        // Default to PCI-to-Local, source is PCI buffer & destination is local space
+        pSrc  = Sim_BusAddrToVa( pSim, AddrSrc, count );
+        pDest = pSim->pLocalSpace + (SIM_REG( pSim, OffsetBase + 0x8 ) % SIM_LOCAL_SPACE_SIZE);
+
+        if ((pSrc == NULL) ||
+            ((pDest + count) > (pSim->pLocalSpace + SIM_LOCAL_SPACE_SIZE)))
+        {
+            DebugPrintf(("SIM: ERROR - 9054 DMA %d address invalid\n", channel));
+            SIM_REG( pSim, SIM_9054_DMA_COMMAND_STAT ) |= ((1 << 4) << (channel * 8));
+            return PLX_STATUS_INVALID_ADDR;
+        }
+
+        // Descriptor pointer [3] selects Local-to-PCI direction
+        if (SIM_REG( pSim, OffsetBase + 0x10 ) & (1 << 3))
+        {
+            memmove( pSrc, pDest, count );
+            Sim_PerfAccount_Locked( pSim, 0, count );
+        }
+        else
+        {
+            memmove( pDest, pSrc, count );
+            Sim_PerfAccount_Locked( pSim, count, 0 );
+        }
+
+        // Set channel done ([4])
+        SIM_REG( pSim, SIM_9054_DMA_COMMAND_STAT ) |= ((1 << 4) << (channel * 8));
+
+        // Done interrupt enabled ([10]) & routed to PCI ([17])
+        bIntEnable = ((SIM_REG( pSim, OffsetBase ) & ((1 << 10) | (1 << 17))) == ((1 << 10) | (1 << 17)));
+        if (bIntEnable)
+        {
+            // Channel interrupt active in INTCSR ([21],[22])
+            SIM_REG( pSim, SIM_9054_INT_CTRL_STAT ) |= ((1 << 21) << channel);
+        }
+    }
+    else
+    {
+        OffsetBase = SIM_8000_DMA_BASE(channel);
+
+        regCount   = SIM_REG( pSim, OffsetBase + SIM_8000_DMA_COUNT );
+        count      = regCount & 0x07FFFFFF;
+        bIntEnable = (regCount & (1 << 30)) ? TRUE : FALSE;
+        bConstSrc  = (regCount & (1 << 29)) ? TRUE : FALSE;
+        bConstDest = (regCount & (1 << 28)) ? TRUE : FALSE;
+
+        AddrSrc  = ((U64)SIM_REG( pSim, OffsetBase + SIM_8000_DMA_SRC_HIGH ) << 32) |
+                   SIM_REG( pSim, OffsetBase + SIM_8000_DMA_SRC_LOW );
+        AddrDest = ((U64)SIM_REG( pSim, OffsetBase + SIM_8000_DMA_DEST_HIGH ) << 32) |
+                   SIM_REG( pSim, OffsetBase + SIM_8000_DMA_DEST_LOW );
+
+        pSrc  = Sim_BusAddrToVa( pSim, AddrSrc, bConstSrc ? sizeof(U32) : count );
+        pDest = Sim_BusAddrToVa( pSim, AddrDest, bConstDest ? sizeof(U32) : count );
+
+        if ( ((regCount & ((U32)1 << 31)) == 0) || (pSrc == NULL) || (pDest == NULL) )
+        {
+            DebugPrintf(("SIM: ERROR - 8000 DMA %d descriptor invalid\n", channel));
+
+            // Flag error ([16]) & report if enabled ([0])
+            SIM_REG( pSim, OffsetBase + SIM_8000_DMA_INT_CTRL_STAT ) |= (1 << 16);
+            if (SIM_REG( pSim, OffsetBase + SIM_8000_DMA_INT_CTRL_STAT ) & (1 << 0))
+            {
+                IntrSource.DmaError = (1 << channel);
+                Sim_InterruptTrigger_Locked( pSim, &IntrSource );
+            }
+            return PLX_STATUS_INVALID_ADDR;
+        }
+
+        if ((bConstSrc == FALSE) && (bConstDest == FALSE))
+        {
+            memmove( pDest, pSrc, count );
+        }
+        else
+        {
+            // Constant address transfers move a DWORD at a time
+            for (i = 0; (i + sizeof(U32)) <= count; i += sizeof(U32))
+            {
+                *(U32*)(pDest + (bConstDest ? 0 : i)) = *(U32*)(pSrc + (bConstSrc ? 0 : i));
+            }
+        }
+
+        Sim_PerfAccount_Locked( pSim, count, count );
+
+        // Clear valid bit & count as the hardware does on completion
+        SIM_REG( pSim, OffsetBase + SIM_8000_DMA_COUNT ) = regCount & ~(((U32)1 << 31) | 0x07FFFFFF);
+
+        // Set descriptor done status ([18])
+        if (bIntEnable)
+        {
+            SIM_REG( pSim, OffsetBase + SIM_8000_DMA_INT_CTRL_STAT ) |= (1 << 18);
+        }
+    }
+
+    pSim->Stats.DmaBytes[channel] += count;
+    pSim->Stats.DmaTransfers[channel]++;
+
+    if (bIntEnable)
+    {
+        IntrSource.DmaDone = (1 << channel);
+        Sim_InterruptTrigger_Locked( pSim, &IntrSource );
+    }
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Sim_InterruptTrigger_Locked
+ *
+ * Description:  Signals notification objects waiting on the interrupt sources
+ *
+ * Note       :  Caller must hold the model lock
+ *
+ *****************************************************************************/
+static VOID
+Sim_InterruptTrigger_Locked(
+    SIM_DEVICE_PROP *pSim,
+    PLX_INTERRUPT   *pSource
+    )
+{
+    U8               i;
+    U8               matched;
+    BOOLEAN          bMatch;
+    SIM_WAIT_OBJECT *pWait;
+
+
+    // Model interrupts are serviced immediately, as if by ISR & DPC
+    pSim->Stats.Interrupts++;
+    pSim->Stats.DpcCount++;
+
+    pWait = pSim->pWaitList;
+    while (pWait != NULL)
+    {
+        bMatch = FALSE;
+
+        // PLX_INTERRUPT is bitfields only, so compare it byte-wise
+        for (i = 0; i < sizeof(PLX_INTERRUPT); i++)
+        {
+            matched = ((U8*)&pWait->Notify)[i] & ((U8*)pSource)[i];
+            if (matched)
+            {
+                ((U8*)&pWait->Source)[i] |= matched;
+                bMatch = TRUE;
+            }
+        }
+
+        if (bMatch)
+        {
+            pSim->Stats.NotifySignalled++;
+            pWait->bSignalled = TRUE;
+            pthread_cond_broadcast( &pWait->Cond );
+        }
+
+        pWait = pWait->pNext;
+    }
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Sim_PerfAccount_Locked
+ *
+ * Description:  Updates performance counters for DMA traffic on the model port
+ *
+ * Note       :  Caller must hold the model lock
+ *
+ *****************************************************************************/
+static VOID
+Sim_PerfAccount_Locked(
+    SIM_DEVICE_PROP *pSim,
+    U32              BytesRead,
+    U32              BytesWritten
+    )
+{
+    U32 TlpCount;
+
+
+    if (pSim->bPerfEnabled == FALSE)
+    {
+        return;
+    }
+
+    // Reads go out as read requests & return as completions
+    if (BytesRead != 0)
+    {
+        pSim->PerfCounter[SIM_PERF_EG_NONPOSTED_HDR] += SIM_TLP_COUNT( BytesRead, SIM_PERF_READ_REQ_SIZE );
+
+        TlpCount = SIM_TLP_COUNT( BytesRead, SIM_PERF_TLP_PAYLOAD );
+        pSim->PerfCounter[SIM_PERF_IN_CPL_HDR] += TlpCount;
+        pSim->PerfCounter[SIM_PERF_IN_CPL_DW]  += SIM_TLP_COUNT( BytesRead, sizeof(U32) );
+        pSim->PerfCounter[SIM_PERF_EG_DLLP]    += TlpCount;
+    }
+
+    // Writes go out as posted requests
+    if (BytesWritten != 0)
+    {
+        TlpCount = SIM_TLP_COUNT( BytesWritten, SIM_PERF_TLP_PAYLOAD );
+        pSim->PerfCounter[SIM_PERF_EG_POSTED_HDR] += TlpCount;
+        pSim->PerfCounter[SIM_PERF_EG_POSTED_DW]  += SIM_TLP_COUNT( BytesWritten, sizeof(U32) );
+        pSim->PerfCounter[SIM_PERF_IN_DLLP]       += TlpCount;
+    }
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Sim_WaitObjectFind_Locked
+ *
+ * Description:  Validates a notification wait object handle
+ *
+ * Note       :  Caller must hold the model lock
+ *
+ *****************************************************************************/
+static SIM_WAIT_OBJECT*
+Sim_WaitObjectFind_Locked(
+    SIM_DEVICE_PROP *pSim,
+    U64              pWaitObject
+    )
+{
+    SIM_WAIT_OBJECT *pWait;
+
+
+    pWait = pSim->pWaitList;
+    while (pWait != NULL)
+    {
+        if (PLX_PTR_TO_INT( pWait ) == pWaitObject)
+        {
+            return pWait;
+        }
+        pWait = pWait->pNext;
+    }
+
+    return NULL;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Sim_WaitObjectRemove_Locked
+ *
+ * Description:  Removes a wait object, waking any threads waiting on it
+ *
+ * Note       :  Caller must hold the model lock
+ *
+ *****************************************************************************/
+static VOID
+Sim_WaitObjectRemove_Locked(
+    SIM_DEVICE_PROP *pSim,
+    SIM_WAIT_OBJECT *pWait
+    )
+{
+    SIM_WAIT_OBJECT **ppWait;
+
+
+    ppWait = &pSim->pWaitList;
+    while (*ppWait != NULL)
+    {
+        if (*ppWait == pWait)
+        {
+            *ppWait = pWait->pNext;
+            break;
+        }
+        ppWait = &(*ppWait)->pNext;
+    }
+
+    // Object is released by last waiter if any are still waiting
+    if (pWait->WaitCount == 0)
+    {
+        pthread_cond_destroy( &pWait->Cond );
+        free( pWait );
+    }
+    else
+    {
+        pWait->bCanceled = TRUE;
+        pthread_cond_broadcast( &pWait->Cond );
+    }
+}
+
+#endif // PLX_LINUX
@@ -0,0 +1,158 @@
+#ifndef __SIM_DEVICE_H
+#define __SIM_DEVICE_H
+
+/*******************************************************************************
+ * Copyright 2013-2019 Broadcom, Inc
+ * Copyright (c) 2009 to 2012 PLX Technology Inc.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directorY of this source tree, or the
+ * BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+/*******************************************************************************
+ *
+ * File Name:
+ *
+ *     SimDevice.h
+ *
+ * Description:
+ *
+ *     Header file for the simulated (in-process) device interface functions
+ *
+ * Revision History:
+ *
+ *     09-01-19: PCI/PCIe SDK v8.10
+ *
+ ******************************************************************************/
+
+
+#include "PlxIoctl.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/******************************************
+ *             Definitions
+ ******************************************/
+#define SIM_MAX_DEVICES                 2           // Number of simulated devices
+#define SIM_DEVICE_9054                 0           // Simulated 9054 PCI-to-Local bridge
+#define SIM_DEVICE_8000_DMA             1           // Simulated 8000 DMA function
+#define SIM_MAX_DMA_CHANNELS            4           // Max DMA channels of any model
+
+// Sizes of simulated resources
+#define SIM_REG_SPACE_SIZE              (8 * 1024)  // BAR 0 register space
+#define SIM_LOCAL_SPACE_SIZE            (1024*1024) // 9054 local space 0 (BAR 2)
+#define SIM_COMMON_BUFFER_SIZE          (64 * 1024) // Common buffer size
+#define SIM_PERF_TLP_PAYLOAD            128         // Bytes per TLP for perf counters
+#define SIM_PERF_READ_REQ_SIZE          512         // Bytes per read request for perf counters
+#define SIM_PAGE_SIZE                   4096        // Page size for SGL statistics
+
+// 9054 register offsets (BAR 0)
+#define SIM_9054_MAILBOX_BASE           0x40        // Mailboxes 2-7
+#define SIM_9054_MAILBOX_BASE_I2O       0x78        // Mailboxes 0-1
+#define SIM_9054_P2L_DOORBELL           0x60        // PCI-to-Local doorbell
+#define SIM_9054_L2P_DOORBELL           0x64        // Local-to-PCI doorbell
+#define SIM_9054_INT_CTRL_STAT          0x68
+#define SIM_9054_DMA0_MODE              0x80
+#define SIM_9054_DMA1_MODE              0x94
+#define SIM_9054_DMA_COMMAND_STAT       0xA8
+#define SIM_9054_DMA0_PCI_DAC           0xB4
+
+// 8000 DMA register offsets (BAR 0)
+#define SIM_8000_DMA_BASE(ch)           (0x200 + ((ch) * 0x100))
+#define SIM_8000_DMA_SRC_LOW            0x00
+#define SIM_8000_DMA_SRC_HIGH           0x04
+#define SIM_8000_DMA_DEST_LOW           0x08
+#define SIM_8000_DMA_DEST_HIGH          0x0C
+#define SIM_8000_DMA_COUNT              0x10
+#define SIM_8000_DMA_CTRL_STAT          0x38
+#define SIM_8000_DMA_INT_CTRL_STAT      0x3C
+
+
+
+
+/******************************************
+ *      Device Selection Functions
+ *****************************************/
+PLX_STATUS
+Sim_DeviceOpen(
+    PLX_DEVICE_OBJECT *pDevice
+    );
+
+PLX_STATUS
+Sim_DeviceClose(
+    PLX_DEVICE_OBJECT *pDevice
+    );
+
+PLX_STATUS
+Sim_DeviceFindEx(
+    PLX_DEVICE_KEY *pKey,
+    U16             DeviceNumber,
+    PLX_MODE_PROP  *pModeProp
+    );
+
+
+/******************************************
+ *    Simulator Private Support Functions
+ *****************************************/
+S32
+Sim_Dispatch_IoControl(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                IoControlCode,
+    PLX_PARAMS        *pIoBuffer,
+    U32                Size
+    );
+
+
+/******************************************
+ *   Simulated Register Access Functions
+ *****************************************/
+U32
+Sim_PlxRegisterRead(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset,
+    PLX_STATUS        *pStatus
+    );
+
+PLX_STATUS
+Sim_PlxRegisterWrite(
+    PLX_DEVICE_OBJECT *pDevice,
+    U32                offset,
+    U32                value
+    );
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -50,6 +50,10 @@
 
 #include <string.h>     // For memset()/memcpy()
 #include <sys/timeb.h>  // For ftime()
+#if defined(PLX_LINUX)
+    #include <time.h>   // For clock_gettime()
+#endif
+#include "PexApi.h"
 #include "SpiFlash.h"
 #include "PlxApiDebug.h"
 
@@ -220,10 +224,12 @@ Spi_Erase(
     // If requested, poll status until completion
     if (BoolWaitComplete)
     {
-        while (Spi_GetStatus( PtrDev, PtrSpi ) == PLX_STATUS_IN_PROGRESS)
-        {
-            Plx_sleep( 200 );
-        }
+        return PlxPci_SpiFlashWaitWriteComplete(
+            PtrDev,
+            PtrSpi,
+            (StartOffset == SPI_FLASH_ERASE_ALL) ?
+              SPI_MAX_WAIT_BULK_ERASE_MS : SPI_MAX_WAIT_SECTOR_ERASE_MS
+            );
     }
 
     return PLX_STATUS_OK;
@@ -252,6 +258,7 @@ Spi_ReadBuffer(
     U8         cmd[SPI_MAX_CMD_LEN];
     U32        addr;
     U32        offset;
+    U32        regVal;
     U32        rxBytes;
     U32        pageBytes;
     PLX_STATUS status;
@@ -278,9 +285,31 @@ Spi_ReadBuffer(
              (PtrSpi->MmapAddr != 0xFFFFFFF) &&
              (PtrSpi->MmapAddr != 0) )
         {
-            // Read 32-bits at a time
-            *(U32*)&PtrRxBuff[offset] =
-                PlxDir_PlxMappedRegRead( PtrDev, PtrSpi->MmapAddr + addr, &status );
+            // Read all remaining 32-bit data from window in a single request
+            rxBytes = SizeRx & ~(U32)0x3;
+            if (rxBytes != 0)
+            {
+                status =
+                    PlxDir_PlxMappedRegReadBuffer(
+                        PtrDev,
+                        PtrSpi->MmapAddr + addr,
+                        &PtrRxBuff[offset],
+                        rxBytes
+                        );
+            }
+            else
+            {
+                // Final partial 32-bit value
+                regVal =
+                    PlxDir_PlxMappedRegRead(
+                        PtrDev,
+                        PtrSpi->MmapAddr + addr,
+                        &status
+                        );
+                memcpy( &PtrRxBuff[offset], &regVal, SizeRx );
+                rxBytes = SizeRx;
+            }
+
             if (status != PLX_STATUS_OK)
             {
                 ErrorPrintf((
@@ -289,7 +318,6 @@ Spi_ReadBuffer(
                     ));
                 return status;
             }
-            rxBytes = sizeof(U32);
         }
         else
         {
@@ -373,8 +401,6 @@ Spi_WriteBuffer(
     U32                SizeTx
     )
 {
-    U8         cmdLen;
-    U8         cmd[SPI_MAX_CMD_LEN];
     U32        addr;
     U32        offset;
     U32        txBytes;
@@ -395,101 +421,29 @@ Spi_WriteBuffer(
 
     while (SizeTx)
     {
-        // Send WRITE ENABLE command
-        cmd[0] = SPI_FLASH_CMD_WRITE_ENABLE;
-        status =
-            Spi_CmdSendAndReply(
-                PtrDev,
-                PtrSpi,
-                SPI_CMD_FLAGS_OP_MORE_CMDS, // WRITE command to follow
-                cmd,
-                sizeof(U8),
-                NULL,       // No reply
-                0
-                );
-        if (status != PLX_STATUS_OK)
-        {
-            return status;
-        }
-
         // Set next base address
         addr = StartOffset + offset;
 
-        // Prepare WRITE command
-        if (addr & 0xFF000000)
-        {
-            // 4B addressing not currently supported
-            return PLX_STATUS_UNSUPPORTED;
-        }
-        else
-        {
-            // Set command based on mode
-            if (PtrSpi->IoMode == PEX_SPI_IO_MODE_QUAD_IO)
-            {
-                cmd[0] = SPI_FLASH_CMD_3B_WRITE_QUAD_IO;
-            }
-            else
-            {
-                cmd[0] = SPI_FLASH_CMD_3B_WRITE;
-            }
-
-            // Add address & specify length
-            cmd[1] = (U8)(addr >> 16);
-            cmd[2] = (U8)(addr >>  8);
-            cmd[3] = (U8)(addr >>  0);
-            cmdLen = sizeof(U8) + (3 * sizeof(U8));
-        }
-
-        // Send WRITE command + address
-        status =
-            Spi_CmdSendAndReply(
-                PtrDev,
-                PtrSpi,
-                SPI_CMD_FLAGS_OP_MORE_DATA,
-                cmd,
-                cmdLen,
-                NULL,       // No reply
-                0
-                );
-        if (status != PLX_STATUS_OK)
-        {
-            return status;
-        }
-
         // Set max transfer size, ensuring not to cross page boundary
         txBytes = pageBytes - (addr & (pageBytes - 1));
 
         // Determine size of next transfer
         txBytes = PEX_MIN( SizeTx, txBytes );
 
-        // Send data
+        // Program page & wait for completion, in driver if supported
         status =
-            Spi_CmdSendAndReply(
+            PlxPci_SpiFlashPageProgram(
                 PtrDev,
                 PtrSpi,
-                SPI_CMD_FLAGS_NONE,
+                addr,
                 &PtrTxBuff[offset],
-                txBytes,
-                NULL,       // No reply
-                0
+                txBytes
                 );
         if (status != PLX_STATUS_OK)
         {
             return status;
         }
 
-        // Poll status register to ensure completion
-        do
-        {
-            status = Spi_GetStatus( PtrDev, PtrSpi );
-            if ( (status != PLX_STATUS_OK) &&
-                 (status != PLX_STATUS_IN_PROGRESS) )
-            {
-                return status;
-            }
-        }
-        while (status == PLX_STATUS_IN_PROGRESS);
-
         // Adjust for next transfer
         SizeTx -= txBytes;
         offset += txBytes;
@@ -501,6 +455,113 @@ Spi_WriteBuffer(
 
 
 
+/*******************************************************************************
+ *
+ * Function   : Spi_PageProgram
+ *
+ * Description: Programs data into a single flash page through the manual
+ *              controller registers & waits for completion
+ *
+ ******************************************************************************/
+PLX_STATUS
+Spi_PageProgram(
+    PLX_DEVICE_OBJECT *PtrDev,
+    PEX_SPI_OBJ       *PtrSpi,
+    U32                StartOffset,
+    U8                *PtrTxBuff,
+    U32                SizeTx
+    )
+{
+    U8         cmdLen;
+    U8         cmd[SPI_MAX_CMD_LEN];
+    PLX_STATUS status;
+
+
+    // Send WRITE ENABLE command
+    cmd[0] = SPI_FLASH_CMD_WRITE_ENABLE;
+    status =
+        Spi_CmdSendAndReply(
+            PtrDev,
+            PtrSpi,
+            SPI_CMD_FLAGS_OP_MORE_CMDS, // WRITE command to follow
+            cmd,
+            sizeof(U8),
+            NULL,       // No reply
+            0
+            );
+    if (status != PLX_STATUS_OK)
+    {
+        return status;
+    }
+
+    // Prepare WRITE command
+    if (StartOffset & 0xFF000000)
+    {
+        // 4B addressing not currently supported
+        return PLX_STATUS_UNSUPPORTED;
+    }
+    else
+    {
+        // Set command based on mode
+        if (PtrSpi->IoMode == PEX_SPI_IO_MODE_QUAD_IO)
+        {
+            cmd[0] = SPI_FLASH_CMD_3B_WRITE_QUAD_IO;
+        }
+        else
+        {
+            cmd[0] = SPI_FLASH_CMD_3B_WRITE;
+        }
+
+        // Add address & specify length
+        cmd[1] = (U8)(StartOffset >> 16);
+        cmd[2] = (U8)(StartOffset >>  8);
+        cmd[3] = (U8)(StartOffset >>  0);
+        cmdLen = sizeof(U8) + (3 * sizeof(U8));
+    }
+
+    // Send WRITE command + address
+    status =
+        Spi_CmdSendAndReply(
+            PtrDev,
+            PtrSpi,
+            SPI_CMD_FLAGS_OP_MORE_DATA,
+            cmd,
+            cmdLen,
+            NULL,       // No reply
+            0
+            );
+    if (status != PLX_STATUS_OK)
+    {
+        return status;
+    }
+
+    // Send data
+    status =
+        Spi_CmdSendAndReply(
+            PtrDev,
+            PtrSpi,
+            SPI_CMD_FLAGS_NONE,
+            PtrTxBuff,
+            SizeTx,
+            NULL,       // No reply
+            0
+            );
+    if (status != PLX_STATUS_OK)
+    {
+        return status;
+    }
+
+    // Poll status register to ensure completion
+    return Spi_WaitWriteComplete(
+        PtrDev,
+        PtrSpi,
+        SPI_MAX_WAIT_PAGE_PROG_MS
+        );
+}
+
+
+
+
 /*******************************************************************************
  *
  * Function   : Spi_GetStatus
@@ -805,3 +866,111 @@ Spi_WaitControllerReady(
 
     return PLX_STATUS_OK;
 }
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   : Spi_WaitWriteComplete
+ *
+ * Description: Polls the flash write-in-progress bit until a program or erase
+ *              operation completes
+ *
+ * Notes      : Page programs typically complete within a few polls, so status
+ *              is first polled back-to-back. Longer operations (e.g. erase)
+ *              then back off exponentially, bounded by the given timeout.
+ *
+ ******************************************************************************/
+PLX_STATUS
+Spi_WaitWriteComplete(
+    PLX_DEVICE_OBJECT *PtrDev,
+    PEX_SPI_OBJ       *PtrSpi,
+    U32                TimeoutMs
+    )
+{
+    U32        delayMs;
+    U32        pollCount;
+    U64        startTimeMs;
+    PLX_STATUS status;
+
+
+    // Note start time
+    startTimeMs = Spi_GetTimeMs();
+
+    delayMs   = 0;
+    pollCount = 0;
+
+    while (1)
+    {
+        // Done if operation complete or an error occurs
+        status = Spi_GetStatus( PtrDev, PtrSpi );
+        if (status != PLX_STATUS_IN_PROGRESS)
+        {
+            return status;
+        }
+
+        // Verify we don't exceed poll time
+        if ((Spi_GetTimeMs() - startTimeMs) >= TimeoutMs)
+        {
+            ErrorPrintf((
+                "SPI: ERROR: Timeout (%dms) waiting for write/erase completion\n",
+                TimeoutMs
+                ));
+            return PLX_STATUS_TIMEOUT;
+        }
+
+        // Back off after initial polls
+        pollCount++;
+        if (pollCount >= SPI_WIP_POLL_SPIN_COUNT)
+        {
+            if (delayMs == 0)
+            {
+                delayMs = 1;
+            }
+            else if (delayMs < SPI_WIP_POLL_MAX_DELAY_MS)
+            {
+                delayMs = delayMs * 2;
+            }
+
+            Plx_sleep( delayMs );
+        }
+    }
+}
+
+
+
+
+/*******************************************************************************
+ *
+ * Function   : Spi_GetTimeMs
+ *
+ * Description: Returns a monotonic timestamp in milliseconds
+ *
+ ******************************************************************************/
+U64
+Spi_GetTimeMs(
+    VOID
+    )
+{
+#if defined(PLX_MSWINDOWS)
+    return GetTickCount64();
+
+#elif defined(PLX_LINUX)
+    struct timespec ts;
+
+
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+
+    return ((U64)ts.tv_sec * 1000) + (ts.tv_nsec / 1000000);
+
+#else
+    struct timeb curTime;
+
+
+    // No monotonic source available
+    ftime( &curTime );
+
+    return ((U64)curTime.time * 1000) + curTime.millitm;
+#endif
+}
@@ -71,6 +71,15 @@ extern "C" {
 // Max time to wait until controller is ready
 #define SPI_MAX_WAIT_CTRL_READY_MS          (1000)
 
+// Max time to wait for flash program/erase operations to complete
+#define SPI_MAX_WAIT_PAGE_PROG_MS           (100)
+#define SPI_MAX_WAIT_SECTOR_ERASE_MS        (10 * 1000)
+#define SPI_MAX_WAIT_BULK_ERASE_MS          (600 * 1000)
+
+// Write-in-progress polling backoff
+#define SPI_WIP_POLL_SPIN_COUNT             8       // Back-to-back polls before delaying
+#define SPI_WIP_POLL_MAX_DELAY_MS           64      // Max delay between polls
+
 // PBAM SPI registers
 #define PEX_REG_SPI_MANUAL_IO_MODE          0x7C
 #define PEX_REG_SPI_MANUAL_RD_DATA          0x78
@@ -156,6 +165,15 @@ Spi_WriteBuffer(
     U32                SizeTx
     );
 
+PLX_STATUS
+Spi_PageProgram(
+    PLX_DEVICE_OBJECT *PtrDev,
+    PEX_SPI_OBJ       *PtrSpi,
+    U32                StartOffset,
+    U8                *PtrTxBuff,
+    U32                SizeTx
+    );
+
 PLX_STATUS
 Spi_GetStatus(
     PLX_DEVICE_OBJECT *PtrDev,
@@ -183,6 +201,18 @@ Spi_WaitControllerReady(
     PEX_SPI_OBJ       *PtrSpi
     );
 
+PLX_STATUS
+Spi_WaitWriteComplete(
+    PLX_DEVICE_OBJECT *PtrDev,
+    PEX_SPI_OBJ       *PtrSpi,
+    U32                TimeoutMs
+    );
+
+U64
+Spi_GetTimeMs(
+    VOID
+    );
+
 
 
 #ifdef __cplusplus
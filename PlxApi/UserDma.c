@@ -0,0 +1,770 @@
+/*******************************************************************************
+ * Copyright 2013-2019 Broadcom Inc
+ * Copyright (c) 2009 to 2012 PLX Technology Inc.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directorY of this source tree, or the
+ * BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+/*******************************************************************************
+ *
+ * File Name:
+ *
+ *      UserDma.c
+ *
+ * Description:
+ *
+ *      Implements 8000 DMA transfers driven entirely from user space.  The
+ *      channel is reserved through the driver, after which descriptors are
+ *      placed in a ring in a physical buffer allocated for the channel and the
+ *      DMA registers are accessed through a user mapping of BAR 0.  Submitting
+ *      and completing transfers then requires no calls into the driver.
+ *
+ *      Descriptor write-back is enabled, so the engine clears the valid bit
+ *      of each descriptor it completes. The table of open channels is protected
+ *      by a process-wide lock & each channel's ring by its own lock, so calls
+ *      may be made from multiple threads. The engine is only started when it
+ *      is idle; a ring that halts on a descriptor prefetched before it became
+ *      valid is restarted the next time completion is polled.
+ *
+ *      Global DMA configuration is left to the driver. On Sirius, a channel
+ *      is only opened if descriptors are already set to external (1FC[2]=0).
+ *
+ * Revision History:
+ *
+ *      09-01-19 : PCI/PCIe SDK v8.10
+ *
+ ******************************************************************************/
+
+
+#include "PexApi.h"
+#include "PlxApiDebug.h"
+#include "PlxApiDirect.h"
+#include "UserDma.h"
+
+
+
+
+/**********************************************
+ *               Definitions
+ *********************************************/
+// Ensure descriptor contents are visible before ownership passes to hardware
+#if defined(PLX_MSWINDOWS)
+    #define UDMA_WRITE_BARRIER()            MemoryBarrier()
+#elif defined(PLX_LINUX)
+    #define UDMA_WRITE_BARRIER()            __sync_synchronize()
+#else
+    #define UDMA_WRITE_BARRIER()
+#endif
+
+
+
+
+/**********************************************
+ *           Global Variables
+ *********************************************/
+static BOOLEAN      Gbl_bUDmaLockInit = FALSE;
+static UDMA_CHANNEL Gbl_UDmaChannel[UDMA_MAX_CHANNELS];
+
+#if defined(PLX_DOS)
+    #define UDMA_LOCK()
+    #define UDMA_UNLOCK()
+    #define UDMA_CH_LOCK(pCh)
+    #define UDMA_CH_UNLOCK(pCh)
+#else
+    static CRITICAL_SECTION Gbl_UDmaLock;
+    static CRITICAL_SECTION Gbl_UDmaChLock[UDMA_MAX_CHANNELS];
+
+    // Table lock must be held to acquire a channel lock, never the reverse
+    #define UDMA_LOCK()                 EnterCriticalSection( &Gbl_UDmaLock )
+    #define UDMA_UNLOCK()               LeaveCriticalSection( &Gbl_UDmaLock )
+    #define UDMA_CH_LOCK(pCh)           EnterCriticalSection( &Gbl_UDmaChLock[(pCh) - Gbl_UDmaChannel] )
+    #define UDMA_CH_UNLOCK(pCh)         LeaveCriticalSection( &Gbl_UDmaChLock[(pCh) - Gbl_UDmaChannel] )
+#endif
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  UDma_ChannelOpen
+ *
+ * Description:  Reserves a DMA channel & sets it up for user-space operation
+ *
+ *****************************************************************************/
+PLX_STATUS
+UDma_ChannelOpen(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 channel,
+    PLX_DMA_PROP      *pDmaProp
+    )
+{
+    U16           i;
+    U32           RegValue;
+    PLX_STATUS    status;
+    UDMA_CHANNEL *pCh;
+
+
+    // Only 8000 DMA over the PLX driver is supported
+    if ((pDevice->Key.ApiMode != PLX_API_MODE_PCI) ||
+        ((pDevice->Key.PlxChip & 0xF000) != 0x8000))
+    {
+        return PLX_STATUS_UNSUPPORTED;
+    }
+
+    if (channel >= 4)
+    {
+        return PLX_STATUS_INVALID_ADDR;
+    }
+
+    if (Gbl_bUDmaLockInit == FALSE)
+    {
+#if !defined(PLX_DOS)
+        InitializeCriticalSection( &Gbl_UDmaLock );
+
+        for (i = 0; i < UDMA_MAX_CHANNELS; i++)
+        {
+            InitializeCriticalSection( &Gbl_UDmaChLock[i] );
+        }
+#endif
+        Gbl_bUDmaLockInit = TRUE;
+    }
+
+    UDMA_LOCK();
+
+    // Verify channel not already open by this process
+    if (UDma_ChannelFind( pDevice, channel ) != NULL)
+    {
+        UDMA_UNLOCK();
+        return PLX_STATUS_IN_USE;
+    }
+
+    // Find a free entry
+    pCh = NULL;
+    for (i = 0; i < UDMA_MAX_CHANNELS; i++)
+    {
+        if (Gbl_UDmaChannel[i].pDevice == NULL)
+        {
+            pCh = &Gbl_UDmaChannel[i];
+            break;
+        }
+    }
+
+    if (pCh == NULL)
+    {
+        UDMA_UNLOCK();
+        return PLX_STATUS_INSUFFICIENT_RES;
+    }
+
+    // Reserve the channel in the driver
+    status = PlxPci_DmaChannelOpen( pDevice, channel, pDmaProp );
+    if (status != PLX_STATUS_OK)
+    {
+        UDMA_UNLOCK();
+        return status;
+    }
+
+    RtlZeroMemory( pCh, sizeof(UDMA_CHANNEL) );
+
+    // Map DMA registers
+    status = PlxPci_PciBarMap( pDevice, 0, (VOID**)&pCh->pBarVa );
+    if (status != PLX_STATUS_OK)
+    {
+        PlxPci_DmaChannelClose( pDevice, channel );
+        UDMA_UNLOCK();
+        return status;
+    }
+
+    // Descriptor location is global & owned by the driver, so require
+    // DMA descriptors already set to external ([2] = 0)
+    if (pDevice->Key.PlxFamily == PLX_FAMILY_SIRIUS)
+    {
+        RegValue = *(volatile U32*)(pCh->pBarVa + 0x1FC);
+        if (RegValue & (1 << 2))
+        {
+            DebugPrintf(("ERROR - DMA descriptors set to internal (1FC[2]=1)\n"));
+            PlxPci_PciBarUnmap( pDevice, (VOID**)&pCh->pBarVa );
+            PlxPci_DmaChannelClose( pDevice, channel );
+            UDMA_UNLOCK();
+            return PLX_STATUS_UNSUPPORTED;
+        }
+    }
+
+    // Allocate a ring owned by this channel only
+    pCh->RingMem.Size = UDMA_RING_SIZE;
+
+    status = PlxPci_PhysicalMemoryAllocate( pDevice, &pCh->RingMem, FALSE );
+    if (status != PLX_STATUS_OK)
+    {
+        DebugPrintf(("ERROR - Unable to allocate DMA ring\n"));
+        PlxPci_PciBarUnmap( pDevice, (VOID**)&pCh->pBarVa );
+        PlxPci_DmaChannelClose( pDevice, channel );
+        UDMA_UNLOCK();
+        return status;
+    }
+
+    // Descriptors must be 64B aligned & addressable with standard descriptors
+    if ((pCh->RingMem.PhysicalAddr & 0x3F) ||
+        ((pCh->RingMem.PhysicalAddr + UDMA_RING_SIZE) > ((U64)1 << 48)))
+    {
+        DebugPrintf(("ERROR - Physical address not usable for DMA ring\n"));
+        status = PLX_STATUS_INVALID_ADDR;
+    }
+    else
+    {
+        status = PlxPci_PhysicalMemoryMap( pDevice, &pCh->RingMem );
+    }
+
+    if (status != PLX_STATUS_OK)
+    {
+        PlxPci_PhysicalMemoryFree( pDevice, &pCh->RingMem );
+        PlxPci_PciBarUnmap( pDevice, (VOID**)&pCh->pBarVa );
+        PlxPci_DmaChannelClose( pDevice, channel );
+        UDMA_UNLOCK();
+        return status;
+    }
+
+    pCh->channel     = channel;
+    pCh->pRegVa      = pCh->pBarVa + UDMA_8000_REG_BASE( channel );
+    pCh->pRing       = (volatile U32*)PLX_INT_TO_PTR( pCh->RingMem.UserAddr );
+    pCh->RingBusAddr = pCh->RingMem.PhysicalAddr;
+
+    // Clear all descriptors so none are valid
+    RtlZeroMemory( (VOID*)pCh->pRing, UDMA_RING_SIZE );
+
+    // Prefetch must be a multiple of 4 & not exceed descriptor count
+    UDMA_REG_WRITE( pCh, UDMA_8000_DESCR_PREFETCH, UDMA_RING_COUNT & ~0x3 );
+
+    // Clear block mode registers
+    UDMA_REG_WRITE( pCh, 0x00, 0 );
+    UDMA_REG_WRITE( pCh, 0x04, 0 );
+    UDMA_REG_WRITE( pCh, 0x08, 0 );
+    UDMA_REG_WRITE( pCh, 0x0C, 0 );
+    UDMA_REG_WRITE( pCh, 0x10, 0 );
+
+    // Descriptor ring address, current descriptor & size
+    UDMA_REG_WRITE( pCh, UDMA_8000_RING_ADDR_LOW, PLX_64_LOW_32(pCh->RingBusAddr) );
+    UDMA_REG_WRITE( pCh, UDMA_8000_RING_ADDR_HIGH, PLX_64_HIGH_32(pCh->RingBusAddr) );
+    UDMA_REG_WRITE( pCh, UDMA_8000_RING_CURR_ADDR, PLX_64_LOW_32(pCh->RingBusAddr) );
+    UDMA_REG_WRITE( pCh, UDMA_8000_RING_SIZE, UDMA_RING_COUNT );
+    UDMA_REG_WRITE( pCh, UDMA_8000_RING_CURR_COUNT, 0 );
+
+    // Disable invalid descriptor interrupt (x3C[1]), completion is polled
+    RegValue = UDMA_REG_READ( pCh, UDMA_8000_INT_CTRL_STAT );
+    UDMA_REG_WRITE( pCh, UDMA_8000_INT_CTRL_STAT, RegValue & ~(1 << 1) );
+
+    // Get DMA control/status
+    RegValue = UDMA_REG_READ( pCh, UDMA_8000_CTRL_STAT );
+
+    // Enable descriptor write-back ([2]) so completed descriptors are released
+    RegValue |= (1 << 2);
+
+    // Clear any active status bits ([31,12:8])
+    RegValue |= ((1 << 31) | (0x1F << 8));
+
+    // Enable SGL off-chip mode & halt on an invalid descriptor
+    if (pDevice->Key.PlxFamily == PLX_FAMILY_SIRIUS)
+    {
+        RegValue |= (1 << 5) | (1 << 4);        // SGL mode (4) & descriptor halt mode (5)
+    }
+    else
+    {
+        RegValue &= ~(3 << 5);
+        RegValue |= (2 << 5) | (1 << 4);        // SGL mode ([6:5]) & descriptor halt mode (4)
+    }
+
+    UDMA_REG_WRITE( pCh, UDMA_8000_CTRL_STAT, RegValue );
+
+    // Entry now in use
+    pCh->pDevice = pDevice;
+
+    UDMA_UNLOCK();
+
+    DebugPrintf((
+        "User DMA ch %d ring at %08X_%08X (%d descriptors)\n",
+        channel, PLX_64_HIGH_32(pCh->RingBusAddr),
+        PLX_64_LOW_32(pCh->RingBusAddr), UDMA_RING_COUNT
+        ));
+
+    return PLX_STATUS_OK;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  UDma_TransferBlock
+ *
+ * Description:  Queues a transfer in the channel ring & optionally waits for
+ *               it to complete by polling
+ *
+ *****************************************************************************/
+PLX_STATUS
+UDma_TransferBlock(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 channel,
+    PLX_DMA_PARAMS    *pDmaParams,
+    U64                Timeout_ms
+    )
+{
+    U32           Seq;
+    U32           SpinCount;
+    U32           TmpValue;
+    U64           ElapsedMs;
+    PLX_STATUS    status;
+    UDMA_CHANNEL *pCh;
+    volatile U32 *pDescr;
+
+
+    if ((pDmaParams->ByteCount == 0) ||
+        (pDmaParams->ByteCount > UDMA_MAX_BYTE_COUNT))
+    {
+        return PLX_STATUS_INVALID_SIZE;
+    }
+
+    // Extended descriptors are not supported
+    if ((pDmaParams->AddrSource >> 48) || (pDmaParams->AddrDest >> 48))
+    {
+        return PLX_STATUS_INVALID_ADDR;
+    }
+
+    // No channels open if lock not yet created
+    if (Gbl_bUDmaLockInit == FALSE)
+    {
+        return PLX_STATUS_INVALID_ACCESS;
+    }
+
+    UDMA_LOCK();
+
+    pCh = UDma_ChannelFind( pDevice, channel );
+    if (pCh == NULL)
+    {
+        UDMA_UNLOCK();
+        return PLX_STATUS_INVALID_ACCESS;
+    }
+
+    UDMA_CH_LOCK( pCh );
+    UDMA_UNLOCK();
+
+    // Release completed descriptors
+    status = UDma_RingReap( pCh );
+    if (status != PLX_STATUS_OK)
+    {
+        UDMA_CH_UNLOCK( pCh );
+        return status;
+    }
+
+    if (pCh->NumPending == UDMA_RING_COUNT)
+    {
+        UDMA_CH_UNLOCK( pCh );
+        return PLX_STATUS_INSUFFICIENT_RES;
+    }
+
+    pDescr = pCh->pRing + (pCh->IdxHead * (UDMA_DESCR_SIZE / sizeof(U32)));
+
+    // Offset 04h - Upper address bits of source & dest ([47:32])
+    TmpValue  = (PLX_64_HIGH_32( pDmaParams->AddrSource ) & 0x0000FFFF) << 16;
+    TmpValue |= (PLX_64_HIGH_32( pDmaParams->AddrDest ) & 0x0000FFFF) << 0;
+    pDescr[1] = PLX_LE_DATA_32( TmpValue );
+
+    // Offset 08h - Low bits of destination address ([31:0])
+    pDescr[2] = PLX_LE_DATA_32( PLX_64_LOW_32( pDmaParams->AddrDest ) );
+
+    // Offset 0Ch - Low bits of source address ([31:0])
+    pDescr[3] = PLX_LE_DATA_32( PLX_64_LOW_32( pDmaParams->AddrSource ) );
+
+    // Offset 00h - Written last since the valid bit passes ownership
+    TmpValue = PLX_LE_U32_BIT( 31 ) |                   // Descriptor valid
+               PLX_LE_DATA_32( pDmaParams->ByteCount ); // Transfer byte count
+
+    if (pDmaParams->bConstAddrSrc)
+    {
+        TmpValue |= PLX_LE_U32_BIT( 29 );    // Keep source address constant
+    }
+
+    if (pDmaParams->bConstAddrDest)
+    {
+        TmpValue |= PLX_LE_U32_BIT( 28 );    // Keep destination address constant
+    }
+
+    UDMA_WRITE_BARRIER();
+
+    pDescr[0] = TmpValue;
+
+    UDMA_WRITE_BARRIER();
+
+    pCh->IdxHead = (pCh->IdxHead + 1) % UDMA_RING_COUNT;
+    pCh->NumPending++;
+    pCh->SeqSubmitted++;
+
+    Seq = pCh->SeqSubmitted;
+
+    // Start the engine if idle. A running engine either reaches the new
+    // descriptor or halts before it & is restarted when completion is polled.
+    status = UDma_RingKick( pCh );
+
+    UDMA_CH_UNLOCK( pCh );
+
+    if ((status != PLX_STATUS_OK) && (status != PLX_STATUS_IN_PROGRESS))
+    {
+        return status;
+    }
+
+    // Don't wait for completion if requested not to
+    if (Timeout_ms == 0)
+    {
+        return PLX_STATUS_OK;
+    }
+
+    SpinCount = 0;
+    ElapsedMs = 0;
+
+    // Poll for completion, yielding the CPU once the initial spin expires
+    while (1)
+    {
+        UDMA_LOCK();
+
+        // Channel may have been closed by another thread
+        if (UDma_ChannelFind( pDevice, channel ) != pCh)
+        {
+            UDMA_UNLOCK();
+            return PLX_STATUS_INVALID_ACCESS;
+        }
+
+        UDMA_CH_LOCK( pCh );
+        UDMA_UNLOCK();
+
+        // Reap completions & restart the engine if it halted
+        status = UDma_RingReap( pCh );
+
+        if ((status == PLX_STATUS_OK) &&
+            ((S32)(pCh->SeqCompleted - Seq) < 0))
+        {
+            status = PLX_STATUS_IN_PROGRESS;
+        }
+
+        UDMA_CH_UNLOCK( pCh );
+
+        if (status != PLX_STATUS_IN_PROGRESS)
+        {
+            return status;
+        }
+
+        if (SpinCount < UDMA_SPIN_COUNT)
+        {
+            SpinCount++;
+        }
+        else
+        {
+            if (ElapsedMs >= Timeout_ms)
+            {
+                return PLX_STATUS_TIMEOUT;
+            }
+
+            Plx_sleep( 1 );
+            ElapsedMs++;
+        }
+    }
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  UDma_Status
+ *
+ * Description:  Returns whether all queued transfers have completed
+ *
+ *****************************************************************************/
+PLX_STATUS
+UDma_Status(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 channel
+    )
+{
+    PLX_STATUS    status;
+    UDMA_CHANNEL *pCh;
+
+
+    // No channels open if lock not yet created
+    if (Gbl_bUDmaLockInit == FALSE)
+    {
+        return PLX_STATUS_INVALID_ACCESS;
+    }
+
+    UDMA_LOCK();
+
+    pCh = UDma_ChannelFind( pDevice, channel );
+    if (pCh == NULL)
+    {
+        UDMA_UNLOCK();
+        return PLX_STATUS_INVALID_ACCESS;
+    }
+
+    UDMA_CH_LOCK( pCh );
+    UDMA_UNLOCK();
+
+    // Reap completions & restart the engine if it halted
+    status = UDma_RingReap( pCh );
+
+    if (status == PLX_STATUS_OK)
+    {
+        if (pCh->NumPending != 0)
+        {
+            status = PLX_STATUS_IN_PROGRESS;
+        }
+        else
+        {
+            status = PLX_STATUS_COMPLETE;
+        }
+    }
+
+    UDMA_CH_UNLOCK( pCh );
+
+    return status;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  UDma_ChannelClose
+ *
+ * Description:  Releases a user-space DMA channel back to the driver
+ *
+ *****************************************************************************/
+PLX_STATUS
+UDma_ChannelClose(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 channel
+    )
+{
+    U32           RegValue;
+    UDMA_CHANNEL *pCh;
+
+
+    // No channels open if lock not yet created
+    if (Gbl_bUDmaLockInit == FALSE)
+    {
+        return PLX_STATUS_INVALID_ACCESS;
+    }
+
+    UDMA_LOCK();
+
+    pCh = UDma_ChannelFind( pDevice, channel );
+    if (pCh == NULL)
+    {
+        UDMA_UNLOCK();
+        return PLX_STATUS_INVALID_ACCESS;
+    }
+
+    // Wait for any submit or poll in progress on the channel
+    UDMA_CH_LOCK( pCh );
+
+    // Verify no transfers are still owned by hardware
+    UDma_RingReap( pCh );
+
+    if (pCh->NumPending != 0)
+    {
+        UDMA_CH_UNLOCK( pCh );
+        UDMA_UNLOCK();
+        DebugPrintf(("ERROR - User DMA ch %d has pending transfers\n", channel));
+        return PLX_STATUS_IN_PROGRESS;
+    }
+
+    // Disable descriptor write-back ([2]) to restore driver defaults
+    RegValue = UDMA_REG_READ( pCh, UDMA_8000_CTRL_STAT );
+    RegValue &= ~(1 << 2);
+    UDMA_REG_WRITE( pCh, UDMA_8000_CTRL_STAT, RegValue );
+
+    // Release the ring & register mapping
+    PlxPci_PhysicalMemoryUnmap( pDevice, &pCh->RingMem );
+    PlxPci_PhysicalMemoryFree( pDevice, &pCh->RingMem );
+    PlxPci_PciBarUnmap( pDevice, (VOID**)&pCh->pBarVa );
+
+    // Mark entry as free
+    pCh->pRing   = NULL;
+    pCh->pDevice = NULL;
+
+    UDMA_CH_UNLOCK( pCh );
+    UDMA_UNLOCK();
+
+    return PlxPci_DmaChannelClose( pDevice, channel );
+}
+
+
+
+
+/***********************************************************
+ *
+ *               PRIVATE SUPPORT FUNCTIONS
+ *
+ **********************************************************/
+
+
+/******************************************************************************
+ *
+ * Function   :  UDma_ChannelFind
+ *
+ * Description:  Returns the user-space state of an open channel
+ *
+ * Note       :  Must be called with the table lock held
+ *
+ *****************************************************************************/
+UDMA_CHANNEL*
+UDma_ChannelFind(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 channel
+    )
+{
+    U16 i;
+
+
+    for (i = 0; i < UDMA_MAX_CHANNELS; i++)
+    {
+        if ((Gbl_UDmaChannel[i].pDevice == pDevice) &&
+            (Gbl_UDmaChannel[i].channel == channel))
+        {
+            return &Gbl_UDmaChannel[i];
+        }
+    }
+
+    return NULL;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  UDma_RingReap
+ *
+ * Description:  Releases descriptors the engine has completed, in order
+ *
+ * Note       :  Must be called with the channel lock held
+ *
+ *****************************************************************************/
+PLX_STATUS
+UDma_RingReap(
+    UDMA_CHANNEL *pCh
+    )
+{
+    PLX_STATUS    status;
+    volatile U32 *pDescr;
+
+
+    while (pCh->NumPending != 0)
+    {
+        pDescr = pCh->pRing + (pCh->IdxTail * (UDMA_DESCR_SIZE / sizeof(U32)));
+
+        // Stop at first descriptor still owned by hardware
+        if (pDescr[0] & PLX_LE_U32_BIT( 31 ))
+        {
+            break;
+        }
+
+        pCh->IdxTail = (pCh->IdxTail + 1) % UDMA_RING_COUNT;
+        pCh->NumPending--;
+        pCh->SeqCompleted++;
+    }
+
+    if (pCh->NumPending == 0)
+    {
+        return PLX_STATUS_OK;
+    }
+
+    // Restart engine if it halted before a descriptor became valid
+    status = UDma_RingKick( pCh );
+
+    if (status == PLX_STATUS_IN_PROGRESS)
+    {
+        return PLX_STATUS_OK;
+    }
+
+    return status;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  UDma_RingKick
+ *
+ * Description:  Starts the engine if idle so it fetches newly valid descriptors
+ *
+ * Note       :  Must be called with the channel lock held. A running engine
+ *               is left alone & PLX_STATUS_IN_PROGRESS returned; if it halts
+ *               on a slot prefetched while still invalid, the next reap
+ *               restarts it. Returns PLX_STATUS_TIMEOUT if a started engine
+ *               neither runs nor completes the oldest pending descriptor.
+ *
+ *****************************************************************************/
+PLX_STATUS
+UDma_RingKick(
+    UDMA_CHANNEL *pCh
+    )
+{
+    U32           RegValue;
+    U32           SpinCount;
+    volatile U32 *pDescr;
+
+
+    RegValue = UDMA_REG_READ( pCh, UDMA_8000_CTRL_STAT );
+
+    // Don't disturb the engine if DMA in progress ([30])
+    if (RegValue & (1 << 30))
+    {
+        return PLX_STATUS_IN_PROGRESS;
+    }
+
+    // Clear any active status bits ([31,12:8]) & start DMA ([3])
+    RegValue |= ((1 << 31) | (0x1F << 8));
+
+    UDMA_REG_WRITE( pCh, UDMA_8000_CTRL_STAT, RegValue | (1 << 3) );
+
+    pDescr = pCh->pRing + (pCh->IdxTail * (UDMA_DESCR_SIZE / sizeof(U32)));
+
+    // Verify the engine picked up the ring
+    for (SpinCount = 0; SpinCount < UDMA_KICK_SPIN_COUNT; SpinCount++)
+    {
+        // Done if oldest descriptor already released or DMA in progress
+        if (((pDescr[0] & PLX_LE_U32_BIT( 31 )) == 0) ||
+            (UDMA_REG_READ( pCh, UDMA_8000_CTRL_STAT ) & (1 << 30)))
+        {
+            return PLX_STATUS_OK;
+        }
+    }
+
+    DebugPrintf(("ERROR - User DMA ch %d did not start\n", pCh->channel));
+
+    return PLX_STATUS_TIMEOUT;
+}
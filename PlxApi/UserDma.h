@@ -0,0 +1,168 @@
+#ifndef __USER_DMA_H
+#define __USER_DMA_H
+
+/*******************************************************************************
+ * Copyright 2013-2019 Broadcom, Inc
+ * Copyright (c) 2009 to 2012 PLX Technology Inc.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directorY of this source tree, or the
+ * BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+/*******************************************************************************
+ *
+ * File Name:
+ *
+ *     UserDma.h
+ *
+ * Description:
+ *
+ *     Header file for the user-space (kernel bypass) DMA ring functions
+ *
+ * Revision History:
+ *
+ *     09-01-19: PCI/PCIe SDK v8.10
+ *
+ ******************************************************************************/
+
+
+#include "PlxIoctl.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/******************************************
+ *             Definitions
+ ******************************************/
+#define UDMA_MAX_CHANNELS               16          // Max channels open at once by a process
+#define UDMA_RING_COUNT                 64          // Descriptors per channel ring
+#define UDMA_DESCR_SIZE                 16          // Size of standard 8000 DMA descriptor
+#define UDMA_RING_SIZE                  (UDMA_RING_COUNT * UDMA_DESCR_SIZE)
+#define UDMA_MAX_BYTE_COUNT             0x07FFFFFF  // Max transfer size per descriptor ([26:0])
+#define UDMA_SPIN_COUNT                 1000        // Status polls before sleeping on a wait
+#define UDMA_KICK_SPIN_COUNT            1000        // Status polls for a restarted engine to start
+
+// 8000 DMA channel registers (BAR 0)
+#define UDMA_8000_REG_BASE(ch)          (0x200 + ((ch) * 0x100))
+#define UDMA_8000_RING_ADDR_LOW         0x14
+#define UDMA_8000_RING_ADDR_HIGH        0x18
+#define UDMA_8000_RING_CURR_ADDR        0x1C
+#define UDMA_8000_RING_SIZE             0x20
+#define UDMA_8000_RING_CURR_COUNT       0x28
+#define UDMA_8000_DESCR_PREFETCH        0x34
+#define UDMA_8000_CTRL_STAT             0x38
+#define UDMA_8000_INT_CTRL_STAT         0x3C
+
+// Access to a channel register through the user-mode BAR mapping
+#define UDMA_REG_READ(pCh, offset)          \
+    (*(volatile U32*)((pCh)->pRegVa + (offset)))
+
+#define UDMA_REG_WRITE(pCh, offset, value)  \
+    (*(volatile U32*)((pCh)->pRegVa + (offset)) = (value))
+
+
+// State of a channel driven from user space
+typedef struct _UDMA_CHANNEL
+{
+    PLX_DEVICE_OBJECT *pDevice;          // Owning device (NULL = entry unused)
+    U8                 channel;          // DMA channel number
+    U8                *pBarVa;           // User mapping of BAR 0
+    U8                *pRegVa;           // Channel register base in BAR 0
+    PLX_PHYSICAL_MEM   RingMem;          // Physical buffer holding the ring
+    volatile U32      *pRing;            // Descriptor ring virtual address
+    U64                RingBusAddr;      // Descriptor ring bus address
+    U16                IdxHead;          // Next descriptor to fill
+    U16                IdxTail;          // Oldest descriptor owned by hardware
+    U16                NumPending;       // Descriptors owned by hardware
+    U32                SeqSubmitted;     // Number of descriptors submitted
+    U32                SeqCompleted;     // Number of descriptors completed
+} UDMA_CHANNEL;
+
+
+
+
+/******************************************
+ *       User-space DMA Functions
+ *****************************************/
+PLX_STATUS
+UDma_ChannelOpen(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 channel,
+    PLX_DMA_PROP      *pDmaProp
+    );
+
+PLX_STATUS
+UDma_TransferBlock(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 channel,
+    PLX_DMA_PARAMS    *pDmaParams,
+    U64                Timeout_ms
+    );
+
+PLX_STATUS
+UDma_Status(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 channel
+    );
+
+PLX_STATUS
+UDma_ChannelClose(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 channel
+    );
+
+
+/******************************************
+ *     User-space DMA Support Functions
+ *****************************************/
+UDMA_CHANNEL*
+UDma_ChannelFind(
+    PLX_DEVICE_OBJECT *pDevice,
+    U8                 channel
+    );
+
+PLX_STATUS
+UDma_RingReap(
+    UDMA_CHANNEL *pCh
+    );
+
+PLX_STATUS
+UDma_RingKick(
+    UDMA_CHANNEL *pCh
+    );
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -124,12 +124,14 @@ U8  ChipRevision;
  *
  * Function   :  main
  *
- * Description:  The main entry point
+ * Description:  The main entry point. Passing "-sim [index]" tests a
+ *               simulated device model instead of selecting a device.
  *
  *****************************************************************************/
 int 
 main(
-    void
+    int   argc,
+    char *argv[]
     )
 {
     S16               DeviceSelected;
@@ -152,10 +154,37 @@ main(
     /************************************
      *         Select Device
      ***********************************/
-    DeviceSelected =
-        SelectDevice(
-            &DeviceKey
-            );
+    if ((argc > 1) && (Plx_strcasecmp( argv[1], "-sim" ) == 0))
+    {
+        // Use simulated device model (9054 by default)
+        DeviceSelected = 0;
+        if (argc > 2)
+        {
+            DeviceSelected = (S16)atoi( argv[2] );
+        }
+
+        memset(&DeviceKey, PCI_FIELD_IGNORE, sizeof(PLX_DEVICE_KEY));
+
+        rc =
+            PlxPci_DeviceFindEx(
+                &DeviceKey,
+                DeviceSelected,
+                PLX_API_MODE_SIMULATED,
+                NULL
+                );
+
+        if (rc != PLX_STATUS_OK)
+        {
+            DeviceSelected = -1;
+        }
+    }
+    else
+    {
+        DeviceSelected =
+            SelectDevice(
+                &DeviceKey
+                );
+    }
 
     if (DeviceSelected == -1)
     {
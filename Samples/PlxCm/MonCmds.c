@@ -234,6 +234,8 @@ BOOLEAN Cmd_Help( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND
     Cons_printf(" rtr       Access Run-Time registers\n");
     Cons_printf(" dma       Access DMA Registers\n");
     Cons_printf(" mqr       Access Message Queue Registers\n");
+    Cons_printf(" regsave   Save snapshot of all port registers to a file\n");
+    Cons_printf(" regdiff   Display register changes between snapshots\n");
 
     Cons_printf("\n");
     Cons_printf("       ------------  EEPROM Access  -------------\n");
@@ -258,6 +260,12 @@ BOOLEAN Cmd_Help( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND
     Cons_printf(" ew        Write 16-bit data to memory\n");
     Cons_printf(" el        Write 32-bit data to memory\n");
     Cons_printf(" eq        Write 64-bit data to memory (if supported)\n");
+    Cons_printf(" memfill   Fill memory with a 32-bit value\n");
+    Cons_printf(" memcopy   Copy memory using CPU or DMA\n");
+    Cons_printf(" memcmp    Compare two memory ranges\n");
+    Cons_printf(" memsum    Calculate 32-bit checksum of memory\n");
+    Cons_printf(" memsave   Save memory to a binary file\n");
+    Cons_printf(" memperf   Measure memory read/write throughput\n");
 
     Cons_printf("\n");
     Cons_printf("       -----------  I/O Port Access  ------------\n");
@@ -870,6 +878,7 @@ BOOLEAN Cmd_I2cConnect( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_CO
 #else
 
     U16             i;
+    U32             I2cPorts;
     BOOLEAN         bError;
     BOOLEAN         bReselect;
     PLXCM_ARG      *pArg;
@@ -965,6 +974,18 @@ BOOLEAN Cmd_I2cConnect( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_CO
 
     Cons_printf("Scan for I2C devices (ESC to halt)...\n");
 
+    // For auto-probe, refresh devices on the selected I2C port
+    if (ModeProp.I2c.SlaveAddr == (U16)-1)
+    {
+        PlxPci_I2cTopologyScan(
+            PLX_API_MODE_I2C_AARDVARK,
+            ModeProp.I2c.ClockRate,
+            PLXCM_I2C_TOPOLOGY_TTL_SEC,
+            (1 << ModeProp.I2c.I2cPort),
+            &I2cPorts
+            );
+    }
+
     // Build device list
     i = DeviceListCreate( PLX_API_MODE_I2C_AARDVARK, &ModeProp );
 
@@ -1208,6 +1229,18 @@ BOOLEAN Cmd_SdbConnect( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_CO
             {
                 ModeProp.Sdb.Baud = SDB_BAUD_RATE_19200;
             }
+            else if ((U8)pArg->ArgIntDec == 3)
+            {
+                ModeProp.Sdb.Baud = SDB_BAUD_RATE_230400;
+            }
+            else if ((U8)pArg->ArgIntDec == 4)
+            {
+                ModeProp.Sdb.Baud = SDB_BAUD_RATE_460800;
+            }
+            else if ((U8)pArg->ArgIntDec == 5)
+            {
+                ModeProp.Sdb.Baud = SDB_BAUD_RATE_921600;
+            }
             else
             {
                 bError = TRUE;
@@ -1241,7 +1274,8 @@ BOOLEAN Cmd_SdbConnect( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_CO
             "Usage: sdb <COM Port> <BAUD Rate> [u] \n"
             "\n"
             "    COM Port : COM/TTY port number (1,2..)\n"
-            "    BAUD Rate: 0=Default  1=19,200  2=115,2000 (default)\n"
+            "    BAUD Rate: 0=Default  1=19,200  2=115,200 (default)\n"
+            "               3=230,400  4=460,800  5=921,600 (if supported by chip UART)\n"
             "    u        : [Linux] Specify USB-to-Serial (ttyUSBx)\n"
             "\n"
             "Examples: 'sdb 1 0'   - COM1 115,200 baud\n"
@@ -2470,59 +2504,705 @@ BOOLEAN Cmd_MemRead( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMA
             // Adjust spaces
             SpacesToInsert -= (size * 2) + 1;
 
-            if (pCurrAddr >= pEndAddr)
-            {
-                bDone    = TRUE;
-                bEndLine = TRUE;
-            }
+            if (pCurrAddr >= pEndAddr)
+            {
+                bDone    = TRUE;
+                bEndLine = TRUE;
+            }
+
+            if (!bEndLine)
+            {
+                if (i == 16)
+                {
+                    i        = 0;
+                    bEndLine = TRUE;
+                }
+            }
+
+            if (bEndLine)
+            {
+                bEndLine = FALSE;
+
+                // Insert necessary spaces
+                while (SpacesToInsert--)
+                {
+                    Cons_printf(" ");
+                }
+
+                // Display characters at end of line
+                for (x = 0; x < CharsToPrint; x++)
+                {
+                    Cons_printf("%c", buffer[x]);
+                }
+
+                // Next line but check if user (Q)uit via throttle prompt
+                if (Cons_printf("\n") == 0)
+                {
+                    break;
+                }
+
+                // Check for user cancel for larger reads
+                if ((ByteCount > MIN_BYTE_CHECK_CANCEL) && Cons_kbhit())
+                {
+                    if (Cons_getch() == CONS_KEY_ESCAPE)
+                    {
+                        Cons_printf(" -- USER ABORT --\n");
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    while (bRepeat);
+
+    // Disable throttle output
+    ConsoleIoThrottleSet(FALSE);
+
+    return TRUE;
+}
+
+
+
+
+/**********************************************************
+ *
+ * Function   :  Cmd_MemWrite
+ *
+ * Description:
+ *
+ *********************************************************/
+BOOLEAN Cmd_MemWrite( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd )
+{
+    U8         i;
+    U8         size;
+    U8        *pAddr;
+    BOOLEAN    bVerifyArgs;
+    PLXCM_ARG *pArg;
+
+
+    // Memory access commands only available in PCI access mode
+    if (pDevice->Key.ApiMode != PLX_API_MODE_PCI)
+    {
+        Cons_printf("Error: '%s' is only available in direct PCI access mode\n", pCmd->szCmd);
+        return FALSE;
+    }
+
+    // Set access size
+    if (pCmd->szCmd[1] == 'b')
+    {
+        size = sizeof(U8);
+    }
+    else if (pCmd->szCmd[1] == 'w')
+    {
+        size = sizeof(U16);
+    }
+    else if (pCmd->szCmd[1] == 'l')
+    {
+        size = sizeof(U32);
+    }
+    else if (pCmd->szCmd[1] == 'q')
+    {
+        size = sizeof(U64);
+    }
+    else
+    {
+        return FALSE;
+    }
+
+    if (pCmd->NumArgs < 2)
+    {
+        Cons_printf(
+            "Error: Missing parameters(s)\n"
+            "Usage:\n"
+            "   e<b,w,l,q> <virtual_address> <value1> [value2 value3 ... valueN]\n"
+            );
+
+        return TRUE;
+    }
+
+    // Get starting address
+    pArg = CmdLine_ArgGet( pCmd, 0 );
+
+    // Verify argument
+    if (pArg->ArgType != PLXCM_ARG_TYPE_INT)
+    {
+        Cons_printf("Error: '%s' is not a valid address\n", pArg->ArgString);
+        return FALSE;
+    }
+
+    // Set current address
+    pAddr = PLX_CAST_64_TO_8_PTR( (PLX_UINT_PTR)pArg->ArgIntHex );
+
+    bVerifyArgs = TRUE;
+
+    do
+    {
+        for (i = 1; i < pCmd->NumArgs; i++)
+        {
+            // Get argument
+            pArg = CmdLine_ArgGet( pCmd, i );
+
+            if (bVerifyArgs)
+            {
+                // Verify arguments
+                if (pArg->ArgType != PLXCM_ARG_TYPE_INT)
+                {
+                    Cons_printf(
+                        "Error: Parameter %d (%s) is not a valid value\n",
+                        i+1, pArg->ArgString
+                        );
+                    return FALSE;
+                }
+            }
+            else
+            {
+                // Perform writes
+                switch (size)
+                {
+                    case sizeof(U8):
+                        PlxCm_MemWrite_8(pAddr, (U8)pArg->ArgIntHex);
+                        break;
+
+                    case sizeof(U16):
+                        PlxCm_MemWrite_16(pAddr, (U16)pArg->ArgIntHex);
+                        break;
+
+                    case sizeof(U32):
+                        PlxCm_MemWrite_32(pAddr, (U32)pArg->ArgIntHex);
+                        break;
+                }
+
+                pAddr += size;
+            }
+        }
+
+        if (bVerifyArgs == FALSE)
+        {
+            break;
+        }
+
+        bVerifyArgs = FALSE;
+    }
+    while (1);
+
+    return TRUE;
+}
+
+
+
+
+/**********************************************************
+ *
+ * Function   :  Cmd_MemFill
+ *
+ * Description:  Fills a memory range with a 32-bit pattern
+ *
+ *********************************************************/
+BOOLEAN Cmd_MemFill( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd )
+{
+    U8           *pAddr;
+    U32           value;
+    U32           offset;
+    U32           ByteCount;
+    PLXCM_ARG    *pArg;
+    struct timeb  end;
+    struct timeb  start;
+
+
+    // Memory access commands only available in PCI access mode
+    if ((pDevice == NULL) || (pDevice->Key.ApiMode != PLX_API_MODE_PCI))
+    {
+        Cons_printf("Error: '%s' is only available in direct PCI access mode\n", pCmd->szCmd);
+        return FALSE;
+    }
+
+    if (pCmd->NumArgs < 3)
+    {
+        Cons_printf(
+            "Usage: memfill <virtual_address> <byte_count> <32-bit_value>\n"
+            );
+        return FALSE;
+    }
+
+    // Get address, count & fill value
+    pArg = CmdLine_ArgGet( pCmd, 0 );
+    if (pArg->ArgType != PLXCM_ARG_TYPE_INT)
+    {
+        Cons_printf("Error: '%s' is not a valid address\n", pArg->ArgString);
+        return FALSE;
+    }
+    pAddr = PLX_CAST_64_TO_8_PTR( (PLX_UINT_PTR)pArg->ArgIntHex );
+
+    pArg = CmdLine_ArgGet( pCmd, 1 );
+    if ((pArg->ArgType != PLXCM_ARG_TYPE_INT) || (pArg->ArgIntHex & 0x3))
+    {
+        Cons_printf("Error: '%s' is not a valid DW-aligned byte count\n", pArg->ArgString);
+        return FALSE;
+    }
+    ByteCount = (U32)pArg->ArgIntHex;
+
+    pArg = CmdLine_ArgGet( pCmd, 2 );
+    if (pArg->ArgType != PLXCM_ARG_TYPE_INT)
+    {
+        Cons_printf("Error: '%s' is not a valid value\n", pArg->ArgString);
+        return FALSE;
+    }
+    value = (U32)pArg->ArgIntHex;
+
+    ftime( &start );
+
+    for (offset = 0; offset < ByteCount; offset += sizeof(U32))
+    {
+        PlxCm_MemWrite_32( pAddr + offset, value );
+    }
+
+    ftime( &end );
+
+    Cons_printf(
+        "Filled %08X bytes with %08X (%.3f sec)\n",
+        ByteCount, value, PLX_DIFF_TIMEB( end, start )
+        );
+
+    Gbl_LastRetVal = ByteCount;
+
+    return TRUE;
+}
+
+
+
+
+/**********************************************************
+ *
+ * Function   :  Cmd_MemCopy
+ *
+ * Description:  Copies a memory range using the CPU or DMA
+ *
+ *********************************************************/
+BOOLEAN Cmd_MemCopy( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd )
+{
+    U8              i;
+    U8              channel;
+    U8             *pSrc;
+    U8             *pDest;
+    U32             offset;
+    U32             ByteCount;
+    U64             AddrSrc;
+    U64             AddrDest;
+    double          ElapsedTime;
+    BOOLEAN         bDma;
+    PLXCM_ARG      *pArg;
+    PLX_STATUS      status;
+    PLX_DMA_PARAMS  DmaParams;
+    struct timeb    end;
+    struct timeb    start;
+
+
+    // Memory access commands only available in PCI access mode
+    if ((pDevice == NULL) || (pDevice->Key.ApiMode != PLX_API_MODE_PCI))
+    {
+        Cons_printf("Error: '%s' is only available in direct PCI access mode\n", pCmd->szCmd);
+        return FALSE;
+    }
+
+    if (pCmd->NumArgs < 3)
+    {
+        Cons_printf(
+            "Usage: memcopy <dest_address> <src_address> <byte_count> [-dma [channel]]\n"
+            "       Addresses are virtual, or PCI physical if DMA is used\n"
+            );
+        return FALSE;
+    }
+
+    // Verify address & count parameters
+    for (i = 0; i < 3; i++)
+    {
+        pArg = CmdLine_ArgGet( pCmd, i );
+        if (pArg->ArgType != PLXCM_ARG_TYPE_INT)
+        {
+            Cons_printf("Error: Parameter %d (%s) is not a valid value\n", i+1, pArg->ArgString);
+            return FALSE;
+        }
+    }
+
+    AddrDest  = CmdLine_ArgGet( pCmd, 0 )->ArgIntHex;
+    AddrSrc   = CmdLine_ArgGet( pCmd, 1 )->ArgIntHex;
+    ByteCount = (U32)CmdLine_ArgGet( pCmd, 2 )->ArgIntHex;
+
+    if ((ByteCount == 0) || (ByteCount & 0x3))
+    {
+        Cons_printf("Error: Byte count must be a non-zero multiple of 4\n");
+        return FALSE;
+    }
+
+    // Check for DMA option & channel
+    bDma    = FALSE;
+    channel = 0;
+
+    pArg = CmdLine_ArgGet( pCmd, 3 );
+    if (pArg != NULL)
+    {
+        if (Plx_strcasecmp( pArg->ArgString, "-dma" ) != 0)
+        {
+            Cons_printf("Error: Invalid option '%s'\n", pArg->ArgString);
+            return FALSE;
+        }
+        bDma = TRUE;
+
+        pArg = CmdLine_ArgGet( pCmd, 4 );
+        if (pArg != NULL)
+        {
+            if (pArg->ArgType != PLXCM_ARG_TYPE_INT)
+            {
+                Cons_printf("Error: '%s' is not a valid DMA channel\n", pArg->ArgString);
+                return FALSE;
+            }
+            channel = (U8)pArg->ArgIntDec;
+        }
+    }
+
+    if (bDma)
+    {
+        // DMA copy uses PCI addresses, which only the 8000 DMA engine supports
+        if (pDevice->Key.PlxFamily == PLX_FAMILY_BRIDGE_P2L)
+        {
+            Cons_printf("Error: DMA copy is only supported on 8000 DMA devices\n");
+            return FALSE;
+        }
+
+        status = PlxPci_DmaChannelOpen( pDevice, channel, NULL );
+        if (status != PLX_STATUS_OK)
+        {
+            Cons_printf("Error: Unable to open DMA channel %d (status=%Xh)\n", channel, status);
+            return FALSE;
+        }
+
+        RtlZeroMemory( &DmaParams, sizeof(PLX_DMA_PARAMS) );
+
+        DmaParams.AddrSource = AddrSrc;
+        DmaParams.AddrDest   = AddrDest;
+        DmaParams.ByteCount  = ByteCount;
+
+        ftime( &start );
+
+        status =
+            PlxPci_DmaTransferBlock(
+                pDevice,
+                channel,
+                &DmaParams,
+                PLXCM_BULK_DMA_TIMEOUT_MS
+                );
+
+        ftime( &end );
+
+        PlxPci_DmaChannelClose( pDevice, channel );
+
+        if (status != PLX_STATUS_OK)
+        {
+            Cons_printf("Error: DMA transfer failed (status=%Xh)\n", status);
+            return FALSE;
+        }
+    }
+    else
+    {
+        pDest = PLX_CAST_64_TO_8_PTR( (PLX_UINT_PTR)AddrDest );
+        pSrc  = PLX_CAST_64_TO_8_PTR( (PLX_UINT_PTR)AddrSrc );
+
+        ftime( &start );
+
+        for (offset = 0; offset < ByteCount; offset += sizeof(U32))
+        {
+            PlxCm_MemWrite_32( pDest + offset, PlxCm_MemRead_32( pSrc + offset ) );
+        }
+
+        ftime( &end );
+    }
+
+    ElapsedTime = PLX_DIFF_TIMEB( end, start );
+
+    Cons_printf(
+        "Copied %08X bytes using %s (%.3f sec",
+        ByteCount, (bDma) ? "DMA" : "CPU", ElapsedTime
+        );
+
+    if (ElapsedTime > 0)
+    {
+        Cons_printf(", %.2f MB/s", ((double)ByteCount / ElapsedTime) / (1 << 20));
+    }
+    Cons_printf(")\n");
+
+    Gbl_LastRetVal = ByteCount;
+
+    return TRUE;
+}
+
+
+
+
+/**********************************************************
+ *
+ * Function   :  Cmd_MemCompare
+ *
+ * Description:  Compares two memory ranges
+ *
+ *********************************************************/
+BOOLEAN Cmd_MemCompare( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd )
+{
+    U8         i;
+    U8        *pAddr1;
+    U8        *pAddr2;
+    U32        value1;
+    U32        value2;
+    U32        offset;
+    U32        ByteCount;
+    U32        MismatchCount;
+    PLXCM_ARG *pArg;
+
+
+    // Memory access commands only available in PCI access mode
+    if ((pDevice == NULL) || (pDevice->Key.ApiMode != PLX_API_MODE_PCI))
+    {
+        Cons_printf("Error: '%s' is only available in direct PCI access mode\n", pCmd->szCmd);
+        return FALSE;
+    }
+
+    if (pCmd->NumArgs < 3)
+    {
+        Cons_printf("Usage: memcmp <virtual_address_1> <virtual_address_2> <byte_count>\n");
+        return FALSE;
+    }
+
+    for (i = 0; i < 3; i++)
+    {
+        pArg = CmdLine_ArgGet( pCmd, i );
+        if (pArg->ArgType != PLXCM_ARG_TYPE_INT)
+        {
+            Cons_printf("Error: Parameter %d (%s) is not a valid value\n", i+1, pArg->ArgString);
+            return FALSE;
+        }
+    }
+
+    pAddr1    = PLX_CAST_64_TO_8_PTR( (PLX_UINT_PTR)CmdLine_ArgGet( pCmd, 0 )->ArgIntHex );
+    pAddr2    = PLX_CAST_64_TO_8_PTR( (PLX_UINT_PTR)CmdLine_ArgGet( pCmd, 1 )->ArgIntHex );
+    ByteCount = (U32)CmdLine_ArgGet( pCmd, 2 )->ArgIntHex;
+
+    if (ByteCount & 0x3)
+    {
+        Cons_printf("Error: Byte count must be a multiple of 4\n");
+        return FALSE;
+    }
+
+    MismatchCount = 0;
+
+    for (offset = 0; offset < ByteCount; offset += sizeof(U32))
+    {
+        value1 = PlxCm_MemRead_32( pAddr1 + offset );
+        value2 = PlxCm_MemRead_32( pAddr2 + offset );
+
+        if (value1 != value2)
+        {
+            // Only report the first few differences
+            if (MismatchCount < PLXCM_BULK_MAX_MISMATCH_SHOW)
+            {
+                Cons_printf(
+                    "  Offset %08X: %08X != %08X\n",
+                    offset, value1, value2
+                    );
+            }
+            MismatchCount++;
+        }
+    }
+
+    if (MismatchCount == 0)
+    {
+        Cons_printf("Compare %08X bytes: Match\n", ByteCount);
+    }
+    else
+    {
+        Cons_printf("Compare %08X bytes: %d DW mismatch(es)\n", ByteCount, MismatchCount);
+    }
+
+    Gbl_LastRetVal = MismatchCount;
+
+    return TRUE;
+}
+
+
+
+
+/**********************************************************
+ *
+ * Function   :  Cmd_MemChecksum
+ *
+ * Description:  Calculates a 32-bit additive checksum of a memory range
+ *
+ *********************************************************/
+BOOLEAN Cmd_MemChecksum( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd )
+{
+    U8        *pAddr;
+    U32        offset;
+    U32        checksum;
+    U32        ByteCount;
+    PLXCM_ARG *pArg;
+
+
+    // Memory access commands only available in PCI access mode
+    if ((pDevice == NULL) || (pDevice->Key.ApiMode != PLX_API_MODE_PCI))
+    {
+        Cons_printf("Error: '%s' is only available in direct PCI access mode\n", pCmd->szCmd);
+        return FALSE;
+    }
+
+    if (pCmd->NumArgs < 2)
+    {
+        Cons_printf("Usage: memsum <virtual_address> <byte_count>\n");
+        return FALSE;
+    }
+
+    pArg = CmdLine_ArgGet( pCmd, 0 );
+    if (pArg->ArgType != PLXCM_ARG_TYPE_INT)
+    {
+        Cons_printf("Error: '%s' is not a valid address\n", pArg->ArgString);
+        return FALSE;
+    }
+    pAddr = PLX_CAST_64_TO_8_PTR( (PLX_UINT_PTR)pArg->ArgIntHex );
+
+    pArg = CmdLine_ArgGet( pCmd, 1 );
+    if ((pArg->ArgType != PLXCM_ARG_TYPE_INT) || (pArg->ArgIntHex & 0x3))
+    {
+        Cons_printf("Error: '%s' is not a valid DW-aligned byte count\n", pArg->ArgString);
+        return FALSE;
+    }
+    ByteCount = (U32)pArg->ArgIntHex;
+
+    checksum = 0;
+
+    for (offset = 0; offset < ByteCount; offset += sizeof(U32))
+    {
+        checksum += PlxCm_MemRead_32( pAddr + offset );
+    }
+
+    Cons_printf("Checksum of %08X bytes: %08X\n", ByteCount, checksum);
+
+    Gbl_LastRetVal = checksum;
+
+    return TRUE;
+}
+
+
+
+
+/**********************************************************
+ *
+ * Function   :  Cmd_MemSave
+ *
+ * Description:  Saves a memory range to a binary file
+ *
+ *********************************************************/
+BOOLEAN Cmd_MemSave( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd )
+{
+    U8           *pAddr;
+    U32          *pBuffer;
+    U32           i;
+    U32           offset;
+    U32           ByteCount;
+    U32           BytesToCopy;
+    FILE         *pFile;
+    BOOLEAN       bError;
+    PLXCM_ARG    *pArg;
+    struct timeb  end;
+    struct timeb  start;
+
+
+    // Memory access commands only available in PCI access mode
+    if ((pDevice == NULL) || (pDevice->Key.ApiMode != PLX_API_MODE_PCI))
+    {
+        Cons_printf("Error: '%s' is only available in direct PCI access mode\n", pCmd->szCmd);
+        return FALSE;
+    }
+
+    if (pCmd->NumArgs < 3)
+    {
+        Cons_printf("Usage: memsave <virtual_address> <byte_count> <file_name>\n");
+        return FALSE;
+    }
+
+    pArg = CmdLine_ArgGet( pCmd, 0 );
+    if (pArg->ArgType != PLXCM_ARG_TYPE_INT)
+    {
+        Cons_printf("Error: '%s' is not a valid address\n", pArg->ArgString);
+        return FALSE;
+    }
+    pAddr = PLX_CAST_64_TO_8_PTR( (PLX_UINT_PTR)pArg->ArgIntHex );
+
+    pArg = CmdLine_ArgGet( pCmd, 1 );
+    if ((pArg->ArgType != PLXCM_ARG_TYPE_INT) || (pArg->ArgIntHex & 0x3))
+    {
+        Cons_printf("Error: '%s' is not a valid DW-aligned byte count\n", pArg->ArgString);
+        return FALSE;
+    }
+    ByteCount = (U32)pArg->ArgIntHex;
+
+    // Read memory in blocks to avoid a file write per access
+    pBuffer = malloc( PLXCM_BULK_BLOCK_SIZE );
+    if (pBuffer == NULL)
+    {
+        Cons_printf("Error: Unable to allocate buffer\n");
+        return FALSE;
+    }
+
+    pArg  = CmdLine_ArgGet( pCmd, 2 );
+    pFile = fopen( pArg->ArgString, "wb" );
+    if (pFile == NULL)
+    {
+        Cons_printf("Error: Unable to create file '%s'\n", pArg->ArgString);
+        free( pBuffer );
+        return FALSE;
+    }
+
+    ftime( &start );
+
+    bError = FALSE;
+    offset = 0;
+
+    while (offset < ByteCount)
+    {
+        BytesToCopy = ByteCount - offset;
+        if (BytesToCopy > PLXCM_BULK_BLOCK_SIZE)
+        {
+            BytesToCopy = PLXCM_BULK_BLOCK_SIZE;
+        }
 
-            if (!bEndLine)
-            {
-                if (i == 16)
-                {
-                    i        = 0;
-                    bEndLine = TRUE;
-                }
-            }
+        for (i = 0; i < (BytesToCopy / sizeof(U32)); i++)
+        {
+            pBuffer[i] = PlxCm_MemRead_32( pAddr + offset + (i * sizeof(U32)) );
+        }
 
-            if (bEndLine)
-            {
-                bEndLine = FALSE;
+        if (fwrite( pBuffer, 1, BytesToCopy, pFile ) != BytesToCopy)
+        {
+            bError = TRUE;
+            break;
+        }
 
-                // Insert necessary spaces
-                while (SpacesToInsert--)
-                {
-                    Cons_printf(" ");
-                }
+        offset += BytesToCopy;
+    }
 
-                // Display characters at end of line
-                for (x = 0; x < CharsToPrint; x++)
-                {
-                    Cons_printf("%c", buffer[x]);
-                }
+    ftime( &end );
 
-                // Next line but check if user (Q)uit via throttle prompt
-                if (Cons_printf("\n") == 0)
-                {
-                    break;
-                }
+    fclose( pFile );
+    free( pBuffer );
 
-                // Check for user cancel for larger reads
-                if ((ByteCount > MIN_BYTE_CHECK_CANCEL) && Cons_kbhit())
-                {
-                    if (Cons_getch() == CONS_KEY_ESCAPE)
-                    {
-                        Cons_printf(" -- USER ABORT --\n");
-                        break;
-                    }
-                }
-            }
-        }
+    if (bError)
+    {
+        Cons_printf("Error: Write to '%s' failed\n", pArg->ArgString);
+        return FALSE;
     }
-    while (bRepeat);
 
-    // Disable throttle output
-    ConsoleIoThrottleSet(FALSE);
+    Cons_printf(
+        "Saved %08X bytes to '%s' (%.3f sec)\n",
+        ByteCount, pArg->ArgString, PLX_DIFF_TIMEB( end, start )
+        );
+
+    Gbl_LastRetVal = ByteCount;
 
     return TRUE;
 }
@@ -2532,124 +3212,132 @@ BOOLEAN Cmd_MemRead( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMA
 
 /**********************************************************
  *
- * Function   :  Cmd_MemWrite
+ * Function   :  Cmd_MemPerf
  *
- * Description:
+ * Description:  Times repeated reads or writes over a memory range
  *
  *********************************************************/
-BOOLEAN Cmd_MemWrite( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd )
+BOOLEAN Cmd_MemPerf( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd )
 {
-    U8         i;
-    U8         size;
-    U8        *pAddr;
-    BOOLEAN    bVerifyArgs;
-    PLXCM_ARG *pArg;
+    U8           *pAddr;
+    U32           loop;
+    volatile U32  value;
+    U32           offset;
+    U32           LoopCount;
+    U32           ByteCount;
+    double        TotalBytes;
+    double        ElapsedTime;
+    BOOLEAN       bWrite;
+    PLXCM_ARG    *pArg;
+    struct timeb  end;
+    struct timeb  start;
 
 
     // Memory access commands only available in PCI access mode
-    if (pDevice->Key.ApiMode != PLX_API_MODE_PCI)
+    if ((pDevice == NULL) || (pDevice->Key.ApiMode != PLX_API_MODE_PCI))
     {
         Cons_printf("Error: '%s' is only available in direct PCI access mode\n", pCmd->szCmd);
         return FALSE;
     }
 
-    // Set access size
-    if (pCmd->szCmd[1] == 'b')
-    {
-        size = sizeof(U8);
-    }
-    else if (pCmd->szCmd[1] == 'w')
+    if (pCmd->NumArgs < 3)
     {
-        size = sizeof(U16);
+        Cons_printf("Usage: memperf <rd|wr> <virtual_address> <byte_count> [loop_count]\n");
+        return FALSE;
     }
-    else if (pCmd->szCmd[1] == 'l')
+
+    // Get operation
+    pArg = CmdLine_ArgGet( pCmd, 0 );
+    if (Plx_strcasecmp( pArg->ArgString, "rd" ) == 0)
     {
-        size = sizeof(U32);
+        bWrite = FALSE;
     }
-    else if (pCmd->szCmd[1] == 'q')
+    else if (Plx_strcasecmp( pArg->ArgString, "wr" ) == 0)
     {
-        size = sizeof(U64);
+        bWrite = TRUE;
     }
     else
     {
+        Cons_printf("Error: Operation must be 'rd' or 'wr'\n");
         return FALSE;
     }
 
-    if (pCmd->NumArgs < 2)
-    {
-        Cons_printf(
-            "Error: Missing parameters(s)\n"
-            "Usage:\n"
-            "   e<b,w,l,q> <virtual_address> <value1> [value2 value3 ... valueN]\n"
-            );
-
-        return TRUE;
-    }
-
-    // Get starting address
-    pArg = CmdLine_ArgGet( pCmd, 0 );
-
-    // Verify argument
+    pArg = CmdLine_ArgGet( pCmd, 1 );
     if (pArg->ArgType != PLXCM_ARG_TYPE_INT)
     {
         Cons_printf("Error: '%s' is not a valid address\n", pArg->ArgString);
         return FALSE;
     }
-
-    // Set current address
     pAddr = PLX_CAST_64_TO_8_PTR( (PLX_UINT_PTR)pArg->ArgIntHex );
 
-    bVerifyArgs = TRUE;
+    pArg = CmdLine_ArgGet( pCmd, 2 );
+    if ((pArg->ArgType != PLXCM_ARG_TYPE_INT) || (pArg->ArgIntHex & 0x3))
+    {
+        Cons_printf("Error: '%s' is not a valid DW-aligned byte count\n", pArg->ArgString);
+        return FALSE;
+    }
+    ByteCount = (U32)pArg->ArgIntHex;
 
-    do
+    // Loop count is decimal
+    LoopCount = 1;
+    pArg      = CmdLine_ArgGet( pCmd, 3 );
+    if (pArg != NULL)
     {
-        for (i = 1; i < pCmd->NumArgs; i++)
+        if (pArg->ArgType != PLXCM_ARG_TYPE_INT)
         {
-            // Get argument
-            pArg = CmdLine_ArgGet( pCmd, i );
+            Cons_printf("Error: '%s' is not a valid loop count\n", pArg->ArgString);
+            return FALSE;
+        }
+        LoopCount = (U32)pArg->ArgIntDec;
+    }
 
-            if (bVerifyArgs)
+    value = 0;
+
+    ftime( &start );
+
+    for (loop = 0; loop < LoopCount; loop++)
+    {
+        if (bWrite)
+        {
+            for (offset = 0; offset < ByteCount; offset += sizeof(U32))
             {
-                // Verify arguments
-                if (pArg->ArgType != PLXCM_ARG_TYPE_INT)
-                {
-                    Cons_printf(
-                        "Error: Parameter %d (%s) is not a valid value\n",
-                        i+1, pArg->ArgString
-                        );
-                    return FALSE;
-                }
+                PlxCm_MemWrite_32( pAddr + offset, offset );
             }
-            else
+        }
+        else
+        {
+            for (offset = 0; offset < ByteCount; offset += sizeof(U32))
             {
-                // Perform writes
-                switch (size)
-                {
-                    case sizeof(U8):
-                        PlxCm_MemWrite_8(pAddr, (U8)pArg->ArgIntHex);
-                        break;
+                value = PlxCm_MemRead_32( pAddr + offset );
+            }
+        }
+    }
 
-                    case sizeof(U16):
-                        PlxCm_MemWrite_16(pAddr, (U16)pArg->ArgIntHex);
-                        break;
+    ftime( &end );
 
-                    case sizeof(U32):
-                        PlxCm_MemWrite_32(pAddr, (U32)pArg->ArgIntHex);
-                        break;
-                }
+    // Added to prevent compiler warning
+    if (value)
+    {
+    }
 
-                pAddr += size;
-            }
-        }
+    ElapsedTime = PLX_DIFF_TIMEB( end, start );
+    TotalBytes  = (double)ByteCount * LoopCount;
 
-        if (bVerifyArgs == FALSE)
-        {
-            break;
-        }
+    Cons_printf(
+        "%s %.0f bytes in %.3f sec",
+        (bWrite) ? "Wrote" : "Read", TotalBytes, ElapsedTime
+        );
 
-        bVerifyArgs = FALSE;
+    if (ElapsedTime > 0)
+    {
+        Cons_printf(" (%.2f MB/s)", (TotalBytes / ElapsedTime) / (1 << 20));
+        Gbl_LastRetVal = (U64)(TotalBytes / ElapsedTime);
     }
-    while (1);
+    else
+    {
+        Gbl_LastRetVal = 0;
+    }
+    Cons_printf("\n");
 
     return TRUE;
 }
@@ -3860,6 +4548,119 @@ BOOLEAN Cmd_RegDump( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMA
 
 
 
+/**********************************************************
+ *
+ * Function   :  Cmd_RegSnapshot
+ *
+ * Description:  Saves a snapshot of all port registers or displays
+ *               differences between snapshots or the live device
+ *
+ *********************************************************/
+BOOLEAN Cmd_RegSnapshot( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd )
+{
+    U32           DiffCount;
+    BOOLEAN       bOk;
+    PLXCM_ARG    *pArg;
+    REG_SNAPSHOT  SnapOld;
+    REG_SNAPSHOT  SnapNew;
+    struct timeb  end;
+    struct timeb  start;
+
+
+    if (pCmd->NumArgs == 0)
+    {
+        Cons_printf(
+            "Usage: regsave <file_name>\n"
+            "       regdiff <file_name> [file_name_2]\n"
+            "       Without a 2nd file, regdiff compares against the selected device\n"
+            );
+        return TRUE;
+    }
+
+    ftime( &start );
+
+    pArg = CmdLine_ArgGet( pCmd, 0 );
+
+    if (Plx_strcasecmp( pCmd->szCmd, "regsave" ) == 0)
+    {
+        if ( (pDevice == NULL) || (pNode == NULL) )
+        {
+            Cons_printf("Error: No device selected\n");
+            return FALSE;
+        }
+
+        if (Plx_RegSnapshotCapture( pDevice, &SnapNew ) == FALSE)
+        {
+            return FALSE;
+        }
+
+        bOk = Plx_RegSnapshotFileSave( &SnapNew, pArg->ArgString );
+
+        ftime( &end );
+
+        if (bOk)
+        {
+            Cons_printf(
+                "Saved %d ports to '%s' (%.3f sec)\n",
+                SnapNew.Hdr.PortCount, pArg->ArgString, PLX_DIFF_TIMEB( end, start )
+                );
+        }
+
+        Plx_RegSnapshotFree( &SnapNew );
+
+        Gbl_LastRetVal = (bOk) ? 1 : 0;
+
+        return bOk;
+    }
+
+    // Load baseline snapshot
+    if (Plx_RegSnapshotFileLoad( pArg->ArgString, &SnapOld ) == FALSE)
+    {
+        return FALSE;
+    }
+
+    // Compare against 2nd file or capture live device
+    pArg = CmdLine_ArgGet( pCmd, 1 );
+    if (pArg != NULL)
+    {
+        bOk = Plx_RegSnapshotFileLoad( pArg->ArgString, &SnapNew );
+    }
+    else if ( (pDevice == NULL) || (pNode == NULL) )
+    {
+        Cons_printf("Error: No device selected\n");
+        bOk = FALSE;
+    }
+    else
+    {
+        bOk = Plx_RegSnapshotCapture( pDevice, &SnapNew );
+    }
+
+    if (bOk == FALSE)
+    {
+        Plx_RegSnapshotFree( &SnapOld );
+        return FALSE;
+    }
+
+    DiffCount = Plx_RegSnapshotDiff( &SnapOld, &SnapNew );
+
+    ftime( &end );
+
+    Cons_printf(
+        "%d difference(s) found (%.3f sec)\n",
+        DiffCount, PLX_DIFF_TIMEB( end, start )
+        );
+
+    Plx_RegSnapshotFree( &SnapOld );
+    Plx_RegSnapshotFree( &SnapNew );
+
+    Gbl_LastRetVal = DiffCount;
+
+    return TRUE;
+}
+
+
+
+
 /**********************************************************
  *
  * Function   :  Cmd_Eep
@@ -4505,6 +5306,7 @@ BOOLEAN Cmd_EepFile( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMA
     BOOLEAN    bLoadFile;
     BOOLEAN    bEndianSwap;
     BOOLEAN    bBypassVerify;
+    BOOLEAN    bDiffOnly;
     PLXCM_ARG *pArg;
     PLXCM_ARG *pArgFile;
 
@@ -4518,6 +5320,9 @@ BOOLEAN Cmd_EepFile( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMA
     // Default not to bypass data verification
     bBypassVerify = FALSE;
 
+    // Default to program all values
+    bDiffOnly = FALSE;
+
     // Flag file name not set
     pArgFile = NULL;
 
@@ -4531,6 +5336,10 @@ BOOLEAN Cmd_EepFile( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMA
         {
             bBypassVerify = TRUE;
         }
+        else if (Plx_strcasecmp( pArg->ArgString, "-u" ) == 0)
+        {
+            bDiffOnly = TRUE;
+        }
         else if (pArg->ArgString[0] == '-')
         {
             // Final check - unknown parameter
@@ -4653,7 +5462,8 @@ BOOLEAN Cmd_EepFile( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMA
                     pDevice,
                     pArgFile->ArgString,     // File name
                     bCrc,
-                    bBypassVerify
+                    bBypassVerify,
+                    bDiffOnly
                     );
             }
             else
@@ -4726,7 +5536,8 @@ BOOLEAN Cmd_EepFile( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMA
             EepPortSize,
             bCrc,
             bBypassVerify,
-            bEndianSwap
+            bEndianSwap,
+            bDiffOnly
             );
     }
     else
@@ -5399,6 +6210,10 @@ BOOLEAN Cmd_SpiFile( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMA
         {
             nvFlags |= PEX_NV_FLAG_BYPASS_VERIFY;
         }
+        else if (bLoad && (Plx_strcasecmp( pArg->ArgString, "/u" ) == 0))
+        {
+            nvFlags |= PEX_NV_FLAG_DIFF_ONLY;
+        }
         else if (Plx_strcasecmp( pArg->ArgString, "/nr" ) == 0)
         {
             nvFlags &= ~PEX_NV_FLAG_CPU_IN_RESET;
@@ -5526,12 +6341,13 @@ BOOLEAN Cmd_SpiFile( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMA
             Cons_printf(
                 "spiload  - Programs flash with contents from a file\n"
                 "\n"
-                "Usage: spiload <FileName> [/o offset] [/cs <ChipSel>] [/b] [-mmr] [/nr]\n"
+                "Usage: spiload <FileName> [/o offset] [/cs <ChipSel>] [/b] [/u] [-mmr] [/nr]\n"
                 "\n"
                 "    FileName   : Name of the file to load\n"
                 "    /o offset  : Specify the starting offset to program (default=0)\n"
                 "    /cs ChipSel: Specify the flash chip select (default=0)\n"
                 "    /b         : Skip data verification read-back\n"
+                "    /u         : Only erase & program sectors that differ from file\n"
                 "    /mmr       : Use mem-mapped reads for verify, if supported\n"
                 "    /nr        : Do not put embedded CPU in reset\n"
                 "\n"
@@ -56,6 +56,10 @@
  *          Definitions
  ************************************/
 #define MIN_BYTE_CHECK_CANCEL         (4 * 1024)   // Min bytes before check for user abort
+#define PLXCM_I2C_TOPOLOGY_TTL_SEC    30           // Time I2C scan results are re-used
+#define PLXCM_BULK_BLOCK_SIZE         (64 * 1024)  // Buffer size for bulk memory file operations
+#define PLXCM_BULK_DMA_TIMEOUT_MS     (10 * 1000)  // Timeout for bulk memory DMA transfers
+#define PLXCM_BULK_MAX_MISMATCH_SHOW  8            // Max compare differences to display
 
 typedef enum
 {
@@ -82,11 +86,18 @@ typedef enum
     CMD_BUFFER,
     CMD_MEM_READ,
     CMD_MEM_WRITE,
+    CMD_MEM_FILL,
+    CMD_MEM_COPY,
+    CMD_MEM_CMP,
+    CMD_MEM_SUM,
+    CMD_MEM_SAVE,
+    CMD_MEM_PERF,
     CMD_IO_READ,
     CMD_IO_WRITE,
     CMD_REG_PCI,
     CMD_REG_PLX,
     CMD_REG_DUMP,
+    CMD_REG_SNAP,
     CMD_EEP,
     CMD_EEP_FILE,
     CMD_SPI_RW,
@@ -122,11 +133,18 @@ BOOLEAN Cmd_VarSet     ( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_C
 BOOLEAN Cmd_ShowBuffer ( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd );
 BOOLEAN Cmd_MemRead    ( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd );
 BOOLEAN Cmd_MemWrite   ( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd );
+BOOLEAN Cmd_MemFill    ( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd );
+BOOLEAN Cmd_MemCopy    ( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd );
+BOOLEAN Cmd_MemCompare ( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd );
+BOOLEAN Cmd_MemChecksum( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd );
+BOOLEAN Cmd_MemSave    ( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd );
+BOOLEAN Cmd_MemPerf    ( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd );
 BOOLEAN Cmd_IoRead     ( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd );
 BOOLEAN Cmd_IoWrite    ( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd );
 BOOLEAN Cmd_RegPci     ( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd );
 BOOLEAN Cmd_RegPlx     ( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd );
 BOOLEAN Cmd_RegDump    ( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd );
+BOOLEAN Cmd_RegSnapshot( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd );
 BOOLEAN Cmd_Eep        ( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd );
 BOOLEAN Cmd_Eep8000    ( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd );
 BOOLEAN Cmd_EepFile    ( DEVICE_NODE *pNode, PLX_DEVICE_OBJECT *pDevice, PLXCM_COMMAND *pCmd );
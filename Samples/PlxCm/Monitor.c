@@ -67,6 +67,7 @@ static PLXCM_COMMAND     *Gbl_pPostedCmd;
 static DEVICE_NODE       *Gbl_pNodeCurrent;
 static PLX_DEVICE_OBJECT  Gbl_DeviceObj;
 static FILE              *Gbl_pScriptFile = NULL;
+static BOOLEAN            Gbl_bBatchMode  = FALSE;
 
 U8  Gbl_PciDriverFound;     // Flag whether at least 1 PCI driver detected
 U64 Gbl_LastRetVal = 0;     // Last return value from a command
@@ -97,11 +98,18 @@ static FN_TABLE Gbl_FnTable[] =
     { CMD_BUFFER    , FALSE, "buffer/buff"             , Cmd_ShowBuffer  },
     { CMD_MEM_READ  ,  TRUE, "db/dw/dl/dq"             , Cmd_MemRead     },
     { CMD_MEM_WRITE ,  TRUE, "eb/ew/el/eq"             , Cmd_MemWrite    },
+    { CMD_MEM_FILL  ,  TRUE, "memfill"                 , Cmd_MemFill     },
+    { CMD_MEM_COPY  ,  TRUE, "memcopy"                 , Cmd_MemCopy     },
+    { CMD_MEM_CMP   ,  TRUE, "memcmp"                  , Cmd_MemCompare  },
+    { CMD_MEM_SUM   ,  TRUE, "memsum"                  , Cmd_MemChecksum },
+    { CMD_MEM_SAVE  ,  TRUE, "memsave"                 , Cmd_MemSave     },
+    { CMD_MEM_PERF  ,  TRUE, "memperf"                 , Cmd_MemPerf     },
     { CMD_IO_READ   ,  TRUE, "ib/iw/il"                , Cmd_IoRead      },
     { CMD_IO_WRITE  ,  TRUE, "ob/ow/ol"                , Cmd_IoWrite     },
     { CMD_REG_PCI   ,  TRUE, "pcr/pci"                 , Cmd_RegPci      },
     { CMD_REG_PLX   ,  TRUE, "reg/mmr/lcr/rtr/dma/mqr" , Cmd_RegPlx      },
     { CMD_REG_DUMP  ,  TRUE, "dp/dr"                   , Cmd_RegDump     },
+    { CMD_REG_SNAP  , FALSE, "regsave/regdiff"         , Cmd_RegSnapshot },
     { CMD_EEP       ,  TRUE, "eep"                     , Cmd_Eep         },
     { CMD_EEP_FILE  , FALSE, "eepload/eepsave"         , Cmd_EepFile     },
     { CMD_SPI_RW    ,  TRUE, "spirw"                   , Cmd_SpiRW       },
@@ -203,8 +211,18 @@ main(
         goto __Exit_App;
     }
 
+    // Cache read-only registers to speed up I2C/MDIO/SDB accesses
+    PlxPci_RegisterCacheEnable( TRUE );
+
     // Start the monitor
-    Monitor();
+    if (Gbl_bBatchMode)
+    {
+        ExitCode = MonitorBatch();
+    }
+    else
+    {
+        Monitor();
+    }
 
     // Free device list
     DeviceListFree();
@@ -245,6 +263,7 @@ ProcessMonitorParams(
 
     // Set default options
     Gbl_pScriptFile = NULL;
+    Gbl_bBatchMode  = FALSE;
 
     bGetFileName = FALSE;
 
@@ -252,14 +271,22 @@ ProcessMonitorParams(
     {
         if (bGetFileName)
         {
-            if (argv[i][0] == '-')
+            if ((argv[i][0] == '-') && (argv[i][1] != '\0'))
             {
                 Cons_printf("ERROR: File name not specified\n");
                 return -1;
             }
 
-            // Attempt to open the file
-            Gbl_pScriptFile = fopen( argv[i], "rt" );
+            // Attempt to open the file, '-' in batch mode selects stdin
+            if (Gbl_bBatchMode && (strcmp( argv[i], "-" ) == 0))
+            {
+                Gbl_pScriptFile = stdin;
+            }
+            else
+            {
+                Gbl_pScriptFile = fopen( argv[i], "rt" );
+            }
+
             if (Gbl_pScriptFile == NULL)
             {
                 Cons_printf("ERROR: Unable to open script file\n");
@@ -274,6 +301,12 @@ ProcessMonitorParams(
             // Set flag to get file name
             bGetFileName = TRUE;
         }
+        else if (Plx_strcasecmp(argv[i], "-b") == 0)
+        {
+            // Run script non-interactively
+            Gbl_bBatchMode = TRUE;
+            bGetFileName   = TRUE;
+        }
         else
         {
             Cons_printf("ERROR: Invalid argument \'%s\'\n", argv[i]);
@@ -323,33 +356,8 @@ Monitor(
     Cons_printf("Searching for devices...");
     Cons_fflush( stdout );
 
-    // Make sure no device is selected
-    Gbl_pNodeCurrent = NULL;
-
-    // Build PCI device list
-    DeviceListCreate( PLX_API_MODE_PCI, NULL );
-
-    // Select first PLX device
-    Gbl_pNodeCurrent =
-        DeviceNodeGetByNum(
-            0,
-            TRUE        // PLX only device
-            );
-
-    if (Gbl_pNodeCurrent != NULL)
-    {
-        // Select the device
-        PlxPci_DeviceOpen( &Gbl_pNodeCurrent->Key, &Gbl_DeviceObj );
-
-        // Map valid PCI BAR spaces
-        PciSpacesMap( &Gbl_DeviceObj );
-
-        // Get Common buffer properties
-        CommonBufferMap( &Gbl_DeviceObj );
-
-        // Mark device as selected
-        Gbl_pNodeCurrent->DevFlags |= PEX_DEV_FLAG_IS_SELECTED;
-    }
+    // Build device list & select first PLX device
+    MonitorDefaultDeviceSelect();
 
     Cons_clear();
 
@@ -461,17 +469,7 @@ Monitor(
                         (pCmd->pCmdRoutine == NULL) &&
                         (pCmd->bErrorParse == FALSE))
                     {
-                        if (pDevice)
-                        {
-                            // Unmap PCI BAR spaces
-                            PciSpacesUnmap( pDevice );
-
-                            // Release common buffer
-                            CommonBufferUnmap( pDevice );
-
-                            // Make sure device is closed
-                            PlxPci_DeviceClose( pDevice );
-                        }
+                        MonitorDeviceRelease( pDevice );
                         return;
                     }
 
@@ -790,6 +788,185 @@ _Monitor_StandardKey:
 
 
 
+/**********************************************************
+ *
+ * Function   :  MonitorBatch
+ *
+ * Description:  Executes script commands without user interaction
+ *
+ *********************************************************/
+S8
+MonitorBatch(
+    VOID
+    )
+{
+    S8                 ExitCode;
+    U32                LineNum;
+    char              *pStr;
+    char               buffer[MAX_CMDLN_LEN];
+    PLXCM_COMMAND     *pCmd;
+    PLX_DEVICE_OBJECT *pDevice;
+
+
+    // Batch output is never paged
+    ConsoleIoThrottleSet( FALSE );
+    ConsoleIoThrottleLock( TRUE );
+
+    // Build device list & select first PLX device
+    MonitorDefaultDeviceSelect();
+
+    Gbl_PciDriverFound = (Gbl_pNodeCurrent != NULL);
+
+    ExitCode = 0;
+    LineNum  = 0;
+
+    while (fgets( buffer, MAX_CMDLN_LEN, Gbl_pScriptFile ) != NULL)
+    {
+        LineNum++;
+
+        // Remove comments & end-of-line characters
+        pStr = strpbrk( buffer, "#\r\n" );
+        if (pStr != NULL)
+        {
+            *pStr = '\0';
+        }
+
+        // Skip leading whitespace & empty lines
+        pStr = buffer;
+        while (isspace( (int)*pStr ))
+        {
+            pStr++;
+        }
+
+        if (*pStr == '\0')
+        {
+            continue;
+        }
+
+        // Echo command for script logs
+        Cons_printf( MONITOR_PROMPT "%s\n", pStr );
+
+        // Set device object parameter to pass
+        if (Gbl_pNodeCurrent == NULL)
+        {
+            pDevice = NULL;
+        }
+        else
+        {
+            pDevice = &Gbl_DeviceObj;
+        }
+
+        // Process the command & stop script on any failure
+        pCmd = ProcessCommand( Gbl_pNodeCurrent, pDevice, pStr );
+        if ((pCmd == NULL) || pCmd->bErrorParse)
+        {
+            Cons_printf("ERROR: Script aborted at line %d\n", LineNum);
+            ExitCode = -1;
+            break;
+        }
+
+        // Update 'RetVal' system variable to latest value
+        sprintf( buffer, "%08lX", (unsigned long)Gbl_LastRetVal );
+        CmdLine_VarAdd( "RetVal", buffer, TRUE );
+
+        // Check for exit command
+        if (pCmd->pCmdRoutine == NULL)
+        {
+            break;
+        }
+    }
+
+    if (Gbl_pScriptFile != stdin)
+    {
+        fclose( Gbl_pScriptFile );
+    }
+    Gbl_pScriptFile = NULL;
+
+    if (Gbl_pNodeCurrent != NULL)
+    {
+        MonitorDeviceRelease( &Gbl_DeviceObj );
+    }
+
+    return ExitCode;
+}
+
+
+
+
+/**********************************************************
+ *
+ * Function   :  MonitorDefaultDeviceSelect
+ *
+ * Description:  Builds the PCI device list & selects the first PLX device
+ *
+ *********************************************************/
+VOID
+MonitorDefaultDeviceSelect(
+    VOID
+    )
+{
+    // Make sure no device is selected
+    Gbl_pNodeCurrent = NULL;
+
+    // Build PCI device list
+    DeviceListCreate( PLX_API_MODE_PCI, NULL );
+
+    // Select first PLX device
+    Gbl_pNodeCurrent =
+        DeviceNodeGetByNum(
+            0,
+            TRUE        // PLX only device
+            );
+
+    if (Gbl_pNodeCurrent != NULL)
+    {
+        // Select the device
+        PlxPci_DeviceOpen( &Gbl_pNodeCurrent->Key, &Gbl_DeviceObj );
+
+        // Map valid PCI BAR spaces
+        PciSpacesMap( &Gbl_DeviceObj );
+
+        // Get Common buffer properties
+        CommonBufferMap( &Gbl_DeviceObj );
+
+        // Mark device as selected
+        Gbl_pNodeCurrent->DevFlags |= PEX_DEV_FLAG_IS_SELECTED;
+    }
+}
+
+
+
+
+/**********************************************************
+ *
+ * Function   :  MonitorDeviceRelease
+ *
+ * Description:  Unmaps resources & closes the selected device
+ *
+ *********************************************************/
+VOID
+MonitorDeviceRelease(
+    PLX_DEVICE_OBJECT *pDevice
+    )
+{
+    if (pDevice == NULL)
+    {
+        return;
+    }
+
+    // Unmap PCI BAR spaces
+    PciSpacesUnmap( pDevice );
+
+    // Release common buffer
+    CommonBufferUnmap( pDevice );
+
+    // Make sure device is closed
+    PlxPci_DeviceClose( pDevice );
+}
+
+
+
+
 /**********************************************************
  *
  * Function   :  ProcessCommand
@@ -833,8 +1010,11 @@ ProcessCommand(
             return NULL;
         }
 
-        // Call the command
-        pCmd->pCmdRoutine( pNode, pDevice, pCmd );
+        // Call the command & report failure to caller
+        if (pCmd->pCmdRoutine( pNode, pDevice, pCmd ) == FALSE)
+        {
+            return NULL;
+        }
     }
 
     return pCmd;
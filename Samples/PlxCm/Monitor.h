@@ -88,7 +88,8 @@ typedef enum _PEX_NV_FLAGS
 {
     PEX_NV_FLAG_NONE            = 0,        // No flags
     PEX_NV_FLAG_CPU_IN_RESET    = (1 << 1), // Put CPU in reset during operation
-    PEX_NV_FLAG_BYPASS_VERIFY   = (1 << 2)  // Do not verify write values
+    PEX_NV_FLAG_BYPASS_VERIFY   = (1 << 2), // Do not verify write values
+    PEX_NV_FLAG_DIFF_ONLY       = (1 << 3)  // Only erase/program data that differs
 } PEX_NV_FLAGS;
 
 
@@ -118,6 +119,21 @@ Monitor(
     VOID
     );
 
+S8
+MonitorBatch(
+    VOID
+    );
+
+VOID
+MonitorDefaultDeviceSelect(
+    VOID
+    );
+
+VOID
+MonitorDeviceRelease(
+    PLX_DEVICE_OBJECT *pDevice
+    );
+
 PLXCM_COMMAND*
 ProcessCommand(
     DEVICE_NODE       *pNode,
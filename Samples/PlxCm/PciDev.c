@@ -46,6 +46,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/timeb.h>
 #include "Monitor.h"
 #include "PciDev.h"
@@ -313,6 +314,9 @@ DeviceListCreate(
 
     DevCount = 0;
 
+    // Discard cached registers so a rescan reflects current hardware
+    PlxPci_RegisterCacheFlush( NULL );
+
     // Find all devices
     DevNum = 0;
 
@@ -1490,7 +1494,8 @@ Plx_EepromFileLoad(
     U8                 EepPortSize,
     BOOLEAN            bCrc,
     BOOLEAN            bBypassVerify,
-    BOOLEAN            bEndianSwap
+    BOOLEAN            bEndianSwap,
+    BOOLEAN            bDiffOnly
     )
 {
     S8            rc;
@@ -1499,6 +1504,7 @@ Plx_EepromFileLoad(
     U32           value;
     U32           Verify_Value;
     U32           FileSize;
+    U32           BytesWritten;
     U32          *pBuffer;
     FILE         *pFile;
     struct timeb  end;
@@ -1570,6 +1576,8 @@ Plx_EepromFileLoad(
 
     Cons_printf("Program EEPROM......... ");
 
+    BytesWritten = 0;
+
     // Write buffer into EEPROM
     for (offset = 0; offset < FileSize; offset += sizeof(U32))
     {
@@ -1600,8 +1608,19 @@ Plx_EepromFileLoad(
             }
         }
 
+        // Skip values already programmed if requested
+        if (bDiffOnly)
+        {
+            PlxPci_EepromReadByOffset( pDevice, offset, &Verify_Value );
+            if (Verify_Value == value)
+            {
+                continue;
+            }
+        }
+
         // Store next value
         PlxPci_EepromWriteByOffset( pDevice, offset, value );
+        BytesWritten += sizeof(U32);
 
         // Verify value unless ignore option enabled
         if (bBypassVerify)
@@ -1626,7 +1645,14 @@ Plx_EepromFileLoad(
 
     if (rc == TRUE)
     {
-        Cons_printf("Ok \n");
+        if (bDiffOnly)
+        {
+            Cons_printf("Ok (%dB updated)\n", BytesWritten);
+        }
+        else
+        {
+            Cons_printf("Ok \n");
+        }
 
         // Update CRC if requested
         if (bCrc)
@@ -1802,17 +1828,20 @@ Plx8000_EepromFileLoad(
     PLX_DEVICE_OBJECT *pDevice,
     char              *pFileName,
     BOOLEAN            bCrc,
-    BOOLEAN            bBypassVerify
+    BOOLEAN            bBypassVerify,
+    BOOLEAN            bDiffOnly
     )
 {
     U8            bCrcEn;
     U8           *pBuffer;
+    U8           *pCurrent;
     U16           Verify_Value_16;
     U32           value;
     U32           Verify_Value;
     U32           Crc;
     U32           offset;
     U32           FileSize;
+    U32           BytesWritten;
     U32           EepHeader;
     FILE         *pFile;
     struct timeb  end;
@@ -1823,6 +1852,7 @@ Plx8000_EepromFileLoad(
     ftime( &start );
 
     pBuffer   = NULL;
+    pCurrent  = NULL;
     EepHeader = 0;
 
     // Start with CRC option matching CRC support
@@ -1877,8 +1907,29 @@ Plx8000_EepromFileLoad(
           : "ENABLED (Use '/b' to disable)"
         );
 
+    // Get current EEPROM contents to only update values that differ
+    if (bDiffOnly && ((FileSize & ~0x3) != 0))
+    {
+        pCurrent = malloc( FileSize & ~0x3 );
+        if (pCurrent != NULL)
+        {
+            if (PlxPci_EepromReadBuffer(
+                    pDevice,
+                    0,
+                    pCurrent,
+                    FileSize & ~0x3
+                    ) != PLX_STATUS_OK)
+            {
+                free( pCurrent );
+                pCurrent = NULL;
+            }
+        }
+    }
+
     Cons_printf("Program EEPROM..... ");
 
+    BytesWritten = 0;
+
     // Write 32-bit aligned buffer into EEPROM
     for (offset = 0; offset < (FileSize & ~0x3); offset += sizeof(U32))
     {
@@ -1909,8 +1960,15 @@ Plx8000_EepromFileLoad(
             }
         }
 
+        // Skip value if already programmed
+        if ((pCurrent != NULL) && (*(U32*)(pCurrent + offset) == value))
+        {
+            continue;
+        }
+
         // Write value & read back to verify
         PlxPci_EepromWriteByOffset( pDevice, offset, value );
+        BytesWritten += sizeof(U32);
 
         // Verify value unless ignore option enabled
         if (bBypassVerify)
@@ -1938,29 +1996,48 @@ Plx8000_EepromFileLoad(
         // Get next value
         value = *(U16*)(pBuffer + offset);
 
-        // Write value & read back to verify
-        PlxPci_EepromWriteByOffset_16( pDevice, offset, (U16)value );
-
-        // Verify value unless ignore option enabled
-        if (bBypassVerify)
-        {
-            Verify_Value_16 = (U16)value;
-        }
-        else
+        // Skip value if already programmed
+        Verify_Value_16 = (U16)~value;
+        if (bDiffOnly)
         {
             PlxPci_EepromReadByOffset_16( pDevice, offset, &Verify_Value_16 );
         }
 
         if (Verify_Value_16 != (U16)value)
         {
-            Cons_printf(
-                "ERROR: offset:%02X  wrote:%04X  read:%04X\n",
-                offset, value, Verify_Value_16
-                );
-            goto _Exit_File_Load_8000;
+            // Write value & read back to verify
+            PlxPci_EepromWriteByOffset_16( pDevice, offset, (U16)value );
+            BytesWritten += sizeof(U16);
+
+            // Verify value unless ignore option enabled
+            if (bBypassVerify)
+            {
+                Verify_Value_16 = (U16)value;
+            }
+            else
+            {
+                PlxPci_EepromReadByOffset_16( pDevice, offset, &Verify_Value_16 );
+            }
+
+            if (Verify_Value_16 != (U16)value)
+            {
+                Cons_printf(
+                    "ERROR: offset:%02X  wrote:%04X  read:%04X\n",
+                    offset, value, Verify_Value_16
+                    );
+                goto _Exit_File_Load_8000;
+            }
         }
     }
-    Cons_printf( "Ok \n" );
+
+    if (bDiffOnly)
+    {
+        Cons_printf( "Ok (%dB updated)\n", BytesWritten );
+    }
+    else
+    {
+        Cons_printf( "Ok \n" );
+    }
 
     // Update CRC if requested
     if (bCrc)
@@ -1982,12 +2059,17 @@ Plx8000_EepromFileLoad(
     }
 
 _Exit_File_Load_8000:
-    // Release the buffer
+    // Release the buffers
     if (pBuffer != NULL)
     {
         free( pBuffer );
     }
 
+    if (pCurrent != NULL)
+    {
+        free( pCurrent );
+    }
+
     // Note completion time
     ftime( &end );
 
@@ -2180,6 +2262,7 @@ Plx_SpiFileLoad(
 {
     S8            rc;
     U8           *ptrBuffer;
+    U8           *ptrSector;
     U8            verifyBuff[SPI_MAX_BLOCK_SIZE];
     U16           idx;
     U32           offset;
@@ -2188,6 +2271,9 @@ Plx_SpiFileLoad(
     U32           txVal;
     U32           regReset;
     U32           fileSize;
+    U32           sectorBytes;
+    U32           bytesWritten;
+    U32           sectorsErased;
     FILE         *ptrFile;
     double        elapsed;
     double        xferRate;
@@ -2300,14 +2386,30 @@ Plx_SpiFileLoad(
         StartOffset, StartOffset + fileSize - 1
         );
 
+    // Allocate sector buffers to compare against & verify flash contents
+    ptrSector   = NULL;
+    sectorBytes = ((U32)1 << PtrSpi->SectorSize);
+    if (NvFlags & PEX_NV_FLAG_DIFF_ONLY)
+    {
+        ptrSector = malloc( 2 * sectorBytes );
+        if (ptrSector == NULL)
+        {
+            Cons_printf("Error: Sector buffer allocation failure (%dB)\n", 2 * sectorBytes);
+            rc = FALSE;
+        }
+    }
+
     Cons_printf("Program flash (ESC=halt)... ");
 
+    bytesWritten  = 0;
+    sectorsErased = 0;
+
     // Write buffer into flash
     offset = 0;
     while ( (rc == TRUE) && (offset < fileSize) )
     {
         // Periodically update status
-        if ((offset & 0xF) == 0)
+        if (((offset & 0xF) == 0) || (ptrSector != NULL))
         {
             // Display current status
             Cons_printf(
@@ -2330,6 +2432,30 @@ Plx_SpiFileLoad(
             Cons_fflush( stdout );
         }
 
+        // Only update sectors that differ if requested
+        if (ptrSector != NULL)
+        {
+            // Update up to end of current sector
+            txBytes = sectorBytes - ((StartOffset + offset) & (sectorBytes - 1));
+            txBytes = PEX_MIN( txBytes, (fileSize - offset) );
+
+            rc =
+                Plx_SpiSectorUpdate(
+                    PtrDev,
+                    PtrSpi,
+                    StartOffset + offset,
+                    &ptrBuffer[offset],
+                    txBytes,
+                    ptrSector,
+                    NvFlags,
+                    &bytesWritten,
+                    &sectorsErased
+                    );
+
+            offset += txBytes;
+            continue;
+        }
+
         // Determine size of next block
         txBytes = PEX_MIN( SPI_MAX_BLOCK_SIZE, (fileSize - offset) );
 
@@ -2398,7 +2524,17 @@ Plx_SpiFileLoad(
 
     if (rc == TRUE)
     {
-        Cons_printf("Ok             \n");
+        if (ptrSector != NULL)
+        {
+            Cons_printf(
+                "Ok (%dB written, %d sector(s) erased)\n",
+                bytesWritten, sectorsErased
+                );
+        }
+        else
+        {
+            Cons_printf("Ok             \n");
+        }
     }
 
     if (NvFlags & PEX_NV_FLAG_CPU_IN_RESET)
@@ -2413,9 +2549,14 @@ Plx_SpiFileLoad(
         Cons_printf("Ok\n");
     }
 
-    // Release the buffer
+    // Release the buffers
     free( ptrBuffer );
 
+    if (ptrSector != NULL)
+    {
+        free( ptrSector );
+    }
+
     // Calculate elapsed time
     ftime( &end );
     elapsed = PLX_DIFF_TIMEB( end, start );
@@ -2446,6 +2587,267 @@ Plx_SpiFileLoad(
 
 
 
+/******************************************************************************
+ *
+ * Function   :  Plx_SpiSectorUpdate
+ *
+ * Description:  Updates a region within a single SPI flash sector, only erasing
+ *               and programming when the contents differ
+ *
+ * Notes      :  PtrSector must reference a buffer twice the size of a sector.
+ *               The second half holds data read back for verification. If an
+ *               erase is required, data in the sector outside the region is
+ *               read and re-programmed so it is preserved, and the entire
+ *               sector is verified.
+ *
+ ******************************************************************************/
+BOOLEAN
+Plx_SpiSectorUpdate(
+    PLX_DEVICE_OBJECT *PtrDev,
+    PEX_SPI_OBJ       *PtrSpi,
+    U32                Address,
+    U8                *PtrData,
+    U32                ByteCount,
+    U8                *PtrSector,
+    U8                 NvFlags,
+    U32               *PtrBytesWritten,
+    U32               *PtrSectorsErased
+    )
+{
+    U8           *ptrCur;
+    U8           *ptrNew;
+    U8           *ptrVerify;
+    U32           idx;
+    U32           txIdx;
+    U32           txBytes;
+    U32           progAddr;
+    U32           progBytes;
+    U32           pageBytes;
+    U32           sectorBase;
+    U32           sectorBytes;
+    BOOLEAN       bErase;
+    BOOLEAN       bDiffer;
+    PLX_STATUS    status;
+
+
+    pageBytes   = ((U32)1 << PtrSpi->PageSize);
+    sectorBytes = ((U32)1 << PtrSpi->SectorSize);
+    sectorBase  = PEX_P2_ROUND_DOWN( Address, sectorBytes );
+
+    // Place region at its location within the sector buffer
+    ptrCur = PtrSector + (Address - sectorBase);
+
+    // Read back data into second half of buffer, so expected data is kept
+    ptrVerify = PtrSector + sectorBytes;
+
+    // Get current contents of region
+    status =
+        PlxPci_SpiFlashReadBuffer(
+            PtrDev,
+            PtrSpi,
+            Address,
+            ptrCur,
+            ByteCount
+            );
+    if (status != PLX_STATUS_OK)
+    {
+        Cons_printf(
+            "\n\tError: SPI read failed (offset:%02X status=%Xh)\n",
+            Address, status
+            );
+        return FALSE;
+    }
+
+    // Determine if region differs & whether an erase is required
+    bDiffer = FALSE;
+    bErase  = FALSE;
+    for (idx = 0; idx < ByteCount; idx++)
+    {
+        if (ptrCur[idx] != PtrData[idx])
+        {
+            bDiffer = TRUE;
+
+            // Programming can only clear bits, any bit set requires an erase
+            if (PtrData[idx] & ~ptrCur[idx])
+            {
+                bErase = TRUE;
+                break;
+            }
+        }
+    }
+
+    // Nothing to do if already matches
+    if (bDiffer == FALSE)
+    {
+        return TRUE;
+    }
+
+    if (bErase)
+    {
+        // Preserve any data in sector before the region
+        if (Address > sectorBase)
+        {
+            status =
+                PlxPci_SpiFlashReadBuffer(
+                    PtrDev,
+                    PtrSpi,
+                    sectorBase,
+                    PtrSector,
+                    Address - sectorBase
+                    );
+        }
+
+        // Preserve any data in sector after the region
+        if ( (status == PLX_STATUS_OK) &&
+             ((Address + ByteCount) < (sectorBase + sectorBytes)) )
+        {
+            status =
+                PlxPci_SpiFlashReadBuffer(
+                    PtrDev,
+                    PtrSpi,
+                    Address + ByteCount,
+                    ptrCur + ByteCount,
+                    (sectorBase + sectorBytes) - (Address + ByteCount)
+                    );
+        }
+
+        if (status != PLX_STATUS_OK)
+        {
+            Cons_printf(
+                "\n\tError: SPI sector read failed (offset:%02X status=%Xh)\n",
+                sectorBase, status
+                );
+            return FALSE;
+        }
+
+        // Merge new data into sector
+        for (idx = 0; idx < ByteCount; idx++)
+        {
+            ptrCur[idx] = PtrData[idx];
+        }
+
+        status =
+            PlxPci_SpiFlashErase(
+                PtrDev,
+                PtrSpi,
+                sectorBase,
+                TRUE        // Wait for completion
+                );
+        if (status != PLX_STATUS_OK)
+        {
+            Cons_printf(
+                "\n\tError: SPI sector erase failed (offset:%02X status=%Xh)\n",
+                sectorBase, status
+                );
+            return FALSE;
+        }
+        (*PtrSectorsErased)++;
+
+        // Re-program entire sector
+        progAddr  = sectorBase;
+        progBytes = sectorBytes;
+        ptrNew    = PtrSector;
+    }
+    else
+    {
+        // Only program the region
+        progAddr  = Address;
+        progBytes = ByteCount;
+        ptrNew    = PtrData;
+    }
+
+    // Program each page that requires an update
+    for (idx = 0; idx < progBytes; idx += txBytes)
+    {
+        // Limit transfer to page boundary
+        txBytes = pageBytes - ((progAddr + idx) & (pageBytes - 1));
+        txBytes = PEX_MIN( txBytes, (progBytes - idx) );
+
+        // Skip page if still erased (after erase) or already matching
+        for (txIdx = idx; txIdx < (idx + txBytes); txIdx++)
+        {
+            if (bErase)
+            {
+                if (ptrNew[txIdx] != 0xFF)
+                {
+                    break;
+                }
+            }
+            else if (ptrNew[txIdx] != ptrCur[txIdx])
+            {
+                break;
+            }
+        }
+
+        if (txIdx == (idx + txBytes))
+        {
+            continue;
+        }
+
+        status =
+            PlxPci_SpiFlashWriteBuffer(
+                PtrDev,
+                PtrSpi,
+                progAddr + idx,
+                &ptrNew[idx],
+                txBytes
+                );
+        if (status != PLX_STATUS_OK)
+        {
+            Cons_printf(
+                "\n\tError: SPI block write failed (offset:%02X status=%Xh)\n",
+                (progAddr + idx), status
+                );
+            return FALSE;
+        }
+
+        *PtrBytesWritten += txBytes;
+    }
+
+    // Verify everything programmed (entire sector if erased) if option enabled
+    if ((NvFlags & PEX_NV_FLAG_BYPASS_VERIFY) == 0)
+    {
+        status =
+            PlxPci_SpiFlashReadBuffer(
+                PtrDev,
+                PtrSpi,
+                progAddr,
+                ptrVerify,
+                progBytes
+                );
+        if (status != PLX_STATUS_OK)
+        {
+            Cons_printf(
+                "\n\tError: SPI block read for verification failed (offset:%02X status=%Xh)\n",
+                progAddr, status
+                );
+            return FALSE;
+        }
+
+        if (memcmp( ptrVerify, ptrNew, progBytes ) != 0)
+        {
+            // Report first mismatch
+            for (idx = 0; idx < progBytes; idx++)
+            {
+                if (ptrVerify[idx] != ptrNew[idx])
+                {
+                    Cons_printf(
+                        "\n\tERROR: offset:%02X  wrote:%02X  read:%02X\n",
+                        progAddr + idx, ptrNew[idx], ptrVerify[idx]
+                        );
+                    break;
+                }
+            }
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+
+
+
 /******************************************************************************
  *
  * Function   :  Plx_SpiFileSave
@@ -2680,3 +3082,355 @@ Plx_SpiFileSave(
 
     return rc;
 }
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Plx_RegSnapshotCapture
+ *
+ * Description:  Captures the register space of all enabled switch ports
+ *
+ * Notes      :  Each run of consecutive ports is read with a single buffer
+ *               request, rather than one request per register.
+ *
+ ******************************************************************************/
+BOOLEAN
+Plx_RegSnapshotCapture(
+    PLX_DEVICE_OBJECT *pDevice,
+    REG_SNAPSHOT      *pSnap
+    )
+{
+    U16           port;
+    U16           portFirst;
+    U32           blockIdx;
+    PLX_STATUS    status;
+    PEX_CHIP_FEAT chipFeat;
+
+
+    RtlZeroMemory( pSnap, sizeof(REG_SNAPSHOT) );
+
+    // Get enabled ports for the chip
+    status =
+        PlxPci_ChipGetPortMask(
+            pDevice->Key.ChipID,
+            pDevice->Key.PlxRevision,
+            &chipFeat
+            );
+    if (status != PLX_STATUS_OK)
+    {
+        Cons_printf("Error: Unable to determine chip port mask (status=%X)\n", status);
+        return FALSE;
+    }
+
+    pSnap->Hdr.Signature   = REG_SNAP_SIGNATURE;
+    pSnap->Hdr.Version     = REG_SNAP_VERSION;
+    pSnap->Hdr.ChipType    = pDevice->Key.PlxChip;
+    pSnap->Hdr.Revision    = pDevice->Key.PlxRevision;
+    pSnap->Hdr.PortRegSize = PEX_PORT_REGS_SIZE;
+
+    // Only capture actual ports, skip special types above max port
+    for (port = 0; port < PEX_MAX_PORT; port++)
+    {
+        if (PEX_BITMASK_TEST( chipFeat.PortMask, port ))
+        {
+            PEX_BITMASK_SET( pSnap->Hdr.PortMask, port );
+            pSnap->Hdr.PortCount++;
+        }
+    }
+
+    if (pSnap->Hdr.PortCount == 0)
+    {
+        Cons_printf("Error: No ports found to capture\n");
+        return FALSE;
+    }
+
+    pSnap->pRegs = malloc( pSnap->Hdr.PortCount * PEX_PORT_REGS_SIZE );
+    if (pSnap->pRegs == NULL)
+    {
+        Cons_printf("Error: Buffer allocation failure\n");
+        return FALSE;
+    }
+
+    port     = 0;
+    blockIdx = 0;
+
+    while (port < PEX_MAX_PORT)
+    {
+        if (PEX_BITMASK_TEST( pSnap->Hdr.PortMask, port ) == FALSE)
+        {
+            port++;
+            continue;
+        }
+
+        // Find end of consecutive port run
+        portFirst = port;
+        while ((port < PEX_MAX_PORT) && PEX_BITMASK_TEST( pSnap->Hdr.PortMask, port ))
+        {
+            port++;
+        }
+
+        status =
+            PlxPci_PlxMappedRegisterReadBuffer(
+                pDevice,
+                portFirst * PEX_PORT_REGS_SIZE,
+                (U8*)pSnap->pRegs + (blockIdx * PEX_PORT_REGS_SIZE),
+                (port - portFirst) * PEX_PORT_REGS_SIZE
+                );
+        if (status != PLX_STATUS_OK)
+        {
+            Cons_printf(
+                "Error: Register read of ports %d-%d failed (status=%X)\n",
+                portFirst, port - 1, status
+                );
+            Plx_RegSnapshotFree( pSnap );
+            return FALSE;
+        }
+
+        blockIdx += (port - portFirst);
+    }
+
+    return TRUE;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Plx_RegSnapshotFileSave
+ *
+ * Description:  Saves a register snapshot to a binary file
+ *
+ ******************************************************************************/
+BOOLEAN
+Plx_RegSnapshotFileSave(
+    REG_SNAPSHOT *pSnap,
+    char         *pFileName
+    )
+{
+    U32      DataSize;
+    FILE    *pFile;
+    BOOLEAN  bOk;
+
+
+    pFile = fopen( pFileName, "wb" );
+    if (pFile == NULL)
+    {
+        Cons_printf("Error: Unable to create file '%s'\n", pFileName);
+        return FALSE;
+    }
+
+    DataSize = pSnap->Hdr.PortCount * pSnap->Hdr.PortRegSize;
+
+    // File is the header followed by port blocks in ascending port order
+    bOk = (fwrite( &pSnap->Hdr, sizeof(REG_SNAP_HEADER), 1, pFile ) == 1) &&
+          (fwrite( pSnap->pRegs, 1, DataSize, pFile ) == DataSize);
+
+    fclose( pFile );
+
+    if (bOk == FALSE)
+    {
+        Cons_printf("Error: Write to '%s' failed\n", pFileName);
+    }
+
+    return bOk;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Plx_RegSnapshotFileLoad
+ *
+ * Description:  Loads a register snapshot from a binary file
+ *
+ ******************************************************************************/
+BOOLEAN
+Plx_RegSnapshotFileLoad(
+    char         *pFileName,
+    REG_SNAPSHOT *pSnap
+    )
+{
+    U16   port;
+    U16   PortCount;
+    U32   DataSize;
+    FILE *pFile;
+
+
+    RtlZeroMemory( pSnap, sizeof(REG_SNAPSHOT) );
+
+    pFile = fopen( pFileName, "rb" );
+    if (pFile == NULL)
+    {
+        Cons_printf("Error: Unable to open file '%s'\n", pFileName);
+        return FALSE;
+    }
+
+    // Verify header
+    if ((fread( &pSnap->Hdr, sizeof(REG_SNAP_HEADER), 1, pFile ) != 1) ||
+        (pSnap->Hdr.Signature != REG_SNAP_SIGNATURE) ||
+        (pSnap->Hdr.Version != REG_SNAP_VERSION) ||
+        (pSnap->Hdr.PortRegSize != PEX_PORT_REGS_SIZE))
+    {
+        Cons_printf("Error: '%s' is not a valid register snapshot\n", pFileName);
+        fclose( pFile );
+        return FALSE;
+    }
+
+    // Port blocks are located by port mask, so it must match the block count
+    PortCount = 0;
+    for (port = 0; port < PEX_MAX_PORT; port++)
+    {
+        if (PEX_BITMASK_TEST( pSnap->Hdr.PortMask, port ))
+        {
+            PortCount++;
+        }
+    }
+
+    if ((PortCount == 0) || (PortCount != pSnap->Hdr.PortCount))
+    {
+        Cons_printf(
+            "Error: '%s' port mask (%d ports) does not match port count (%d)\n",
+            pFileName, PortCount, pSnap->Hdr.PortCount
+            );
+        fclose( pFile );
+        return FALSE;
+    }
+
+    DataSize     = pSnap->Hdr.PortCount * pSnap->Hdr.PortRegSize;
+    pSnap->pRegs = malloc( DataSize );
+
+    if ((pSnap->pRegs == NULL) ||
+        (fread( pSnap->pRegs, 1, DataSize, pFile ) != DataSize))
+    {
+        Cons_printf("Error: Unable to read snapshot data from '%s'\n", pFileName);
+        Plx_RegSnapshotFree( pSnap );
+        fclose( pFile );
+        return FALSE;
+    }
+
+    // Verify no data follows the last port block
+    if (fgetc( pFile ) != EOF)
+    {
+        Cons_printf("Error: '%s' contains unexpected data after snapshot\n", pFileName);
+        Plx_RegSnapshotFree( pSnap );
+        fclose( pFile );
+        return FALSE;
+    }
+
+    fclose( pFile );
+
+    return TRUE;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Plx_RegSnapshotDiff
+ *
+ * Description:  Displays register differences between two snapshots
+ *
+ * Returns    :  Number of differing registers & ports only in one snapshot
+ *
+ ******************************************************************************/
+U32
+Plx_RegSnapshotDiff(
+    REG_SNAPSHOT *pSnapOld,
+    REG_SNAPSHOT *pSnapNew
+    )
+{
+    U16      port;
+    U32      offset;
+    U32      DiffCount;
+    U32     *pRegsOld;
+    U32     *pRegsNew;
+    BOOLEAN  bInOld;
+    BOOLEAN  bInNew;
+
+
+    if (pSnapOld->Hdr.ChipType != pSnapNew->Hdr.ChipType)
+    {
+        Cons_printf(
+            "Note: Snapshots are from different chips (%04X vs %04X)\n",
+            pSnapOld->Hdr.ChipType, pSnapNew->Hdr.ChipType
+            );
+    }
+
+    DiffCount = 0;
+    pRegsOld  = pSnapOld->pRegs;
+    pRegsNew  = pSnapNew->pRegs;
+
+    for (port = 0; port < PEX_MAX_PORT; port++)
+    {
+        bInOld = PEX_BITMASK_TEST( pSnapOld->Hdr.PortMask, port );
+        bInNew = PEX_BITMASK_TEST( pSnapNew->Hdr.PortMask, port );
+
+        if (bInOld && bInNew)
+        {
+            // Only scan registers if port block differs
+            if (memcmp( pRegsOld, pRegsNew, PEX_PORT_REGS_SIZE ) != 0)
+            {
+                for (offset = 0; offset < (PEX_PORT_REGS_SIZE / sizeof(U32)); offset++)
+                {
+                    if (pRegsOld[offset] != pRegsNew[offset])
+                    {
+                        Cons_printf(
+                            " Port %2d  %03X: %08X -> %08X\n",
+                            port, (offset * sizeof(U32)),
+                            pRegsOld[offset], pRegsNew[offset]
+                            );
+                        DiffCount++;
+                    }
+                }
+            }
+        }
+        else if (bInOld || bInNew)
+        {
+            Cons_printf(
+                " Port %2d: Only in %s snapshot\n",
+                port, (bInOld) ? "first" : "second"
+                );
+            DiffCount++;
+        }
+
+        // Advance to next port block
+        if (bInOld)
+        {
+            pRegsOld += (PEX_PORT_REGS_SIZE / sizeof(U32));
+        }
+
+        if (bInNew)
+        {
+            pRegsNew += (PEX_PORT_REGS_SIZE / sizeof(U32));
+        }
+    }
+
+    return DiffCount;
+}
+
+
+
+
+/******************************************************************************
+ *
+ * Function   :  Plx_RegSnapshotFree
+ *
+ * Description:  Releases register snapshot data
+ *
+ ******************************************************************************/
+VOID
+Plx_RegSnapshotFree(
+    REG_SNAPSHOT *pSnap
+    )
+{
+    if (pSnap->pRegs != NULL)
+    {
+        free( pSnap->pRegs );
+        pSnap->pRegs = NULL;
+    }
+}
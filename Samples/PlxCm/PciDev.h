@@ -96,6 +96,10 @@
 // Max bytes to read/write for each SPI flash block operation
 #define SPI_MAX_BLOCK_SIZE        512
 
+// Register snapshot file identification
+#define REG_SNAP_SIGNATURE        0x50414E53        // "SNAP"
+#define REG_SNAP_VERSION          1
+
 
 // Device flags
 typedef enum _PEX_DEV_FLAGS
@@ -118,6 +122,28 @@ typedef struct _DEVICE_NODE
     struct _DEVICE_NODE *pNext;             // Pointer to next node in device list
 } DEVICE_NODE;
 
+// Register snapshot file header
+typedef struct _REG_SNAP_HEADER
+{
+    U32 Signature;                          // Snapshot file signature
+    U16 Version;                            // Snapshot format version
+    U16 ChipType;                           // PLX chip type captured
+    U8  Revision;                           // PLX chip revision
+    U8  PortCount;                          // Number of port register blocks
+    U16 Reserved;
+    U32 PortRegSize;                        // Bytes per port register block
+
+    // Ports present in snapshot
+    PEX_BITMASK_T( PortMask, PEX_MAX_PORT );
+} REG_SNAP_HEADER;
+
+// Register snapshot (port blocks stored in ascending port order)
+typedef struct _REG_SNAPSHOT
+{
+    REG_SNAP_HEADER  Hdr;
+    U32             *pRegs;
+} REG_SNAPSHOT;
+
 
 
 
@@ -180,7 +206,8 @@ Plx_EepromFileLoad(
     U8                 EepPortSize,
     BOOLEAN            bCrc,
     BOOLEAN            bBypassVerify,
-    BOOLEAN            bEndianSwap
+    BOOLEAN            bEndianSwap,
+    BOOLEAN            bDiffOnly
     );
 
 BOOLEAN
@@ -198,7 +225,8 @@ Plx8000_EepromFileLoad(
     PLX_DEVICE_OBJECT *pDevice,
     char              *pFileName,
     BOOLEAN            bCrc,
-    BOOLEAN            bBypassVerify
+    BOOLEAN            bBypassVerify,
+    BOOLEAN            bDiffOnly
     );
 
 BOOLEAN
@@ -218,6 +246,19 @@ Plx_SpiFileLoad(
     U8                 NvFlags
     );
 
+BOOLEAN
+Plx_SpiSectorUpdate(
+    PLX_DEVICE_OBJECT *PtrDev,
+    PEX_SPI_OBJ       *PtrSpi,
+    U32                Address,
+    U8                *PtrData,
+    U32                ByteCount,
+    U8                *PtrSector,
+    U8                 NvFlags,
+    U32               *PtrBytesWritten,
+    U32               *PtrSectorsErased
+    );
+
 BOOLEAN
 Plx_SpiFileSave(
     PLX_DEVICE_OBJECT *PtrDev,
@@ -228,6 +269,35 @@ Plx_SpiFileSave(
     U8                 NvFlags
     );
 
+BOOLEAN
+Plx_RegSnapshotCapture(
+    PLX_DEVICE_OBJECT *pDevice,
+    REG_SNAPSHOT      *pSnap
+    );
+
+BOOLEAN
+Plx_RegSnapshotFileSave(
+    REG_SNAPSHOT *pSnap,
+    char         *pFileName
+    );
+
+BOOLEAN
+Plx_RegSnapshotFileLoad(
+    char         *pFileName,
+    REG_SNAPSHOT *pSnap
+    );
+
+U32
+Plx_RegSnapshotDiff(
+    REG_SNAPSHOT *pSnapOld,
+    REG_SNAPSHOT *pSnapNew
+    );
+
+VOID
+Plx_RegSnapshotFree(
+    REG_SNAPSHOT *pSnap
+    );
+
 
 
 #endif
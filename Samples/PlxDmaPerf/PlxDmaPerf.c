@@ -65,6 +65,8 @@
  *********************************************/
 #define DMA_TIMEOUT_SEC                 3                                       // Max time to wait for DMA completion
 #define UPDATE_DISPLAY_SEC              4                                       // Number of seconds between display updates
+#define SMALL_DMA_SIZE                  64                                      // Transfer size when measuring submission cost
+#define LARGE_DMA_SIZE_9000             (64 * 1024)                             // Max 9000 transfer size, limited by local memory
 #define PlxReg(Va, reg)                 (*(volatile U32 *)(((U8*)Va) + (reg)))  // Macro to access PLX Chip registers
 
 
@@ -83,6 +85,11 @@ PerformDma_8000(
     PLX_DEVICE_OBJECT *pDevice
     );
 
+void
+PerformDma_9000(
+    PLX_DEVICE_OBJECT *pDevice
+    );
+
 
 
 
@@ -160,6 +167,11 @@ main(
     {
         PerformDma_8000( &Device );
     }
+    else if (((DeviceKey.PlxChip & 0xF000) == 0x9000) ||
+              (DeviceKey.PlxChip == 0x8311))
+    {
+        PerformDma_9000( &Device );
+    }
     else
     {
         Cons_printf(
@@ -241,6 +253,13 @@ SelectDevice_DMA(
                 // Verify supported chip type
                 switch (DevKey.PlxChip)
                 {
+                    case 0x9054:
+                    case 0x9056:
+                    case 0x9080:
+                    case 0x9656:
+                    case 0x8311:
+                        break;
+
                     default:
                         if ((DevKey.PlxChip & 0xF000) == 0x8000)
                         {
@@ -350,6 +369,7 @@ PerformDma_8000(
     U32               LoopCount;
     U32               PollCount;
     U32               OffsetDmaCmd;
+    U32               TransferSize;
     U32               ElapsedTime_ms;
     VOID             *BarVa;
     double            Stat_TxTotalCount;
@@ -396,6 +416,21 @@ PerformDma_8000(
         bInterrupts = FALSE;
     }
 
+    // Determine whether to measure throughput or per-transfer submission cost
+    Cons_printf("Large(l) or small(s) transfers [l/s]? --> ");
+    UserInput = Cons_getch();
+    Cons_printf("%c\n\n", UserInput);
+
+    if (UserInput == 's' || UserInput == 'S')
+    {
+        // Back-to-back small DMAs are dominated by submission overhead
+        TransferSize = SMALL_DMA_SIZE;
+    }
+    else
+    {
+        TransferSize = 0;
+    }
+
 
     /**************************************************************
      *
@@ -553,6 +588,12 @@ PerformDma_8000(
     DmaParams.AddrDest   = PciBuffer.PhysicalAddr + (PciBuffer.Size / 2);
     DmaParams.ByteCount  = PciBuffer.Size / 2;
 
+    // Override size if measuring submission cost
+    if (TransferSize != 0)
+    {
+        DmaParams.ByteCount = TransferSize;
+    }
+
     // If polling, disable DMA interrupt
     if (bInterrupts == FALSE)
     {
@@ -583,7 +624,16 @@ PerformDma_8000(
             if (ElapsedTime_ms >= (UPDATE_DISPLAY_SEC * 1000))
             {
                 // Display statistics
-                if (ElapsedTime_ms != 0)
+                if ((ElapsedTime_ms != 0) && (TransferSize != 0))
+                {
+                    Cons_printf(
+                        " Transfers: %0.0lf   Time: %ldms   Rate: %0.0lf DMA/s   Avg: %0.2lf us/DMA\n",
+                        Stat_TxTotalCount, ElapsedTime_ms,
+                        (Stat_TxTotalCount * 1000) / (double)ElapsedTime_ms,
+                        ((double)ElapsedTime_ms * 1000) / Stat_TxTotalCount
+                        );
+                }
+                else if (ElapsedTime_ms != 0)
                 {
                     Cons_printf(
                         " Transfers: %0.0lf   Bytes: %0.2lf MB   Time: %ldms   Rate:%6.3lf MB/s\n",
@@ -676,7 +726,7 @@ PerformDma_8000(
 
         // Update statistics
         Stat_TxTotalCount++;
-        Stat_TxTotalBytes += PciBuffer.Size / 2;
+        Stat_TxTotalBytes += DmaParams.ByteCount;
 
         LoopCount++;
     }
@@ -732,3 +782,319 @@ _ExitDmaTest:
         &PciBuffer
         );
 }
+
+
+
+
+/********************************************************
+ *
+ *******************************************************/
+void
+PerformDma_9000(
+    PLX_DEVICE_OBJECT *pDevice
+    )
+{
+    U8                DmaChannel;
+    U16               UserInput;
+    U32               LoopCount;
+    U32               PollCount;
+    U32               LocalAddress;
+    U32               ElapsedTime_ms;
+    double            Stat_TxTotalCount;
+    double            Stat_TxTotalBytes;
+    BOOLEAN           bInterrupts;
+    PLX_STATUS        status;
+    struct timeb      StartTime, EndTime;
+    PLX_DMA_PROP      DmaProp;
+    PLX_INTERRUPT     PlxInterrupt;
+    PLX_DMA_PARAMS    DmaParams;
+    PLX_PHYSICAL_MEM  PciBuffer;
+    PLX_NOTIFY_OBJECT NotifyObject;
+
+
+    Cons_printf(
+        "\n"
+        " WARNING: There is no safeguard mechanism to protect against invalid\n"
+        "          local bus addresses.  The DMA engine will hang if an\n"
+        "          invalid address is accessed.\n"
+        "\n"
+        );
+
+    Cons_printf("Please enter a valid local address  --> ");
+    if (Cons_scanf("%x", &LocalAddress) <= 0)
+    {
+        // Added for compiler warning
+    }
+
+    Cons_printf("Please select a DMA channel (0-1)   --> ");
+    if (Cons_scanf("%hd", &UserInput) <= 0)
+    {
+        // Added for compiler warning
+    }
+
+    if (UserInput >= 2)
+    {
+        Cons_printf("ERROR: Unsupported DMA channel, test aborted\n");
+        return;
+    }
+
+    DmaChannel = (U8)UserInput;
+
+    // Determine whether to use interrupts or polling
+    Cons_printf("Use interrupts(i) or poll(p) [i/p]? --> ");
+    UserInput = Cons_getch();
+    Cons_printf("%c\n", UserInput);
+
+    if (UserInput == 'i' || UserInput == 'I')
+    {
+        bInterrupts = TRUE;
+    }
+    else
+    {
+        bInterrupts = FALSE;
+    }
+
+    // Get DMA buffer parameters
+    PlxPci_CommonBufferProperties(
+        pDevice,
+        &PciBuffer
+        );
+
+    // Clear DMA data
+    memset(&DmaParams, 0, sizeof(PLX_DMA_PARAMS));
+
+    DmaParams.PciAddr   = PciBuffer.PhysicalAddr;
+    DmaParams.LocalAddr = LocalAddress;
+    DmaParams.Direction = PLX_DMA_PCI_TO_LOC;
+
+    // Determine whether to measure throughput or per-transfer submission cost
+    Cons_printf("Large(l) or small(s) transfers [l/s]? --> ");
+    UserInput = Cons_getch();
+    Cons_printf("%c\n\n", UserInput);
+
+    if (UserInput == 's' || UserInput == 'S')
+    {
+        // Back-to-back small DMAs are dominated by submission overhead
+        DmaParams.ByteCount = SMALL_DMA_SIZE;
+    }
+    else
+    {
+        DmaParams.ByteCount = LARGE_DMA_SIZE_9000;
+
+        if (DmaParams.ByteCount > PciBuffer.Size)
+        {
+            DmaParams.ByteCount = PciBuffer.Size;
+        }
+    }
+
+    // If polling, disable DMA interrupt
+    if (bInterrupts == FALSE)
+    {
+        DmaParams.bIgnoreBlockInt = TRUE;
+    }
+
+
+    /**************************************************************
+     *
+     *************************************************************/
+    // Clear DMA structure
+    memset(&DmaProp, 0, sizeof(PLX_DMA_PROP));
+
+    // Initialize the DMA channel
+    DmaProp.LocalBusWidth = 3;   // 32-bit
+    DmaProp.ReadyInput    = 1;
+
+    Cons_printf("  Open Channel %i for DMA......... ", DmaChannel);
+    status =
+        PlxPci_DmaChannelOpen(
+            pDevice,
+            DmaChannel,
+            &DmaProp
+            );
+
+    if (status != PLX_STATUS_OK)
+    {
+        Cons_printf("*ERROR* - API failed\n");
+        PlxSdkErrorDisplay(status);
+        return;
+    }
+    Cons_printf("Ok\n");
+
+    if (bInterrupts)
+    {
+        Cons_printf("  Register for notification...... ");
+
+        // Clear interrupt fields
+        memset( &PlxInterrupt, 0, sizeof(PLX_INTERRUPT) );
+
+        // Setup to wait for selected DMA channel
+        PlxInterrupt.DmaDone = (1 << DmaChannel);
+
+        status =
+            PlxPci_NotificationRegisterFor(
+                pDevice,
+                &PlxInterrupt,
+                &NotifyObject
+                );
+
+        if (status != PLX_STATUS_OK)
+        {
+            Cons_printf("*ERROR* - API failed\n");
+            PlxSdkErrorDisplay(status);
+            bInterrupts = FALSE;
+            goto _ExitDmaTest;
+        }
+        Cons_printf( "Ok\n" );
+    }
+
+
+    /*****************************************
+     *
+     *          Transfer the Data
+     *
+     *****************************************/
+    Cons_printf("\n\n");
+    Cons_printf("  --- Performing DMA transfers (Press ESC to halt) ---\n");
+
+    LoopCount = 0;
+
+    // Reset stats
+    Stat_TxTotalCount = 0;
+    Stat_TxTotalBytes = 0;
+
+    // Get initial start time
+    ftime( &StartTime );
+
+    do
+    {
+        // Periodically display statistics
+        if ((LoopCount & 0x0000003F) == 0)
+        {
+            // Get end time
+            ftime( &EndTime );
+
+            // Calculate elapsed time in milliseconds
+            ElapsedTime_ms = (((U32)EndTime.time * 1000) + EndTime.millitm) -
+                             (((U32)StartTime.time * 1000) + StartTime.millitm);
+
+            if (ElapsedTime_ms >= (UPDATE_DISPLAY_SEC * 1000))
+            {
+                // Display statistics
+                Cons_printf(
+                    " Transfers: %0.0lf   Time: %ldms   Rate: %0.0lf DMA/s  %6.3lf MB/s   Avg: %0.2lf us/DMA\n",
+                    Stat_TxTotalCount, ElapsedTime_ms,
+                    (Stat_TxTotalCount * 1000) / (double)ElapsedTime_ms,
+                    ((Stat_TxTotalBytes * 1000) / (double)ElapsedTime_ms) / (double)(1 << 20),
+                    ((double)ElapsedTime_ms * 1000) / Stat_TxTotalCount
+                    );
+
+                // Reset stats
+                Stat_TxTotalCount = 0;
+                Stat_TxTotalBytes = 0;
+
+                // Check for user cancel
+                if ( (Cons_kbhit()) && (Cons_getch() == CONS_KEY_ESCAPE) )
+                {
+                    goto _ExitDmaTest;
+                }
+
+                // Get new start time
+                ftime( &StartTime );
+            }
+        }
+
+        status =
+            PlxPci_DmaTransferBlock(
+                pDevice,
+                DmaChannel,
+                &DmaParams,
+                0          // Don't wait for completion
+                );
+
+        if (status != PLX_STATUS_OK)
+        {
+            Cons_printf("*ERROR* - API failed\n");
+            PlxSdkErrorDisplay(status);
+            goto _ExitDmaTest;
+        }
+
+        if (bInterrupts)
+        {
+            status =
+                PlxPci_NotificationWait(
+                    pDevice,
+                    &NotifyObject,
+                    DMA_TIMEOUT_SEC * 1000
+                    );
+
+            if (status != PLX_STATUS_OK)
+            {
+                Cons_printf("*ERROR* - Interrupt wait failed\n");
+                PlxSdkErrorDisplay(status);
+                goto _ExitDmaTest;
+            }
+        }
+        else
+        {
+            PollCount = 1000000;
+
+            // Poll for DMA completion (register shared by channels, read through driver)
+            do
+            {
+                PollCount--;
+
+                status =
+                    PlxPci_DmaStatus(
+                        pDevice,
+                        DmaChannel
+                        );
+            }
+            while ((status == PLX_STATUS_IN_PROGRESS) && (PollCount != 0));
+
+            if (status != PLX_STATUS_COMPLETE)
+            {
+                Cons_printf("*ERROR* - Timeout waiting for DMA to complete\n");
+                goto _ExitDmaTest;
+            }
+        }
+
+        // Update statistics
+        Stat_TxTotalCount++;
+        Stat_TxTotalBytes += DmaParams.ByteCount;
+
+        LoopCount++;
+    }
+    while (1);
+
+
+_ExitDmaTest:
+
+    Cons_printf("\n       ------------------\n");
+
+    // Release the interrupt wait object
+    if (bInterrupts)
+    {
+        PlxPci_NotificationCancel(
+            pDevice,
+            &NotifyObject
+            );
+    }
+
+    // Close DMA Channel
+    Cons_printf("  Close DMA Channel.............. ");
+    status =
+        PlxPci_DmaChannelClose(
+            pDevice,
+            DmaChannel
+            );
+
+    if (status == PLX_STATUS_OK)
+    {
+        Cons_printf("Ok\n");
+    }
+    else
+    {
+        Cons_printf("*ERROR* - API failed\n");
+        PlxSdkErrorDisplay(status);
+    }
+}
@@ -57,6 +57,43 @@
     #include "ConsFunc.h"
 #endif
 
+#if defined(PLX_LINUX)
+    #include <pthread.h>
+#endif
+
+
+
+
+/*************************************
+ *   Batch mode worker thread support
+ ************************************/
+#if defined(PLX_MSWINDOWS)
+    #define EEP_THREAD                          HANDLE
+    #define EEP_THREAD_RETURN                   DWORD WINAPI
+    #define EEP_THREAD_EXIT                     0
+    #define EepThreadCreate(pThread, fn, arg)   ((*(pThread) = CreateThread(NULL, 0, (fn), (arg), 0, NULL)) != NULL)
+    #define EepThreadJoin(thread)               do { WaitForSingleObject( (thread), INFINITE ); CloseHandle( (thread) ); } while (0)
+#elif defined(PLX_LINUX)
+    #define EEP_THREAD                          pthread_t
+    #define EEP_THREAD_RETURN                   void*
+    #define EEP_THREAD_EXIT                     NULL
+    #define EepThreadCreate(pThread, fn, arg)   (pthread_create( (pThread), NULL, (fn), (arg) ) == 0)
+    #define EepThreadJoin(thread)               pthread_join( (thread), NULL )
+#else
+    // No thread support, devices are processed sequentially
+    #define EEP_THREAD                          int
+    #define EEP_THREAD_RETURN                   int
+    #define EEP_THREAD_EXIT                     0
+    #define EepThreadCreate(pThread, fn, arg)   FALSE
+    #define EepThreadJoin(thread)
+#endif
+
+
+static EEP_THREAD_RETURN
+EepBatchWorker(
+    VOID *pContext
+    );
+
 
 
 
@@ -75,11 +112,9 @@ main(
 {
     int               ExitCode;
     S16               rc;
-    PLX_STATUS        status;
     EEP_OPTIONS       EepOptions;
     PLX_DEVICE_KEY    Key;
     PLX_DEVICE_OBJECT Device;
-    PLX_EEPROM_STATUS EepStatus;
 
 
     // Initialize the console
@@ -124,6 +159,13 @@ main(
         goto __Exit_App;
     }
 
+    // Process all matching devices in parallel if requested
+    if (EepOptions.bAllDevices)
+    {
+        ExitCode = EepFileBatch( &EepOptions );
+        goto __Exit_App;
+    }
+
     // Decide which device to select
     rc = SelectDevice( &Key, &EepOptions );
 
@@ -154,24 +196,8 @@ main(
         Key.bus, Key.slot, Key.function
         );
 
-    // Verify EEPROM is present
-    EepStatus = PlxPci_EepromPresent( &Device, &status );
-    if ((status == PLX_STATUS_OK) && (EepStatus == PLX_EEPROM_STATUS_NONE))
-    {
-        if (EepOptions.bIgnoreWarnings)
-        {
-            Cons_printf("WARNING: PLX chip reports no EEPROM present, ignoring\n");
-        }
-        else
-        {
-            Cons_printf("ERROR: PLX chip reports no EEPROM present, unable to continue\n");
-            ExitCode = EXIT_CODE_EEP_NOT_EXIST;
-            goto __Exit_App;
-        }
-    }
-
     // Perform EEPROM operation
-    ExitCode = EepFile( &Device, &EepOptions );
+    ExitCode = EepDeviceProcess( &Device, &EepOptions );
 
     // Release device
     PlxPci_DeviceClose( &Device );
@@ -429,6 +455,14 @@ ProcessCommandLine(
         {
             pOptions->bIgnoreWarnings = TRUE;
         }
+        else if (Plx_strcasecmp(argv[i], "-u") == 0)
+        {
+            pOptions->bDiffOnly = TRUE;
+        }
+        else if (Plx_strcasecmp(argv[i], "-a") == 0)
+        {
+            pOptions->bAllDevices = TRUE;
+        }
         else
         {
             Cons_printf("ERROR: Invalid argument \'%s\'\n", argv[i]);
@@ -477,6 +511,22 @@ ProcessCommandLine(
         return EXIT_CODE_CMD_LINE_ERR;
     }
 
+    // Batch mode loads one file into all devices
+    if (pOptions->bAllDevices)
+    {
+        if (pOptions->bLoadFile == FALSE)
+        {
+            Cons_printf("ERROR: All devices (-a) only supported when loading a file (-l)\n");
+            return EXIT_CODE_CMD_LINE_ERR;
+        }
+
+        if (pOptions->DeviceNumber != -1)
+        {
+            Cons_printf("ERROR: Options -a and -d may not be used together\n");
+            return EXIT_CODE_CMD_LINE_ERR;
+        }
+    }
+
     return EXIT_CODE_SUCCESS;
 }
 
@@ -502,8 +552,8 @@ DisplayHelp(
         "\n"
         "PlxEep.exe v%d.%d%d - EEPROM file utility for PLX devices.\n"
         "\n"
-        " Usage: PlxEep -l|-s file [-p chip[,rev]] [-d dev] [-w width]\n"
-        "                          [-i] [-n bytes] [-v]\n"
+        " Usage: PlxEep -l|-s file [-p chip[,rev]] [-d dev | -a] [-w width]\n"
+        "                          [-i] [-u] [-n bytes] [-v]\n"
         "\n"
         " Options:\n"
         "   -l | -s       Load (-l) file to EEPROM -OR- Save (-s) EEPROM to file\n"
@@ -511,8 +561,10 @@ DisplayHelp(
         "   -p chip,rev   Limits device selection to a specific PLX chip type. If\n"
         "                  revision provided, it further limits to a specific revision.\n"
         "   -d dev        Specifies device number to select. Numbering starts at 1.\n"
+        "   -a            Load file to all matching devices in parallel (load only)\n"
         "   -w width      Specifies an EEPROM address width (1, 2, or 3) to override\n"
         "   -i            Ignore warnings & continue (e.g. EEPROM not detected)\n"
+        "   -u            Update only EEPROM values that differ from file (load only)\n"
         "   -n bytes      Number of extra bytes (after PLX portion) to save to file\n"
         "   -v            Verbose output (for debug purposes)\n"
         "   -h or -?      This help screen\n"
@@ -569,7 +621,9 @@ DisplayHelp(
  *
  * Function   : SelectDevice
  *
- * Description: Asks the user which device to select
+ * Description: Asks the user which device to select. In batch (-a)
+ *              mode, pKey must hold MAX_DEVICES_TO_LIST entries and
+ *              receives all matching devices without prompting.
  *
  * Returns    : Total devices found
  *              -1,  if user cancelled the selection
@@ -666,6 +720,20 @@ SelectDevice(
                 }
             }
 
+            // In batch mode, skip NT & GEP ports, which share the EEPROM of
+            // their switch & would otherwise program it multiple times
+            if ( bAddDevice && pOptions->bAllDevices &&
+                 ((DevKey.PlxPortType == PLX_SPEC_PORT_NT_VIRTUAL) ||
+                  (DevKey.PlxPortType == PLX_SPEC_PORT_NT_LINK) ||
+                  (DevKey.PlxPortType == PLX_SPEC_PORT_GEP)) )
+            {
+                bAddDevice = FALSE;
+                if (pOptions->bVerbose)
+                {
+                    Cons_printf("App: Device shares switch EEPROM, skip in batch mode\n");
+                }
+            }
+
             // Check if limited to a specific chip type
             if (bAddDevice && (pOptions->LimitPlxChip != 0))
             {
@@ -698,6 +766,12 @@ SelectDevice(
                 // Increment to next device
                 NumDevices++;
 
+                // Batch mode returns all matching devices
+                if (pOptions->bAllDevices)
+                {
+                    pKey[NumDevices - 1] = DevKey;
+                }
+
                 if (pOptions->DeviceNumber == -1)
                 {
                     if (NumDevices == 1)
@@ -734,6 +808,12 @@ SelectDevice(
         return 0;
     }
 
+    // No selection required in batch mode
+    if (pOptions->bAllDevices)
+    {
+        return NumDevices;
+    }
+
     Cons_printf("\t\t     0. Cancel\n\n");
 
     do
@@ -760,6 +840,261 @@ SelectDevice(
 
 
 
+/**********************************************************
+ *
+ * Function   :  EepDeviceProcess
+ *
+ * Description:  Verifies EEPROM presence & performs the
+ *               requested operation on an opened device
+ *
+ *********************************************************/
+S8
+EepDeviceProcess(
+    PLX_DEVICE_OBJECT *pDevice,
+    EEP_OPTIONS       *pOptions
+    )
+{
+    PLX_STATUS        status;
+    PLX_EEPROM_STATUS EepStatus;
+
+
+    // Verify EEPROM is present
+    EepStatus = PlxPci_EepromPresent( pDevice, &status );
+    if ((status == PLX_STATUS_OK) && (EepStatus == PLX_EEPROM_STATUS_NONE))
+    {
+        if (pOptions->bIgnoreWarnings)
+        {
+            Cons_printf("WARNING: PLX chip reports no EEPROM present, ignoring\n");
+        }
+        else
+        {
+            Cons_printf("ERROR: PLX chip reports no EEPROM present, unable to continue\n");
+            return EXIT_CODE_EEP_NOT_EXIST;
+        }
+    }
+
+    // Perform EEPROM operation
+    return EepFile( pDevice, pOptions );
+}
+
+
+
+
+/**********************************************************
+ *
+ * Function   :  EepFileBatch
+ *
+ * Description:  Loads the EEPROM file into all matching
+ *               devices, one worker thread per device
+ *
+ *********************************************************/
+S8
+EepFileBatch(
+    EEP_OPTIONS *pOptions
+    )
+{
+    S16              i;
+    S16              NumDevices;
+    U16              NumFailed;
+    BOOLEAN          bThreadStarted[MAX_DEVICES_TO_LIST];
+    EEP_THREAD       hThread[MAX_DEVICES_TO_LIST];
+    struct timeb     end;
+    struct timeb     start;
+    PLX_DEVICE_KEY   DevKeyList[MAX_DEVICES_TO_LIST];
+    EEP_BATCH_DEVICE BatchDev[MAX_DEVICES_TO_LIST];
+
+
+    // Get all matching devices
+    NumDevices = SelectDevice( DevKeyList, pOptions );
+
+    if (NumDevices <= 0)
+    {
+        Cons_printf("ERROR: No matching devices found\n");
+        return EXIT_CODE_INVALID_DEV;
+    }
+
+    Cons_printf(
+        "\n"
+        "Load '%s' to %d device(s) in parallel.. ",
+        pOptions->FileName, NumDevices
+        );
+    Cons_fflush( stdout );
+
+    // Note start time
+    ftime( &start );
+
+    // Per-device progress would interleave, so suppress it until all complete
+    ConsoleIoOutputDisable( TRUE );
+
+    for (i = 0; i < NumDevices; i++)
+    {
+        BatchDev[i].Key        = DevKeyList[i];
+        BatchDev[i].pOptions   = pOptions;
+        BatchDev[i].ExitCode   = EXIT_CODE_SUCCESS;
+        BatchDev[i].ElapsedSec = 0;
+
+        bThreadStarted[i] =
+            (BOOLEAN)EepThreadCreate(
+                &hThread[i],
+                EepBatchWorker,
+                &BatchDev[i]
+                );
+
+        // Process in this thread if a worker could not be started
+        if (bThreadStarted[i] == FALSE)
+        {
+            EepBatchWorker( &BatchDev[i] );
+        }
+    }
+
+    // Wait for all workers to complete
+    for (i = 0; i < NumDevices; i++)
+    {
+        if (bThreadStarted[i])
+        {
+            EepThreadJoin( hThread[i] );
+        }
+    }
+
+    ConsoleIoOutputDisable( FALSE );
+
+    // Note completion time
+    ftime( &end );
+
+    Cons_printf("Done (%.2f sec)\n\n", PLX_DIFF_TIMEB( end, start ));
+
+    // Display per-device summary
+    Cons_printf(
+        "    #  Device     Chip Rev  Location     Time     Result\n"
+        "   --  ---------  ---- ---  ----------  -------  -------------------------\n"
+        );
+
+    NumFailed = 0;
+
+    for (i = 0; i < NumDevices; i++)
+    {
+        if (BatchDev[i].ExitCode != EXIT_CODE_SUCCESS)
+        {
+            NumFailed++;
+        }
+
+        Cons_printf(
+            "   %2d  %04x %04x  %04X  %02X  [%02X:%02X.%X]  %5.2fs  %s\n",
+            i + 1,
+            BatchDev[i].Key.DeviceId, BatchDev[i].Key.VendorId,
+            BatchDev[i].Key.PlxChip, BatchDev[i].Key.PlxRevision,
+            BatchDev[i].Key.bus, BatchDev[i].Key.slot, BatchDev[i].Key.function,
+            BatchDev[i].ElapsedSec,
+            EepExitCodeString( BatchDev[i].ExitCode )
+            );
+    }
+
+    Cons_printf(
+        "\n"
+        "  %d of %d device(s) programmed successfully\n",
+        NumDevices - NumFailed, NumDevices
+        );
+
+    if (NumFailed != 0)
+    {
+        return EXIT_CODE_EEP_FAIL;
+    }
+
+    return EXIT_CODE_SUCCESS;
+}
+
+
+
+
+/**********************************************************
+ *
+ * Function   :  EepBatchWorker
+ *
+ * Description:  Batch mode worker to process a single device
+ *
+ *********************************************************/
+static EEP_THREAD_RETURN
+EepBatchWorker(
+    VOID *pContext
+    )
+{
+    struct timeb      end;
+    struct timeb      start;
+    EEP_BATCH_DEVICE *pBatchDev;
+    PLX_DEVICE_OBJECT Device;
+
+
+    pBatchDev = (EEP_BATCH_DEVICE*)pContext;
+
+    // Note start time
+    ftime( &start );
+
+    if (PlxPci_DeviceOpen( &pBatchDev->Key, &Device ) != PLX_STATUS_OK)
+    {
+        pBatchDev->ExitCode = EXIT_CODE_DEV_OPEN_ERR;
+    }
+    else
+    {
+        // Load & verify EEPROM
+        pBatchDev->ExitCode =
+            EepDeviceProcess(
+                &Device,
+                pBatchDev->pOptions
+                );
+
+        PlxPci_DeviceClose( &Device );
+    }
+
+    // Note completion time
+    ftime( &end );
+
+    pBatchDev->ElapsedSec = PLX_DIFF_TIMEB( end, start );
+
+    return EEP_THREAD_EXIT;
+}
+
+
+
+
+/**********************************************************
+ *
+ * Function   :  EepExitCodeString
+ *
+ * Description:  Returns a description of an exit code
+ *
+ *********************************************************/
+char*
+EepExitCodeString(
+    S8 ExitCode
+    )
+{
+    switch (ExitCode)
+    {
+        case EXIT_CODE_SUCCESS:
+            return "Ok";
+
+        case EXIT_CODE_DEV_OPEN_ERR:
+            return "ERROR: Device open error";
+
+        case EXIT_CODE_EEP_FAIL:
+            return "ERROR: EEPROM operation failed";
+
+        case EXIT_CODE_EEP_NOT_EXIST:
+            return "ERROR: EEPROM not present";
+
+        case EXIT_CODE_INVALID_PLX:
+            return "ERROR: Invalid PLX chip type";
+
+        case EXIT_CODE_EEP_WIDTH_ERR:
+            return "ERROR: Address width set error";
+    }
+
+    return "ERROR: Unknown";
+}
+
+
+
+
 /**********************************************************
  *
  * Function   :  EepFile
@@ -1019,6 +1354,7 @@ Plx_EepromFileLoad(
     U32           value;
     U32           Verify_Value;
     U32           FileSize;
+    U32           BytesWritten;
     U32          *pBuffer;
     FILE         *pFile;
     struct timeb  end;
@@ -1085,6 +1421,8 @@ Plx_EepromFileLoad(
     // Default to successful operation
     rc = EXIT_CODE_SUCCESS;
 
+    BytesWritten = 0;
+
     Cons_printf("Program EEPROM......... ");
 
     // Write buffer into EEPROM
@@ -1117,8 +1455,19 @@ Plx_EepromFileLoad(
             }
         }
 
+        // Skip values already programmed if requested
+        if (pOptions->bDiffOnly)
+        {
+            PlxPci_EepromReadByOffset( pDevice, offset, &Verify_Value );
+            if (Verify_Value == value)
+            {
+                continue;
+            }
+        }
+
         // Store next value
         PlxPci_EepromWriteByOffset( pDevice, offset, value );
+        BytesWritten += sizeof(U32);
 
         // Re-read to verify
         PlxPci_EepromReadByOffset( pDevice, offset, &Verify_Value );
@@ -1134,7 +1483,14 @@ Plx_EepromFileLoad(
         }
     }
 
-    Cons_printf("Ok \n");
+    if (pOptions->bDiffOnly)
+    {
+        Cons_printf("Ok (%dB updated)\n", BytesWritten);
+    }
+    else
+    {
+        Cons_printf("Ok \n");
+    }
 
     // Update CRC if requested
     if (bCrc)
@@ -1304,13 +1660,22 @@ Plx8000_EepromFileLoad(
     S8            rc;
     U8            bCrcEn;
     U8           *pBuffer;
+    U8            EepBlock[EEP_BLOCK_SIZE];
     U16           Verify_Value_16;
+    U32           i;
+    U32           j;
     U32           value;
     U32           Verify_Value;
     U32           Crc;
     U32           offset;
     U32           FileSize;
+    U32           BlockSize;
+    U32           RunSize;
+    U32           BytesWritten;
     U32           EepHeader;
+    U32           OffsetCrc;
+    BOOLEAN       bCompare;
+    PLX_STATUS    status;
     FILE         *pFile;
     struct timeb  end;
     struct timeb  start;
@@ -1375,50 +1740,116 @@ Plx8000_EepromFileLoad(
     // Default to successful operation
     rc = EXIT_CODE_SUCCESS;
 
+    BytesWritten = 0;
+
     Cons_printf( "Program EEPROM..... " );
 
-    // Write 32-bit aligned buffer into EEPROM
-    for (offset = 0; offset < (FileSize & ~0x3); offset += sizeof(U32))
+    // For chips that support CRC, verify CRC is enabled (0h[15])
+    if (FileSize >= sizeof(U32))
     {
-        // Periodically update status
-        if ((offset & 0x7) == 0)
+        // Store EEPROM header
+        EepHeader = *(U32*)pBuffer;
+
+        // Remove CRC option if disabled
+        if ((bCrcEn == TRUE) && ((EepHeader & (1 << 15)) == 0))
         {
-            // Display current status
-            Cons_printf(
-                "%02ld%%\b\b\b",
-                ((offset * 100) / FileSize)
-                );
-            Cons_fflush( stdout );
+            bCrcEn = FALSE;
         }
+    }
 
-        // Get next value
-        value = *(U32*)(pBuffer + offset);
+    // Write 32-bit aligned buffer into EEPROM in blocks
+    for (offset = 0; offset < (FileSize & ~0x3); offset += BlockSize)
+    {
+        // Display current status
+        Cons_printf(
+            "%02ld%%\b\b\b",
+            ((offset * 100) / FileSize)
+            );
+        Cons_fflush( stdout );
 
-        // For chips that support CRC, verify CRC is enabled (0h[15])
-        if (offset == 0)
+        BlockSize = (FileSize & ~0x3) - offset;
+        if (BlockSize > EEP_BLOCK_SIZE)
         {
-            // Store EEPROM header
-            EepHeader = value;
+            BlockSize = EEP_BLOCK_SIZE;
+        }
 
-            // Remove CRC option if disabled
-            if ((bCrcEn == TRUE) && ((value & (1 << 15)) == 0))
+        // Get current contents to only update values that differ
+        bCompare = FALSE;
+        if (pOptions->bDiffOnly)
+        {
+            status =
+                PlxPci_EepromReadBuffer(
+                    pDevice,
+                    offset,
+                    EepBlock,
+                    BlockSize
+                    );
+            if (status == PLX_STATUS_OK)
             {
-                bCrcEn = FALSE;
+                bCompare = TRUE;
             }
         }
 
-        // Write value & read back to verify
-        PlxPci_EepromWriteByOffset( pDevice, offset, value );
-        PlxPci_EepromReadByOffset( pDevice, offset, &Verify_Value );
-
-        if (Verify_Value != value)
+        // Write each run of values requiring update
+        for (i = 0; i < BlockSize; i += RunSize)
         {
-            Cons_printf(
-                "ERROR: offset:%02X  wrote:%08X  read:%08X\n",
-                offset, value, Verify_Value
-                );
-            rc = EXIT_CODE_EEP_FAIL;
-            goto _Exit_File_Load_8000;
+            RunSize = BlockSize - i;
+
+            if (bCompare)
+            {
+                // Skip value if already programmed
+                if (*(U32*)(EepBlock + i) == *(U32*)(pBuffer + offset + i))
+                {
+                    RunSize = sizeof(U32);
+                    continue;
+                }
+
+                // Extend run over consecutive values that differ
+                RunSize = sizeof(U32);
+                while (((i + RunSize) < BlockSize) &&
+                       (*(U32*)(EepBlock + i + RunSize) != *(U32*)(pBuffer + offset + i + RunSize)))
+                {
+                    RunSize += sizeof(U32);
+                }
+            }
+
+            // Write run & read back to verify
+            status =
+                PlxPci_EepromWriteBuffer(
+                    pDevice,
+                    offset + i,
+                    pBuffer + offset + i,
+                    RunSize,
+                    TRUE            // Verify data
+                    );
+
+            if (status != PLX_STATUS_OK)
+            {
+                // Report first value that does not match
+                for (j = i; j < (i + RunSize); j += sizeof(U32))
+                {
+                    value = *(U32*)(pBuffer + offset + j);
+                    PlxPci_EepromReadByOffset( pDevice, offset + j, &Verify_Value );
+
+                    if (Verify_Value != value)
+                    {
+                        Cons_printf(
+                            "ERROR: offset:%02X  wrote:%08X  read:%08X\n",
+                            offset + j, value, Verify_Value
+                            );
+                        break;
+                    }
+                }
+
+                if (j >= (i + RunSize))
+                {
+                    Cons_printf("ERROR: EEPROM write failed (status=%d)\n", status);
+                }
+                rc = EXIT_CODE_EEP_FAIL;
+                goto _Exit_File_Load_8000;
+            }
+
+            BytesWritten += RunSize;
         }
     }
 
@@ -1428,20 +1859,39 @@ Plx8000_EepromFileLoad(
         // Get next value
         value = *(U16*)(pBuffer + offset);
 
-        // Write value & read back to verify
-        PlxPci_EepromWriteByOffset_16( pDevice, offset, (U16)value );
-        PlxPci_EepromReadByOffset_16( pDevice, offset, &Verify_Value_16 );
+        // Skip value if already programmed
+        Verify_Value_16 = (U16)~value;
+        if (pOptions->bDiffOnly)
+        {
+            PlxPci_EepromReadByOffset_16( pDevice, offset, &Verify_Value_16 );
+        }
 
         if (Verify_Value_16 != (U16)value)
         {
-            Cons_printf(
-                "ERROR: offset:%02X  wrote:%04X  read:%04X\n",
-                offset, value, Verify_Value_16
-                );
-            goto _Exit_File_Load_8000;
+            // Write value & read back to verify
+            PlxPci_EepromWriteByOffset_16( pDevice, offset, (U16)value );
+            PlxPci_EepromReadByOffset_16( pDevice, offset, &Verify_Value_16 );
+            BytesWritten += sizeof(U16);
+
+            if (Verify_Value_16 != (U16)value)
+            {
+                Cons_printf(
+                    "ERROR: offset:%02X  wrote:%04X  read:%04X\n",
+                    offset, value, Verify_Value_16
+                    );
+                goto _Exit_File_Load_8000;
+            }
         }
     }
-    Cons_printf( "Ok \n" );
+
+    if (pOptions->bDiffOnly)
+    {
+        Cons_printf( "Ok (%dB updated)\n", BytesWritten );
+    }
+    else
+    {
+        Cons_printf( "Ok \n" );
+    }
 
     // Update CRC if requested
     if (bCrc)
@@ -1454,8 +1904,27 @@ Plx8000_EepromFileLoad(
         else
         {
             Cons_fflush( stdout );
-            PlxPci_EepromCrcUpdate( pDevice, &Crc, TRUE );
-            Cons_printf("Ok (CRC=%08X offset=%02Xh)\n", (int)Crc, (EepHeader >> 16) + sizeof(U32));
+
+            // CRC location after EEPROM (header + reg addr/data values)
+            OffsetCrc = (EepHeader >> 16) + sizeof(U32);
+
+            // If image covers the CRC range, calculate from file instead of re-reading EEPROM
+            if (((pDevice->Key.PlxFamily == PLX_FAMILY_DRACO_2)   ||
+                 (pDevice->Key.PlxFamily == PLX_FAMILY_CAPELLA_1) ||
+                 (pDevice->Key.PlxFamily == PLX_FAMILY_CAPELLA_2)) &&
+                (FileSize >= OffsetCrc))
+            {
+                // CRC calculation starts at byte 2
+                PlxPci_EepromCrcCompute( pBuffer + 2, OffsetCrc - 2, &Crc );
+
+                PlxPci_EepromWriteByOffset_16( pDevice, OffsetCrc, (U16)Crc );
+                PlxPci_EepromWriteByOffset_16( pDevice, OffsetCrc + sizeof(U16), (U16)(Crc >> 16) );
+            }
+            else
+            {
+                PlxPci_EepromCrcUpdate( pDevice, &Crc, TRUE );
+            }
+            Cons_printf("Ok (CRC=%08X offset=%02Xh)\n", (int)Crc, OffsetCrc);
         }
     }
 
@@ -1587,9 +2056,10 @@ Plx8000_EepromFileSave(
     }
 
     // Read 32-bit aligned EEPROM data into buffer
-    for (offset = 0; offset < (EepSize & ~0x3); offset += sizeof(U32))
+    offset = EepSize & ~0x3;
+    if (offset != 0)
     {
-        PlxPci_EepromReadByOffset( pDevice, offset, (U32*)(pBuffer + offset) );
+        PlxPci_EepromReadBuffer( pDevice, 0, pBuffer, offset );
     }
 
     // Read any remaining 16-bit aligned byte
@@ -61,6 +61,7 @@
 
 #define BOOLEAN_UNKNOWN             4
 #define MAX_DEVICES_TO_LIST         50
+#define EEP_BLOCK_SIZE              256     // Bytes per EEPROM buffer access (8000 series)
 
 #define EXIT_CODE_SUCCESS           0
 #define EXIT_CODE_NON_DOS           1
@@ -85,6 +86,8 @@ typedef struct _EEP_OPTIONS
     BOOLEAN bVerbose;
     BOOLEAN bLoadFile;
     BOOLEAN bIgnoreWarnings;
+    BOOLEAN bDiffOnly;
+    BOOLEAN bAllDevices;
     char    FileName[255];
     S8      DeviceNumber;
     U8      EepWidthSet;
@@ -94,6 +97,16 @@ typedef struct _EEP_OPTIONS
 } EEP_OPTIONS;
 
 
+// Per-device state for batch (-a) mode
+typedef struct _EEP_BATCH_DEVICE
+{
+    PLX_DEVICE_KEY  Key;
+    EEP_OPTIONS    *pOptions;
+    S8              ExitCode;
+    double          ElapsedSec;
+} EEP_BATCH_DEVICE;
+
+
 
 
 /*************************************
@@ -117,6 +130,22 @@ SelectDevice(
     EEP_OPTIONS    *pOptions
     );
 
+S8
+EepDeviceProcess(
+    PLX_DEVICE_OBJECT *pDevice,
+    EEP_OPTIONS       *pOptions
+    );
+
+S8
+EepFileBatch(
+    EEP_OPTIONS *pOptions
+    );
+
+char*
+EepExitCodeString(
+    S8 ExitCode
+    );
+
 S8
 EepFile(
     PLX_DEVICE_OBJECT *pDevice,
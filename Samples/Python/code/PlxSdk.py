@@ -107,12 +107,103 @@ class PLX_PORT_PROPERTIES(Structure):
 			self.bNonPcieDevice =0
 
 class PLX_PHYSICAL_MEM(Structure):
+	_pack_ = 4
 	_fields_ = [	("UserAddr",c_ulonglong),
 					("PhysicalAddr",c_ulonglong),
 					("CpuPhysical",c_ulonglong),
 					("Size",c_uint) ]
 
 
+class PLX_NOTIFY_OBJECT(Structure):
+	_pack_ = 4
+	_fields_ = [	("IsValidTag",c_uint),
+					("pWaitObject",c_ulonglong),
+					("hEvent",c_ulonglong) ]
+
+class PLX_INTERRUPT(Structure):
+	_pack_ = 4
+	_fields_ = [	("Doorbell",c_uint),
+					("PciMain",c_ubyte,1),
+					("PciAbort",c_ubyte,1),
+					("LocalToPci",c_ubyte,2),
+					("DmaDone",c_ubyte,4),
+					("DmaPauseDone",c_ubyte,4),
+					("DmaAbortDone",c_ubyte,4),
+					("DmaImmedStopDone",c_ubyte,4),
+					("DmaInvalidDescr",c_ubyte,4),
+					("DmaError",c_ubyte,4),
+					("MuInboundPost",c_ubyte,1),
+					("MuOutboundPost",c_ubyte,1),
+					("MuOutboundOverflow",c_ubyte,1),
+					("TargetRetryAbort",c_ubyte,1),
+					("Message",c_ubyte,4),
+					("SwInterrupt",c_ubyte,1),
+					("ResetDeassert",c_ubyte,1),
+					("PmeDeassert",c_ubyte,1),
+					("GPIO_4_5",c_ubyte,1),
+					("GPIO_14_15",c_ubyte,1),
+					("NTV_LE_Correctable",c_ubyte,1),
+					("NTV_LE_Uncorrectable",c_ubyte,1),
+					("NTV_LE_LinkStateChange",c_ubyte,1),
+					("NTV_LE_UncorrErrorMsg",c_ubyte,1) ]
+
+# 8000 DMA bit fields span bytes in C, so they share a 32-bit container
+class PLX_DMA_PROP(Structure):
+	_pack_ = 4
+	_fields_ = [	("CplStatusWriteBack",c_uint,1),
+					("DescriptorMode",c_uint,2),
+					("DescriptorPollMode",c_uint,1),
+					("RingHaltAtEnd",c_uint,1),
+					("RingWrapDelayTime",c_uint,3),
+					("RelOrderDescrRead",c_uint,1),
+					("RelOrderDescrWrite",c_uint,1),
+					("RelOrderDataReadReq",c_uint,1),
+					("RelOrderDataWrite",c_uint,1),
+					("NoSnoopDescrRead",c_uint,1),
+					("NoSnoopDescrWrite",c_uint,1),
+					("NoSnoopDataReadReq",c_uint,1),
+					("NoSnoopDataWrite",c_uint,1),
+					("MaxSrcXferSize",c_uint,3),
+					("MaxDestWriteSize",c_uint,3),
+					("TrafficClass",c_uint,3),
+					("MaxPendingReadReq",c_uint,6),
+					("DescriptorPollTime",c_ubyte),
+					("MaxDescriptorFetch",c_ubyte),
+					("ReadReqDelayClocks",c_ushort),
+					("ReadyInput",c_ubyte,1),
+					("Burst",c_ubyte,1),
+					("BurstInfinite",c_ubyte,1),
+					("SglMode",c_ubyte,1),
+					("DoneInterrupt",c_ubyte,1),
+					("RouteIntToPci",c_ubyte,1),
+					("ConstAddrLocal",c_ubyte,1),
+					("WriteInvalidMode",c_ubyte,1),
+					("DemandMode",c_ubyte,1),
+					("EnableEOT",c_ubyte,1),
+					("FastTerminateMode",c_ubyte,1),
+					("ClearCountMode",c_ubyte,1),
+					("DualAddressMode",c_ubyte,1),
+					("EOTEndLink",c_ubyte,1),
+					("ValidMode",c_ubyte,1),
+					("ValidStopControl",c_ubyte,1),
+					("LocalBusWidth",c_ubyte,2),
+					("WaitStates",c_ubyte,4) ]
+
+class PLX_DMA_PARAMS(Structure):
+	_pack_ = 4
+	_fields_ = [	("UserVa",c_ulonglong),
+					("AddrSource",c_ulonglong),
+					("AddrDest",c_ulonglong),
+					("PciAddr",c_ulonglong),
+					("LocalAddr",c_uint),
+					("ByteCount",c_uint),
+					("Direction",c_ubyte),
+					("bConstAddrSrc",c_ubyte,1),
+					("bConstAddrDest",c_ubyte,1),
+					("bForceFlush",c_ubyte,1),
+					("bIgnoreBlockInt",c_ubyte,1) ]
+
+
 class PLX_DRIVER_PROP(Structure):
     _fields_ = [ ( "Version",c_uint,32),
                  ( "Name",c_char*16),
@@ -280,6 +371,142 @@ def CommonBufferUnmap(SdkLib,devObject,bufMap):
 	print CommonBufferUnmap.__name__,"is a suspect implementation"
 	return rc
 
+# DMA
+def DmaChannelOpen(SdkLib,devObject,channel,dmaProp=None):
+	SdkLib.PlxPci_DmaChannelOpen.argtypes=[c_char_p,c_ubyte,POINTER(PLX_DMA_PROP)]
+	SdkLib.PlxPci_DmaChannelOpen.restype=c_uint
+	if dmaProp == None:
+		rc = SdkLib.PlxPci_DmaChannelOpen(devObject,channel,None)
+	else:
+		rc = SdkLib.PlxPci_DmaChannelOpen(devObject,channel,byref(dmaProp))
+	return rc
+def DmaGetProperties(SdkLib,devObject,channel):
+	SdkLib.PlxPci_DmaGetProperties.argtypes=[c_char_p,c_ubyte,POINTER(PLX_DMA_PROP)]
+	SdkLib.PlxPci_DmaGetProperties.restype=c_uint
+	dmaProp=PLX_DMA_PROP()
+	rc = SdkLib.PlxPci_DmaGetProperties(devObject,channel,byref(dmaProp))
+	return rc,dmaProp
+def DmaSetProperties(SdkLib,devObject,channel,dmaProp):
+	SdkLib.PlxPci_DmaSetProperties.argtypes=[c_char_p,c_ubyte,POINTER(PLX_DMA_PROP)]
+	SdkLib.PlxPci_DmaSetProperties.restype=c_uint
+	rc = SdkLib.PlxPci_DmaSetProperties(devObject,channel,byref(dmaProp))
+	return rc
+def DmaControl(SdkLib,devObject,channel,command):
+	SdkLib.PlxPci_DmaControl.argtypes=[c_char_p,c_ubyte,c_uint]
+	SdkLib.PlxPci_DmaControl.restype=c_uint
+	rc = SdkLib.PlxPci_DmaControl(devObject,channel,command)
+	return rc
+def DmaStatus(SdkLib,devObject,channel):
+	SdkLib.PlxPci_DmaStatus.argtypes=[c_char_p,c_ubyte]
+	SdkLib.PlxPci_DmaStatus.restype=c_uint
+	rc = SdkLib.PlxPci_DmaStatus(devObject,channel)
+	return rc
+def DmaChannelClose(SdkLib,devObject,channel):
+	SdkLib.PlxPci_DmaChannelClose.argtypes=[c_char_p,c_ubyte]
+	SdkLib.PlxPci_DmaChannelClose.restype=c_uint
+	rc = SdkLib.PlxPci_DmaChannelClose(devObject,channel)
+	return rc
+
+# Block DMA between bus addresses (e.g. common buffer <-> BAR).
+# A Timeout_ms of 0 starts the transfer and returns immediately; completion
+# is then detected with DmaStatus() or a DmaDone notification.
+def DmaTransferBlock(SdkLib,devObject,channel,dmaParams,Timeout_ms=PLX_TIMEOUT_INFINITE):
+	SdkLib.PlxPci_DmaTransferBlock.argtypes=[c_char_p,c_ubyte,POINTER(PLX_DMA_PARAMS),c_ulonglong]
+	SdkLib.PlxPci_DmaTransferBlock.restype=c_uint
+	rc = SdkLib.PlxPci_DmaTransferBlock(devObject,channel,byref(dmaParams),Timeout_ms)
+	return rc
+
+# SGL DMA to/from a user buffer. 'data' may be any writable object supporting
+# the buffer protocol (bytearray, ctypes array, numpy array...). The driver
+# locks the pages of that object directly, so nothing is copied. The object
+# must not be resized or freed until the transfer completes.
+def DmaTransferUserBuffer(SdkLib,devObject,channel,data,Direction,PciAddr,LocalAddr=0,Timeout_ms=PLX_TIMEOUT_INFINITE):
+	SdkLib.PlxPci_DmaTransferUserBuffer.argtypes=[c_char_p,c_ubyte,POINTER(PLX_DMA_PARAMS),c_ulonglong]
+	SdkLib.PlxPci_DmaTransferUserBuffer.restype=c_uint
+	mv=memoryview(data)
+	if mv.readonly:
+		return PLX_STATUS_INVALID_ACCESS
+	ByteCount=mv.itemsize
+	for dim in mv.shape:
+		ByteCount*=dim
+	Buffer=(c_ubyte*ByteCount).from_buffer(data)
+	dmaParams=PLX_DMA_PARAMS()
+	dmaParams.UserVa=addressof(Buffer)
+	dmaParams.PciAddr=PciAddr
+	dmaParams.LocalAddr=LocalAddr
+	dmaParams.ByteCount=ByteCount
+	dmaParams.Direction=Direction
+	rc = SdkLib.PlxPci_DmaTransferUserBuffer(devObject,channel,byref(dmaParams),Timeout_ms)
+	return rc
+
+# Background completion
+#
+# The blocking calls above run in a worker thread with the GIL released.
+# DmaTransferThread() returns a started thread; its 'rc' attribute holds the
+# status once join() returns. The *Async() variants schedule the call on the
+# executor of an asyncio-style event loop (asyncio, or trollius on Python 2)
+# and return a future that completes with the PLX status.
+class PlxCallThread(threading.Thread):
+	def __init__(self,fn,*args):
+		threading.Thread.__init__(self)
+		self.daemon=True
+		self.fn=fn
+		self.args=args
+		self.rc=PLX_STATUS_IN_PROGRESS
+	def run(self):
+		self.rc=self.fn(*self.args)
+
+def DmaTransferThread(SdkLib,devObject,channel,data,Direction,PciAddr,LocalAddr=0,Timeout_ms=PLX_TIMEOUT_INFINITE):
+	t=PlxCallThread(DmaTransferUserBuffer,SdkLib,devObject,channel,data,Direction,PciAddr,LocalAddr,Timeout_ms)
+	t.start()
+	return t
+
+def DmaTransferUserBufferAsync(loop,SdkLib,devObject,channel,data,Direction,PciAddr,LocalAddr=0,Timeout_ms=PLX_TIMEOUT_INFINITE):
+	return loop.run_in_executor(None,functools.partial(DmaTransferUserBuffer,SdkLib,devObject,channel,data,Direction,PciAddr,LocalAddr,Timeout_ms))
+def DmaTransferBlockAsync(loop,SdkLib,devObject,channel,dmaParams,Timeout_ms=PLX_TIMEOUT_INFINITE):
+	return loop.run_in_executor(None,functools.partial(DmaTransferBlock,SdkLib,devObject,channel,dmaParams,Timeout_ms))
+def NotificationWaitAsync(loop,SdkLib,devObject,event,Timeout_ms=PLX_TIMEOUT_INFINITE):
+	return loop.run_in_executor(None,functools.partial(NotificationWait,SdkLib,devObject,event,Timeout_ms))
+
+# Maps the common buffer and returns a zero-copy memoryview over it
+def CommonBufferView(SdkLib,devObject):
+	rc,pme=CommonBufferProperties(SdkLib,devObject)
+	if rc != PLX_STATUS_OK:
+		return rc,None,None
+	rc,bufMap=CommonBufferMap(SdkLib,devObject)
+	if rc != PLX_STATUS_OK:
+		return rc,None,None
+	return rc,bufMap,MemoryView(bufMap.value,pme.Size)
+
+def PhysicalMemoryAllocate(SdkLib,devObject,Size,bSmallerOk=False):
+	SdkLib.PlxPci_PhysicalMemoryAllocate.argtypes=[c_char_p,POINTER(PLX_PHYSICAL_MEM),c_ubyte]
+	SdkLib.PlxPci_PhysicalMemoryAllocate.restype=c_uint
+	pme=PLX_PHYSICAL_MEM()
+	pme.Size=Size
+	rc=SdkLib.PlxPci_PhysicalMemoryAllocate(devObject,byref(pme),bSmallerOk)
+	return rc,pme
+def PhysicalMemoryFree(SdkLib,devObject,pme):
+	SdkLib.PlxPci_PhysicalMemoryFree.argtypes=[c_char_p,POINTER(PLX_PHYSICAL_MEM)]
+	SdkLib.PlxPci_PhysicalMemoryFree.restype=c_uint
+	rc=SdkLib.PlxPci_PhysicalMemoryFree(devObject,byref(pme))
+	return rc
+def PhysicalMemoryMap(SdkLib,devObject,pme):
+	SdkLib.PlxPci_PhysicalMemoryMap.argtypes=[c_char_p,POINTER(PLX_PHYSICAL_MEM)]
+	SdkLib.PlxPci_PhysicalMemoryMap.restype=c_uint
+	rc=SdkLib.PlxPci_PhysicalMemoryMap(devObject,byref(pme))
+	return rc
+def PhysicalMemoryUnmap(SdkLib,devObject,pme):
+	SdkLib.PlxPci_PhysicalMemoryUnmap.argtypes=[c_char_p,POINTER(PLX_PHYSICAL_MEM)]
+	SdkLib.PlxPci_PhysicalMemoryUnmap.restype=c_uint
+	rc=SdkLib.PlxPci_PhysicalMemoryUnmap(devObject,byref(pme))
+	return rc
+
+# Zero-copy view of a mapped physical buffer (call PhysicalMemoryMap first)
+def PhysicalMemoryView(pme):
+	return MemoryView(pme.UserAddr,pme.Size)
+def PhysicalMemoryArray(pme,dtype='uint32'):
+	return MemoryArray(pme.UserAddr,pme.Size,dtype)
+
 def DeviceReset(SdkLib,devObject):
 	SdkLib.PlxPci_DeviceReset.argtypes=[c_char_p]
 	SdkLib.PlxPci_DeviceReset.restype=c_uint
@@ -388,22 +615,101 @@ def IoPortWrite(SdkLib,devObject,port,Buffer,ByteCount,AccessType):
 	Buffer=c_void_p()
 	rc=SdkLib.PlxPci_IoPortWrite(devObject,port,Buffer,ByteCount,AccessTYpe)
 	return rc
-def InterruptEnable(SdkLib,devObject):
-	print "Not Implemented"
-	return PLX_STATUS_FAILED
-def InterruptDisable(SdkLib,devObject):
-	print "Not Implemented"
-	return PLX_STATUS_FAILED
+def InterruptEnable(SdkLib,devObject,intr):
+	SdkLib.PlxPci_InterruptEnable.argtypes=[c_char_p,POINTER(PLX_INTERRUPT)]
+	SdkLib.PlxPci_InterruptEnable.restype=c_uint
+	rc = SdkLib.PlxPci_InterruptEnable(devObject,byref(intr))
+	return rc
+def InterruptDisable(SdkLib,devObject,intr):
+	SdkLib.PlxPci_InterruptDisable.argtypes=[c_char_p,POINTER(PLX_INTERRUPT)]
+	SdkLib.PlxPci_InterruptDisable.restype=c_uint
+	rc = SdkLib.PlxPci_InterruptDisable(devObject,byref(intr))
+	return rc
+
+# Notifications
+#
+# PlxPci_NotificationWait() blocks in the driver. ctypes CDLL functions
+# release the GIL for the duration of the call, so other Python threads
+# keep running while a wait is pending.
+def NotificationRegisterFor(SdkLib,devObject,intr):
+	SdkLib.PlxPci_NotificationRegisterFor.argtypes=[c_char_p,POINTER(PLX_INTERRUPT),POINTER(PLX_NOTIFY_OBJECT)]
+	SdkLib.PlxPci_NotificationRegisterFor.restype=c_uint
+	event=PLX_NOTIFY_OBJECT()
+	rc = SdkLib.PlxPci_NotificationRegisterFor(devObject,byref(intr),byref(event))
+	return rc,event
+def NotificationWait(SdkLib,devObject,event,Timeout_ms=PLX_TIMEOUT_INFINITE):
+	SdkLib.PlxPci_NotificationWait.argtypes=[c_char_p,POINTER(PLX_NOTIFY_OBJECT),c_ulonglong]
+	SdkLib.PlxPci_NotificationWait.restype=c_uint
+	rc = SdkLib.PlxPci_NotificationWait(devObject,byref(event),Timeout_ms)
+	return rc
+def NotificationStatus(SdkLib,devObject,event):
+	SdkLib.PlxPci_NotificationStatus.argtypes=[c_char_p,POINTER(PLX_NOTIFY_OBJECT),POINTER(PLX_INTERRUPT)]
+	SdkLib.PlxPci_NotificationStatus.restype=c_uint
+	intr=PLX_INTERRUPT()
+	rc = SdkLib.PlxPci_NotificationStatus(devObject,byref(event),byref(intr))
+	return rc,intr
+def NotificationCancel(SdkLib,devObject,event):
+	SdkLib.PlxPci_NotificationCancel.argtypes=[c_char_p,POINTER(PLX_NOTIFY_OBJECT)]
+	SdkLib.PlxPci_NotificationCancel.restype=c_uint
+	rc = SdkLib.PlxPci_NotificationCancel(devObject,byref(event))
+	return rc
 def BarSpaceRead(SdkLib,devObject,BarIndex,offset,Buffer,ByteCount,AccessType,bOffsetAsLocalAddr):
-	SdkLib.PlxPci_PciBarSpaceRead.argtypes=[c_char_p,c_ubyte,c_uint,POINTER(c_void_p),c_uint,c_uint]
+	SdkLib.PlxPci_PciBarSpaceRead.argtypes=[c_char_p,c_ubyte,c_uint,c_void_p,c_uint,c_uint,c_ubyte]
 	SdkLib.PlxPci_PciBarSpaceRead.restype=c_uint
 	rc = SdkLib.PlxPci_PciBarSpaceRead(devObject,BarIndex,offset,Buffer,ByteCount,AccessType,bOffsetAsLocalAddr)
 	return rc
 def BarSpaceWrite(SdkLib,devObject,BarIndex,offset,Buffer,ByteCount,AccessType,bOffsetAsLocalAddr):
-	SdkLib.PlxPci_PciBarSpaceWrite.argtypes=[c_char_p,c_ubyte,c_uint,POINTER(c_void_p),c_uint,c_uint]
+	SdkLib.PlxPci_PciBarSpaceWrite.argtypes=[c_char_p,c_ubyte,c_uint,c_void_p,c_uint,c_uint,c_ubyte]
 	SdkLib.PlxPci_PciBarSpaceWrite.restype=c_uint
 	rc = SdkLib.PlxPci_PciBarSpaceWrite(devObject,BarIndex,offset,Buffer,ByteCount,AccessType,bOffsetAsLocalAddr)
 	return rc
+
+# Bulk BAR access - the whole block is transferred by a single API call
+# instead of one ctypes call per element. Returns (rc, ctypes array).
+def BarSpaceReadBuffer(SdkLib,devObject,BarIndex,offset,ByteCount,AccessType=BitSize32,bOffsetAsLocalAddr=False):
+	Buffer=(c_ubyte*ByteCount)()
+	rc = BarSpaceRead(SdkLib,devObject,BarIndex,offset,Buffer,ByteCount,AccessType,bOffsetAsLocalAddr)
+	return rc,Buffer
+
+# 'data' may be any object supporting the buffer protocol (bytearray,
+# ctypes array, numpy array, memoryview...). Writable buffers are passed
+# to the API directly; read-only ones (e.g. str) are copied once.
+def BarSpaceWriteBuffer(SdkLib,devObject,BarIndex,offset,data,AccessType=BitSize32,bOffsetAsLocalAddr=False):
+	Buffer=BufferFromObject(data)
+	rc = BarSpaceWrite(SdkLib,devObject,BarIndex,offset,Buffer,sizeof(Buffer),AccessType,bOffsetAsLocalAddr)
+	return rc
+
+def BufferFromObject(data):
+	mv=memoryview(data)
+	ByteCount=mv.itemsize
+	for dim in mv.shape:
+		ByteCount*=dim
+	try:
+		return (c_ubyte*ByteCount).from_buffer(data)
+	except (TypeError,ValueError):
+		return (c_ubyte*ByteCount).from_buffer_copy(data)
+
+# Zero-copy views of memory already mapped into this process (BAR mappings,
+# common buffer, physical buffers). The view aliases the mapping directly,
+# so the caller must keep the mapping alive for as long as the view is used.
+def MemoryView(address,ByteCount):
+	if address == None or address == 0:
+		return None
+	return memoryview((c_ubyte*ByteCount).from_address(address))
+
+# Same as MemoryView() but returns a NumPy array of the requested dtype.
+# Returns None if NumPy is not installed.
+def MemoryArray(address,ByteCount,dtype='uint32'):
+	try:
+		import numpy
+	except ImportError:
+		return None
+	if address == None or address == 0:
+		return None
+	return numpy.ctypeslib.as_array((c_ubyte*ByteCount).from_address(address)).view(dtype)
+
+def PointerAddress(ptr):
+	return ctypes.cast(ptr,c_void_p).value
 #Casting example
 #mydblPtr = cast(myVoidVal, POINTER(c_double))
 def PciBarMap(SdkLib,devObject,BarIndex):
@@ -482,6 +788,14 @@ def PlxMappedRegisterWrite(SdkLib,devObject,offset,value):
 	rc = SdkLib.PlxPci_PlxMappedRegisterWrite(devObject,offset,value)
 	return rc
 
+# Reads a block of consecutive registers in a single API call. Returns (rc, U32 array).
+def PlxMappedRegisterReadBuffer(SdkLib,devObject,offset,ByteCount):
+	SdkLib.PlxPci_PlxMappedRegisterReadBuffer.argtypes=[c_char_p,c_uint,c_void_p,c_uint]
+	SdkLib.PlxPci_PlxMappedRegisterReadBuffer.restype=c_uint
+	Buffer=(c_uint*(ByteCount/Sizeof_32))()
+	rc = SdkLib.PlxPci_PlxMappedRegisterReadBuffer(devObject,offset,Buffer,ByteCount)
+	return rc,Buffer
+
 def PerformanceInitializeProperties(SdkLib,devObject):
 	SdkLib.PlxPci_PerformanceInitializeProperties.argtypes=[c_char_p,POINTER(PLX_PERF_PROP)]
 	SdkLib.PlxPci_PerformanceInitializeProperties.restype=c_uint
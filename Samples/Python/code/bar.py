@@ -78,6 +78,33 @@ class BarSpace:
 		offset+=ATLAS_OFFSET
 		B32=cast(self.Buffer,POINTER(c_uint))
 		B32[offset/4]=(value&0xFFFFFFFF)
+
+	# Zero-copy view of the mapped BAR. Writes to the view go straight
+	# to the device; the view is only valid while the BAR stays mapped.
+	def getMemoryView(self,offset=0,size=None):
+		if self.Buffer == None:
+			return None
+		offset+=ATLAS_OFFSET
+		if size == None:
+			size=self.barsize-offset
+		return MemoryView(PointerAddress(self.Buffer)+offset,size)
+
+	# Same as getMemoryView() as a NumPy array (None if NumPy is missing)
+	def getArray(self,offset=0,size=None,dtype='uint32'):
+		if self.Buffer == None:
+			return None
+		offset+=ATLAS_OFFSET
+		if size == None:
+			size=self.barsize-offset
+		return MemoryArray(PointerAddress(self.Buffer)+offset,size,dtype)
+
+	# Bulk transfers through the API, one call for the whole block
+	def ReadBlock(self,offset,ByteCount,AccessType=BitSize32):
+		offset+=ATLAS_OFFSET
+		return BarSpaceReadBuffer(self.SdkLib,self.devObject,self.barid,offset,ByteCount,AccessType)
+	def WriteBlock(self,offset,data,AccessType=BitSize32):
+		offset+=ATLAS_OFFSET
+		return BarSpaceWriteBuffer(self.SdkLib,self.devObject,self.barid,offset,data,AccessType)
 	
 	def __del__(self):
 		self.barid = -1
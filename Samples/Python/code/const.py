@@ -1,3 +1,5 @@
+import os
+
 #class Constants:
 PLX_STATUS_START=0x200
 PLX_STATUS_OK = PLX_STATUS_START
@@ -86,6 +88,35 @@ PLX_API_MODE_MDIO_SPLICE    = PLX_API_MODE_PCI+2
 PLX_API_MODE_SDB			= PLX_API_MODE_PCI+3
 PLX_API_MODE_TCP            = PLX_API_MODE_PCI+4
 
+#Access Types ( PLX_ACCESS_TYPE Enum)
+BitSize8                    = 0
+BitSize16                   = 1
+BitSize32                   = 2
+BitSize64                   = 3
+
+#Wait forever ( INFINITE on Windows, MAX_SCHEDULE_TIMEOUT on Linux)
+if os.name == "nt":
+	PLX_TIMEOUT_INFINITE    = 0xFFFFFFFF
+else:
+	PLX_TIMEOUT_INFINITE    = 0x7FFFFFFFFFFFFFFF
+
+#DMA Transfer Direction ( PLX_DMA_DIR Enum)
+PLX_DMA_PCI_TO_LOC          = 0
+PLX_DMA_LOC_TO_PCI          = 1
+PLX_DMA_USER_TO_PCI         = PLX_DMA_PCI_TO_LOC
+PLX_DMA_PCI_TO_USER         = PLX_DMA_LOC_TO_PCI
+
+#DMA Descriptor Mode ( PLX_DMA_DESCR_MODE Enum)
+PLX_DMA_MODE_BLOCK          = 0
+PLX_DMA_MODE_SGL            = 1
+PLX_DMA_MODE_SGL_INTERNAL   = 2
+
+#DMA Control ( PLX_DMA_COMMAND Enum)
+DmaPause                    = 0
+DmaPauseImmediate           = 1
+DmaResume                   = 2
+DmaAbort                    = 3
+
 #Performance Monitor Control ( It is an Enum)
 PLX_PERF_CMD_START          = 0 
 PLX_PERF_CMD_STOP			= 1
@@ -2,6 +2,8 @@ import os
 import sys
 from ctypes import *
 import ctypes
+import functools
+import threading
 
 def getLibPrefix():
 	if os.name == "nt":